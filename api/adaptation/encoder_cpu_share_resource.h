@@ -0,0 +1,34 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_ADAPTATION_ENCODER_CPU_SHARE_RESOURCE_H_
+#define API_ADAPTATION_ENCODER_CPU_SHARE_RESOURCE_H_
+
+#include "api/adaptation/resource.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/system/rtc_export.h"
+
+namespace webrtc {
+
+// A Resource that represents the share of one video encoder in CPU that is
+// arbitrated between several encoders, e.g. all the encoders of a process.
+// The encoder reports how long each frame took to encode, and the
+// implementation decides, based on the encode times of all encoders, when
+// this encoder should adapt. An encoder configured with a share does not
+// adapt on its own encode usage.
+class RTC_EXPORT EncoderCpuShareResource : public Resource {
+ public:
+  // Called on the encoder task queue for every encoded frame.
+  virtual void OnEncodeCompleted(TimeDelta encode_duration) = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // API_ADAPTATION_ENCODER_CPU_SHARE_RESOURCE_H_
@@ -0,0 +1,26 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video/create_shared_video_encoder.h"
+
+#include "api/environment/environment.h"
+#include "api/make_ref_counted.h"
+#include "api/scoped_refptr.h"
+#include "api/video/shared_video_encoder.h"
+#include "video/shared_video_stream_encoder.h"
+
+namespace webrtc {
+
+scoped_refptr<SharedVideoEncoder> CreateSharedVideoEncoder(
+    const Environment& env) {
+  return make_ref_counted<SharedVideoStreamEncoder>(env);
+}
+
+}  // namespace webrtc
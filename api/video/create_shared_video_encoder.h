@@ -0,0 +1,30 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_VIDEO_CREATE_SHARED_VIDEO_ENCODER_H_
+#define API_VIDEO_CREATE_SHARED_VIDEO_ENCODER_H_
+
+#include "api/environment/environment.h"
+#include "api/scoped_refptr.h"
+#include "api/video/shared_video_encoder.h"
+#include "rtc_base/system/rtc_export.h"
+
+namespace webrtc {
+
+// Creates an encoder to be set in VideoStreamEncoderSettings::shared_encoder
+// of several send streams. The encoder runs with `env`, which must outlive it,
+// and not with the environment of any of the send streams, since the send
+// streams may belong to different calls and come and go in any order.
+RTC_EXPORT scoped_refptr<SharedVideoEncoder> CreateSharedVideoEncoder(
+    const Environment& env);
+
+}  // namespace webrtc
+
+#endif  // API_VIDEO_CREATE_SHARED_VIDEO_ENCODER_H_
@@ -0,0 +1,64 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_VIDEO_DECODE_THREAD_POOL_H_
+#define API_VIDEO_DECODE_THREAD_POOL_H_
+
+#include <memory>
+
+#include "absl/functional/any_invocable.h"
+#include "api/location.h"
+#include "api/ref_count.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/timestamp.h"
+#include "rtc_base/system/rtc_export.h"
+
+namespace webrtc {
+
+// A pool of threads that decodes the frames of several video receive streams,
+// so that the number of decode threads does not grow with the number of
+// streams. Set the same instance in VideoReceiveStreamInterface::Config::
+// decode_thread_pool of all the receive streams that should share it. The only
+// implementation is SharedDecodeThreadPool in video/.
+class RTC_EXPORT DecodeThreadPool : public RefCountInterface {
+ public:
+  // The decode queue of one receive stream. Its tasks run one at a time, in
+  // the order they are posted, on any of the pool threads.
+  class DecodeQueue : public TaskQueueBase {
+   public:
+    // Posts a task that should run before `deadline`, e.g. the decoding of a
+    // frame that is to be rendered at that time. When several queues have
+    // tasks to run, the pool threads first run the task with the earliest
+    // deadline. Tasks posted with PostTask() have no deadline and run before
+    // any task with a deadline.
+    virtual void PostTaskWithDeadline(
+        absl::AnyInvocable<void() &&> task,
+        Timestamp deadline,
+        const Location& location = Location::Current()) = 0;
+
+   protected:
+    ~DecodeQueue() override = default;
+  };
+
+  virtual std::unique_ptr<DecodeQueue, TaskQueueDeleter> CreateQueue() = 0;
+
+  // Returns the number of threads a decoder of a stream that uses the pool
+  // should be configured with. It is fixed for the lifetime of the pool, since
+  // receive streams configure their decoders once when they start. Threads
+  // that a decoder creates internally run in addition to the pool threads.
+  virtual int DecoderThreadsPerStream() const = 0;
+
+ protected:
+  ~DecodeThreadPool() override = default;
+};
+
+}  // namespace webrtc
+
+#endif  // API_VIDEO_DECODE_THREAD_POOL_H_
@@ -17,13 +17,16 @@
 #include <map>
 #include <optional>
 #include <utility>
+#include <vector>
 
+#include "api/array_view.h"
 #include "api/ref_count.h"
 #include "api/rtp_packet_infos.h"
 #include "api/scoped_refptr.h"
 #include "api/units/timestamp.h"
 #include "api/video/color_space.h"
 #include "api/video/corruption_detection_filter_settings.h"
+#include "api/video/nalu_index.h"
 #include "api/video/video_codec_constants.h"
 #include "api/video/video_content_type.h"
 #include "api/video/video_frame_type.h"
@@ -182,11 +185,13 @@ class RTC_EXPORT EncodedImage {
   void SetEncodedData(scoped_refptr<EncodedImageBufferInterface> encoded_data) {
     encoded_data_ = encoded_data;
     size_ = encoded_data->size();
+    nalu_indices_.clear();
   }
 
   void ClearEncodedData() {
     encoded_data_ = nullptr;
     size_ = 0;
+    nalu_indices_.clear();
   }
 
   scoped_refptr<EncodedImageBufferInterface> GetEncodedData() const {
@@ -200,6 +205,23 @@ class RTC_EXPORT EncodedImage {
   const uint8_t* begin() const { return data(); }
   const uint8_t* end() const { return data() + size(); }
 
+  // NAL units of an H.264 or H.265 image, stored by the first user that scans
+  // the bitstream so that later users on the send path, e.g. the RTP
+  // packetizer, need not scan it again. Empty unless set for the current
+  // encoded data. Code that modifies the encoded data in place without
+  // changing its size must reset them with SetNaluIndices({}).
+  ArrayView<const NaluIndex> NaluIndices() const {
+    if (nalu_indices_data_ != data() || nalu_indices_size_ != size()) {
+      return {};
+    }
+    return nalu_indices_;
+  }
+  void SetNaluIndices(std::vector<NaluIndex> nalu_indices) {
+    nalu_indices_ = std::move(nalu_indices);
+    nalu_indices_data_ = data();
+    nalu_indices_size_ = size();
+  }
+
   // Returns whether the encoded image can be considered to be of target
   // quality.
   [[deprecated]] bool IsAtTargetQuality() const { return at_target_quality_; }
@@ -298,6 +320,11 @@ class RTC_EXPORT EncodedImage {
   // used.
   std::optional<CorruptionDetectionFilterSettings>
       corruption_detection_filter_settings_;
+
+  std::vector<NaluIndex> nalu_indices_;
+  // The encoded data `nalu_indices_` were set for.
+  const uint8_t* nalu_indices_data_ = nullptr;
+  size_t nalu_indices_size_ = 0;
 };
 
 }  // namespace webrtc
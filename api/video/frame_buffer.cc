@@ -13,7 +13,6 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <iterator>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -23,6 +22,7 @@
 #include "api/array_view.h"
 #include "api/field_trials_view.h"
 #include "api/video/encoded_frame.h"
+#include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/sequence_number_util.h"
 
@@ -44,27 +44,22 @@ bool ValidReferences(const EncodedFrame& frame) {
 }
 
 // Since FrameBuffer::FrameInfo is private it can't be used in the function
-// signature, hence the FrameIteratorT type.
-template <typename FrameIteratorT>
-ArrayView<const int64_t> GetReferences(const FrameIteratorT& it) {
-  return {it->second.encoded_frame->references,
-          std::min<size_t>(it->second.encoded_frame->num_references,
+// signature, hence the FrameInfoT type.
+template <typename FrameInfoT>
+ArrayView<const int64_t> GetReferences(const FrameInfoT& frame) {
+  return {frame.encoded_frame->references,
+          std::min<size_t>(frame.encoded_frame->num_references,
                            EncodedFrame::kMaxFrameReferences)};
 }
 
-template <typename FrameIteratorT>
-int64_t GetFrameId(const FrameIteratorT& it) {
-  return it->first;
+template <typename FrameInfoT>
+uint32_t GetTimestamp(const FrameInfoT& frame) {
+  return frame.encoded_frame->RtpTimestamp();
 }
 
-template <typename FrameIteratorT>
-uint32_t GetTimestamp(const FrameIteratorT& it) {
-  return it->second.encoded_frame->RtpTimestamp();
-}
-
-template <typename FrameIteratorT>
-bool IsLastFrameInTemporalUnit(const FrameIteratorT& it) {
-  return it->second.encoded_frame->is_last_spatial_layer;
+template <typename FrameInfoT>
+bool IsLastFrameInTemporalUnit(const FrameInfoT& frame) {
+  return frame.encoded_frame->is_last_spatial_layer;
 }
 }  // namespace
 
@@ -74,6 +69,7 @@ FrameBuffer::FrameBuffer(int max_size,
     : legacy_frame_id_jump_behavior_(
           !field_trials.IsDisabled("WebRTC-LegacyFrameIdJumpBehavior")),
       max_size_(max_size),
+      slots_(max_size),
       decoded_frame_history_(max_decode_history) {}
 
 bool FrameBuffer::InsertFrame(std::unique_ptr<EncodedFrame> frame) {
@@ -97,7 +93,7 @@ bool FrameBuffer::InsertFrame(std::unique_ptr<EncodedFrame> frame) {
     }
   }
 
-  if (frames_.size() == max_size_) {
+  if (num_frames_ == max_size_) {
     if (frame->is_keyframe()) {
       RTC_DLOG(LS_WARNING) << "Keyframe " << frame->Id()
                            << " inserted into full buffer, clearing buffer.";
@@ -109,18 +105,26 @@ bool FrameBuffer::InsertFrame(std::unique_ptr<EncodedFrame> frame) {
   }
 
   const int64_t frame_id = frame->Id();
-  auto insert_res = frames_.emplace(frame_id, FrameInfo{std::move(frame)});
-  if (!insert_res.second) {
+  const size_t index = LowerBound(frame_id);
+  if (index < num_frames_ && FrameAt(index).id == frame_id) {
     // Frame has already been inserted.
     return false;
   }
 
-  if (frames_.size() == max_size_) {
+  // Make room for the frame by moving the frames with higher ids one slot
+  // towards the back, which is none of them for frames received in order.
+  ++num_frames_;
+  for (size_t i = num_frames_ - 1; i > index; --i) {
+    FrameAt(i) = std::move(FrameAt(i - 1));
+  }
+  FrameAt(index) = {.id = frame_id, .encoded_frame = std::move(frame)};
+
+  if (num_frames_ == max_size_) {
     RTC_DLOG(LS_WARNING) << "Frame " << frame_id
                          << " inserted, buffer is now full.";
   }
 
-  PropagateContinuity(insert_res.first);
+  PropagateContinuity(index);
   FindNextAndLastDecodableTemporalUnit();
   return true;
 }
@@ -132,11 +136,11 @@ FrameBuffer::ExtractNextDecodableTemporalUnit() {
     return res;
   }
 
-  auto end_it = std::next(next_decodable_temporal_unit_->last_frame);
-  for (auto it = next_decodable_temporal_unit_->first_frame; it != end_it;
-       ++it) {
-    decoded_frame_history_.InsertDecoded(GetFrameId(it), GetTimestamp(it));
-    res.push_back(std::move(it->second.encoded_frame));
+  for (size_t i = next_decodable_temporal_unit_->first_frame;
+       i <= next_decodable_temporal_unit_->last_frame; ++i) {
+    FrameInfo& frame = FrameAt(i);
+    decoded_frame_history_.InsertDecoded(frame.id, GetTimestamp(frame));
+    res.push_back(std::move(frame.encoded_frame));
   }
 
   DropNextDecodableTemporalUnit();
@@ -148,12 +152,14 @@ void FrameBuffer::DropNextDecodableTemporalUnit() {
     return;
   }
 
-  auto end_it = std::next(next_decodable_temporal_unit_->last_frame);
-  num_dropped_frames_ += std::count_if(
-      frames_.begin(), end_it,
-      [](const auto& f) { return f.second.encoded_frame != nullptr; });
+  const size_t end = next_decodable_temporal_unit_->last_frame + 1;
+  for (size_t i = 0; i < end; ++i) {
+    if (FrameAt(i).encoded_frame != nullptr) {
+      ++num_dropped_frames_;
+    }
+  }
 
-  frames_.erase(frames_.begin(), end_it);
+  EraseFramesBefore(end);
   FindNextAndLastDecodableTemporalUnit();
 }
 
@@ -178,18 +184,63 @@ int FrameBuffer::GetTotalNumberOfDroppedFrames() const {
 }
 
 size_t FrameBuffer::CurrentSize() const {
-  return frames_.size();
+  return num_frames_;
 }
 
-bool FrameBuffer::IsContinuous(const FrameIterator& it) const {
-  for (int64_t reference : GetReferences(it)) {
+FrameBuffer::FrameInfo& FrameBuffer::FrameAt(size_t index) {
+  RTC_DCHECK_LT(index, num_frames_);
+  size_t slot = first_slot_ + index;
+  return slots_[slot < max_size_ ? slot : slot - max_size_];
+}
+
+const FrameBuffer::FrameInfo& FrameBuffer::FrameAt(size_t index) const {
+  RTC_DCHECK_LT(index, num_frames_);
+  size_t slot = first_slot_ + index;
+  return slots_[slot < max_size_ ? slot : slot - max_size_];
+}
+
+size_t FrameBuffer::LowerBound(int64_t frame_id) const {
+  // Frames are mostly inserted at the back, and referenced frames are
+  // usually recent, so check the last frame before searching.
+  if (num_frames_ == 0 || FrameAt(num_frames_ - 1).id < frame_id) {
+    return num_frames_;
+  }
+  size_t first = 0;
+  size_t count = num_frames_;
+  while (count > 0) {
+    const size_t step = count / 2;
+    if (FrameAt(first + step).id < frame_id) {
+      first += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+void FrameBuffer::EraseFramesBefore(size_t end) {
+  RTC_DCHECK_LE(end, num_frames_);
+  for (size_t i = 0; i < end; ++i) {
+    FrameAt(i) = FrameInfo();
+  }
+  first_slot_ += end;
+  if (first_slot_ >= max_size_) {
+    first_slot_ -= max_size_;
+  }
+  num_frames_ -= end;
+}
+
+bool FrameBuffer::IsContinuous(size_t index) const {
+  for (int64_t reference : GetReferences(FrameAt(index))) {
     if (decoded_frame_history_.WasDecoded(reference)) {
       continue;
     }
 
-    auto reference_frame_it = frames_.find(reference);
-    if (reference_frame_it != frames_.end() &&
-        reference_frame_it->second.continuous) {
+    const size_t reference_index = LowerBound(reference);
+    if (reference_index < num_frames_ &&
+        FrameAt(reference_index).id == reference &&
+        FrameAt(reference_index).continuous) {
       continue;
     }
 
@@ -199,18 +250,19 @@ bool FrameBuffer::IsContinuous(const FrameIterator& it) const {
   return true;
 }
 
-void FrameBuffer::PropagateContinuity(const FrameIterator& frame_it) {
-  for (auto it = frame_it; it != frames_.end(); ++it) {
-    if (!it->second.continuous) {
-      if (IsContinuous(it)) {
-        it->second.continuous = true;
-        if (last_continuous_frame_id_ < GetFrameId(it)) {
-          last_continuous_frame_id_ = GetFrameId(it);
+void FrameBuffer::PropagateContinuity(size_t index) {
+  for (size_t i = index; i < num_frames_; ++i) {
+    FrameInfo& frame = FrameAt(i);
+    if (!frame.continuous) {
+      if (IsContinuous(i)) {
+        frame.continuous = true;
+        if (last_continuous_frame_id_ < frame.id) {
+          last_continuous_frame_id_ = frame.id;
         }
-        if (IsLastFrameInTemporalUnit(it)) {
+        if (IsLastFrameInTemporalUnit(frame)) {
           num_continuous_temporal_units_++;
-          if (last_continuous_temporal_unit_frame_id_ < GetFrameId(it)) {
-            last_continuous_temporal_unit_frame_id_ = GetFrameId(it);
+          if (last_continuous_temporal_unit_frame_id_ < frame.id) {
+            last_continuous_temporal_unit_frame_id_ = frame.id;
           }
         }
       }
@@ -226,29 +278,27 @@ void FrameBuffer::FindNextAndLastDecodableTemporalUnit() {
     return;
   }
 
-  FrameIterator first_frame_it = frames_.begin();
-  FrameIterator last_frame_it = frames_.begin();
+  size_t first_frame_index = 0;
   absl::InlinedVector<int64_t, 4> frames_in_temporal_unit;
   uint32_t last_decodable_temporal_unit_timestamp;
-  for (auto frame_it = frames_.begin(); frame_it != frames_.end();) {
-    if (GetFrameId(frame_it) > *last_continuous_temporal_unit_frame_id_) {
+  for (size_t i = 0; i < num_frames_; ++i) {
+    const FrameInfo& frame = FrameAt(i);
+    if (frame.id > *last_continuous_temporal_unit_frame_id_) {
       break;
     }
 
-    if (GetTimestamp(frame_it) != GetTimestamp(first_frame_it)) {
+    if (GetTimestamp(frame) != GetTimestamp(FrameAt(first_frame_index))) {
       frames_in_temporal_unit.clear();
-      first_frame_it = frame_it;
+      first_frame_index = i;
     }
 
-    frames_in_temporal_unit.push_back(GetFrameId(frame_it));
-
-    last_frame_it = frame_it++;
+    frames_in_temporal_unit.push_back(frame.id);
 
-    if (IsLastFrameInTemporalUnit(last_frame_it)) {
+    if (IsLastFrameInTemporalUnit(frame)) {
       bool temporal_unit_decodable = true;
-      for (auto it = first_frame_it; it != frame_it && temporal_unit_decodable;
-           ++it) {
-        for (int64_t reference : GetReferences(it)) {
+      for (size_t j = first_frame_index; j <= i && temporal_unit_decodable;
+           ++j) {
+        for (int64_t reference : GetReferences(FrameAt(j))) {
           if (!decoded_frame_history_.WasDecoded(reference) &&
               !absl::c_linear_search(frames_in_temporal_unit, reference)) {
             // A frame in the temporal unit has a non-decoded reference outside
@@ -261,10 +311,11 @@ void FrameBuffer::FindNextAndLastDecodableTemporalUnit() {
 
       if (temporal_unit_decodable) {
         if (!next_decodable_temporal_unit_) {
-          next_decodable_temporal_unit_ = {first_frame_it, last_frame_it};
+          next_decodable_temporal_unit_ = {.first_frame = first_frame_index,
+                                           .last_frame = i};
         }
 
-        last_decodable_temporal_unit_timestamp = GetTimestamp(first_frame_it);
+        last_decodable_temporal_unit_timestamp = GetTimestamp(frame);
       }
     }
   }
@@ -272,13 +323,14 @@ void FrameBuffer::FindNextAndLastDecodableTemporalUnit() {
   if (next_decodable_temporal_unit_) {
     decodable_temporal_units_info_ = {
         .next_rtp_timestamp =
-            GetTimestamp(next_decodable_temporal_unit_->first_frame),
+            GetTimestamp(FrameAt(next_decodable_temporal_unit_->first_frame)),
         .last_rtp_timestamp = last_decodable_temporal_unit_timestamp};
   }
 }
 
 void FrameBuffer::Clear() {
-  frames_.clear();
+  EraseFramesBefore(num_frames_);
+  first_slot_ = 0;
   next_decodable_temporal_unit_.reset();
   decodable_temporal_units_info_.reset();
   last_continuous_frame_id_.reset();
@@ -13,9 +13,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <map>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "absl/container/inlined_vector.h"
 #include "api/field_trials_view.h"
@@ -71,27 +71,39 @@ class FrameBuffer {
 
  private:
   struct FrameInfo {
+    int64_t id = 0;
     std::unique_ptr<EncodedFrame> encoded_frame;
     bool continuous = false;
   };
 
-  using FrameMap = std::map<int64_t, FrameInfo>;
-  using FrameIterator = FrameMap::iterator;
-
   struct TemporalUnit {
-    // Both first and last are inclusive.
-    FrameIterator first_frame;
-    FrameIterator last_frame;
+    // Indices into the frames ordered by id, both first and last are
+    // inclusive.
+    size_t first_frame;
+    size_t last_frame;
   };
 
-  bool IsContinuous(const FrameIterator& it) const;
-  void PropagateContinuity(const FrameIterator& frame_it);
+  // Returns the frame at `index` in the frames ordered by id.
+  FrameInfo& FrameAt(size_t index);
+  const FrameInfo& FrameAt(size_t index) const;
+  // Returns the index of the first frame with an id not less than `frame_id`.
+  size_t LowerBound(int64_t frame_id) const;
+  // Removes the frames at indices [0, `end`).
+  void EraseFramesBefore(size_t end);
+
+  bool IsContinuous(size_t index) const;
+  void PropagateContinuity(size_t index);
   void FindNextAndLastDecodableTemporalUnit();
   void Clear();
 
   const bool legacy_frame_id_jump_behavior_;
   const size_t max_size_;
-  FrameMap frames_;
+  // Frames ordered by id, stored in a ring of `max_size_` slots starting at
+  // `first_slot_`. The slots are allocated once, and as frames mostly arrive
+  // in order they are inserted at the back without moving other frames.
+  std::vector<FrameInfo> slots_;
+  size_t first_slot_ = 0;
+  size_t num_frames_ = 0;
   std::optional<TemporalUnit> next_decodable_temporal_unit_;
   std::optional<DecodabilityInfo> decodable_temporal_units_info_;
   std::optional<int64_t> last_continuous_frame_id_;
@@ -0,0 +1,95 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/video/encoded_frame.h"
+#include "api/video/frame_buffer.h"
+#include "benchmark/benchmark.h"
+#include "rtc_base/checks.h"
+#include "test/fake_encoded_frame.h"
+#include "test/scoped_key_value_config.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kTemporalUnits = 60;
+constexpr int kMaxBufferedFrames = 800;
+constexpr int kMaxDecodeHistory = 1 << 13;
+
+// Inserts one second of a 60 fps SVC stream with `range(0)` spatial layers
+// into the buffer and extracts the temporal units for decoding, keeping up
+// to `range(1)` temporal units in the buffer like a jitter buffer would.
+// Each spatial layer frame references the frame below it and the same layer
+// of the previous temporal unit.
+void BM_InsertAndExtract(benchmark::State& state) {
+  const int num_spatial_layers = state.range(0);
+  const int buffered_units = state.range(1);
+  test::ScopedKeyValueConfig field_trials;
+  FrameBuffer buffer(kMaxBufferedFrames, kMaxDecodeHistory, field_trials);
+  int64_t frame_id = 0;
+  uint32_t rtp_timestamp = 0;
+  std::vector<std::unique_ptr<EncodedFrame>> frames;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    frames.clear();
+    for (int unit = 0; unit < kTemporalUnits; ++unit) {
+      rtp_timestamp += 90'000 / kTemporalUnits;
+      for (int sid = 0; sid < num_spatial_layers; ++sid, ++frame_id) {
+        std::vector<int64_t> references;
+        if (frame_id >= num_spatial_layers) {
+          references.push_back(frame_id - num_spatial_layers);
+        }
+        if (sid > 0) {
+          references.push_back(frame_id - 1);
+        }
+        test::FakeFrameBuilder builder;
+        builder.Time(rtp_timestamp)
+            .Id(frame_id)
+            .SpatialLayer(sid)
+            .Refs(references);
+        if (sid == num_spatial_layers - 1) {
+          builder.AsLast();
+        }
+        frames.push_back(builder.Build());
+      }
+    }
+    state.ResumeTiming();
+
+    int extracted_units = 0;
+    for (int unit = 0; unit < kTemporalUnits; ++unit) {
+      for (int sid = 0; sid < num_spatial_layers; ++sid) {
+        RTC_CHECK(buffer.InsertFrame(
+            std::move(frames[unit * num_spatial_layers + sid])));
+      }
+      if (unit + 1 >= buffered_units) {
+        RTC_CHECK(!buffer.ExtractNextDecodableTemporalUnit().empty());
+        ++extracted_units;
+      }
+    }
+    while (extracted_units < kTemporalUnits) {
+      RTC_CHECK(!buffer.ExtractNextDecodableTemporalUnit().empty());
+      ++extracted_units;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kTemporalUnits *
+                          num_spatial_layers);
+}
+
+BENCHMARK(BM_InsertAndExtract)
+    ->ArgsProduct({{1, 3, 5}, {1, 30}})
+    ->ArgNames({"spatial_layers", "buffered_units"});
+
+}  // namespace
+}  // namespace webrtc
@@ -0,0 +1,184 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video/frame_latency_trace.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/synchronization/mutex.h"
+
+namespace webrtc {
+
+namespace {
+
+// Only the most recent frames are searched when recording a stage, since the
+// frames in flight through a pipeline are always among the latest ones. This
+// bounds the cost of recording a stage of a new frame.
+constexpr size_t kMaxSearchedFrames = 64;
+
+// Name of the event that ends at `stage`, or nullptr if no event ends there.
+const char* EventName(FrameLatencyTrace::Stage stage) {
+  switch (stage) {
+    case FrameLatencyTrace::Stage::kCapture:
+      return nullptr;
+    case FrameLatencyTrace::Stage::kEncodeStart:
+      return "encoder_queue";
+    case FrameLatencyTrace::Stage::kEncodeFinish:
+      return "encode";
+    case FrameLatencyTrace::Stage::kPacketized:
+      return "packetize";
+    case FrameLatencyTrace::Stage::kFirstPacketSent:
+      return "pacer_queue";
+    case FrameLatencyTrace::Stage::kLastPacketSent:
+      return "pacer_send";
+    case FrameLatencyTrace::Stage::kFirstPacketReceived:
+      return "network";
+    case FrameLatencyTrace::Stage::kLastPacketReceived:
+      return "receive";
+    case FrameLatencyTrace::Stage::kFrameComplete:
+      return "assemble";
+    case FrameLatencyTrace::Stage::kDecodeStart:
+      return "jitter_buffer";
+    case FrameLatencyTrace::Stage::kDecodeFinish:
+      return "decode";
+    case FrameLatencyTrace::Stage::kRender:
+      return "render";
+  }
+  RTC_CHECK_NOTREACHED();
+}
+
+}  // namespace
+
+FrameLatencyTrace::FrameLatencyTrace(size_t max_frames)
+    : max_frames_(max_frames) {
+  RTC_DCHECK_GT(max_frames_, 0);
+}
+
+FrameLatencyTrace::~FrameLatencyTrace() = default;
+
+void FrameLatencyTrace::OnFrameStage(uint32_t ssrc,
+                                     uint32_t rtp_timestamp,
+                                     Stage stage,
+                                     Timestamp time) {
+  MutexLock lock(&mutex_);
+  Frame* frame = FindFrame(ssrc, rtp_timestamp);
+  if (frame == nullptr) {
+    if (frames_.size() < max_frames_) {
+      frame = &frames_.emplace_back();
+    } else {
+      frame = &frames_[next_frame_];
+      *frame = Frame();
+    }
+    next_frame_ = (next_frame_ + 1) % max_frames_;
+    frame->ssrc = ssrc;
+    frame->rtp_timestamp = rtp_timestamp;
+  }
+  frame->stage_times[static_cast<size_t>(stage)] = time;
+}
+
+void FrameLatencyTrace::OnPacketSent(uint32_t ssrc,
+                                     Timestamp capture_time,
+                                     Timestamp send_time) {
+  constexpr size_t kCapture = static_cast<size_t>(Stage::kCapture);
+  constexpr size_t kFirstPacketSent =
+      static_cast<size_t>(Stage::kFirstPacketSent);
+  constexpr size_t kLastPacketSent =
+      static_cast<size_t>(Stage::kLastPacketSent);
+
+  MutexLock lock(&mutex_);
+  const size_t num_searched = std::min(frames_.size(), kMaxSearchedFrames);
+  for (size_t i = 1; i <= num_searched; ++i) {
+    Frame& frame =
+        frames_[(next_frame_ + frames_.size() - i) % frames_.size()];
+    if (frame.ssrc == ssrc && frame.stage_times[kCapture] == capture_time) {
+      if (!frame.stage_times[kFirstPacketSent]) {
+        frame.stage_times[kFirstPacketSent] = send_time;
+      }
+      frame.stage_times[kLastPacketSent] = send_time;
+      return;
+    }
+  }
+}
+
+std::vector<FrameLatencyTrace::Frame> FrameLatencyTrace::GetFrames() const {
+  MutexLock lock(&mutex_);
+  // Until the buffer is full, the oldest frame is the first one.
+  const size_t oldest = frames_.size() < max_frames_ ? 0 : next_frame_;
+  std::vector<Frame> frames;
+  frames.reserve(frames_.size());
+  for (size_t i = 0; i < frames_.size(); ++i) {
+    frames.push_back(frames_[(oldest + i) % frames_.size()]);
+  }
+  return frames;
+}
+
+std::string FrameLatencyTrace::ToChromeTraceJson() const {
+  const std::vector<Frame> frames = GetFrames();
+  StringBuilder json;
+  json << "{\"traceEvents\":[";
+  bool first_event = true;
+  std::set<uint32_t> ssrcs;
+  for (const Frame& frame : frames) {
+    if (ssrcs.insert(frame.ssrc).second) {
+      // Names the track of the stream.
+      json << (first_event ? "" : ",")
+           << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+           << frame.ssrc << ",\"args\":{\"name\":\"ssrc " << frame.ssrc
+           << "\"}}";
+      first_event = false;
+    }
+    std::optional<Timestamp> previous_time;
+    for (size_t i = 0; i < kNumStages; ++i) {
+      const std::optional<Timestamp>& time = frame.stage_times[i];
+      if (!time) {
+        continue;
+      }
+      const char* name = EventName(static_cast<Stage>(i));
+      if (previous_time && name) {
+        const TimeDelta duration =
+            std::max(*time - *previous_time, TimeDelta::Zero());
+        json << ",{\"name\":\"" << name
+             << "\",\"cat\":\"video\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+             << frame.ssrc << ",\"ts\":" << previous_time->us()
+             << ",\"dur\":" << duration.us()
+             << ",\"args\":{\"rtp_timestamp\":" << frame.rtp_timestamp
+             << "}}";
+      }
+      previous_time = time;
+    }
+  }
+  json << "],\"displayTimeUnit\":\"ms\"}";
+  return json.Release();
+}
+
+FrameLatencyTrace::Frame* FrameLatencyTrace::FindFrame(uint32_t ssrc,
+                                                       uint32_t rtp_timestamp) {
+  const size_t num_searched = std::min(frames_.size(), kMaxSearchedFrames);
+  for (size_t i = 1; i <= num_searched; ++i) {
+    Frame& frame =
+        frames_[(next_frame_ + frames_.size() - i) % frames_.size()];
+    if (frame.ssrc == ssrc && frame.rtp_timestamp == rtp_timestamp) {
+      return &frame;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,111 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_VIDEO_FRAME_LATENCY_TRACE_H_
+#define API_VIDEO_FRAME_LATENCY_TRACE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "api/units/timestamp.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system/rtc_export.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Records when each of the most recent video frames of one or more streams
+// passed the stages of the send or receive pipeline, so that the latency can
+// be broken down per frame. Recording is opt-in: a trace is attached to a
+// stream through its config, and nothing is recorded without one.
+//
+// The recorded frames can be exported as Chrome trace event JSON, which can be
+// opened in Perfetto (ui.perfetto.dev) or chrome://tracing.
+//
+// This class is thread safe.
+class RTC_EXPORT FrameLatencyTrace {
+ public:
+  // The stages of a frame in pipeline order. A sent frame goes through the
+  // stages from kCapture to kLastPacketSent, a received frame through
+  // kCapture and the stages from kFirstPacketReceived to kRender.
+  enum class Stage {
+    kCapture,
+    kEncodeStart,
+    kEncodeFinish,
+    kPacketized,
+    kFirstPacketSent,
+    kLastPacketSent,
+    kFirstPacketReceived,
+    kLastPacketReceived,
+    kFrameComplete,
+    kDecodeStart,
+    kDecodeFinish,
+    kRender,
+  };
+  static constexpr size_t kNumStages = static_cast<size_t>(Stage::kRender) + 1;
+
+  struct Frame {
+    uint32_t ssrc = 0;
+    uint32_t rtp_timestamp = 0;
+    // Indexed by Stage, in the local clock. Unset if the stage was not
+    // recorded.
+    std::array<std::optional<Timestamp>, kNumStages> stage_times;
+  };
+
+  static constexpr size_t kDefaultMaxFrames = 1024;
+
+  explicit FrameLatencyTrace(size_t max_frames = kDefaultMaxFrames);
+  ~FrameLatencyTrace();
+
+  FrameLatencyTrace(const FrameLatencyTrace&) = delete;
+  FrameLatencyTrace& operator=(const FrameLatencyTrace&) = delete;
+
+  // Records that the frame with `rtp_timestamp` of the stream `ssrc` reached
+  // `stage` at `time`. A stage recorded more than once, e.g. once per spatial
+  // layer, keeps the latest time. Once `max_frames` frames are recorded, a new
+  // frame replaces the oldest one.
+  void OnFrameStage(uint32_t ssrc,
+                    uint32_t rtp_timestamp,
+                    Stage stage,
+                    Timestamp time);
+
+  // Records that a packet of the stream `ssrc` with `capture_time` left the
+  // pacer at `send_time`. Packets of frames without a recorded kCapture stage
+  // at `capture_time` are ignored.
+  void OnPacketSent(uint32_t ssrc, Timestamp capture_time, Timestamp send_time);
+
+  // Returns the recorded frames, oldest first.
+  std::vector<Frame> GetFrames() const;
+
+  // Returns the recorded frames as a Chrome trace event JSON object. Each
+  // stage of a frame after the first recorded one becomes a complete event
+  // that spans from the previous recorded stage, on a track per stream.
+  std::string ToChromeTraceJson() const;
+
+ private:
+  Frame* FindFrame(uint32_t ssrc, uint32_t rtp_timestamp)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  mutable Mutex mutex_;
+  // Ring buffer of the recorded frames. `next_frame_` is the slot the next
+  // new frame is recorded in, which holds the oldest frame once the buffer is
+  // full.
+  std::vector<Frame> frames_ RTC_GUARDED_BY(mutex_);
+  const size_t max_frames_;
+  size_t next_frame_ RTC_GUARDED_BY(mutex_) = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // API_VIDEO_FRAME_LATENCY_TRACE_H_
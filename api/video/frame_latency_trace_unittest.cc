@@ -0,0 +1,137 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video/frame_latency_trace.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "api/units/timestamp.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::Field;
+using ::testing::HasSubstr;
+using ::testing::IsEmpty;
+using Stage = FrameLatencyTrace::Stage;
+
+constexpr uint32_t kSsrc = 1111;
+
+std::optional<Timestamp> StageTime(const FrameLatencyTrace::Frame& frame,
+                                   Stage stage) {
+  return frame.stage_times[static_cast<size_t>(stage)];
+}
+
+TEST(FrameLatencyTraceTest, RecordsStagesPerFrame) {
+  FrameLatencyTrace trace;
+  trace.OnFrameStage(kSsrc, 100, Stage::kCapture, Timestamp::Millis(10));
+  trace.OnFrameStage(kSsrc, 200, Stage::kCapture, Timestamp::Millis(20));
+  trace.OnFrameStage(kSsrc, 100, Stage::kEncodeStart, Timestamp::Millis(21));
+
+  std::vector<FrameLatencyTrace::Frame> frames = trace.GetFrames();
+  ASSERT_EQ(frames.size(), 2u);
+  EXPECT_EQ(frames[0].rtp_timestamp, 100u);
+  EXPECT_EQ(StageTime(frames[0], Stage::kCapture), Timestamp::Millis(10));
+  EXPECT_EQ(StageTime(frames[0], Stage::kEncodeStart), Timestamp::Millis(21));
+  EXPECT_EQ(frames[1].rtp_timestamp, 200u);
+  EXPECT_EQ(StageTime(frames[1], Stage::kEncodeStart), std::nullopt);
+}
+
+TEST(FrameLatencyTraceTest, KeepsStreamsApart) {
+  FrameLatencyTrace trace;
+  trace.OnFrameStage(kSsrc, 100, Stage::kCapture, Timestamp::Millis(10));
+  trace.OnFrameStage(kSsrc + 1, 100, Stage::kCapture, Timestamp::Millis(11));
+
+  EXPECT_THAT(trace.GetFrames(),
+              ElementsAre(Field(&FrameLatencyTrace::Frame::ssrc, kSsrc),
+                          Field(&FrameLatencyTrace::Frame::ssrc, kSsrc + 1)));
+}
+
+TEST(FrameLatencyTraceTest, ReplacesOldestFrameWhenFull) {
+  FrameLatencyTrace trace(/*max_frames=*/2);
+  for (uint32_t rtp_timestamp : {100, 200, 300}) {
+    trace.OnFrameStage(kSsrc, rtp_timestamp, Stage::kCapture,
+                       Timestamp::Millis(rtp_timestamp));
+  }
+
+  EXPECT_THAT(
+      trace.GetFrames(),
+      ElementsAre(Field(&FrameLatencyTrace::Frame::rtp_timestamp, 200u),
+                  Field(&FrameLatencyTrace::Frame::rtp_timestamp, 300u)));
+}
+
+TEST(FrameLatencyTraceTest, RecordsFirstAndLastPacketSentByCaptureTime) {
+  FrameLatencyTrace trace;
+  trace.OnFrameStage(kSsrc, 100, Stage::kCapture, Timestamp::Millis(10));
+  trace.OnPacketSent(kSsrc, Timestamp::Millis(10), Timestamp::Millis(30));
+  trace.OnPacketSent(kSsrc, Timestamp::Millis(10), Timestamp::Millis(31));
+  trace.OnPacketSent(kSsrc, Timestamp::Millis(10), Timestamp::Millis(32));
+  // Packets of other streams or unknown frames are ignored.
+  trace.OnPacketSent(kSsrc + 1, Timestamp::Millis(10), Timestamp::Millis(33));
+  trace.OnPacketSent(kSsrc, Timestamp::Millis(11), Timestamp::Millis(33));
+
+  std::vector<FrameLatencyTrace::Frame> frames = trace.GetFrames();
+  ASSERT_EQ(frames.size(), 1u);
+  EXPECT_EQ(StageTime(frames[0], Stage::kFirstPacketSent),
+            Timestamp::Millis(30));
+  EXPECT_EQ(StageTime(frames[0], Stage::kLastPacketSent),
+            Timestamp::Millis(32));
+}
+
+TEST(FrameLatencyTraceTest, ExportsEmptyTrace) {
+  FrameLatencyTrace trace;
+  EXPECT_EQ(trace.ToChromeTraceJson(),
+            "{\"traceEvents\":[],\"displayTimeUnit\":\"ms\"}");
+  EXPECT_THAT(trace.GetFrames(), IsEmpty());
+}
+
+TEST(FrameLatencyTraceTest, ExportsEventsBetweenRecordedStages) {
+  FrameLatencyTrace trace;
+  trace.OnFrameStage(kSsrc, 100, Stage::kCapture, Timestamp::Millis(10));
+  // kEncodeStart is not recorded, so encoding spans from the capture.
+  trace.OnFrameStage(kSsrc, 100, Stage::kEncodeFinish, Timestamp::Millis(25));
+
+  EXPECT_THAT(
+      trace.ToChromeTraceJson(),
+      Eq("{\"traceEvents\":["
+         "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1111,"
+         "\"args\":{\"name\":\"ssrc 1111\"}},"
+         "{\"name\":\"encode\",\"cat\":\"video\",\"ph\":\"X\",\"pid\":1,"
+         "\"tid\":1111,\"ts\":10000,\"dur\":15000,"
+         "\"args\":{\"rtp_timestamp\":100}}"
+         "],\"displayTimeUnit\":\"ms\"}"));
+}
+
+TEST(FrameLatencyTraceTest, ExportsReceiveStages) {
+  FrameLatencyTrace trace;
+  trace.OnFrameStage(kSsrc, 100, Stage::kFirstPacketReceived,
+                     Timestamp::Millis(10));
+  trace.OnFrameStage(kSsrc, 100, Stage::kDecodeStart, Timestamp::Millis(15));
+  trace.OnFrameStage(kSsrc, 100, Stage::kDecodeFinish, Timestamp::Millis(20));
+  trace.OnFrameStage(kSsrc, 100, Stage::kRender, Timestamp::Millis(22));
+
+  std::string json = trace.ToChromeTraceJson();
+  EXPECT_THAT(json, HasSubstr("\"name\":\"jitter_buffer\""));
+  EXPECT_THAT(json, HasSubstr("\"name\":\"decode\""));
+  EXPECT_THAT(json, HasSubstr("\"name\":\"render\",\"cat\":\"video\",\"ph\":"
+                              "\"X\",\"pid\":1,\"tid\":1111,\"ts\":20000,"
+                              "\"dur\":2000"));
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -0,0 +1,30 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_VIDEO_NALU_INDEX_H_
+#define API_VIDEO_NALU_INDEX_H_
+
+#include <cstddef>
+
+namespace webrtc {
+
+// Position of a NAL unit in an H.264 or H.265 Annex B bitstream.
+struct NaluIndex {
+  // Start index of NALU, including start sequence.
+  size_t start_offset = 0;
+  // Start index of NALU payload, typically type header.
+  size_t payload_start_offset = 0;
+  // Length of NALU payload, in bytes, counting from payload_start_offset.
+  size_t payload_size = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // API_VIDEO_NALU_INDEX_H_
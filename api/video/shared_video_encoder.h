@@ -0,0 +1,49 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_VIDEO_SHARED_VIDEO_ENCODER_H_
+#define API_VIDEO_SHARED_VIDEO_ENCODER_H_
+
+#include "api/ref_count.h"
+#include "rtc_base/system/rtc_export.h"
+
+namespace webrtc {
+
+class SharedVideoStreamEncoder;
+
+// An encoder shared by the video send streams that send the same source with
+// the same encoder configuration, e.g. to the receivers of a broadcast. Every
+// frame is encoded once and packetized separately for each send stream. Set
+// the same instance in VideoStreamEncoderSettings::shared_encoder of all the
+// send streams that should share it.
+//
+// Create instances with CreateSharedVideoEncoder() in
+// api/video/create_shared_video_encoder.h. The interface cannot be
+// implemented outside of WebRTC.
+class RTC_EXPORT SharedVideoEncoder : public RefCountInterface {
+ public:
+  // Returns the number of send streams that currently use the encoder.
+  virtual int NumSendStreams() const = 0;
+
+ protected:
+  ~SharedVideoEncoder() override = default;
+
+ private:
+  // The only implementation is SharedVideoStreamEncoder in video/.
+  friend class SharedVideoStreamEncoder;
+  SharedVideoEncoder() = default;
+
+  // Returns the implementation that the send streams use.
+  virtual SharedVideoStreamEncoder* implementation() = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // API_VIDEO_SHARED_VIDEO_ENCODER_H_
@@ -0,0 +1,57 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video/encoded_image.h"
+
+#include <cstdint>
+
+#include "api/video/nalu_index.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr uint8_t kFrame[] = {0, 0, 0, 1, 0x65, 0xaa, 0xbb};
+
+TEST(EncodedImageTest, KeepsNaluIndicesOfCurrentData) {
+  EncodedImage image;
+  image.SetEncodedData(EncodedImageBuffer::Create(kFrame, sizeof(kFrame)));
+  EXPECT_TRUE(image.NaluIndices().empty());
+
+  image.SetNaluIndices({{.start_offset = 0,
+                         .payload_start_offset = 4,
+                         .payload_size = 3}});
+  ASSERT_EQ(image.NaluIndices().size(), 1u);
+  EXPECT_EQ(image.NaluIndices()[0].payload_size, 3u);
+
+  // Copies share the encoded data, and so the indices.
+  EncodedImage copy = image;
+  EXPECT_EQ(copy.NaluIndices().size(), 1u);
+}
+
+TEST(EncodedImageTest, DropsNaluIndicesWhenDataChanges) {
+  EncodedImage image;
+  image.SetEncodedData(EncodedImageBuffer::Create(kFrame, sizeof(kFrame)));
+  image.SetNaluIndices({{.start_offset = 0,
+                         .payload_start_offset = 4,
+                         .payload_size = 3}});
+
+  image.set_size(sizeof(kFrame) - 1);
+  EXPECT_TRUE(image.NaluIndices().empty());
+
+  image.SetNaluIndices({{.start_offset = 0,
+                         .payload_start_offset = 4,
+                         .payload_size = 2}});
+  image.SetEncodedData(EncodedImageBuffer::Create(kFrame, sizeof(kFrame)));
+  EXPECT_TRUE(image.NaluIndices().empty());
+}
+
+}  // namespace
+}  // namespace webrtc
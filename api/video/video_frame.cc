@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "api/rtp_packet_infos.h"
 #include "api/scoped_refptr.h"
@@ -171,10 +172,14 @@ VideoFrame::Builder::~Builder() = default;
 
 VideoFrame VideoFrame::Builder::build() {
   RTC_CHECK(video_frame_buffer_ != nullptr);
-  return VideoFrame(id_, video_frame_buffer_, timestamp_us_,
-                    presentation_timestamp_, reference_time_, timestamp_rtp_,
-                    ntp_time_ms_, rotation_, color_space_, render_parameters_,
-                    update_rect_, packet_infos_);
+  VideoFrame frame(id_, video_frame_buffer_, timestamp_us_,
+                   presentation_timestamp_, reference_time_, timestamp_rtp_,
+                   ntp_time_ms_, rotation_, color_space_, render_parameters_,
+                   update_rect_, packet_infos_);
+  if (update_region_.has_value()) {
+    frame.set_update_region(*update_region_);
+  }
+  return frame;
 }
 
 VideoFrame::Builder& VideoFrame::Builder::set_video_frame_buffer(
@@ -258,6 +263,12 @@ VideoFrame::Builder& VideoFrame::Builder::set_update_rect(
   return *this;
 }
 
+VideoFrame::Builder& VideoFrame::Builder::set_update_region(
+    std::vector<UpdateRect> update_region) {
+  update_region_ = std::move(update_region);
+  return *this;
+}
+
 VideoFrame::Builder& VideoFrame::Builder::set_packet_infos(
     RtpPacketInfos packet_infos) {
   packet_infos_ = std::move(packet_infos);
@@ -324,6 +335,36 @@ VideoFrame::VideoFrame(VideoFrame&&) = default;
 VideoFrame& VideoFrame::operator=(const VideoFrame&) = default;
 VideoFrame& VideoFrame::operator=(VideoFrame&&) = default;
 
+std::vector<VideoFrame::UpdateRect> VideoFrame::update_region() const {
+  if (!update_region_.empty()) {
+    return update_region_;
+  }
+  UpdateRect rect = update_rect();
+  if (rect.IsEmpty()) {
+    return {};
+  }
+  return {rect};
+}
+
+void VideoFrame::set_update_region(std::vector<UpdateRect> rects) {
+  UpdateRect bounding_box;
+  bounding_box.MakeEmptyUpdate();
+  std::erase_if(rects, [](const UpdateRect& rect) { return rect.IsEmpty(); });
+  for (const UpdateRect& rect : rects) {
+    RTC_DCHECK_GE(rect.offset_x, 0);
+    RTC_DCHECK_GE(rect.offset_y, 0);
+    RTC_DCHECK_LE(rect.offset_x + rect.width, width());
+    RTC_DCHECK_LE(rect.offset_y + rect.height, height());
+    bounding_box.Union(rect);
+  }
+  update_rect_ = bounding_box;
+  if (rects.size() > 1 && rects.size() <= kMaxUpdateRegionRects) {
+    update_region_ = std::move(rects);
+  } else {
+    update_region_.clear();
+  }
+}
+
 int VideoFrame::width() const {
   return video_frame_buffer_ ? video_frame_buffer_->width() : 0;
 }
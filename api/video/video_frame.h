@@ -13,8 +13,10 @@
 
 #include <stdint.h>
 
+#include <cstddef>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "api/rtp_packet_infos.h"
 #include "api/scoped_refptr.h"
@@ -32,6 +34,9 @@ class RTC_EXPORT VideoFrame {
  public:
   // Value used to signal that `VideoFrame::id()` is not set.
   static constexpr uint16_t kNotSetId = 0;
+  // Update regions with more rectangles than this are reduced to their
+  // bounding box.
+  static constexpr size_t kMaxUpdateRegionRects = 16;
 
   struct RTC_EXPORT UpdateRect {
     int offset_x = 0;
@@ -123,6 +128,8 @@ class RTC_EXPORT VideoFrame {
     Builder& set_color_space(const ColorSpace* color_space);
     Builder& set_id(uint16_t id);
     Builder& set_update_rect(const std::optional<UpdateRect>& update_rect);
+    // Overrides set_update_rect(), see VideoFrame::set_update_region().
+    Builder& set_update_region(std::vector<UpdateRect> update_region);
     Builder& set_packet_infos(RtpPacketInfos packet_infos);
 
    private:
@@ -137,6 +144,7 @@ class RTC_EXPORT VideoFrame {
     std::optional<ColorSpace> color_space_;
     RenderParameters render_parameters_;
     std::optional<UpdateRect> update_rect_;
+    std::optional<std::vector<UpdateRect>> update_region_;
     RtpPacketInfos packet_infos_;
   };
 
@@ -258,16 +266,33 @@ class RTC_EXPORT VideoFrame {
     return update_rect_.value_or(UpdateRect{0, 0, width(), height()});
   }
 
-  // Rectangle must be within the frame dimensions.
+  // Rectangle must be within the frame dimensions. Replaces any update region
+  // set by set_update_region().
   void set_update_rect(const VideoFrame::UpdateRect& update_rect) {
     RTC_DCHECK_GE(update_rect.offset_x, 0);
     RTC_DCHECK_GE(update_rect.offset_y, 0);
     RTC_DCHECK_LE(update_rect.offset_x + update_rect.width, width());
     RTC_DCHECK_LE(update_rect.offset_y + update_rect.height, height());
     update_rect_ = update_rect;
+    update_region_.clear();
   }
 
-  void clear_update_rect() { update_rect_ = std::nullopt; }
+  void clear_update_rect() {
+    update_rect_ = std::nullopt;
+    update_region_.clear();
+  }
+
+  // Returns the rectangles that changed since the last frame, e.g. the damage
+  // rectangles reported by a screen capturer. Their bounding box is
+  // update_rect(). Unless set by set_update_region(), the region consists of
+  // update_rect() alone. Empty if nothing changed.
+  std::vector<UpdateRect> update_region() const;
+
+  // Sets the area that changed since the last frame to the union of `rects`,
+  // which must be within the frame dimensions, and update_rect() to their
+  // bounding box. Empty rectangles are ignored, so an empty region marks a
+  // frame identical to the previous one.
+  void set_update_region(std::vector<UpdateRect> rects);
 
   // Get information about packets used to assemble this video frame. Might be
   // empty if the information isn't available.
@@ -318,6 +343,9 @@ class RTC_EXPORT VideoFrame {
   // If absent, it means that there's no information about the change at all and
   // update_rect() will return a rectangle corresponding to the entire frame.
   std::optional<UpdateRect> update_rect_;
+  // The changed rectangles within `update_rect_` when there are more than one
+  // of them. Empty if `update_rect_` describes the change on its own.
+  std::vector<UpdateRect> update_region_;
   // Information about packets used to assemble this video frame. This is needed
   // by `SourceTracker` when the frame is delivered to the RTCRtpReceiver's
   // MediaStreamTrack, in order to implement getContributingSources(). See:
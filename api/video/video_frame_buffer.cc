@@ -36,6 +36,12 @@ scoped_refptr<VideoFrameBuffer> VideoFrameBuffer::CropAndScale(
   return result;
 }
 
+scoped_refptr<VideoFrameBuffer> VideoFrameBuffer::GetPrescaledBuffer(
+    int /* scaled_width */,
+    int /* scaled_height */) {
+  return nullptr;
+}
+
 const I420BufferInterface* VideoFrameBuffer::GetI420() const {
   // Overridden by subclasses that can return an I420 buffer without any
   // conversion, in particular, I420BufferInterface.
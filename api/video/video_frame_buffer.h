@@ -107,6 +107,13 @@ class RTC_EXPORT VideoFrameBuffer : public webrtc::RefCountInterface {
     return CropAndScale(0, 0, width(), height(), scaled_width, scaled_height);
   }
 
+  // Returns the full frame scaled to `scaled_width` x `scaled_height` if the
+  // producer of this buffer has already prepared that resolution, e.g. all
+  // simulcast resolutions built in one pass by VideoFramePyramid. Returns
+  // nullptr otherwise, in which case Scale() has to be used. Never scales.
+  virtual scoped_refptr<VideoFrameBuffer> GetPrescaledBuffer(int scaled_width,
+                                                             int scaled_height);
+
   // These functions should only be called if type() is of the correct type.
   // Calling with a different type will result in a crash.
   const I420ABufferInterface* GetI420A() const;
@@ -26,6 +26,13 @@ class VideoSinkInterface {
   // limiting.
   virtual void OnDiscardedFrame() {}
 
+  // May be called by the source before it produces, converts or scales a
+  // frame. Returns false if the sink would drop the next frame anyway, e.g.
+  // because an encoder is paused, in which case the source should call
+  // OnDiscardedFrame() instead of producing the frame. Called on the thread
+  // that delivers frames, and must not change the state of the sink.
+  virtual bool WantsFrame() { return true; }
+
   // Called on the network thread when video constraints change.
   // TODO(crbug/1255737): make pure virtual once downstream project adapts.
   virtual void OnConstraintsChanged(
@@ -43,6 +43,12 @@ struct RTC_EXPORT VideoSinkWants {
   // Tells the source that the sink only wants black frames.
   bool black_frames = false;
 
+  // Tells the source that the sink does not use frames for now, e.g. because
+  // the view that renders them is hidden. A source that is expensive to run,
+  // such as a receive stream that decodes the frames, may then deliver frames
+  // only occasionally, as long as it resumes quickly once no longer paused.
+  bool paused = false;
+
   // Tells the source the maximum number of pixels the sink wants.
   int max_pixel_count = std::numeric_limits<int>::max();
   // Tells the source the desired number of pixels the sinks wants. This will
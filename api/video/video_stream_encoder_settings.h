@@ -11,6 +11,9 @@
 #ifndef API_VIDEO_VIDEO_STREAM_ENCODER_SETTINGS_H_
 #define API_VIDEO_VIDEO_STREAM_ENCODER_SETTINGS_H_
 
+#include "api/adaptation/encoder_cpu_share_resource.h"
+#include "api/scoped_refptr.h"
+#include "api/video/shared_video_encoder.h"
 #include "api/video/video_bitrate_allocator_factory.h"
 #include "api/video_codecs/sdp_video_format.h"
 #include "api/video_codecs/video_encoder.h"
@@ -56,6 +59,15 @@ struct VideoStreamEncoderSettings {
   // Enables the frame instrumentation generator that is required for automatic
   // corruption detection.
   bool enable_frame_instrumentation_generator = false;
+
+  // If set, the encoder adapts to CPU load by reporting its encode times to
+  // this share of a CPU budget shared with other encoders, instead of by
+  // measuring its own encode usage.
+  scoped_refptr<EncoderCpuShareResource> encoder_cpu_share;
+
+  // If set, the send stream does not create its own encoder but uses this
+  // encoder, shared with the other send streams that have it set.
+  scoped_refptr<SharedVideoEncoder> shared_encoder;
 };
 
 }  // namespace webrtc
@@ -53,6 +53,10 @@ class FlexfecReceiveStream : public RtpPacketSinkInterface,
     // protection.
     std::vector<uint32_t> protected_media_ssrcs;
 
+    // Expect Reed-Solomon parity packets, see RtpConfig::Flexfec, instead of
+    // FlexFEC packets. Not signaled in SDP.
+    bool use_reed_solomon = false;
+
     // What RTCP mode to use in the reports.
     RtcpMode rtcp_mode = RtcpMode::kCompound;
 
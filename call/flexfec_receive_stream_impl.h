@@ -28,6 +28,7 @@ namespace webrtc {
 class FlexfecReceiver;
 class ReceiveStatistics;
 class RecoveredPacketReceiver;
+class ReedSolomonFecReceiver;
 class RtcpRttStats;
 class RtpPacketReceived;
 class RtpStreamReceiverControllerInterface;
@@ -85,8 +86,10 @@ class FlexfecReceiveStreamImpl : public FlexfecReceiveStream {
   // disabled.
   int payload_type_ RTC_GUARDED_BY(packet_sequence_checker_) = -1;
 
-  // Erasure code interfacing.
+  // Erasure code interfacing. At most one of these is set, depending on
+  // `Config::use_reed_solomon`.
   const std::unique_ptr<FlexfecReceiver> receiver_;
+  const std::unique_ptr<ReedSolomonFecReceiver> reed_solomon_receiver_;
 
   // RTCP reporting.
   const std::unique_ptr<ReceiveStatistics> rtp_receive_statistics_;
@@ -163,6 +163,12 @@ struct RtpConfig {
     // TODO(brandtr): Update comment above when we support
     // multistream protection.
     std::vector<uint32_t> protected_media_ssrcs;
+
+    // Send Reed-Solomon parity packets instead of FlexFEC packets on the
+    // FlexFEC SSRC and payload type. The payload format is not negotiated
+    // through SDP, so this must only be set when the receiving
+    // FlexfecReceiveStream is configured with `use_reed_solomon` as well.
+    bool use_reed_solomon = false;
   } flexfec;
 
   // Settings for RTP retransmission payload format, see RFC 4588 for
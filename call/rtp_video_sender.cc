@@ -59,6 +59,7 @@
 #include "modules/pacing/packet_router.h"
 #include "modules/rtp_rtcp/include/flexfec_sender.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_generator.h"
 #include "modules/rtp_rtcp/source/rtp_rtcp_impl2.h"
 #include "modules/rtp_rtcp/source/rtp_sender.h"
 #include "modules/rtp_rtcp/source/rtp_sender_video.h"
@@ -206,6 +207,12 @@ std::unique_ptr<VideoFecGenerator> MaybeCreateFecGenerator(
     }
 
     RTC_DCHECK_EQ(1U, rtp.flexfec.protected_media_ssrcs.size());
+    if (rtp.flexfec.use_reed_solomon) {
+      return std::make_unique<ReedSolomonFecGenerator>(
+          env, rtp.flexfec.payload_type, rtp.flexfec.ssrc,
+          rtp.flexfec.protected_media_ssrcs[0], rtp.mid, rtp.extensions,
+          RTPSender::FecExtensionSizes(), rtp_state);
+    }
     return std::make_unique<FlexfecSender>(
         env, rtp.flexfec.payload_type, rtp.flexfec.ssrc,
         rtp.flexfec.protected_media_ssrcs[0], rtp.mid, rtp.extensions,
@@ -311,9 +318,12 @@ std::vector<RtpStreamSender> CreateRtpStreamSenders(
         !video_config.field_trials->IsDisabled(
             "WebRTC-Video-EnableRetransmitAllLayers");
 
+    // Reed-Solomon FEC is sent on the FlexFEC stream.
     const bool using_flexfec =
         fec_generator &&
-        fec_generator->GetFecType() == VideoFecGenerator::FecType::kFlexFec;
+        (fec_generator->GetFecType() == VideoFecGenerator::FecType::kFlexFec ||
+         fec_generator->GetFecType() ==
+             VideoFecGenerator::FecType::kReedSolomon);
     const bool should_disable_red_and_ulpfec = ShouldDisableRedAndUlpfec(
         using_flexfec, rtp_config, env.field_trials());
     if (!should_disable_red_and_ulpfec &&
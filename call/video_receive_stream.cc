@@ -96,6 +96,16 @@ std::string VideoReceiveStreamInterface::Stats::ToString(
   ss << "totalDecodeTime: " << total_decode_time.seconds<double>() << ", ";
   ss << "totalProcessingDelay: " << total_processing_delay.seconds<double>()
      << ", ";
+  ss << "framesWithLatencyBreakdown: " << frames_with_latency_breakdown
+     << ", ";
+  ss << "totalReceiveLatency: " << total_receive_latency.seconds<double>()
+     << ", ";
+  ss << "totalAssembleLatency: " << total_assemble_latency.seconds<double>()
+     << ", ";
+  ss << "totalDecodeLatency: " << total_decode_latency.seconds<double>()
+     << ", ";
+  ss << "totalRenderLatency: " << total_render_latency.seconds<double>()
+     << ", ";
   ss << "min_playout_delay_ms: " << min_playout_delay_ms << ", ";
   ss << "sync_offset_ms: " << sync_offset_ms << ", ";
   ss << "cum_loss: " << rtp_stats.packets_lost << ", ";
@@ -131,6 +141,8 @@ std::string VideoReceiveStreamInterface::Config::ToString() const {
   ss << ", rtp: " << rtp.ToString();
   ss << ", renderer: " << (renderer ? "(renderer)" : "nullptr");
   ss << ", render_delay_ms: " << render_delay_ms;
+  if (low_latency_playout)
+    ss << ", low_latency_playout: true";
   if (!sync_group.empty())
     ss << ", sync_group: " << sync_group;
   ss << '}';
@@ -29,6 +29,8 @@
 #include "api/scoped_refptr.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
+#include "api/video/decode_thread_pool.h"
+#include "api/video/frame_latency_trace.h"
 #include "api/video/recordable_encoded_frame.h"
 #include "api/video/video_content_type.h"
 #include "api/video/video_frame.h"
@@ -132,6 +134,17 @@ class VideoReceiveStreamInterface : public MediaReceiveStreamInterface {
     // https://w3c.github.io/webrtc-stats/#dom-rtcinboundrtpstreamstats-totalsqauredinterframedelay
     double total_squared_inter_frame_delay = 0;
     int64_t first_frame_received_to_decoded_ms = -1;
+
+    // Glass-to-glass latency of the rendered frames split by stage: capture to
+    // first packet received, first to last packet received, last packet
+    // received to decoded and decoded to rendered. Summed over
+    // `frames_with_latency_breakdown` frames, which excludes frames with an
+    // unknown capture time or packet receive time.
+    uint32_t frames_with_latency_breakdown = 0;
+    TimeDelta total_receive_latency = TimeDelta::Zero();
+    TimeDelta total_assemble_latency = TimeDelta::Zero();
+    TimeDelta total_decode_latency = TimeDelta::Zero();
+    TimeDelta total_render_latency = TimeDelta::Zero();
     std::optional<uint64_t> qp_sum;
 
     // Corruption score, indicating the probability of corruption. Its value is
@@ -278,6 +291,12 @@ class VideoReceiveStreamInterface : public MediaReceiveStreamInterface {
     // available.
     bool enable_prerenderer_smoothing = true;
 
+    // If true, each frame is released for decoding and rendering as soon as it
+    // is decodable, ignoring the playout delay and the jitter and decode time
+    // estimates, and older decodable frames are dropped in favour of the
+    // latest one. Intended for interactive streams such as remote control.
+    bool low_latency_playout = false;
+
     // Identifier for an A/V synchronization group. Empty string to disable.
     // TODO(pbos): Synchronize streams in a sync group, not just video streams
     // to one of the audio streams.
@@ -292,6 +311,15 @@ class VideoReceiveStreamInterface : public MediaReceiveStreamInterface {
     CryptoOptions crypto_options;
 
     scoped_refptr<webrtc::FrameTransformerInterface> frame_transformer;
+
+    // If set, frames are decoded on this pool, shared with the other receive
+    // streams that have it set, instead of on a decode thread of this stream.
+    scoped_refptr<DecodeThreadPool> decode_thread_pool;
+
+    // If set, the estimated capture, packet receive, frame complete, decode
+    // and render times of each rendered frame are recorded in this trace. Not
+    // owned, and must outlive the stream.
+    FrameLatencyTrace* frame_latency_trace = nullptr;
   };
 
   // TODO(pbos): Add info on currently-received codec to Stats.
@@ -321,6 +349,18 @@ class VideoReceiveStreamInterface : public MediaReceiveStreamInterface {
   // Cause eventual generation of a key frame from the sender.
   virtual void GenerateKeyFrame() = 0;
 
+  // Tells the stream whether the sink of the decoded frames is paused, e.g.
+  // because the view that renders them is hidden. While paused, only key
+  // frames are decoded. When unpaused, a key frame is requested to resume
+  // decoding.
+  virtual void SetSinkPaused(bool paused) = 0;
+
+  // Sets the decode target of the dependency descriptor to decode, e.g. a
+  // lower spatial layer of an SVC stream rendered in a small view, or
+  // std::nullopt to decode all layers. Frames the decode target does not
+  // depend on are dropped without being decoded.
+  virtual void SetDecodeTarget(std::optional<int> decode_target) = 0;
+
   // Sets or clears a flexfec RTP sink. This affects `rtp.packet_sink_` and
   // `rtp.protected_by_flexfec` parts of the configuration. Must be called on
   // the packet delivery thread.
@@ -89,7 +89,8 @@ std::string VideoSendStream::Stats::ToString(int64_t time_ms) const {
   ss << "cpu_adapted_fps: " << (cpu_limited_framerate ? "true" : "false")
      << ", ";
   ss << "#cpu_adaptations: " << number_of_cpu_adapt_changes << ", ";
-  ss << "#quality_adaptations: " << number_of_quality_adapt_changes;
+  ss << "#quality_adaptations: " << number_of_quality_adapt_changes << ", ";
+  ss << "#frames_converted: " << frames_converted_for_encoder;
   ss << '}';
   for (const auto& substream : substreams) {
     if (substream.second.type ==
@@ -26,6 +26,7 @@
 #include "api/rtp_sender_interface.h"
 #include "api/scoped_refptr.h"
 #include "api/units/data_rate.h"
+#include "api/video/frame_latency_trace.h"
 #include "api/video/video_content_type.h"
 #include "api/video/video_frame.h"
 #include "api/video/video_source_interface.h"
@@ -123,6 +124,8 @@ class VideoSendStream {
     uint32_t frames_dropped_by_rate_limiter = 0;
     uint32_t frames_dropped_by_congestion_window = 0;
     uint32_t frames_dropped_by_encoder = 0;
+    // Frames passed to the encoder in a pixel format it had to convert.
+    uint32_t frames_converted_for_encoder = 0;
     // Metric only used by legacy getStats()'s BWE.
     // - Similar to `StreamStats::target_bitrate` except this is for the whole
     //   stream as opposed to being per substream (per SSRC).
@@ -214,6 +217,11 @@ class VideoSendStream {
 
     scoped_refptr<webrtc::FrameTransformerInterface> frame_transformer;
 
+    // If set, the capture, encode, packetization and pacer times of each
+    // encoded frame are recorded in this trace. Not owned, and must outlive
+    // the stream.
+    FrameLatencyTrace* frame_latency_trace = nullptr;
+
    private:
     // Access to the copy constructor is private to force use of the Copy()
     // method for those exceptional cases where we do use it.
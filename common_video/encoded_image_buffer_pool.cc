@@ -0,0 +1,113 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/include/encoded_image_buffer_pool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "api/make_ref_counted.h"
+#include "api/scoped_refptr.h"
+#include "api/video/encoded_image.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/ref_counted_object.h"
+
+namespace webrtc {
+
+namespace {
+
+// EncodedImageBuffer that exposes the capacity of its storage, which is kept
+// when a smaller size is set.
+class PooledBuffer : public EncodedImageBuffer {
+ public:
+  explicit PooledBuffer(size_t size) : EncodedImageBuffer(size) {}
+
+  size_t capacity() const { return buffer_.capacity(); }
+};
+
+// Cast is safe because all the pooled buffers are created in CreateBuffer() as
+// `RefCountedObject<PooledBuffer>`.
+RefCountedObject<PooledBuffer>* AsPooled(
+    const scoped_refptr<EncodedImageBuffer>& buffer) {
+  return static_cast<RefCountedObject<PooledBuffer>*>(buffer.get());
+}
+
+}  // namespace
+
+EncodedImageBufferPool::EncodedImageBufferPool()
+    : EncodedImageBufferPool(kDefaultMaxNumberOfBuffers) {}
+
+EncodedImageBufferPool::EncodedImageBufferPool(size_t max_number_of_buffers)
+    : max_number_of_buffers_(max_number_of_buffers) {}
+
+EncodedImageBufferPool::~EncodedImageBufferPool() = default;
+
+scoped_refptr<EncodedImageBuffer> EncodedImageBufferPool::CreateBuffer(
+    size_t size) {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  ++stats_.num_requests;
+
+  // If the ref count is 1, the list holds the only reference and the buffer
+  // can be reused.
+  RefCountedObject<PooledBuffer>* best_fit = nullptr;
+  RefCountedObject<PooledBuffer>* largest = nullptr;
+  for (const scoped_refptr<EncodedImageBuffer>& buffer : buffers_) {
+    RefCountedObject<PooledBuffer>* pooled = AsPooled(buffer);
+    if (!pooled->HasOneRef()) {
+      continue;
+    }
+    if (pooled->capacity() >= size &&
+        (!best_fit || pooled->capacity() < best_fit->capacity())) {
+      best_fit = pooled;
+    }
+    if (!largest || pooled->capacity() > largest->capacity()) {
+      largest = pooled;
+    }
+  }
+
+  if (best_fit) {
+    ++stats_.num_hits;
+    best_fit->Realloc(size);
+    return scoped_refptr<EncodedImageBuffer>(best_fit);
+  }
+  if (largest) {
+    // Grows the storage, which is kept for later frames.
+    largest->Realloc(size);
+    return scoped_refptr<EncodedImageBuffer>(largest);
+  }
+  scoped_refptr<EncodedImageBuffer> buffer =
+      make_ref_counted<PooledBuffer>(size);
+  if (buffers_.size() < max_number_of_buffers_) {
+    buffers_.push_back(buffer);
+  }
+  return buffer;
+}
+
+scoped_refptr<EncodedImageBuffer> EncodedImageBufferPool::CreateBuffer(
+    const uint8_t* data,
+    size_t size) {
+  scoped_refptr<EncodedImageBuffer> buffer = CreateBuffer(size);
+  if (size > 0) {
+    memcpy(buffer->data(), data, size);
+  }
+  return buffer;
+}
+
+EncodedImageBufferPool::Stats EncodedImageBufferPool::GetStats() const {
+  return stats_;
+}
+
+void EncodedImageBufferPool::Release() {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  buffers_.clear();
+}
+
+}  // namespace webrtc
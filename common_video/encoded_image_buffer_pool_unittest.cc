@@ -0,0 +1,104 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/include/encoded_image_buffer_pool.h"
+
+#include <cstdint>
+
+#include "api/scoped_refptr.h"
+#include "api/video/encoded_image.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAre;
+
+TEST(EncodedImageBufferPoolTest, ReusesReleasedBuffer) {
+  EncodedImageBufferPool pool;
+  scoped_refptr<EncodedImageBuffer> buffer = pool.CreateBuffer(100);
+  EXPECT_EQ(buffer->size(), 100u);
+  const uint8_t* data = buffer->data();
+  buffer = nullptr;
+
+  buffer = pool.CreateBuffer(50);
+  EXPECT_EQ(buffer->size(), 50u);
+  EXPECT_EQ(buffer->data(), data);
+  EXPECT_EQ(pool.GetStats().num_requests, 2);
+  EXPECT_EQ(pool.GetStats().num_hits, 1);
+}
+
+TEST(EncodedImageBufferPoolTest, DoesNotReuseBufferInUse) {
+  EncodedImageBufferPool pool;
+  scoped_refptr<EncodedImageBuffer> buffer1 = pool.CreateBuffer(100);
+  scoped_refptr<EncodedImageBuffer> buffer2 = pool.CreateBuffer(100);
+  EXPECT_NE(buffer1->data(), buffer2->data());
+  EXPECT_EQ(pool.GetStats().num_hits, 0);
+}
+
+TEST(EncodedImageBufferPoolTest, PicksSmallestBufferThatFits) {
+  EncodedImageBufferPool pool;
+  scoped_refptr<EncodedImageBuffer> large = pool.CreateBuffer(10000);
+  scoped_refptr<EncodedImageBuffer> small = pool.CreateBuffer(100);
+  const uint8_t* large_data = large->data();
+  const uint8_t* small_data = small->data();
+  large = nullptr;
+  small = nullptr;
+
+  EXPECT_EQ(pool.CreateBuffer(80)->data(), small_data);
+  EXPECT_EQ(pool.CreateBuffer(5000)->data(), large_data);
+}
+
+TEST(EncodedImageBufferPoolTest, GrowsFreeBufferIfNoneFits) {
+  EncodedImageBufferPool pool;
+  pool.CreateBuffer(100);
+  scoped_refptr<EncodedImageBuffer> buffer = pool.CreateBuffer(1000);
+  EXPECT_EQ(buffer->size(), 1000u);
+  EXPECT_EQ(pool.GetStats().num_hits, 0);
+  const uint8_t* data = buffer->data();
+  buffer = nullptr;
+
+  EXPECT_EQ(pool.CreateBuffer(1000)->data(), data);
+  EXPECT_EQ(pool.GetStats().num_hits, 1);
+}
+
+TEST(EncodedImageBufferPoolTest, ReturnsUnpooledBufferWhenFull) {
+  EncodedImageBufferPool pool(/*max_number_of_buffers=*/1);
+  scoped_refptr<EncodedImageBuffer> pooled = pool.CreateBuffer(100);
+  scoped_refptr<EncodedImageBuffer> unpooled = pool.CreateBuffer(100);
+  ASSERT_TRUE(unpooled);
+  const uint8_t* pooled_data = pooled->data();
+  pooled = nullptr;
+  unpooled = nullptr;
+
+  EXPECT_EQ(pool.CreateBuffer(100)->data(), pooled_data);
+}
+
+TEST(EncodedImageBufferPoolTest, CopiesData) {
+  EncodedImageBufferPool pool;
+  const uint8_t kData[] = {1, 2, 3};
+  scoped_refptr<EncodedImageBuffer> buffer =
+      pool.CreateBuffer(kData, sizeof(kData));
+  EXPECT_THAT(*buffer, ElementsAre(1, 2, 3));
+}
+
+TEST(EncodedImageBufferPoolTest, BufferValidAfterPoolDestruction) {
+  scoped_refptr<EncodedImageBuffer> buffer;
+  {
+    EncodedImageBufferPool pool;
+    buffer = pool.CreateBuffer(3);
+  }
+  buffer->data()[2] = 7;
+  EXPECT_EQ(buffer->size(), 3u);
+}
+
+}  // namespace
+}  // namespace webrtc
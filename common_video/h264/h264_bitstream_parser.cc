@@ -341,8 +341,13 @@ void H264BitstreamParser::ParseSlice(ArrayView<const uint8_t> slice) {
 }
 
 void H264BitstreamParser::ParseBitstream(ArrayView<const uint8_t> bitstream) {
-  std::vector<H264::NaluIndex> nalu_indices = H264::FindNaluIndices(bitstream);
-  for (const H264::NaluIndex& index : nalu_indices)
+  ParseBitstream(bitstream, H264::FindNaluIndices(bitstream));
+}
+
+void H264BitstreamParser::ParseBitstream(
+    ArrayView<const uint8_t> bitstream,
+    ArrayView<const NaluIndex> nalu_indices) {
+  for (const NaluIndex& index : nalu_indices)
     ParseSlice(
         bitstream.subview(index.payload_start_offset, index.payload_size));
 }
@@ -15,6 +15,8 @@
 
 #include <optional>
 
+#include "api/array_view.h"
+#include "api/video/nalu_index.h"
 #include "api/video_codecs/bitstream_parser.h"
 #include "common_video/h264/pps_parser.h"
 #include "common_video/h264/sps_parser.h"
@@ -33,6 +35,10 @@ class H264BitstreamParser : public BitstreamParser {
   ~H264BitstreamParser() override;
 
   void ParseBitstream(ArrayView<const uint8_t> bitstream) override;
+  // Like ParseBitstream() above, but uses the already known positions of the
+  // NAL units of `bitstream` instead of searching for them.
+  void ParseBitstream(ArrayView<const uint8_t> bitstream,
+                      ArrayView<const NaluIndex> nalu_indices);
   std::optional<int> GetLastSliceQp() const override;
 
  protected:
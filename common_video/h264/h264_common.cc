@@ -10,7 +10,13 @@
 
 #include "common_video/h264/h264_common.h"
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/video/nalu_index.h"
+#include "common_video/h264/start_code_search.h"
 
 namespace webrtc {
 namespace H264 {
@@ -18,39 +24,27 @@ namespace H264 {
 const uint8_t kNaluTypeMask = 0x1F;
 
 std::vector<NaluIndex> FindNaluIndices(ArrayView<const uint8_t> buffer) {
-  // This is sorta like Boyer-Moore, but with only the first optimization step:
-  // given a 3-byte sequence we're looking at, if the 3rd byte isn't 1 or 0,
-  // skip ahead to the next 3-byte sequence. 0s and 1s are relatively rare, so
-  // this will skip the majority of reads/checks.
   std::vector<NaluIndex> sequences;
   if (buffer.size() < kNaluShortStartSequenceSize)
     return sequences;
 
-  static_assert(kNaluShortStartSequenceSize >= 2,
-                "kNaluShortStartSequenceSize must be larger or equals to 2");
-  const size_t end = buffer.size() - kNaluShortStartSequenceSize;
-  for (size_t i = 0; i < end;) {
-    if (buffer[i + 2] > 1) {
-      i += 3;
-    } else if (buffer[i + 2] == 1) {
-      if (buffer[i + 1] == 0 && buffer[i] == 0) {
-        // We found a start sequence, now check if it was a 3 of 4 byte one.
-        NaluIndex index = {i, i + 3, 0};
-        if (index.start_offset > 0 && buffer[index.start_offset - 1] == 0)
-          --index.start_offset;
-
-        // Update length of previous entry.
-        auto it = sequences.rbegin();
-        if (it != sequences.rend())
-          it->payload_size = index.start_offset - it->payload_start_offset;
-
-        sequences.push_back(index);
-      }
-
-      i += 3;
-    } else {
-      ++i;
-    }
+  // Only start codes followed by at least one byte are NALU starts.
+  const size_t end = buffer.size() - 1;
+  for (size_t i = FindStartCode(buffer.data(), end); i < end;) {
+    // We found a start sequence, now check if it was a 3 of 4 byte one.
+    NaluIndex index = {i, i + kNaluShortStartSequenceSize, 0};
+    if (index.start_offset > 0 && buffer[index.start_offset - 1] == 0)
+      --index.start_offset;
+
+    // Update length of previous entry.
+    auto it = sequences.rbegin();
+    if (it != sequences.rend())
+      it->payload_size = index.start_offset - it->payload_start_offset;
+
+    sequences.push_back(index);
+
+    i = index.payload_start_offset;
+    i += FindStartCode(buffer.data() + i, end - i);
   }
 
   // Update length of last entry, if any.
@@ -16,6 +16,8 @@
 
 #include <vector>
 
+#include "api/array_view.h"
+#include "api/video/nalu_index.h"
 #include "rtc_base/buffer.h"
 #include "rtc_base/system/rtc_export.h"
 
@@ -53,14 +55,7 @@ enum NaluType : uint8_t {
 
 enum SliceType : uint8_t { kP = 0, kB = 1, kI = 2, kSp = 3, kSi = 4 };
 
-struct NaluIndex {
-  // Start index of NALU, including start sequence.
-  size_t start_offset;
-  // Start index of NALU payload, typically type header.
-  size_t payload_start_offset;
-  // Length of NALU payload, in bytes, counting from payload_start_offset.
-  size_t payload_size;
-};
+using NaluIndex = ::webrtc::NaluIndex;
 
 // Returns a vector of the NALU indices in the given buffer.
 RTC_EXPORT std::vector<NaluIndex> FindNaluIndices(
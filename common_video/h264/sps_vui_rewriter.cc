@@ -17,11 +17,14 @@
 #include <cstdint>
 #include <vector>
 
+#include "api/array_view.h"
 #include "api/video/color_space.h"
+#include "api/video/nalu_index.h"
 #include "common_video/h264/h264_common.h"
 #include "common_video/h264/sps_parser.h"
 #include "rtc_base/bit_buffer.h"
 #include "rtc_base/bitstream_reader.h"
+#include "rtc_base/buffer.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 #include "system_wrappers/include/metrics.h"
@@ -82,6 +85,22 @@ uint32_t CopyBits(int bits,
   return tmp;
 }
 
+// Appends the NAL unit `nalu` preceded by `start_code` to `destination`, and
+// its position to `nalu_indices` if not null.
+void AppendNalu(ArrayView<const uint8_t> start_code,
+                ArrayView<const uint8_t> nalu,
+                Buffer& destination,
+                std::vector<NaluIndex>* nalu_indices) {
+  if (nalu_indices) {
+    nalu_indices->push_back({.start_offset = destination.size(),
+                             .payload_start_offset =
+                                 destination.size() + start_code.size(),
+                             .payload_size = nalu.size()});
+  }
+  destination.AppendData(start_code);
+  destination.AppendData(nalu);
+}
+
 bool CopyAndRewriteVui(const SpsParser::SpsState& sps,
                        BitstreamReader& source,
                        BitBufferWriter& destination,
@@ -222,13 +241,25 @@ SpsVuiRewriter::ParseResult SpsVuiRewriter::ParseAndRewriteSps(
 Buffer SpsVuiRewriter::ParseOutgoingBitstreamAndRewrite(
     ArrayView<const uint8_t> buffer,
     const webrtc::ColorSpace* color_space) {
-  std::vector<H264::NaluIndex> nalus = H264::FindNaluIndices(buffer);
+  return ParseOutgoingBitstreamAndRewrite(buffer, H264::FindNaluIndices(buffer),
+                                          color_space,
+                                          /*output_nalu_indices=*/nullptr);
+}
 
+Buffer SpsVuiRewriter::ParseOutgoingBitstreamAndRewrite(
+    ArrayView<const uint8_t> buffer,
+    ArrayView<const NaluIndex> nalus,
+    const webrtc::ColorSpace* color_space,
+    std::vector<NaluIndex>* output_nalu_indices) {
   // Allocate some extra space for potentially adding a missing VUI.
   Buffer output_buffer(/*size=*/0, /*capacity=*/buffer.size() +
                                        nalus.size() * kMaxVuiSpsIncrease);
+  if (output_nalu_indices) {
+    output_nalu_indices->clear();
+    output_nalu_indices->reserve(nalus.size());
+  }
 
-  for (const H264::NaluIndex& nalu_index : nalus) {
+  for (const NaluIndex& nalu_index : nalus) {
     // Copy NAL unit start code.
     ArrayView<const uint8_t> start_code = buffer.subview(
         nalu_index.start_offset,
@@ -261,8 +292,8 @@ Buffer SpsVuiRewriter::ParseOutgoingBitstreamAndRewrite(
           ParseAndRewriteSps(nalu.subview(H264::kNaluTypeSize), &sps,
                              color_space, &output_nalu, Direction::kOutgoing);
       if (result == ParseResult::kVuiRewritten) {
-        output_buffer.AppendData(start_code);
-        output_buffer.AppendData(output_nalu.data(), output_nalu.size());
+        AppendNalu(start_code, output_nalu, output_buffer,
+                   output_nalu_indices);
         continue;
       }
     } else if (H264::ParseNaluType(nalu[0]) == H264::NaluType::kAud) {
@@ -271,8 +302,7 @@ Buffer SpsVuiRewriter::ParseOutgoingBitstreamAndRewrite(
     }
 
     // vui wasn't rewritten and it is not aud, copy the nal unit as is.
-    output_buffer.AppendData(start_code);
-    output_buffer.AppendData(nalu);
+    AppendNalu(start_code, nalu, output_buffer, output_nalu_indices);
   }
   return output_buffer;
 }
@@ -16,8 +16,11 @@
 #include <stdint.h>
 
 #include <optional>
+#include <vector>
 
+#include "api/array_view.h"
 #include "api/video/color_space.h"
+#include "api/video/nalu_index.h"
 #include "common_video/h264/sps_parser.h"
 #include "rtc_base/buffer.h"
 
@@ -55,6 +58,15 @@ class SpsVuiRewriter : private SpsParser {
       ArrayView<const uint8_t> buffer,
       const ColorSpace* color_space);
 
+  // Like above, but uses the already known positions `nalu_indices` of the
+  // NAL units of `buffer`. If `output_nalu_indices` is not null, it is set to
+  // the positions of the NAL units of the returned buffer.
+  static Buffer ParseOutgoingBitstreamAndRewrite(
+      ArrayView<const uint8_t> buffer,
+      ArrayView<const NaluIndex> nalu_indices,
+      const ColorSpace* color_space,
+      std::vector<NaluIndex>* output_nalu_indices);
+
  private:
   static ParseResult ParseAndRewriteSps(ArrayView<const uint8_t> buffer,
                                         std::optional<SpsParser::SpsState>* sps,
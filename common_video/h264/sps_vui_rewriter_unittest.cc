@@ -10,10 +10,12 @@
 
 #include "common_video/h264/sps_vui_rewriter.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
 #include "api/video/color_space.h"
+#include "api/video/nalu_index.h"
 #include "common_video/h264/h264_common.h"
 #include "rtc_base/bit_buffer.h"
 #include "rtc_base/buffer.h"
@@ -437,6 +439,33 @@ TEST(SpsVuiRewriterOutgoingVuiTest, ParseOutgoingBitstreamNoVui) {
               ::testing::ElementsAreArray(expected_buffer));
 }
 
+TEST(SpsVuiRewriterOutgoingVuiTest, ReportsNaluIndicesOfRewrittenBitstream) {
+  Buffer sps;
+  GenerateFakeSps(kVuiNotPresent, &sps);
+
+  Buffer buffer;
+  buffer.AppendData(kStartSequence);
+  buffer.AppendData(kAud);
+  buffer.AppendData(kStartSequence);
+  buffer.AppendData(kSpsNaluType);
+  buffer.AppendData(sps);
+  buffer.AppendData(kStartSequence);
+  buffer.AppendData(kIdr1);
+
+  std::vector<NaluIndex> nalu_indices;
+  Buffer rewritten = SpsVuiRewriter::ParseOutgoingBitstreamAndRewrite(
+      buffer, H264::FindNaluIndices(buffer), nullptr, &nalu_indices);
+
+  std::vector<NaluIndex> expected = H264::FindNaluIndices(rewritten);
+  ASSERT_EQ(nalu_indices.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(nalu_indices[i].start_offset, expected[i].start_offset);
+    EXPECT_EQ(nalu_indices[i].payload_start_offset,
+              expected[i].payload_start_offset);
+    EXPECT_EQ(nalu_indices[i].payload_size, expected[i].payload_size);
+  }
+}
+
 TEST(SpsVuiRewriterOutgoingAudTest, ParseOutgoingBitstreamWithAud) {
   LogMessage::LogToDebug(LS_VERBOSE);
 
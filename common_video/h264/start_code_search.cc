@@ -0,0 +1,88 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/h264/start_code_search.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include "common_video/h264/start_code_search_neon.h"
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+#include "common_video/h264/start_code_search_avx2.h"
+#include "common_video/h264/start_code_search_sse2.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#endif
+
+namespace webrtc {
+namespace H264 {
+namespace {
+
+// Scans a prefix of the data with vector instructions, see
+// start_code_search_sse2.h.
+using ScanForStartCodeFunction = size_t (*)(const uint8_t*, size_t);
+
+// Returns nullptr if the running CPU has no supported vector instructions.
+ScanForStartCodeFunction SelectScanForStartCode() {
+#if defined(WEBRTC_HAS_NEON)
+  return &ScanForStartCodeNeon;
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+  if (GetCPUInfo(kAVX2)) {
+    return &ScanForStartCodeAvx2;
+  }
+  if (GetCPUInfo(kSSE2)) {
+    return &ScanForStartCodeSse2;
+  }
+  return nullptr;
+#else
+  return nullptr;
+#endif
+}
+
+}  // namespace
+
+size_t FindStartCode(const uint8_t* data, size_t size) {
+  // CPU detection is done once; the function-local static is initialized in
+  // a thread-safe manner.
+  static const ScanForStartCodeFunction scan_for_start_code =
+      SelectScanForStartCode();
+  // The vector scan stops at the first start code, or before the tail that is
+  // too short for a full block. Either way the generic search finishes from
+  // there; it returns right away if a start code begins at `offset`.
+  const size_t offset =
+      scan_for_start_code ? scan_for_start_code(data, size) : 0;
+  return offset + FindStartCodeGeneric(data + offset, size - offset);
+}
+
+size_t FindStartCodeGeneric(const uint8_t* data, size_t size) {
+  // This is sorta like Boyer-Moore, but with only the first optimization step:
+  // given a 3-byte sequence we're looking at, if the 3rd byte isn't 1 or 0,
+  // skip ahead to the next 3-byte sequence. 0s and 1s are relatively rare, so
+  // this will skip the majority of reads/checks.
+  size_t i = 0;
+  while (i + 3 <= size) {
+    if (data[i + 2] > 1) {
+      i += 3;
+    } else if (data[i + 2] == 1) {
+      if (data[i + 1] == 0 && data[i] == 0) {
+        return i;
+      }
+      i += 3;
+    } else {
+      ++i;
+    }
+  }
+  return size;
+}
+
+}  // namespace H264
+}  // namespace webrtc
@@ -0,0 +1,31 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_VIDEO_H264_START_CODE_SEARCH_H_
+#define COMMON_VIDEO_H264_START_CODE_SEARCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace webrtc {
+namespace H264 {
+
+// Returns the offset of the first three byte start code {0 0 1} that lies
+// entirely within the `size` bytes at `data`, or `size` if there is none.
+// Uses the widest vector instruction set available on the running CPU.
+size_t FindStartCode(const uint8_t* data, size_t size);
+
+// Portable implementation, exposed for testing and benchmarking.
+size_t FindStartCodeGeneric(const uint8_t* data, size_t size);
+
+}  // namespace H264
+}  // namespace webrtc
+
+#endif  // COMMON_VIDEO_H264_START_CODE_SEARCH_H_
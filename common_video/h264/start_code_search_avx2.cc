@@ -0,0 +1,51 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/h264/start_code_search_avx2.h"
+
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/numeric/bits.h"
+
+namespace webrtc {
+namespace H264 {
+
+size_t ScanForStartCodeAvx2(const uint8_t* data, size_t size) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i one = _mm256_set1_epi8(1);
+  size_t i = 0;
+  // Each iteration tests the 32 start code candidates beginning at `i`. Most
+  // blocks have no two adjacent zero bytes, so the third byte is only tested
+  // once a candidate is found.
+  for (; i + 34 <= size; i += 32) {
+    const __m256i b0 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    const __m256i b1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 1));
+    const __m256i zeros = _mm256_and_si256(_mm256_cmpeq_epi8(b0, zero),
+                                           _mm256_cmpeq_epi8(b1, zero));
+    if (_mm256_testz_si256(zeros, zeros)) {
+      continue;
+    }
+    const __m256i b2 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 2));
+    const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+        _mm256_and_si256(zeros, _mm256_cmpeq_epi8(b2, one))));
+    if (mask != 0) {
+      return i + absl::countr_zero(mask);
+    }
+  }
+  return i;
+}
+
+}  // namespace H264
+}  // namespace webrtc
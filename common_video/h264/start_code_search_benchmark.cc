@@ -0,0 +1,104 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "api/video/nalu_index.h"
+#include "benchmark/benchmark.h"
+#include "common_video/h264/h264_common.h"
+#include "common_video/h264/start_code_search.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace {
+
+// A 4K key frame is typically split into one slice per row of macroblocks or
+// a few large slices; 1.5 MB in 68 slices approximates a high quality 2160p
+// IDR picture.
+constexpr size_t kKeyFrameSize = 1'500'000;
+constexpr size_t kNumSlices = 68;
+
+// Builds an Annex B access unit of SPS, PPS and `kNumSlices` IDR slices with
+// random, emulation prevented payloads.
+std::vector<uint8_t> CreateKeyFrame() {
+  Random random(0x4b);
+  std::vector<uint8_t> frame;
+  frame.reserve(kKeyFrameSize);
+  auto append_nalu = [&](uint8_t header, size_t payload_size) {
+    frame.insert(frame.end(), {0, 0, 0, 1, header});
+    int zeros = 0;
+    for (size_t i = 0; i < payload_size; ++i) {
+      uint8_t byte = random.Rand<uint8_t>();
+      if (zeros == 2 && byte <= 3) {
+        frame.push_back(3);
+        zeros = 0;
+      }
+      frame.push_back(byte);
+      zeros = byte == 0 ? zeros + 1 : 0;
+    }
+    // Keeps the next start code from extending the payload.
+    if (frame.back() == 0) {
+      frame.push_back(0x80);
+    }
+  };
+  append_nalu(0x67, 16);
+  append_nalu(0x68, 4);
+  for (size_t i = 0; i < kNumSlices; ++i) {
+    append_nalu(0x65, kKeyFrameSize / kNumSlices);
+  }
+  return frame;
+}
+
+void BM_FindStartCodeGeneric(benchmark::State& state) {
+  const std::vector<uint8_t> frame = CreateKeyFrame();
+  for (auto _ : state) {
+    size_t offset = 0;
+    while (offset < frame.size()) {
+      offset += H264::FindStartCodeGeneric(frame.data() + offset,
+                                           frame.size() - offset) +
+                1;
+    }
+    benchmark::DoNotOptimize(offset);
+  }
+  state.SetBytesProcessed(state.iterations() * frame.size());
+}
+BENCHMARK(BM_FindStartCodeGeneric);
+
+void BM_FindStartCode(benchmark::State& state) {
+  const std::vector<uint8_t> frame = CreateKeyFrame();
+  for (auto _ : state) {
+    size_t offset = 0;
+    while (offset < frame.size()) {
+      offset +=
+          H264::FindStartCode(frame.data() + offset, frame.size() - offset) +
+          1;
+    }
+    benchmark::DoNotOptimize(offset);
+  }
+  state.SetBytesProcessed(state.iterations() * frame.size());
+}
+BENCHMARK(BM_FindStartCode);
+
+void BM_FindNaluIndices(benchmark::State& state) {
+  const std::vector<uint8_t> frame = CreateKeyFrame();
+  for (auto _ : state) {
+    std::vector<NaluIndex> nalus = H264::FindNaluIndices(frame);
+    RTC_CHECK_EQ(nalus.size(), kNumSlices + 2);
+    benchmark::DoNotOptimize(nalus.data());
+  }
+  state.SetBytesProcessed(state.iterations() * frame.size());
+}
+BENCHMARK(BM_FindNaluIndices);
+
+}  // namespace
+}  // namespace webrtc
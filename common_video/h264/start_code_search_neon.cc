@@ -0,0 +1,44 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/h264/start_code_search_neon.h"
+
+#include <arm_neon.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/numeric/bits.h"
+
+namespace webrtc {
+namespace H264 {
+
+size_t ScanForStartCodeNeon(const uint8_t* data, size_t size) {
+  const uint8x16_t zero = vdupq_n_u8(0);
+  const uint8x16_t one = vdupq_n_u8(1);
+  size_t i = 0;
+  // Each iteration tests the 16 start code candidates beginning at `i`.
+  for (; i + 18 <= size; i += 16) {
+    uint8x16_t matches =
+        vandq_u8(vandq_u8(vceqq_u8(vld1q_u8(data + i), zero),
+                          vceqq_u8(vld1q_u8(data + i + 1), zero)),
+                 vceqq_u8(vld1q_u8(data + i + 2), one));
+    // Narrows each 0x00 or 0xff byte lane to a nibble, so that the first
+    // match is found by counting the trailing zero bits of a 64-bit mask.
+    const uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+    if (mask != 0) {
+      return i + absl::countr_zero(mask) / 4;
+    }
+  }
+  return i;
+}
+
+}  // namespace H264
+}  // namespace webrtc
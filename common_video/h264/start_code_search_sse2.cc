@@ -0,0 +1,51 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/h264/start_code_search_sse2.h"
+
+#include <emmintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/numeric/bits.h"
+
+namespace webrtc {
+namespace H264 {
+
+size_t ScanForStartCodeSse2(const uint8_t* data, size_t size) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i one = _mm_set1_epi8(1);
+  size_t i = 0;
+  // Each iteration tests the 16 start code candidates beginning at `i`. Most
+  // blocks have no two adjacent zero bytes, so the third byte is only tested
+  // once a candidate is found.
+  for (; i + 18 <= size; i += 16) {
+    const __m128i b0 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const __m128i b1 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 1));
+    const __m128i zeros =
+        _mm_and_si128(_mm_cmpeq_epi8(b0, zero), _mm_cmpeq_epi8(b1, zero));
+    if (_mm_movemask_epi8(zeros) == 0) {
+      continue;
+    }
+    const __m128i b2 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 2));
+    const uint32_t mask = static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_and_si128(zeros, _mm_cmpeq_epi8(b2, one))));
+    if (mask != 0) {
+      return i + absl::countr_zero(mask);
+    }
+  }
+  return i;
+}
+
+}  // namespace H264
+}  // namespace webrtc
@@ -0,0 +1,29 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_VIDEO_H264_START_CODE_SEARCH_SSE2_H_
+#define COMMON_VIDEO_H264_START_CODE_SEARCH_SSE2_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace webrtc {
+namespace H264 {
+
+// SSE2 part of `FindStartCode`, see start_code_search.h. Tests the start code
+// candidates in blocks of 16 and returns the offset of the first start code
+// found, or else of the first candidate it did not test. No start code begins
+// before the returned offset; FindStartCode() scans the rest.
+size_t ScanForStartCodeSse2(const uint8_t* data, size_t size);
+
+}  // namespace H264
+}  // namespace webrtc
+
+#endif  // COMMON_VIDEO_H264_START_CODE_SEARCH_SSE2_H_
@@ -0,0 +1,123 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/h264/start_code_search.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common_video/h264/h264_common.h"
+#include "rtc_base/random.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace H264 {
+namespace {
+
+// Bytes in [0, 2], so that start codes are frequent.
+std::vector<uint8_t> RandomBytes(Random& random, size_t size) {
+  std::vector<uint8_t> bytes(size);
+  for (uint8_t& byte : bytes) {
+    byte = random.Rand(2);
+  }
+  return bytes;
+}
+
+size_t ReferenceFindStartCode(const uint8_t* data, size_t size) {
+  for (size_t i = 0; i + 3 <= size; ++i) {
+    if (data[i] == 0 && data[i + 1] == 0 && data[i + 2] == 1) {
+      return i;
+    }
+  }
+  return size;
+}
+
+class StartCodeSearchTest : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(StartCodeSearchTest, GenericMatchesReference) {
+  Random random(0x1234);
+  const size_t size = GetParam();
+  for (int run = 0; run < 100; ++run) {
+    std::vector<uint8_t> data = RandomBytes(random, size);
+    for (size_t offset = 0; offset < size; offset += 7) {
+      EXPECT_EQ(FindStartCodeGeneric(data.data() + offset, size - offset),
+                ReferenceFindStartCode(data.data() + offset, size - offset));
+    }
+  }
+}
+
+TEST_P(StartCodeSearchTest, DispatchedMatchesReference) {
+  Random random(0x5678);
+  const size_t size = GetParam();
+  for (int run = 0; run < 100; ++run) {
+    std::vector<uint8_t> data = RandomBytes(random, size);
+    for (size_t offset = 0; offset < size; offset += 7) {
+      EXPECT_EQ(FindStartCode(data.data() + offset, size - offset),
+                ReferenceFindStartCode(data.data() + offset, size - offset));
+    }
+  }
+}
+
+TEST_P(StartCodeSearchTest, FindsStartCodeAtEveryPosition) {
+  const size_t size = GetParam();
+  for (size_t position = 0; position + 3 <= size; ++position) {
+    std::vector<uint8_t> data(size, 0xff);
+    data[position] = 0;
+    data[position + 1] = 0;
+    data[position + 2] = 1;
+    EXPECT_EQ(FindStartCode(data.data(), size), position);
+    // A start code cut by the end of the range is not found.
+    EXPECT_EQ(FindStartCode(data.data(), position + 2), position + 2);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Sizes,
+                         StartCodeSearchTest,
+                         ::testing::Values(0, 1, 2, 3, 15, 16, 17, 18, 19, 33,
+                                           34, 35, 64, 100, 1000));
+
+TEST(StartCodeSearchTest, ReturnsSizeWithoutStartCode) {
+  std::vector<uint8_t> data(1000, 0);
+  EXPECT_EQ(FindStartCode(data.data(), data.size()), data.size());
+  data[500] = 1;
+  EXPECT_EQ(FindStartCode(data.data(), data.size()), 498u);
+}
+
+TEST(FindNaluIndicesTest, FindsShortAndLongStartCodes) {
+  const uint8_t kBuffer[] = {
+      0, 0, 0, 1, 0x67, 0xaa,       // SPS with a long start code.
+      0, 0, 1, 0x68, 0xbb,          // PPS with a short start code.
+      0, 0, 0, 1, 0x65, 0xcc, 0xdd  // IDR slice.
+  };
+  std::vector<NaluIndex> nalus = FindNaluIndices(kBuffer);
+  ASSERT_EQ(nalus.size(), 3u);
+  EXPECT_EQ(nalus[0].start_offset, 0u);
+  EXPECT_EQ(nalus[0].payload_start_offset, 4u);
+  EXPECT_EQ(nalus[0].payload_size, 2u);
+  EXPECT_EQ(nalus[1].start_offset, 6u);
+  EXPECT_EQ(nalus[1].payload_start_offset, 9u);
+  EXPECT_EQ(nalus[1].payload_size, 2u);
+  EXPECT_EQ(nalus[2].start_offset, 11u);
+  EXPECT_EQ(nalus[2].payload_start_offset, 15u);
+  EXPECT_EQ(nalus[2].payload_size, 3u);
+}
+
+TEST(FindNaluIndicesTest, IgnoresStartCodeWithoutPayload) {
+  const uint8_t kBuffer[] = {0, 0, 1, 0x41, 0, 0, 1};
+  std::vector<NaluIndex> nalus = FindNaluIndices(kBuffer);
+  ASSERT_EQ(nalus.size(), 1u);
+  EXPECT_EQ(nalus[0].payload_start_offset, 3u);
+  EXPECT_EQ(nalus[0].payload_size, 4u);
+}
+
+}  // namespace
+}  // namespace H264
+}  // namespace webrtc
@@ -640,9 +640,14 @@ std::optional<bool> H265BitstreamParser::IsFirstSliceSegmentInPic(
 }
 
 void H265BitstreamParser::ParseBitstream(ArrayView<const uint8_t> bitstream) {
+  ParseBitstream(bitstream, H265::FindNaluIndices(bitstream));
+}
+
+void H265BitstreamParser::ParseBitstream(
+    ArrayView<const uint8_t> bitstream,
+    ArrayView<const NaluIndex> nalu_indices) {
   lastHasBadRbsp_ = false;
-  std::vector<H265::NaluIndex> nalu_indices = H265::FindNaluIndices(bitstream);
-  for (const H265::NaluIndex& index : nalu_indices)
+  for (const NaluIndex& index : nalu_indices)
     ParseSlice(
         bitstream.subview(index.payload_start_offset, index.payload_size));
 }
@@ -17,6 +17,8 @@
 #include <optional>
 #include <vector>
 
+#include "api/array_view.h"
+#include "api/video/nalu_index.h"
 #include "api/video_codecs/bitstream_parser.h"
 #include "common_video/h265/h265_pps_parser.h"
 #include "common_video/h265/h265_sps_parser.h"
@@ -35,6 +37,10 @@ class RTC_EXPORT H265BitstreamParser : public BitstreamParser {
 
   // New interface.
   void ParseBitstream(ArrayView<const uint8_t> bitstream) override;
+  // Like ParseBitstream() above, but uses the already known positions of the
+  // NAL units of `bitstream` instead of searching for them.
+  void ParseBitstream(ArrayView<const uint8_t> bitstream,
+                      ArrayView<const NaluIndex> nalu_indices);
   std::optional<int> GetLastSliceQp() const override;
 
   std::optional<uint32_t> GetLastSlicePpsId() const;
@@ -14,6 +14,7 @@
 #include <memory>
 #include <vector>
 
+#include "api/video/nalu_index.h"
 #include "common_video/h265/h265_inline.h"
 #include "rtc_base/buffer.h"
 #include "rtc_base/system/rtc_export.h"
@@ -70,14 +71,7 @@ enum NaluType : uint8_t {
 // Slice type definition. See table 7-7 of the H.265 spec
 enum SliceType : uint8_t { kB = 0, kP = 1, kI = 2 };
 
-struct NaluIndex {
-  // Start index of NALU, including start sequence.
-  size_t start_offset = 0;
-  // Start index of NALU payload, typically type header.
-  size_t payload_start_offset = 0;
-  // Length of NALU payload, in bytes, counting from payload_start_offset.
-  size_t payload_size = 0;
-};
+using NaluIndex = ::webrtc::NaluIndex;
 
 // Returns a vector of the NALU indices in the given buffer.
 RTC_EXPORT std::vector<NaluIndex> FindNaluIndices(
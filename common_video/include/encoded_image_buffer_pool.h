@@ -0,0 +1,71 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_VIDEO_INCLUDE_ENCODED_IMAGE_BUFFER_POOL_H_
+#define COMMON_VIDEO_INCLUDE_ENCODED_IMAGE_BUFFER_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+
+#include "api/scoped_refptr.h"
+#include "api/video/encoded_image.h"
+#include "rtc_base/race_checker.h"
+
+namespace webrtc {
+
+// Buffer pool for the output of video encoders, to avoid allocating an
+// EncodedImageBuffer for every encoded frame. A buffer returned from
+// CreateBuffer() goes back to the pool when the last reference to it is
+// released, e.g. by the packetizer or a frame transformer, which may happen
+// on any thread.
+//
+// CreateBuffer() returns the free buffer with the smallest capacity that fits
+// the requested size, so that key frame sized buffers are not used for delta
+// frames while smaller ones are available. If no free buffer fits, the
+// largest free one is grown. If all buffers are in use and the pool is full,
+// an unpooled buffer is returned.
+class EncodedImageBufferPool {
+ public:
+  static constexpr size_t kDefaultMaxNumberOfBuffers = 8;
+
+  struct Stats {
+    // Number of buffers returned by CreateBuffer().
+    int num_requests = 0;
+    // Number of those that reused a pooled buffer without allocating.
+    int num_hits = 0;
+  };
+
+  EncodedImageBufferPool();
+  explicit EncodedImageBufferPool(size_t max_number_of_buffers);
+  ~EncodedImageBufferPool();
+
+  // Returns a buffer of `size` bytes with undefined content.
+  scoped_refptr<EncodedImageBuffer> CreateBuffer(size_t size);
+  // Returns a buffer holding a copy of `data`.
+  scoped_refptr<EncodedImageBuffer> CreateBuffer(const uint8_t* data,
+                                                 size_t size);
+
+  Stats GetStats() const;
+
+  // Drops the pooled buffers, e.g. when the encoder is released. Buffers still
+  // in use are freed with their last reference.
+  void Release();
+
+ private:
+  RaceChecker race_checker_;
+  const size_t max_number_of_buffers_;
+  std::list<scoped_refptr<EncodedImageBuffer>> buffers_;
+  Stats stats_;
+};
+
+}  // namespace webrtc
+
+#endif  // COMMON_VIDEO_INCLUDE_ENCODED_IMAGE_BUFFER_POOL_H_
@@ -0,0 +1,66 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_VIDEO_INCLUDE_VIDEO_FRAME_PYRAMID_H_
+#define COMMON_VIDEO_INCLUDE_VIDEO_FRAME_PYRAMID_H_
+
+#include <memory>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/scoped_refptr.h"
+#include "api/video/resolution.h"
+#include "api/video/video_frame_buffer.h"
+#include "common_video/include/video_frame_buffer_pool.h"
+#include "rtc_base/race_checker.h"
+
+namespace webrtc {
+
+// Builds all the downscaled resolutions of a frame that e.g. the layers of a
+// simulcast encoder need, in one pass over the source. Each resolution is
+// scaled from the next larger one instead of from the source, and resolutions
+// that are exactly half of the next larger one are produced band by band so
+// that the rows they are scaled from are still in cache. The scaled buffers
+// come from one VideoFrameBufferPool per resolution, so building the pyramid
+// does not allocate once the pools are warm.
+//
+// I420 and NV12 frames are scaled, into buffers of the same format. NV12
+// levels are each scaled from the next larger one but not band by band. Other
+// frames are returned as they are and are expected to be scaled with
+// VideoFrameBuffer::Scale() by the consumer.
+class VideoFramePyramid {
+ public:
+  VideoFramePyramid();
+  ~VideoFramePyramid();
+
+  // Sets the resolutions to build for subsequent frames. Resolutions that are
+  // not smaller than the frame are not built.
+  void SetResolutions(ArrayView<const Resolution> resolutions);
+
+  // Returns a buffer with the content of `buffer` on which
+  // VideoFrameBuffer::GetPrescaledBuffer() returns each of the resolutions
+  // that could be built, and Scale() to such a resolution does not scale.
+  // Returns `buffer` itself if there is nothing to build.
+  scoped_refptr<VideoFrameBuffer> Build(scoped_refptr<VideoFrameBuffer> buffer);
+
+ private:
+  struct Level {
+    Resolution resolution;
+    VideoFrameBufferPool pool;
+  };
+
+  RaceChecker race_checker_;
+  // Ordered from largest to smallest.
+  std::vector<std::unique_ptr<Level>> levels_;
+};
+
+}  // namespace webrtc
+
+#endif  // COMMON_VIDEO_INCLUDE_VIDEO_FRAME_PYRAMID_H_
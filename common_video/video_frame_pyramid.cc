@@ -0,0 +1,339 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/include/video_frame_pyramid.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/algorithm/container.h"
+#include "api/array_view.h"
+#include "api/make_ref_counted.h"
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/nv12_buffer.h"
+#include "api/video/resolution.h"
+#include "api/video/video_frame_buffer.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/race_checker.h"
+#include "third_party/libyuv/include/libyuv/scale.h"
+
+namespace webrtc {
+namespace {
+
+// Number of source rows scaled per band. Each halving level halves the band,
+// so this limits the number of levels that can be built band by band.
+constexpr int kBandHeight = 32;
+constexpr size_t kMaxHalvedLevels = 5;
+static_assert(kBandHeight == 1 << kMaxHalvedLevels);
+
+struct DestinationPlane {
+  uint8_t* data;
+  int stride;
+  int width;
+};
+
+// Scales the source plane down by half into `destinations[0]`, that one down
+// by half into `destinations[1]` and so on, one band of source rows at a time.
+// Each level must be exactly half the size of the previous one, which makes
+// the result identical to scaling whole planes.
+void HalvePlaneInBands(const uint8_t* source,
+                       int source_stride,
+                       int source_width,
+                       int source_height,
+                       ArrayView<const DestinationPlane> destinations) {
+  RTC_DCHECK_LE(destinations.size(), kMaxHalvedLevels);
+  for (int band_row = 0; band_row < source_height; band_row += kBandHeight) {
+    const uint8_t* from = source + band_row * source_stride;
+    int from_stride = source_stride;
+    int from_width = source_width;
+    int row = band_row;
+    int rows = std::min(kBandHeight, source_height - band_row);
+    for (const DestinationPlane& to : destinations) {
+      RTC_DCHECK_EQ(rows % 2, 0);
+      row /= 2;
+      rows /= 2;
+      uint8_t* to_data = to.data + row * to.stride;
+      libyuv::ScalePlane(from, from_stride, from_width, 2 * rows, to_data,
+                         to.stride, to.width, rows, libyuv::kFilterBox);
+      from = to_data;
+      from_stride = to.stride;
+      from_width = to.width;
+    }
+  }
+}
+
+bool IsHalfOf(const I420BufferInterface& buffer,
+              const I420BufferInterface& source) {
+  return 2 * buffer.width() == source.width() &&
+         2 * buffer.height() == source.height() &&
+         2 * buffer.ChromaWidth() == source.ChromaWidth() &&
+         2 * buffer.ChromaHeight() == source.ChromaHeight();
+}
+
+// Scales `source` into `scaled`, which is ordered from largest to smallest.
+void ScaleLevels(const I420BufferInterface& source,
+                 ArrayView<const scoped_refptr<I420Buffer>> scaled) {
+  size_t num_halved = 0;
+  const I420BufferInterface* parent = &source;
+  while (num_halved < scaled.size() && num_halved < kMaxHalvedLevels &&
+         IsHalfOf(*scaled[num_halved], *parent)) {
+    parent = scaled[num_halved].get();
+    ++num_halved;
+  }
+
+  if (num_halved > 0) {
+    std::array<DestinationPlane, kMaxHalvedLevels> y;
+    std::array<DestinationPlane, kMaxHalvedLevels> u;
+    std::array<DestinationPlane, kMaxHalvedLevels> v;
+    for (size_t i = 0; i < num_halved; ++i) {
+      I420Buffer& level = *scaled[i];
+      y[i] = {level.MutableDataY(), level.StrideY(), level.width()};
+      u[i] = {level.MutableDataU(), level.StrideU(), level.ChromaWidth()};
+      v[i] = {level.MutableDataV(), level.StrideV(), level.ChromaWidth()};
+    }
+    ArrayView<const DestinationPlane> y_levels(y.data(), num_halved);
+    ArrayView<const DestinationPlane> u_levels(u.data(), num_halved);
+    ArrayView<const DestinationPlane> v_levels(v.data(), num_halved);
+    HalvePlaneInBands(source.DataY(), source.StrideY(), source.width(),
+                      source.height(), y_levels);
+    HalvePlaneInBands(source.DataU(), source.StrideU(), source.ChromaWidth(),
+                      source.ChromaHeight(), u_levels);
+    HalvePlaneInBands(source.DataV(), source.StrideV(), source.ChromaWidth(),
+                      source.ChromaHeight(), v_levels);
+  }
+
+  // Remaining levels are scaled from the smallest level built so far that is
+  // at least as large in both dimensions.
+  for (size_t i = num_halved; i < scaled.size(); ++i) {
+    if (scaled[i]->width() > parent->width() ||
+        scaled[i]->height() > parent->height()) {
+      parent = &source;
+    }
+    scaled[i]->ScaleFrom(*parent);
+    parent = scaled[i].get();
+  }
+}
+
+// Scales `source` into `scaled`, which is ordered from largest to smallest.
+// Each level is scaled from the smallest level built so far that is at least
+// as large in both dimensions.
+void ScaleNV12Levels(const NV12BufferInterface& source,
+                     ArrayView<const scoped_refptr<NV12Buffer>> scaled) {
+  const NV12BufferInterface* parent = &source;
+  for (const scoped_refptr<NV12Buffer>& level : scaled) {
+    if (level->width() > parent->width() ||
+        level->height() > parent->height()) {
+      parent = &source;
+    }
+    level->CropAndScaleFrom(*parent, 0, 0, parent->width(), parent->height());
+    parent = level.get();
+  }
+}
+
+template <typename BufferT>
+scoped_refptr<VideoFrameBuffer> FindScaled(
+    const std::vector<scoped_refptr<BufferT>>& scaled,
+    int width,
+    int height) {
+  for (const scoped_refptr<BufferT>& buffer : scaled) {
+    if (buffer->width() == width && buffer->height() == height) {
+      return buffer;
+    }
+  }
+  return nullptr;
+}
+
+// An I420 buffer that also holds downscaled versions of itself.
+class PrescaledI420Buffer : public I420BufferInterface {
+ public:
+  PrescaledI420Buffer(scoped_refptr<I420BufferInterface> source,
+                      std::vector<scoped_refptr<I420Buffer>> scaled)
+      : source_(std::move(source)), scaled_(std::move(scaled)) {}
+
+  int width() const override { return source_->width(); }
+  int height() const override { return source_->height(); }
+  const uint8_t* DataY() const override { return source_->DataY(); }
+  const uint8_t* DataU() const override { return source_->DataU(); }
+  const uint8_t* DataV() const override { return source_->DataV(); }
+  int StrideY() const override { return source_->StrideY(); }
+  int StrideU() const override { return source_->StrideU(); }
+  int StrideV() const override { return source_->StrideV(); }
+
+  scoped_refptr<VideoFrameBuffer> CropAndScale(int offset_x,
+                                               int offset_y,
+                                               int crop_width,
+                                               int crop_height,
+                                               int scaled_width,
+                                               int scaled_height) override {
+    if (offset_x == 0 && offset_y == 0 && crop_width == width() &&
+        crop_height == height()) {
+      scoped_refptr<VideoFrameBuffer> prescaled =
+          GetPrescaledBuffer(scaled_width, scaled_height);
+      if (prescaled) {
+        return prescaled;
+      }
+    }
+    return source_->CropAndScale(offset_x, offset_y, crop_width, crop_height,
+                                 scaled_width, scaled_height);
+  }
+
+  scoped_refptr<VideoFrameBuffer> GetPrescaledBuffer(
+      int scaled_width,
+      int scaled_height) override {
+    return FindScaled(scaled_, scaled_width, scaled_height);
+  }
+
+ private:
+  const scoped_refptr<I420BufferInterface> source_;
+  const std::vector<scoped_refptr<I420Buffer>> scaled_;
+};
+
+// An NV12 buffer that also holds downscaled versions of itself, so that NV12
+// input stays NV12 all the way to encoders that accept it.
+class PrescaledNV12Buffer : public NV12BufferInterface {
+ public:
+  PrescaledNV12Buffer(scoped_refptr<VideoFrameBuffer> source,
+                      std::vector<scoped_refptr<NV12Buffer>> scaled)
+      : source_(std::move(source)),
+        nv12_(source_->GetNV12()),
+        scaled_(std::move(scaled)) {}
+
+  int width() const override { return nv12_->width(); }
+  int height() const override { return nv12_->height(); }
+  const uint8_t* DataY() const override { return nv12_->DataY(); }
+  const uint8_t* DataUV() const override { return nv12_->DataUV(); }
+  int StrideY() const override { return nv12_->StrideY(); }
+  int StrideUV() const override { return nv12_->StrideUV(); }
+
+  scoped_refptr<I420BufferInterface> ToI420() override {
+    return source_->ToI420();
+  }
+
+  scoped_refptr<VideoFrameBuffer> CropAndScale(int offset_x,
+                                               int offset_y,
+                                               int crop_width,
+                                               int crop_height,
+                                               int scaled_width,
+                                               int scaled_height) override {
+    if (offset_x == 0 && offset_y == 0 && crop_width == width() &&
+        crop_height == height()) {
+      scoped_refptr<VideoFrameBuffer> prescaled =
+          GetPrescaledBuffer(scaled_width, scaled_height);
+      if (prescaled) {
+        return prescaled;
+      }
+    }
+    return source_->CropAndScale(offset_x, offset_y, crop_width, crop_height,
+                                 scaled_width, scaled_height);
+  }
+
+  scoped_refptr<VideoFrameBuffer> GetPrescaledBuffer(
+      int scaled_width,
+      int scaled_height) override {
+    return FindScaled(scaled_, scaled_width, scaled_height);
+  }
+
+ private:
+  const scoped_refptr<VideoFrameBuffer> source_;
+  const NV12BufferInterface* const nv12_;
+  const std::vector<scoped_refptr<NV12Buffer>> scaled_;
+};
+
+}  // namespace
+
+VideoFramePyramid::VideoFramePyramid() = default;
+
+VideoFramePyramid::~VideoFramePyramid() = default;
+
+void VideoFramePyramid::SetResolutions(
+    ArrayView<const Resolution> resolutions) {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  std::vector<Resolution> sorted(resolutions.begin(), resolutions.end());
+  absl::c_sort(sorted, [](const Resolution& a, const Resolution& b) {
+    return a.PixelCount() > b.PixelCount();
+  });
+  sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+  // Keep the pools, and the buffers in them, if nothing changed.
+  if (absl::c_equal(sorted, levels_,
+                    [](const Resolution& resolution,
+                       const std::unique_ptr<Level>& level) {
+                      return resolution == level->resolution;
+                    })) {
+    return;
+  }
+  levels_.clear();
+  for (const Resolution& resolution : sorted) {
+    auto level = std::make_unique<Level>();
+    level->resolution = resolution;
+    levels_.push_back(std::move(level));
+  }
+}
+
+scoped_refptr<VideoFrameBuffer> VideoFramePyramid::Build(
+    scoped_refptr<VideoFrameBuffer> buffer) {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  VideoFrameBuffer::Type type = buffer->type();
+  if (levels_.empty() || (type != VideoFrameBuffer::Type::kI420 &&
+                          type != VideoFrameBuffer::Type::kNV12)) {
+    return buffer;
+  }
+  std::vector<Level*> levels;
+  levels.reserve(levels_.size());
+  for (const std::unique_ptr<Level>& level : levels_) {
+    const Resolution& resolution = level->resolution;
+    if (resolution.width <= buffer->width() &&
+        resolution.height <= buffer->height() &&
+        resolution != Resolution{buffer->width(), buffer->height()}) {
+      levels.push_back(level.get());
+    }
+  }
+  // If a pool is exhausted the consumer falls back to Scale().
+  if (type == VideoFrameBuffer::Type::kNV12) {
+    std::vector<scoped_refptr<NV12Buffer>> scaled;
+    for (Level* level : levels) {
+      scoped_refptr<NV12Buffer> level_buffer = level->pool.CreateNV12Buffer(
+          level->resolution.width, level->resolution.height);
+      if (level_buffer) {
+        scaled.push_back(std::move(level_buffer));
+      }
+    }
+    if (scaled.empty()) {
+      return buffer;
+    }
+    ScaleNV12Levels(*buffer->GetNV12(), scaled);
+    return make_ref_counted<PrescaledNV12Buffer>(std::move(buffer),
+                                                 std::move(scaled));
+  }
+
+  scoped_refptr<I420BufferInterface> source = buffer->ToI420();
+  std::vector<scoped_refptr<I420Buffer>> scaled;
+  for (Level* level : levels) {
+    scoped_refptr<I420Buffer> level_buffer = level->pool.CreateI420Buffer(
+        level->resolution.width, level->resolution.height);
+    if (level_buffer) {
+      scaled.push_back(std::move(level_buffer));
+    }
+  }
+  if (scaled.empty()) {
+    return buffer;
+  }
+  ScaleLevels(*source, scaled);
+  return make_ref_counted<PrescaledI420Buffer>(std::move(source),
+                                               std::move(scaled));
+}
+
+}  // namespace webrtc
@@ -0,0 +1,91 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// Compares scaling a frame to the lower simulcast resolutions one layer at a
+// time, as SimulcastEncoderAdapter used to, with building all of them with
+// VideoFramePyramid.
+
+#include <cstring>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/resolution.h"
+#include "api/video/video_frame_buffer.h"
+#include "benchmark/benchmark.h"
+#include "common_video/include/video_frame_pyramid.h"
+
+namespace webrtc {
+namespace {
+
+scoped_refptr<I420Buffer> CreateSource(int width, int height) {
+  scoped_refptr<I420Buffer> buffer = I420Buffer::Create(width, height);
+  for (int y = 0; y < height; ++y) {
+    memset(buffer->MutableDataY() + y * buffer->StrideY(), y & 0xff, width);
+  }
+  for (int y = 0; y < buffer->ChromaHeight(); ++y) {
+    memset(buffer->MutableDataU() + y * buffer->StrideU(), 0x40,
+           buffer->ChromaWidth());
+    memset(buffer->MutableDataV() + y * buffer->StrideV(), 0xc0,
+           buffer->ChromaWidth());
+  }
+  return buffer;
+}
+
+// The two lower layers of a three layer simulcast configuration.
+std::vector<Resolution> LowerLayers(int width, int height) {
+  return {{.width = width / 2, .height = height / 2},
+          {.width = width / 4, .height = height / 4}};
+}
+
+void BM_ScaleEachLayer(benchmark::State& state) {
+  const int width = state.range(0);
+  const int height = state.range(1);
+  scoped_refptr<I420Buffer> source = CreateSource(width, height);
+  std::vector<Resolution> layers = LowerLayers(width, height);
+  for (auto _ : state) {
+    for (const Resolution& layer : layers) {
+      scoped_refptr<VideoFrameBuffer> scaled =
+          source->Scale(layer.width, layer.height);
+      benchmark::DoNotOptimize(scaled);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_BuildPyramid(benchmark::State& state) {
+  const int width = state.range(0);
+  const int height = state.range(1);
+  scoped_refptr<I420Buffer> source = CreateSource(width, height);
+  std::vector<Resolution> layers = LowerLayers(width, height);
+  VideoFramePyramid pyramid;
+  pyramid.SetResolutions(layers);
+  for (auto _ : state) {
+    scoped_refptr<VideoFrameBuffer> pyramid_buffer = pyramid.Build(source);
+    for (const Resolution& layer : layers) {
+      scoped_refptr<VideoFrameBuffer> scaled =
+          pyramid_buffer->GetPrescaledBuffer(layer.width, layer.height);
+      benchmark::DoNotOptimize(scaled);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ScaleEachLayer)
+    ->Args({1280, 720})
+    ->Args({1920, 1080})
+    ->Args({3840, 2160});
+BENCHMARK(BM_BuildPyramid)
+    ->Args({1280, 720})
+    ->Args({1920, 1080})
+    ->Args({3840, 2160});
+
+}  // namespace
+}  // namespace webrtc
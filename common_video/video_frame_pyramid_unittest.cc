@@ -0,0 +1,171 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/include/video_frame_pyramid.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/i444_buffer.h"
+#include "api/video/nv12_buffer.h"
+#include "api/video/resolution.h"
+#include "api/video/video_frame_buffer.h"
+#include "rtc_base/random.h"
+#include "test/frame_utils.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+scoped_refptr<I420Buffer> CreateRandomBuffer(int width, int height) {
+  scoped_refptr<I420Buffer> buffer = I420Buffer::Create(width, height);
+  Random random(width * height);
+  for (int y = 0; y < buffer->height(); ++y) {
+    for (int x = 0; x < buffer->width(); ++x) {
+      buffer->MutableDataY()[y * buffer->StrideY() + x] =
+          random.Rand<uint8_t>();
+    }
+  }
+  for (int y = 0; y < buffer->ChromaHeight(); ++y) {
+    for (int x = 0; x < buffer->ChromaWidth(); ++x) {
+      buffer->MutableDataU()[y * buffer->StrideU() + x] =
+          random.Rand<uint8_t>();
+      buffer->MutableDataV()[y * buffer->StrideV() + x] =
+          random.Rand<uint8_t>();
+    }
+  }
+  return buffer;
+}
+
+scoped_refptr<VideoFrameBuffer> ScaledFrom(const I420BufferInterface& source,
+                                           int width,
+                                           int height) {
+  scoped_refptr<I420Buffer> scaled = I420Buffer::Create(width, height);
+  scaled->ScaleFrom(source);
+  return scaled;
+}
+
+TEST(VideoFramePyramidTest, EachLevelIsScaledFromTheNextLargerOne) {
+  std::vector<Resolution> resolutions = {
+      {.width = 960, .height = 540},
+      {.width = 480, .height = 270},
+      // Chroma is not exactly half of the 480x270 chroma.
+      {.width = 240, .height = 135}};
+  VideoFramePyramid pyramid;
+  pyramid.SetResolutions(resolutions);
+  scoped_refptr<I420Buffer> source = CreateRandomBuffer(1920, 1080);
+  scoped_refptr<VideoFrameBuffer> result = pyramid.Build(source);
+
+  EXPECT_TRUE(test::FrameBufsEqual(result, source));
+  scoped_refptr<VideoFrameBuffer> expected = source;
+  for (const Resolution& resolution : resolutions) {
+    expected = ScaledFrom(*expected->GetI420(), resolution.width,
+                          resolution.height);
+    scoped_refptr<VideoFrameBuffer> level =
+        result->GetPrescaledBuffer(resolution.width, resolution.height);
+    ASSERT_TRUE(level);
+    EXPECT_TRUE(test::FrameBufsEqual(level, expected))
+        << resolution.width << "x" << resolution.height;
+  }
+}
+
+TEST(VideoFramePyramidTest, ScalesNonHalfResolutionsFromLargerLevel) {
+  VideoFramePyramid pyramid;
+  std::vector<Resolution> resolutions = {{.width = 480, .height = 270},
+                                         {.width = 640, .height = 360}};
+  pyramid.SetResolutions(resolutions);
+  scoped_refptr<I420Buffer> source = CreateRandomBuffer(1280, 720);
+  scoped_refptr<VideoFrameBuffer> result = pyramid.Build(source);
+
+  scoped_refptr<VideoFrameBuffer> half = ScaledFrom(*source, 640, 360);
+  EXPECT_TRUE(
+      test::FrameBufsEqual(result->GetPrescaledBuffer(640, 360), half));
+  EXPECT_TRUE(test::FrameBufsEqual(result->GetPrescaledBuffer(480, 270),
+                                   ScaledFrom(*half->GetI420(), 480, 270)));
+}
+
+TEST(VideoFramePyramidTest, ScaleReturnsPrescaledBuffer) {
+  VideoFramePyramid pyramid;
+  std::vector<Resolution> resolutions = {{.width = 320, .height = 180}};
+  pyramid.SetResolutions(resolutions);
+  scoped_refptr<VideoFrameBuffer> result =
+      pyramid.Build(CreateRandomBuffer(640, 360));
+
+  scoped_refptr<VideoFrameBuffer> prescaled =
+      result->GetPrescaledBuffer(320, 180);
+  ASSERT_TRUE(prescaled);
+  EXPECT_EQ(result->Scale(320, 180), prescaled);
+  EXPECT_FALSE(result->GetPrescaledBuffer(160, 90));
+  scoped_refptr<VideoFrameBuffer> scaled = result->Scale(160, 90);
+  EXPECT_EQ(scaled->width(), 160);
+  EXPECT_EQ(scaled->height(), 90);
+}
+
+TEST(VideoFramePyramidTest, ReusesPooledBuffers) {
+  VideoFramePyramid pyramid;
+  std::vector<Resolution> resolutions = {{.width = 320, .height = 180}};
+  pyramid.SetResolutions(resolutions);
+  scoped_refptr<I420Buffer> source = CreateRandomBuffer(640, 360);
+
+  const VideoFrameBuffer* first =
+      pyramid.Build(source)->GetPrescaledBuffer(320, 180).get();
+  const VideoFrameBuffer* second =
+      pyramid.Build(source)->GetPrescaledBuffer(320, 180).get();
+  EXPECT_EQ(first, second);
+}
+
+TEST(VideoFramePyramidTest, ReturnsInputIfNothingToBuild) {
+  VideoFramePyramid pyramid;
+  scoped_refptr<I420Buffer> source = CreateRandomBuffer(640, 360);
+  EXPECT_EQ(pyramid.Build(source), source);
+
+  std::vector<Resolution> resolutions = {{.width = 640, .height = 360},
+                                         {.width = 1280, .height = 720}};
+  pyramid.SetResolutions(resolutions);
+  EXPECT_EQ(pyramid.Build(source), source);
+
+  resolutions = {{.width = 320, .height = 180}};
+  pyramid.SetResolutions(resolutions);
+  scoped_refptr<I444Buffer> i444 = I444Buffer::Create(640, 360);
+  EXPECT_EQ(pyramid.Build(i444), i444);
+}
+
+TEST(VideoFramePyramidTest, KeepsNV12AsNV12) {
+  VideoFramePyramid pyramid;
+  std::vector<Resolution> resolutions = {{.width = 640, .height = 360},
+                                         {.width = 320, .height = 180}};
+  pyramid.SetResolutions(resolutions);
+  scoped_refptr<NV12Buffer> source =
+      NV12Buffer::Copy(*CreateRandomBuffer(1280, 720));
+
+  scoped_refptr<VideoFrameBuffer> result = pyramid.Build(source);
+  EXPECT_EQ(result->type(), VideoFrameBuffer::Type::kNV12);
+  EXPECT_EQ(result->GetNV12()->DataY(), source->DataY());
+
+  scoped_refptr<NV12Buffer> expected_640 = NV12Buffer::Create(640, 360);
+  expected_640->CropAndScaleFrom(*source, 0, 0, 1280, 720);
+  scoped_refptr<NV12Buffer> expected_320 = NV12Buffer::Create(320, 180);
+  expected_320->CropAndScaleFrom(*expected_640, 0, 0, 640, 360);
+
+  scoped_refptr<VideoFrameBuffer> scaled_640 = result->Scale(640, 360);
+  scoped_refptr<VideoFrameBuffer> scaled_320 = result->Scale(320, 180);
+  ASSERT_EQ(scaled_640->type(), VideoFrameBuffer::Type::kNV12);
+  ASSERT_EQ(scaled_320->type(), VideoFrameBuffer::Type::kNV12);
+  EXPECT_EQ(scaled_640, result->GetPrescaledBuffer(640, 360));
+  EXPECT_TRUE(
+      test::FrameBufsEqual(scaled_640->ToI420(), expected_640->ToI420()));
+  EXPECT_TRUE(
+      test::FrameBufsEqual(scaled_320->ToI420(), expected_320->ToI420()));
+}
+
+}  // namespace
+}  // namespace webrtc
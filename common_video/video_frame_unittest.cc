@@ -13,6 +13,8 @@
 #include <math.h>
 #include <string.h>
 
+#include <vector>
+
 #include "api/video/i010_buffer.h"
 #include "api/video/i210_buffer.h"
 #include "api/video/i410_buffer.h"
@@ -23,10 +25,14 @@
 #include "rtc_base/time_utils.h"
 #include "test/fake_texture_frame.h"
 #include "test/frame_utils.h"
+#include "test/gmock.h"
 #include "test/gtest.h"
 
 namespace webrtc {
 
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
 namespace {
 
 struct SubSampling {
@@ -612,4 +618,58 @@ TEST(TestUpdateRectScale, CropAndScaleByHalf) {
   EXPECT_EQ(scaled, VideoFrame::UpdateRect({42, 22, 56, 106}));
 }
 
+TEST(TestUpdateRegion, DefaultsToUpdateRect) {
+  VideoFrame frame = VideoFrame::Builder()
+                         .set_video_frame_buffer(I420Buffer::Create(640, 480))
+                         .build();
+  EXPECT_THAT(frame.update_region(),
+              ElementsAre(VideoFrame::UpdateRect{0, 0, 640, 480}));
+  frame.set_update_rect({10, 20, 30, 40});
+  EXPECT_THAT(frame.update_region(),
+              ElementsAre(VideoFrame::UpdateRect{10, 20, 30, 40}));
+  frame.set_update_rect({0, 0, 0, 0});
+  EXPECT_THAT(frame.update_region(), IsEmpty());
+}
+
+TEST(TestUpdateRegion, KeepsRectsAndSetsBoundingBox) {
+  VideoFrame frame =
+      VideoFrame::Builder()
+          .set_video_frame_buffer(I420Buffer::Create(640, 480))
+          .set_update_region({{0, 0, 10, 10}, {0, 0, 0, 0}, {600, 400, 40, 80}})
+          .build();
+  EXPECT_TRUE(frame.has_update_rect());
+  EXPECT_EQ(frame.update_rect(), VideoFrame::UpdateRect({0, 0, 640, 480}));
+  EXPECT_THAT(frame.update_region(),
+              ElementsAre(VideoFrame::UpdateRect{0, 0, 10, 10},
+                          VideoFrame::UpdateRect{600, 400, 40, 80}));
+
+  frame.set_update_rect({0, 0, 20, 20});
+  EXPECT_THAT(frame.update_region(),
+              ElementsAre(VideoFrame::UpdateRect{0, 0, 20, 20}));
+}
+
+TEST(TestUpdateRegion, EmptyRegionMarksUnchangedFrame) {
+  VideoFrame frame = VideoFrame::Builder()
+                         .set_video_frame_buffer(I420Buffer::Create(640, 480))
+                         .set_update_region({})
+                         .build();
+  EXPECT_TRUE(frame.has_update_rect());
+  EXPECT_TRUE(frame.update_rect().IsEmpty());
+  EXPECT_THAT(frame.update_region(), IsEmpty());
+}
+
+TEST(TestUpdateRegion, ReducesLargeRegionToBoundingBox) {
+  VideoFrame frame = VideoFrame::Builder()
+                         .set_video_frame_buffer(I420Buffer::Create(640, 480))
+                         .build();
+  std::vector<VideoFrame::UpdateRect> rects;
+  for (size_t i = 0; i <= VideoFrame::kMaxUpdateRegionRects; ++i) {
+    rects.push_back({static_cast<int>(i) * 20, 0, 10, 10});
+  }
+  frame.set_update_region(rects);
+  EXPECT_THAT(frame.update_region(),
+              ElementsAre(VideoFrame::UpdateRect{
+                  0, 0, static_cast<int>(rects.size()) * 20 - 10, 10}));
+}
+
 }  // namespace webrtc
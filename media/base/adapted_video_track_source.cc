@@ -108,6 +108,13 @@ bool AdaptedVideoTrackSource::AdaptFrame(int width,
     return false;
   }
 
+  // Ask the sinks before the VideoAdapter, so that a frame no sink wants does
+  // not count against the frame rate of the adapter.
+  if (!broadcaster_.WantsFrame()) {
+    broadcaster_.OnDiscardedFrame();
+    return false;
+  }
+
   if (!video_adapter_.AdaptFrameResolution(
           width, height, time_us * webrtc::kNumNanosecsPerMicrosec, crop_width,
           crop_height, out_width, out_height)) {
@@ -53,7 +53,9 @@ class RTC_EXPORT AdaptedVideoTrackSource
 
   // Reports the appropriate frame size after adaptation. Returns true
   // if a frame is wanted. Returns false if there are no interested
-  // sinks, or if the VideoAdapter decides to drop the frame.
+  // sinks, if all sinks would drop the frame, e.g. because the encoders are
+  // paused, or if the VideoAdapter decides to drop the frame. Call it before
+  // converting or scaling the frame, so that dropped frames cost nothing.
   bool AdaptFrame(int width,
                   int height,
                   int64_t time_us,
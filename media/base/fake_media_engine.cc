@@ -556,6 +556,9 @@ void FakeVideoMediaReceiveChannel::ClearRecordableEncodedFrameCallback(
 
 void FakeVideoMediaReceiveChannel::RequestRecvKeyFrame(uint32_t /* ssrc */) {}
 
+void FakeVideoMediaReceiveChannel::SetSinkPaused(uint32_t /* ssrc */,
+                                                 bool /* paused */) {}
+
 bool FakeVideoMediaReceiveChannel::GetStats(VideoMediaReceiveInfo* /* info */) {
   return false;
 }
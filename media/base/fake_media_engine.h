@@ -698,6 +698,7 @@ class FakeVideoMediaReceiveChannel
       std::function<void(const RecordableEncodedFrame&)> callback) override;
   void ClearRecordableEncodedFrameCallback(uint32_t ssrc) override;
   void RequestRecvKeyFrame(uint32_t ssrc) override;
+  void SetSinkPaused(uint32_t ssrc, bool paused) override;
   void SetReceiverFeedbackParameters(
       bool /* lntf_enabled */,
       bool /* nack_enabled */,
@@ -1000,6 +1000,9 @@ class VideoMediaReceiveChannelInterface : public MediaReceiveChannelInterface {
   // Request generation of a keyframe for `ssrc` on a receiving channel via
   // RTCP feedback.
   virtual void RequestRecvKeyFrame(uint32_t ssrc) = 0;
+  // Tells the receive stream for `ssrc` whether its sink is paused, in which
+  // case only key frames are decoded until it is unpaused.
+  virtual void SetSinkPaused(uint32_t ssrc, bool paused) = 0;
 
   virtual std::vector<webrtc::RtpSource> GetSources(uint32_t ssrc) const = 0;
   // Set recordable encoded frame callback for `ssrc`
@@ -113,6 +113,14 @@ void VideoBroadcaster::OnDiscardedFrame() {
   }
 }
 
+bool VideoBroadcaster::WantsFrame() {
+  MutexLock lock(&sinks_and_wants_lock_);
+  return std::any_of(sink_pairs().begin(), sink_pairs().end(),
+                     [](const SinkPair& sink_pair) {
+                       return sink_pair.sink->WantsFrame();
+                     });
+}
+
 void VideoBroadcaster::ProcessConstraints(
     const VideoTrackSourceConstraints& constraints) {
   MutexLock lock(&sinks_and_wants_lock_);
@@ -196,6 +204,13 @@ void VideoBroadcaster::UpdateWants() {
     wants.is_active |= sink.wants.is_active;
   }
 
+  // wants.paused == ALL(sink.wants.paused), including the sinks ignored above
+  // since they still get frames.
+  wants.paused =
+      !sink_pairs().empty() &&
+      std::all_of(sink_pairs().begin(), sink_pairs().end(),
+                  [](const auto& sink) { return sink.wants.paused; });
+
   if (wants.target_pixel_count &&
       *wants.target_pixel_count >= wants.max_pixel_count) {
     wants.target_pixel_count.emplace(wants.max_pixel_count);
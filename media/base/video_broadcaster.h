@@ -59,6 +59,10 @@ class VideoBroadcaster : public VideoSourceBase,
 
   void OnDiscardedFrame() override;
 
+  // Returns true if at least one sink wants the next frame, see
+  // VideoSinkInterface::WantsFrame().
+  bool WantsFrame() override;
+
   // Called on the network thread when constraints change. Forwards the
   // constraints to sinks added with AddOrUpdateSink via OnConstraintsChanged.
   void ProcessConstraints(const VideoTrackSourceConstraints& constraints);
@@ -33,7 +33,9 @@ using ::testing::AllOf;
 using ::testing::Eq;
 using ::testing::Field;
 using ::testing::Mock;
+using ::testing::NiceMock;
 using ::testing::Optional;
+using ::testing::Return;
 
 class MockSink : public webrtc::VideoSinkInterface<webrtc::VideoFrame> {
  public:
@@ -43,6 +45,7 @@ class MockSink : public webrtc::VideoSinkInterface<webrtc::VideoFrame> {
               OnConstraintsChanged,
               (const webrtc::VideoTrackSourceConstraints& constraints),
               (override));
+  MOCK_METHOD(bool, WantsFrame, (), (override));
 };
 
 TEST(VideoBroadcasterTest, frame_wanted) {
@@ -57,6 +60,23 @@ TEST(VideoBroadcasterTest, frame_wanted) {
   EXPECT_FALSE(broadcaster.frame_wanted());
 }
 
+TEST(VideoBroadcasterTest, WantsFrameIfAnySinkWantsIt) {
+  VideoBroadcaster broadcaster;
+  EXPECT_FALSE(broadcaster.WantsFrame());
+
+  NiceMock<MockSink> sink1;
+  NiceMock<MockSink> sink2;
+  broadcaster.AddOrUpdateSink(&sink1, webrtc::VideoSinkWants());
+  broadcaster.AddOrUpdateSink(&sink2, webrtc::VideoSinkWants());
+
+  ON_CALL(sink1, WantsFrame).WillByDefault(Return(false));
+  ON_CALL(sink2, WantsFrame).WillByDefault(Return(true));
+  EXPECT_TRUE(broadcaster.WantsFrame());
+
+  ON_CALL(sink2, WantsFrame).WillByDefault(Return(false));
+  EXPECT_FALSE(broadcaster.WantsFrame());
+}
+
 TEST(VideoBroadcasterTest, OnFrame) {
   VideoBroadcaster broadcaster;
 
@@ -357,6 +377,30 @@ TEST(VideoBroadcasterTest, AppliesMaxOfSinkWantsScaleResolutionDownTo) {
   EXPECT_EQ(FrameSize(640, 360), *broadcaster.wants().requested_resolution);
 }
 
+TEST(VideoBroadcasterTest, PausedIfAllSinksArePaused) {
+  VideoBroadcaster broadcaster;
+  EXPECT_FALSE(broadcaster.wants().paused);
+
+  FakeVideoRenderer sink1;
+  VideoSinkWants wants1;
+  wants1.paused = true;
+  broadcaster.AddOrUpdateSink(&sink1, wants1);
+  EXPECT_TRUE(broadcaster.wants().paused);
+
+  FakeVideoRenderer sink2;
+  VideoSinkWants wants2;
+  broadcaster.AddOrUpdateSink(&sink2, wants2);
+  EXPECT_FALSE(broadcaster.wants().paused);
+
+  wants2.paused = true;
+  broadcaster.AddOrUpdateSink(&sink2, wants2);
+  EXPECT_TRUE(broadcaster.wants().paused);
+
+  broadcaster.RemoveSink(&sink1);
+  broadcaster.RemoveSink(&sink2);
+  EXPECT_FALSE(broadcaster.wants().paused);
+}
+
 TEST(VideoBroadcasterTest, AnyActive) {
   VideoBroadcaster broadcaster;
 
@@ -302,6 +302,12 @@ class FakeVideoReceiveStream final : public VideoReceiveStreamInterface {
     return RecordingState();
   }
   void GenerateKeyFrame() override {}
+  void SetSinkPaused(bool paused) override { sink_paused_ = paused; }
+  bool sink_paused() const { return sink_paused_; }
+  void SetDecodeTarget(std::optional<int> decode_target) override {
+    decode_target_ = decode_target;
+  }
+  std::optional<int> decode_target() const { return decode_target_; }
 
   void SetRtcpMode(RtcpMode mode) override { config_.rtp.rtcp_mode = mode; }
 
@@ -353,6 +359,8 @@ class FakeVideoReceiveStream final : public VideoReceiveStreamInterface {
   VideoReceiveStreamInterface::Stats stats_;
 
   int base_mininum_playout_delay_ms_ = 0;
+  bool sink_paused_ = false;
+  std::optional<int> decode_target_;
 };
 
 class FakeFlexfecReceiveStream final : public FlexfecReceiveStream {
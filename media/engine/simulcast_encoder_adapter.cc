@@ -35,6 +35,7 @@
 #include "api/units/data_rate.h"
 #include "api/units/timestamp.h"
 #include "api/video/encoded_image.h"
+#include "api/video/resolution.h"
 #include "api/video/video_bitrate_allocation.h"
 #include "api/video/video_bitrate_allocator.h"
 #include "api/video/video_codec_constants.h"
@@ -51,6 +52,7 @@
 #include "api/video_codecs/video_encoder_factory.h"
 #include "api/video_codecs/video_encoder_software_fallback_wrapper.h"
 #include "common_video/framerate_controller.h"
+#include "common_video/include/video_frame_pyramid.h"
 #include "media/base/sdp_video_format_utils.h"
 #include "modules/video_coding/include/video_error_codes.h"
 #include "modules/video_coding/include/video_error_codes_utils.h"
@@ -301,6 +303,7 @@ int SimulcastEncoderAdapter::Release() {
   }
 
   bypass_mode_ = false;
+  frame_pyramid_.SetResolutions({});
 
   // It's legal to move the encoder to another queue now.
   encoder_queue_.Detach();
@@ -452,6 +455,13 @@ int SimulcastEncoderAdapter::InitEncode(
   // To save memory, don't store encoders that we don't use.
   DestroyStoredEncoders();
 
+  std::vector<Resolution> layer_resolutions;
+  for (const StreamContext& layer : stream_contexts_) {
+    layer_resolutions.push_back(
+        {.width = layer.width(), .height = layer.height()});
+  }
+  frame_pyramid_.SetResolutions(layer_resolutions);
+
   inited_.store(1);
   return WEBRTC_VIDEO_CODEC_OK;
 }
@@ -574,10 +584,14 @@ int SimulcastEncoderAdapter::Encode(
       }
     } else {
       if (src_buffer == nullptr) {
-        src_buffer = input_image.video_frame_buffer();
+        // Builds the resolutions of all layers in one pass over the input.
+        src_buffer = frame_pyramid_.Build(input_image.video_frame_buffer());
       }
       scoped_refptr<VideoFrameBuffer> dst_buffer =
-          src_buffer->Scale(layer.width(), layer.height());
+          src_buffer->GetPrescaledBuffer(layer.width(), layer.height());
+      if (!dst_buffer) {
+        dst_buffer = src_buffer->Scale(layer.width(), layer.height());
+      }
       if (!dst_buffer) {
         RTC_LOG(LS_ERROR) << "Failed to scale video frame";
         return WEBRTC_VIDEO_CODEC_ENCODER_FAILURE;
@@ -955,6 +969,10 @@ VideoEncoder::EncoderInfo SimulcastEncoderAdapter::GetEncoderInfo() const {
   for (size_t i = 0; i < stream_contexts_.size(); ++i) {
     VideoEncoder::EncoderInfo encoder_impl_info =
         stream_contexts_[i].encoder().GetEncoderInfo();
+    if (encoder_impl_info.preferred_pixel_formats.empty()) {
+      encoder_impl_info.preferred_pixel_formats = {
+          VideoFrameBuffer::Type::kI420};
+    }
 
     // Encoder name indicates names of all active sub-encoders.
     if (!stream_contexts_[i].is_paused()) {
@@ -968,6 +986,8 @@ VideoEncoder::EncoderInfo SimulcastEncoderAdapter::GetEncoderInfo() const {
       encoder_info.is_hardware_accelerated =
           encoder_impl_info.is_hardware_accelerated;
       encoder_info.is_qp_trusted = encoder_impl_info.is_qp_trusted;
+      encoder_info.preferred_pixel_formats =
+          encoder_impl_info.preferred_pixel_formats;
     } else {
       // Native handle supported if any encoder supports it.
       encoder_info.supports_native_handle |=
@@ -989,6 +1009,18 @@ VideoEncoder::EncoderInfo SimulcastEncoderAdapter::GetEncoderInfo() const {
       encoder_info.is_qp_trusted =
           encoder_info.is_qp_trusted.value_or(true) &&
           encoder_impl_info.is_qp_trusted.value_or(true);
+
+      // A pixel format is preferred only if all encoders prefer it, so that
+      // e.g. NV12 input is not converted when every layer can encode NV12.
+      // The layers are scaled in the input format.
+      auto not_preferred = [&](VideoFrameBuffer::Type type) {
+        return !absl::c_linear_search(encoder_impl_info.preferred_pixel_formats,
+                                      type);
+      };
+      auto& formats = encoder_info.preferred_pixel_formats;
+      formats.erase(
+          std::remove_if(formats.begin(), formats.end(), not_preferred),
+          formats.end());
     }
     encoder_info.fps_allocation[i] = encoder_impl_info.fps_allocation[0];
     encoder_info.requested_resolution_alignment =
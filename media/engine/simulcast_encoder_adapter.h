@@ -33,6 +33,7 @@
 #include "api/video_codecs/video_encoder.h"
 #include "api/video_codecs/video_encoder_factory.h"
 #include "common_video/framerate_controller.h"
+#include "common_video/include/video_frame_pyramid.h"
 #include "modules/video_coding/include/video_codec_interface.h"
 #include "rtc_base/experiments/encoder_info_settings.h"
 #include "rtc_base/system/no_unique_address.h"
@@ -183,6 +184,8 @@ class RTC_EXPORT SimulcastEncoderAdapter : public VideoEncoder {
   bool bypass_mode_;
   std::vector<StreamContext> stream_contexts_;
   EncodedImageCallback* encoded_complete_callback_;
+  // Downscales input frames to the resolutions of all layers.
+  VideoFramePyramid frame_pyramid_;
 
   // Used for checking the single-threaded access of the encoder interface.
   RTC_NO_UNIQUE_ADDRESS SequenceChecker encoder_queue_;
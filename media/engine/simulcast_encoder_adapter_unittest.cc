@@ -60,7 +60,9 @@
 #include "test/scoped_key_value_config.h"
 
 using ::testing::_;
+using ::testing::ElementsAre;
 using ::testing::Return;
+using ::testing::UnorderedElementsAre;
 using EncoderInfo = webrtc::VideoEncoder::EncoderInfo;
 using FramerateFractions =
     absl::InlinedVector<uint8_t, webrtc::kMaxTemporalStreams>;
@@ -286,6 +288,7 @@ class MockVideoEncoder : public VideoEncoder {
     info.supports_simulcast = supports_simulcast_;
     info.is_qp_trusted = is_qp_trusted_;
     info.resolution_bitrate_limits = resolution_bitrate_limits;
+    info.preferred_pixel_formats = preferred_pixel_formats_;
     return info;
   }
 
@@ -365,6 +368,12 @@ class MockVideoEncoder : public VideoEncoder {
     resolution_bitrate_limits = limits;
   }
 
+  void set_preferred_pixel_formats(
+      absl::InlinedVector<VideoFrameBuffer::Type, kMaxPreferredPixelFormats>
+          formats) {
+    preferred_pixel_formats_ = formats;
+  }
+
   bool supports_simulcast() const { return supports_simulcast_; }
 
   SdpVideoFormat video_format() const { return video_format_; }
@@ -384,6 +393,8 @@ class MockVideoEncoder : public VideoEncoder {
   FramerateFractions fps_allocation_;
   bool supports_simulcast_ = false;
   std::optional<bool> is_qp_trusted_;
+  absl::InlinedVector<VideoFrameBuffer::Type, kMaxPreferredPixelFormats>
+      preferred_pixel_formats_;
   SdpVideoFormat video_format_;
   std::vector<VideoEncoder::ResolutionBitrateLimits> resolution_bitrate_limits;
 
@@ -1663,6 +1674,30 @@ TEST_F(TestSimulcastEncoderAdapterFake, ReportsIsQpTrusted) {
   EXPECT_FALSE(adapter_->GetEncoderInfo().is_qp_trusted.value_or(true));
 }
 
+TEST_F(TestSimulcastEncoderAdapterFake, ReportsCommonPreferredPixelFormats) {
+  SimulcastTestFixtureImpl::DefaultSettings(
+      &codec_, static_cast<const int*>(kTestTemporalLayerProfile),
+      kVideoCodecVP8);
+  codec_.numberOfSimulcastStreams = 3;
+  adapter_->RegisterEncodeCompleteCallback(this);
+  EXPECT_EQ(0, adapter_->InitEncode(&codec_, kSettings));
+  ASSERT_EQ(3u, helper_->factory()->encoders().size());
+
+  // All encoders accept NV12, so the adapter does too.
+  for (MockVideoEncoder* encoder : helper_->factory()->encoders()) {
+    encoder->set_preferred_pixel_formats(
+        {VideoFrameBuffer::Type::kI420, VideoFrameBuffer::Type::kNV12});
+  }
+  EXPECT_THAT(adapter_->GetEncoderInfo().preferred_pixel_formats,
+              UnorderedElementsAre(VideoFrameBuffer::Type::kI420,
+                                   VideoFrameBuffer::Type::kNV12));
+
+  // An encoder without preferred formats only takes I420.
+  helper_->factory()->encoders()[1]->set_preferred_pixel_formats({});
+  EXPECT_THAT(adapter_->GetEncoderInfo().preferred_pixel_formats,
+              ElementsAre(VideoFrameBuffer::Type::kI420));
+}
+
 TEST_F(TestSimulcastEncoderAdapterFake, ReportsFpsAllocation) {
   SimulcastTestFixtureImpl::DefaultSettings(
       &codec_, static_cast<const int*>(kTestTemporalLayerProfile),
@@ -3724,6 +3724,9 @@ void WebRtcVideoReceiveChannel::WebRtcVideoReceiveStream::
     stream_->SetAndGetRecordingState(std::move(*recording_state),
                                      /*generate_key_frame=*/false);
   }
+  if (sink_paused_) {
+    stream_->SetSinkPaused(true);
+  }
   if (receiving_) {
     StartReceiveStream();
   }
@@ -3985,6 +3988,14 @@ void WebRtcVideoReceiveChannel::WebRtcVideoReceiveStream::GenerateKeyFrame() {
   }
 }
 
+void WebRtcVideoReceiveChannel::WebRtcVideoReceiveStream::SetSinkPaused(
+    bool paused) {
+  RTC_DCHECK_RUN_ON(&thread_checker_);
+  sink_paused_ = paused;
+  if (stream_)
+    stream_->SetSinkPaused(paused);
+}
+
 void WebRtcVideoReceiveChannel::WebRtcVideoReceiveStream::
     SetDepacketizerToDecoderFrameTransformer(
         scoped_refptr<FrameTransformerInterface> frame_transformer) {
@@ -4086,6 +4097,17 @@ void WebRtcVideoReceiveChannel::RequestRecvKeyFrame(uint32_t ssrc) {
   }
 }
 
+void WebRtcVideoReceiveChannel::SetSinkPaused(uint32_t ssrc, bool paused) {
+  RTC_DCHECK_RUN_ON(&thread_checker_);
+  WebRtcVideoReceiveStream* stream = FindReceiveStream(ssrc);
+  if (stream) {
+    stream->SetSinkPaused(paused);
+  } else {
+    RTC_LOG(LS_ERROR) << "Absent receive stream; ignoring sink pause for ssrc "
+                      << ssrc;
+  }
+}
+
 void WebRtcVideoReceiveChannel::SetDepacketizerToDecoderFrameTransformer(
     uint32_t ssrc,
     scoped_refptr<FrameTransformerInterface> frame_transformer) {
@@ -611,6 +611,7 @@ class WebRtcVideoReceiveChannel : public MediaChannelUtil,
       std::function<void(const RecordableEncodedFrame&)> callback) override;
   void ClearRecordableEncodedFrameCallback(uint32_t ssrc) override;
   void RequestRecvKeyFrame(uint32_t ssrc) override;
+  void SetSinkPaused(uint32_t ssrc, bool paused) override;
   void SetDepacketizerToDecoderFrameTransformer(
       uint32_t ssrc,
       scoped_refptr<FrameTransformerInterface> frame_transformer) override;
@@ -715,6 +716,7 @@ class WebRtcVideoReceiveChannel : public MediaChannelUtil,
         std::function<void(const RecordableEncodedFrame&)> callback);
     void ClearRecordableEncodedFrameCallback();
     void GenerateKeyFrame();
+    void SetSinkPaused(bool paused);
 
     void SetDepacketizerToDecoderFrameTransformer(
         scoped_refptr<FrameTransformerInterface> frame_transformer);
@@ -759,6 +761,8 @@ class WebRtcVideoReceiveChannel : public MediaChannelUtil,
 
     RTC_NO_UNIQUE_ADDRESS SequenceChecker thread_checker_;
     bool receiving_ RTC_GUARDED_BY(&thread_checker_);
+    // Kept to be applied again when the receive stream is recreated.
+    bool sink_paused_ RTC_GUARDED_BY(&thread_checker_) = false;
   };
   bool GetChangedReceiverParameters(const VideoReceiverParameters& params,
                                     ChangedReceiverParameters* changed_params)
@@ -0,0 +1,143 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/remote_bitrate_estimator/batched_transport_feedback_generator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/sequence_checker.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/remote_bitrate_estimator/rtp_transport_feedback_generator.h"
+#include "modules/rtp_rtcp/source/rtcp_packet.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+
+TimeDelta BatchedTransportFeedbackGenerator::Stats::processing_time_per_packet()
+    const {
+  if (packets_processed == 0) {
+    return TimeDelta::Zero();
+  }
+  return processing_time / packets_processed;
+}
+
+BatchedTransportFeedbackGenerator::BatchedTransportFeedbackGenerator(
+    const Environment& env,
+    const Config& config,
+    RtcpSender feedback_sender)
+    : env_(env),
+      send_rfc8888_feedback_(config.send_rfc8888_feedback),
+      queue_(config.queue_size),
+      transport_sequence_number_feedback_generator_(
+          [this, feedback_sender](
+              std::vector<std::unique_ptr<rtcp::RtcpPacket>> packets) {
+            RTC_DCHECK_RUN_ON(&sequence_checker_);
+            feedback_packets_sent_ += packets.size();
+            feedback_sender(std::move(packets));
+          }),
+      congestion_control_feedback_generator_(
+          env,
+          [this, feedback_sender](
+              std::vector<std::unique_ptr<rtcp::RtcpPacket>> packets) {
+            RTC_DCHECK_RUN_ON(&sequence_checker_);
+            feedback_packets_sent_ += packets.size();
+            feedback_sender(std::move(packets));
+          }) {
+  RTC_DCHECK_GT(config.queue_size, 0);
+  packet_sequence_checker_.Detach();
+}
+
+BatchedTransportFeedbackGenerator::~BatchedTransportFeedbackGenerator() =
+    default;
+
+void BatchedTransportFeedbackGenerator::OnReceivedPacket(
+    const RtpPacketReceived& packet) {
+  RTC_DCHECK_RUN_ON(&packet_sequence_checker_);
+  RtpPacketArrival arrival = RtpPacketArrival::FromPacket(packet);
+  if (!send_rfc8888_feedback_ && !arrival.transport_sequence_number) {
+    // Nothing to give feedback about.
+    return;
+  }
+  if (!queue_.Insert(&arrival)) {
+    if (packets_dropped_.fetch_add(1, std::memory_order_relaxed) == 0) {
+      RTC_LOG(LS_WARNING) << "Transport feedback queue full, dropping packet "
+                             "arrival. Process() is not called often enough.";
+    }
+    return;
+  }
+  packets_queued_.fetch_add(1, std::memory_order_relaxed);
+}
+
+TimeDelta BatchedTransportFeedbackGenerator::Process(Timestamp now) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  const int64_t start_time_ns = TimeNanos();
+  IngestQueuedArrivals();
+  TimeDelta time_until_next =
+      transport_sequence_number_feedback_generator_.Process(now);
+  if (send_rfc8888_feedback_) {
+    time_until_next =
+        std::min(time_until_next,
+                 congestion_control_feedback_generator_.Process(now));
+  }
+  processing_time_ += TimeDelta::Micros((TimeNanos() - start_time_ns) /
+                                        kNumNanosecsPerMicrosec);
+  return std::max(time_until_next, TimeDelta::Zero());
+}
+
+void BatchedTransportFeedbackGenerator::IngestQueuedArrivals() {
+  RtpPacketArrival arrival;
+  int64_t num_arrivals = 0;
+  while (queue_.Remove(&arrival)) {
+    ++num_arrivals;
+    if (send_rfc8888_feedback_) {
+      congestion_control_feedback_generator_.OnPacketArrival(arrival);
+    }
+    if (arrival.transport_sequence_number) {
+      transport_sequence_number_feedback_generator_.OnPacketArrival(arrival);
+    }
+  }
+  if (num_arrivals > 0) {
+    packets_processed_ += num_arrivals;
+    ++batches_processed_;
+  }
+}
+
+void BatchedTransportFeedbackGenerator::OnSendBandwidthEstimateChanged(
+    DataRate estimate) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  transport_sequence_number_feedback_generator_.OnSendBandwidthEstimateChanged(
+      estimate);
+  congestion_control_feedback_generator_.OnSendBandwidthEstimateChanged(
+      estimate);
+}
+
+BatchedTransportFeedbackGenerator::Stats
+BatchedTransportFeedbackGenerator::GetStats() const {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  return {.packets_queued = packets_queued_.load(std::memory_order_relaxed),
+          .packets_dropped = packets_dropped_.load(std::memory_order_relaxed),
+          .packets_processed = packets_processed_,
+          .batches_processed = batches_processed_,
+          .feedback_packets_sent = feedback_packets_sent_,
+          .processing_time = processing_time_};
+}
+
+}  // namespace webrtc
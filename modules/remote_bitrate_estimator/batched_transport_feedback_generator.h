@@ -0,0 +1,118 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_REMOTE_BITRATE_ESTIMATOR_BATCHED_TRANSPORT_FEEDBACK_GENERATOR_H_
+#define MODULES_REMOTE_BITRATE_ESTIMATOR_BATCHED_TRANSPORT_FEEDBACK_GENERATOR_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/sequence_checker.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/remote_bitrate_estimator/congestion_control_feedback_generator.h"
+#include "modules/remote_bitrate_estimator/rtp_transport_feedback_generator.h"
+#include "modules/remote_bitrate_estimator/transport_sequence_number_feedback_generator.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "rtc_base/swap_queue.h"
+#include "rtc_base/system/no_unique_address.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Transport wide feedback generation for all the streams received on one
+// transport, for endpoints that receive many streams.
+//
+// Received packets are reduced to an RtpPacketArrival on the thread that
+// receives them (typically the network thread) and handed over through a
+// lock free single producer, single consumer queue; the packet path never
+// takes a lock and never builds feedback. The queued arrivals are ingested in
+// one batch by Process(), which is also the only place where transport-cc and,
+// if enabled, RFC 8888 feedback is built and sent. The owner thus decides when
+// feedback is produced, e.g. from the same task that sends other RTCP.
+class BatchedTransportFeedbackGenerator : public RtpTransportFeedbackGenerator {
+ public:
+  struct Config {
+    // Also send RFC 8888 congestion control feedback, covering every received
+    // packet. Transport-cc feedback is sent for packets with a transport
+    // sequence number regardless.
+    bool send_rfc8888_feedback = false;
+    // Number of arrivals that can be queued between calls to Process().
+    // Arrivals that do not fit are dropped, and reported as lost.
+    size_t queue_size = 4096;
+  };
+
+  struct Stats {
+    // Arrivals queued by OnReceivedPacket().
+    int64_t packets_queued = 0;
+    // Arrivals dropped because the queue was full.
+    int64_t packets_dropped = 0;
+    // Arrivals ingested by Process().
+    int64_t packets_processed = 0;
+    // Number of Process() calls that ingested at least one arrival.
+    int64_t batches_processed = 0;
+    int64_t feedback_packets_sent = 0;
+    // Time spent in Process() ingesting arrivals and building feedback.
+    TimeDelta processing_time = TimeDelta::Zero();
+
+    // Average processing time per ingested arrival, zero before the first.
+    TimeDelta processing_time_per_packet() const;
+  };
+
+  BatchedTransportFeedbackGenerator(const Environment& env,
+                                    const Config& config,
+                                    RtcpSender feedback_sender);
+  ~BatchedTransportFeedbackGenerator() override;
+
+  // May be called from a different thread than the other methods, but always
+  // from the same one. Never blocks.
+  void OnReceivedPacket(const RtpPacketReceived& packet) override;
+
+  // Ingests the queued arrivals and sends the feedback that is due, including
+  // feedback explicitly requested through TransportSequenceNumberV2. Returns
+  // the time until Process() should be called again.
+  TimeDelta Process(Timestamp now) override;
+
+  void OnSendBandwidthEstimateChanged(DataRate estimate) override;
+
+  Stats GetStats() const;
+
+ private:
+  void IngestQueuedArrivals() RTC_RUN_ON(sequence_checker_);
+
+  const Environment env_;
+  const bool send_rfc8888_feedback_;
+
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker packet_sequence_checker_;
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker sequence_checker_;
+
+  SwapQueue<RtpPacketArrival> queue_;
+  std::atomic<int64_t> packets_queued_{0};
+  std::atomic<int64_t> packets_dropped_{0};
+
+  int64_t packets_processed_ RTC_GUARDED_BY(sequence_checker_) = 0;
+  int64_t batches_processed_ RTC_GUARDED_BY(sequence_checker_) = 0;
+  int64_t feedback_packets_sent_ RTC_GUARDED_BY(sequence_checker_) = 0;
+  TimeDelta processing_time_ RTC_GUARDED_BY(sequence_checker_) =
+      TimeDelta::Zero();
+
+  // Both generators only run on `sequence_checker_`, from Process().
+  TransportSequenceNumberFeedbackGenenerator
+      transport_sequence_number_feedback_generator_;
+  CongestionControlFeedbackGenerator congestion_control_feedback_generator_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_REMOTE_BITRATE_ESTIMATOR_BATCHED_TRANSPORT_FEEDBACK_GENERATOR_H_
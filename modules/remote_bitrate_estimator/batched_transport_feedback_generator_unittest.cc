@@ -0,0 +1,200 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/remote_bitrate_estimator/batched_transport_feedback_generator.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <set>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/rtp_headers.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/source/rtcp_packet.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/congestion_control_feedback.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/transport_feedback.h"
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "rtc_base/platform_thread.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::IsEmpty;
+using ::testing::UnorderedElementsAre;
+
+constexpr uint32_t kSsrc = 1234;
+constexpr TimeDelta kProcessInterval = TimeDelta::Millis(100);
+
+class BatchedTransportFeedbackGeneratorTest : public ::testing::Test {
+ protected:
+  BatchedTransportFeedbackGeneratorTest()
+      : clock_(Timestamp::Seconds(1000)), env_(CreateEnvironment(&clock_)) {
+    extensions_.Register<TransportSequenceNumber>(1);
+    extensions_v2_.Register<TransportSequenceNumberV2>(1);
+  }
+
+  std::unique_ptr<BatchedTransportFeedbackGenerator> CreateGenerator(
+      const BatchedTransportFeedbackGenerator::Config& config) {
+    return std::make_unique<BatchedTransportFeedbackGenerator>(
+        env_, config,
+        [this](std::vector<std::unique_ptr<rtcp::RtcpPacket>> packets) {
+          for (auto& packet : packets) {
+            if (auto* feedback =
+                    dynamic_cast<rtcp::TransportFeedback*>(packet.get())) {
+              for (const auto& received : feedback->GetReceivedPackets()) {
+                transport_feedback_.insert(received.sequence_number());
+              }
+            } else if (auto* feedback =
+                           dynamic_cast<rtcp::CongestionControlFeedback*>(
+                               packet.get())) {
+              for (const auto& info : feedback->packets()) {
+                if (info.arrival_time_offset.IsFinite()) {
+                  rfc8888_feedback_.insert(info.sequence_number);
+                }
+              }
+            }
+          }
+        });
+  }
+
+  RtpPacketReceived CreatePacket(
+      uint16_t sequence_number,
+      std::optional<uint16_t> transport_sequence_number) {
+    RtpPacketReceived packet(&extensions_, clock_.CurrentTime());
+    packet.SetSsrc(kSsrc);
+    packet.SetSequenceNumber(sequence_number);
+    if (transport_sequence_number) {
+      packet.SetExtension<TransportSequenceNumber>(*transport_sequence_number);
+    }
+    return packet;
+  }
+
+  void Process(BatchedTransportFeedbackGenerator& generator) {
+    clock_.AdvanceTime(kProcessInterval);
+    generator.Process(clock_.CurrentTime());
+  }
+
+  SimulatedClock clock_;
+  const Environment env_;
+  RtpHeaderExtensionMap extensions_;
+  RtpHeaderExtensionMap extensions_v2_;
+  std::set<uint16_t> transport_feedback_;
+  std::set<uint16_t> rfc8888_feedback_;
+};
+
+TEST_F(BatchedTransportFeedbackGeneratorTest, SendsFeedbackOnlyFromProcess) {
+  auto generator = CreateGenerator({});
+  for (uint16_t i = 0; i < 3; ++i) {
+    generator->OnReceivedPacket(CreatePacket(i, /*transport_seq=*/100 + i));
+    clock_.AdvanceTimeMilliseconds(1);
+  }
+  EXPECT_THAT(transport_feedback_, IsEmpty());
+
+  Process(*generator);
+  EXPECT_THAT(transport_feedback_, UnorderedElementsAre(100, 101, 102));
+
+  BatchedTransportFeedbackGenerator::Stats stats = generator->GetStats();
+  EXPECT_EQ(stats.packets_queued, 3);
+  EXPECT_EQ(stats.packets_processed, 3);
+  EXPECT_EQ(stats.batches_processed, 1);
+  EXPECT_EQ(stats.feedback_packets_sent, 1);
+  EXPECT_EQ(stats.packets_dropped, 0);
+  EXPECT_GE(stats.processing_time_per_packet(), TimeDelta::Zero());
+}
+
+TEST_F(BatchedTransportFeedbackGeneratorTest,
+       SendsRequestedFeedbackOnNextProcess) {
+  auto generator = CreateGenerator({});
+  RtpPacketReceived packet(&extensions_v2_, clock_.CurrentTime());
+  packet.SetSsrc(kSsrc);
+  packet.SetExtension<TransportSequenceNumberV2>(
+      7, FeedbackRequest{.include_timestamps = true, .sequence_count = 1});
+  generator->OnReceivedPacket(packet);
+  EXPECT_THAT(transport_feedback_, IsEmpty());
+
+  // Requested feedback does not wait for the periodic feedback interval.
+  generator->Process(clock_.CurrentTime());
+  EXPECT_THAT(transport_feedback_, UnorderedElementsAre(7));
+}
+
+TEST_F(BatchedTransportFeedbackGeneratorTest,
+       IgnoresPacketsWithoutTransportSequenceNumberByDefault) {
+  auto generator = CreateGenerator({});
+  generator->OnReceivedPacket(CreatePacket(1, std::nullopt));
+  Process(*generator);
+  EXPECT_EQ(generator->GetStats().packets_queued, 0);
+  EXPECT_THAT(transport_feedback_, IsEmpty());
+}
+
+TEST_F(BatchedTransportFeedbackGeneratorTest,
+       SendsRfc8888FeedbackForAllPacketsIfEnabled) {
+  auto generator = CreateGenerator({.send_rfc8888_feedback = true});
+  generator->OnReceivedPacket(CreatePacket(1, std::nullopt));
+  generator->OnReceivedPacket(CreatePacket(2, /*transport_seq=*/50));
+  Process(*generator);
+  EXPECT_THAT(rfc8888_feedback_, UnorderedElementsAre(1, 2));
+  EXPECT_THAT(transport_feedback_, UnorderedElementsAre(50));
+}
+
+TEST_F(BatchedTransportFeedbackGeneratorTest, DropsArrivalsWhenQueueIsFull) {
+  auto generator = CreateGenerator({.queue_size = 4});
+  for (uint16_t i = 0; i < 6; ++i) {
+    generator->OnReceivedPacket(CreatePacket(i, /*transport_seq=*/i));
+  }
+  Process(*generator);
+  EXPECT_THAT(transport_feedback_, UnorderedElementsAre(0, 1, 2, 3));
+  BatchedTransportFeedbackGenerator::Stats stats = generator->GetStats();
+  EXPECT_EQ(stats.packets_queued, 4);
+  EXPECT_EQ(stats.packets_dropped, 2);
+  EXPECT_EQ(stats.packets_processed, 4);
+}
+
+TEST_F(BatchedTransportFeedbackGeneratorTest,
+       IngestsArrivalsQueuedOnAnotherThread) {
+  constexpr int kNumPackets = 2000;
+  auto generator = CreateGenerator({});
+  // Arrival times are set up front, the clock is only used on this thread.
+  std::vector<RtpPacketReceived> packets;
+  for (int i = 0; i < kNumPackets; ++i) {
+    packets.push_back(CreatePacket(i, /*transport_seq=*/i));
+    packets.back().set_arrival_time(clock_.CurrentTime() +
+                                    TimeDelta::Micros(100 * i));
+  }
+
+  PlatformThread network_thread = PlatformThread::SpawnJoinable(
+      [&] {
+        for (const RtpPacketReceived& packet : packets) {
+          generator->OnReceivedPacket(packet);
+        }
+      },
+      "network_thread");
+  for (int i = 0; i < 20; ++i) {
+    Process(*generator);
+  }
+  network_thread.Finalize();
+  Process(*generator);
+
+  BatchedTransportFeedbackGenerator::Stats stats = generator->GetStats();
+  EXPECT_EQ(stats.packets_dropped, 0);
+  EXPECT_EQ(stats.packets_processed, kNumPackets);
+  EXPECT_EQ(transport_feedback_.size(), static_cast<size_t>(kNumPackets));
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -23,6 +23,7 @@
 #include "api/units/data_size.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
+#include "modules/remote_bitrate_estimator/rtp_transport_feedback_generator.h"
 #include "modules/rtp_rtcp/source/ntp_time_util.h"
 #include "modules/rtp_rtcp/source/rtcp_packet.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/congestion_control_feedback.h"
@@ -51,14 +52,19 @@ CongestionControlFeedbackGenerator::CongestionControlFeedbackGenerator(
 
 void CongestionControlFeedbackGenerator::OnReceivedPacket(
     const RtpPacketReceived& packet) {
+  OnPacketArrival(RtpPacketArrival::FromPacket(packet));
+}
+
+void CongestionControlFeedbackGenerator::OnPacketArrival(
+    const RtpPacketArrival& arrival) {
   RTC_DCHECK_RUN_ON(&sequence_checker_);
 
-  marker_bit_seen_ |= packet.Marker();
+  marker_bit_seen_ |= arrival.marker;
   if (!first_arrival_time_since_feedback_) {
-    first_arrival_time_since_feedback_ = packet.arrival_time();
+    first_arrival_time_since_feedback_ = arrival.arrival_time;
   }
-  feedback_trackers_[packet.Ssrc()].ReceivedPacket(packet);
-  if (NextFeedbackTime() < packet.arrival_time()) {
+  feedback_trackers_[arrival.ssrc].ReceivedPacket(arrival);
+  if (NextFeedbackTime() < arrival.arrival_time) {
     SendFeedback(env_.clock().CurrentTime());
   }
 }
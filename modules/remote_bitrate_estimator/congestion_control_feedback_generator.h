@@ -57,6 +57,9 @@ class CongestionControlFeedbackGenerator
   ~CongestionControlFeedbackGenerator() = default;
 
   void OnReceivedPacket(const RtpPacketReceived& packet) override;
+  // Same as OnReceivedPacket(), for a packet that has already been reduced to
+  // its arrival information.
+  void OnPacketArrival(const RtpPacketArrival& arrival);
 
   void OnSendBandwidthEstimateChanged(DataRate estimate) override {}
 
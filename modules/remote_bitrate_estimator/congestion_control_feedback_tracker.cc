@@ -18,6 +18,7 @@
 #include "absl/algorithm/container.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
+#include "modules/remote_bitrate_estimator/rtp_transport_feedback_generator.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/congestion_control_feedback.h"
 #include "modules/rtp_rtcp/source/rtp_packet_received.h"
 #include "rtc_base/checks.h"
@@ -30,6 +31,14 @@ constexpr int kMaxPacketsPerSsrc = 16384;
 
 void CongestionControlFeedbackTracker::ReceivedPacket(
     const RtpPacketReceived& packet) {
+  ReceivedPacket({.ssrc = packet.Ssrc(),
+                  .sequence_number = packet.SequenceNumber(),
+                  .ecn = packet.ecn(),
+                  .arrival_time = packet.arrival_time()});
+}
+
+void CongestionControlFeedbackTracker::ReceivedPacket(
+    const RtpPacketArrival& arrival) {
   if (packets_.size() > kMaxPacketsPerSsrc) {
     RTC_LOG(LS_VERBOSE)
         << "Unexpected number of packets without sending reports:"
@@ -37,12 +46,12 @@ void CongestionControlFeedbackTracker::ReceivedPacket(
     return;
   }
   int64_t unwrapped_sequence_number =
-      unwrapper_.Unwrap(packet.SequenceNumber());
+      unwrapper_.Unwrap(arrival.sequence_number);
   if (last_sequence_number_in_feedback_ &&
       unwrapped_sequence_number < *last_sequence_number_in_feedback_ + 1) {
     RTC_LOG(LS_WARNING)
         << "Received packet unorderered between feeedback. SSRC: "
-        << packet.Ssrc() << " Seq: " << packet.SequenceNumber()
+        << arrival.ssrc << " Seq: " << arrival.sequence_number
         << " last feedback: "
         << static_cast<uint16_t>(*last_sequence_number_in_feedback_);
     // TODO: bugs.webrtc.org/374550342 - According to spec, the old packets
@@ -53,10 +62,10 @@ void CongestionControlFeedbackTracker::ReceivedPacket(
     // received.
     last_sequence_number_in_feedback_ = unwrapped_sequence_number - 1;
   }
-  packets_.push_back({.ssrc = packet.Ssrc(),
+  packets_.push_back({.ssrc = arrival.ssrc,
                       .unwrapped_sequence_number = unwrapped_sequence_number,
-                      .arrival_time = packet.arrival_time(),
-                      .ecn = packet.ecn()});
+                      .arrival_time = arrival.arrival_time,
+                      .ecn = arrival.ecn});
 }
 
 void CongestionControlFeedbackTracker::AddPacketsToFeedback(
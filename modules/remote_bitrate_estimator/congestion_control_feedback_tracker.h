@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "api/units/timestamp.h"
+#include "modules/remote_bitrate_estimator/rtp_transport_feedback_generator.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/congestion_control_feedback.h"
 #include "modules/rtp_rtcp/source/rtp_packet_received.h"
 #include "rtc_base/network/ecn_marking.h"
@@ -29,6 +30,7 @@ class CongestionControlFeedbackTracker {
   CongestionControlFeedbackTracker() = default;
 
   void ReceivedPacket(const RtpPacketReceived& packet);
+  void ReceivedPacket(const RtpPacketArrival& arrival);
 
   // Adds received packets to `packet_feedback`
   // RTP sequence numbers are continous from the last created feedback unless
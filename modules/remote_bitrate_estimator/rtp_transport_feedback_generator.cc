@@ -0,0 +1,38 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/remote_bitrate_estimator/rtp_transport_feedback_generator.h"
+
+#include <cstdint>
+
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+
+namespace webrtc {
+
+RtpPacketArrival RtpPacketArrival::FromPacket(const RtpPacketReceived& packet) {
+  RtpPacketArrival arrival = {.ssrc = packet.Ssrc(),
+                              .sequence_number = packet.SequenceNumber(),
+                              .marker = packet.Marker(),
+                              .ecn = packet.ecn(),
+                              .arrival_time = packet.arrival_time()};
+  uint16_t transport_sequence_number = 0;
+  if (packet.GetExtension<TransportSequenceNumber>(
+          &transport_sequence_number)) {
+    arrival.transport_sequence_number = transport_sequence_number;
+    arrival.periodic_feedback = true;
+  } else if (packet.GetExtension<TransportSequenceNumberV2>(
+                 &transport_sequence_number, &arrival.feedback_request)) {
+    arrival.transport_sequence_number = transport_sequence_number;
+  }
+  return arrival;
+}
+
+}  // namespace webrtc
@@ -11,10 +11,14 @@
 #ifndef MODULES_REMOTE_BITRATE_ESTIMATOR_RTP_TRANSPORT_FEEDBACK_GENERATOR_H_
 #define MODULES_REMOTE_BITRATE_ESTIMATOR_RTP_TRANSPORT_FEEDBACK_GENERATOR_H_
 
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <vector>
 
+#include "api/rtp_headers.h"
+#include "api/transport/ecn_marking.h"
 #include "api/units/data_rate.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
@@ -23,6 +27,25 @@
 
 namespace webrtc {
 
+// The parts of a received RTP packet that transport feedback is generated
+// from. Trivially copyable, so that it can be queued between threads cheaply.
+struct RtpPacketArrival {
+  static RtpPacketArrival FromPacket(const RtpPacketReceived& packet);
+
+  uint32_t ssrc = 0;
+  uint16_t sequence_number = 0;
+  bool marker = false;
+  EcnMarking ecn = EcnMarking::kNotEct;
+  Timestamp arrival_time = Timestamp::MinusInfinity();
+  // Set if the packet carries the TransportSequenceNumber or the
+  // TransportSequenceNumberV2 extension.
+  std::optional<uint16_t> transport_sequence_number;
+  // True if the transport sequence number was sent with the
+  // TransportSequenceNumber extension, i.e. periodic feedback is expected.
+  bool periodic_feedback = false;
+  std::optional<FeedbackRequest> feedback_request;
+};
+
 class RtpTransportFeedbackGenerator {
  public:
   // Function intented to be used for sending RTCP messages generated by an
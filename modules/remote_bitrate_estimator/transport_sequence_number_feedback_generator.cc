@@ -23,6 +23,7 @@
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "modules/remote_bitrate_estimator/packet_arrival_map.h"
+#include "modules/remote_bitrate_estimator/rtp_transport_feedback_generator.h"
 #include "modules/rtp_rtcp/source/rtcp_packet.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/transport_feedback.h"
 #include "modules/rtp_rtcp/source/rtp_header_extensions.h"
@@ -71,16 +72,8 @@ void TransportSequenceNumberFeedbackGenenerator::MaybeCullOldPackets(
 
 void TransportSequenceNumberFeedbackGenenerator::OnReceivedPacket(
     const RtpPacketReceived& packet) {
-  if (packet.arrival_time().IsInfinite()) {
-    RTC_LOG(LS_WARNING) << "Arrival time not set.";
-    return;
-  }
-
-  uint16_t seqnum = 0;
-  std::optional<FeedbackRequest> feedback_request;
-  if (!packet.GetExtension<TransportSequenceNumber>(&seqnum) &&
-      !packet.GetExtension<TransportSequenceNumberV2>(&seqnum,
-                                                      &feedback_request)) {
+  RtpPacketArrival arrival = RtpPacketArrival::FromPacket(packet);
+  if (!arrival.transport_sequence_number) {
     // This function expected to be called only for packets that have
     // TransportSequenceNumber rtp header extension, however malformed RTP
     // packet may contain unparsable TransportSequenceNumber.
@@ -89,15 +82,25 @@ void TransportSequenceNumberFeedbackGenenerator::OnReceivedPacket(
         << " Expected transport sequence number.";
     return;
   }
+  OnPacketArrival(arrival);
+}
+
+void TransportSequenceNumberFeedbackGenenerator::OnPacketArrival(
+    const RtpPacketArrival& arrival) {
+  RTC_DCHECK(arrival.transport_sequence_number);
+  if (arrival.arrival_time.IsInfinite()) {
+    RTC_LOG(LS_WARNING) << "Arrival time not set.";
+    return;
+  }
 
   MutexLock lock(&lock_);
-  send_periodic_feedback_ = packet.HasExtension<TransportSequenceNumber>();
+  send_periodic_feedback_ = arrival.periodic_feedback;
 
-  media_ssrc_ = packet.Ssrc();
-  int64_t seq = unwrapper_.Unwrap(seqnum);
+  media_ssrc_ = arrival.ssrc;
+  int64_t seq = unwrapper_.Unwrap(*arrival.transport_sequence_number);
 
   if (send_periodic_feedback_) {
-    MaybeCullOldPackets(seq, packet.arrival_time());
+    MaybeCullOldPackets(seq, arrival.arrival_time);
 
     if (!periodic_window_start_seq_ || seq < *periodic_window_start_seq_) {
       periodic_window_start_seq_ = seq;
@@ -109,7 +112,7 @@ void TransportSequenceNumberFeedbackGenenerator::OnReceivedPacket(
     return;
   }
 
-  packet_arrival_times_.AddPacket(seq, packet.arrival_time());
+  packet_arrival_times_.AddPacket(seq, arrival.arrival_time);
 
   // Limit the range of sequence numbers to send feedback for.
   if (periodic_window_start_seq_ <
@@ -117,9 +120,9 @@ void TransportSequenceNumberFeedbackGenenerator::OnReceivedPacket(
     periodic_window_start_seq_ = packet_arrival_times_.begin_sequence_number();
   }
 
-  if (feedback_request.has_value()) {
+  if (arrival.feedback_request.has_value()) {
     // Send feedback packet immediately.
-    SendFeedbackOnRequest(seq, *feedback_request);
+    SendFeedbackOnRequest(seq, *arrival.feedback_request);
   }
 }
 
@@ -44,6 +44,9 @@ class TransportSequenceNumberFeedbackGenenerator
   ~TransportSequenceNumberFeedbackGenenerator();
 
   void OnReceivedPacket(const RtpPacketReceived& packet) override;
+  // Same as OnReceivedPacket(), for a packet that has already been reduced to
+  // its arrival information. `arrival` must have a transport sequence number.
+  void OnPacketArrival(const RtpPacketArrival& arrival);
   void OnSendBandwidthEstimateChanged(DataRate estimate) override;
 
   TimeDelta Process(Timestamp now) override;
@@ -0,0 +1,76 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/fec_xor.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include "modules/rtp_rtcp/source/fec_xor_neon.h"
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+#include "modules/rtp_rtcp/source/fec_xor_avx2.h"
+#include "modules/rtp_rtcp/source/fec_xor_sse2.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#endif
+
+namespace webrtc {
+namespace internal {
+namespace {
+
+using XorBytesFunction = void (*)(const uint8_t*, size_t, uint8_t*);
+
+XorBytesFunction SelectXorBytes() {
+#if defined(WEBRTC_HAS_NEON)
+  return &XorBytesNeon;
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+  if (GetCPUInfo(kAVX2)) {
+    return &XorBytesAvx2;
+  }
+  if (GetCPUInfo(kSSE2)) {
+    return &XorBytesSse2;
+  }
+  return &XorBytesGeneric;
+#else
+  return &XorBytesGeneric;
+#endif
+}
+
+}  // namespace
+
+void XorBytes(const uint8_t* src, size_t length, uint8_t* dst) {
+  // CPU detection is done once; the function-local static is initialized in
+  // a thread-safe manner.
+  static const XorBytesFunction xor_bytes = SelectXorBytes();
+  xor_bytes(src, length, dst);
+}
+
+void XorBytesGeneric(const uint8_t* src, size_t length, uint8_t* dst) {
+  size_t i = 0;
+  // Process 8 bytes at a time. memcpy() keeps this free of alignment and
+  // strict-aliasing issues and is lowered to plain loads/stores.
+  for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+    uint64_t a;
+    uint64_t b;
+    memcpy(&a, src + i, sizeof(a));
+    memcpy(&b, dst + i, sizeof(b));
+    b ^= a;
+    memcpy(dst + i, &b, sizeof(b));
+  }
+  for (; i < length; ++i) {
+    dst[i] ^= src[i];
+  }
+}
+
+}  // namespace internal
+}  // namespace webrtc
@@ -0,0 +1,31 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_FEC_XOR_H_
+#define MODULES_RTP_RTCP_SOURCE_FEC_XOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace webrtc {
+namespace internal {
+
+// Performs `dst[i] ^= src[i]` for `length` bytes. Uses the widest vector
+// instruction set available on the running CPU. `src` and `dst` may have any
+// alignment but must not partially overlap.
+void XorBytes(const uint8_t* src, size_t length, uint8_t* dst);
+
+// Portable implementation, exposed for testing and benchmarking.
+void XorBytesGeneric(const uint8_t* src, size_t length, uint8_t* dst);
+
+}  // namespace internal
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_FEC_XOR_H_
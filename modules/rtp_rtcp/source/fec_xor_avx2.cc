@@ -0,0 +1,56 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/fec_xor_avx2.h"
+
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace webrtc {
+namespace internal {
+
+void XorBytesAvx2(const uint8_t* src, size_t length, uint8_t* dst) {
+  size_t i = 0;
+  for (; i + 128 <= length; i += 128) {
+    const __m256i* s = reinterpret_cast<const __m256i*>(src + i);
+    __m256i* d = reinterpret_cast<__m256i*>(dst + i);
+    __m256i d0 =
+        _mm256_xor_si256(_mm256_loadu_si256(d), _mm256_loadu_si256(s));
+    __m256i d1 =
+        _mm256_xor_si256(_mm256_loadu_si256(d + 1), _mm256_loadu_si256(s + 1));
+    __m256i d2 =
+        _mm256_xor_si256(_mm256_loadu_si256(d + 2), _mm256_loadu_si256(s + 2));
+    __m256i d3 =
+        _mm256_xor_si256(_mm256_loadu_si256(d + 3), _mm256_loadu_si256(s + 3));
+    _mm256_storeu_si256(d, d0);
+    _mm256_storeu_si256(d + 1, d1);
+    _mm256_storeu_si256(d + 2, d2);
+    _mm256_storeu_si256(d + 3, d3);
+  }
+  for (; i + 32 <= length; i += 32) {
+    const __m256i* s = reinterpret_cast<const __m256i*>(src + i);
+    __m256i* d = reinterpret_cast<__m256i*>(dst + i);
+    _mm256_storeu_si256(
+        d, _mm256_xor_si256(_mm256_loadu_si256(d), _mm256_loadu_si256(s)));
+  }
+  if (i + 16 <= length) {
+    const __m128i* s = reinterpret_cast<const __m128i*>(src + i);
+    __m128i* d = reinterpret_cast<__m128i*>(dst + i);
+    _mm_storeu_si128(d, _mm_xor_si128(_mm_loadu_si128(d), _mm_loadu_si128(s)));
+    i += 16;
+  }
+  for (; i < length; ++i) {
+    dst[i] ^= src[i];
+  }
+}
+
+}  // namespace internal
+}  // namespace webrtc
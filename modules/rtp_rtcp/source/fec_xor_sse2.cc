@@ -0,0 +1,45 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/fec_xor_sse2.h"
+
+#include <emmintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace webrtc {
+namespace internal {
+
+void XorBytesSse2(const uint8_t* src, size_t length, uint8_t* dst) {
+  size_t i = 0;
+  for (; i + 64 <= length; i += 64) {
+    const __m128i* s = reinterpret_cast<const __m128i*>(src + i);
+    __m128i* d = reinterpret_cast<__m128i*>(dst + i);
+    __m128i d0 = _mm_xor_si128(_mm_loadu_si128(d), _mm_loadu_si128(s));
+    __m128i d1 = _mm_xor_si128(_mm_loadu_si128(d + 1), _mm_loadu_si128(s + 1));
+    __m128i d2 = _mm_xor_si128(_mm_loadu_si128(d + 2), _mm_loadu_si128(s + 2));
+    __m128i d3 = _mm_xor_si128(_mm_loadu_si128(d + 3), _mm_loadu_si128(s + 3));
+    _mm_storeu_si128(d, d0);
+    _mm_storeu_si128(d + 1, d1);
+    _mm_storeu_si128(d + 2, d2);
+    _mm_storeu_si128(d + 3, d3);
+  }
+  for (; i + 16 <= length; i += 16) {
+    const __m128i* s = reinterpret_cast<const __m128i*>(src + i);
+    __m128i* d = reinterpret_cast<__m128i*>(dst + i);
+    _mm_storeu_si128(d, _mm_xor_si128(_mm_loadu_si128(d), _mm_loadu_si128(s)));
+  }
+  for (; i < length; ++i) {
+    dst[i] ^= src[i];
+  }
+}
+
+}  // namespace internal
+}  // namespace webrtc
@@ -0,0 +1,100 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/fec_xor.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "rtc_base/random.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace internal {
+namespace {
+
+std::vector<uint8_t> RandomBytes(Random& random, size_t size) {
+  std::vector<uint8_t> bytes(size);
+  for (uint8_t& byte : bytes) {
+    byte = random.Rand<uint8_t>();
+  }
+  return bytes;
+}
+
+std::vector<uint8_t> ReferenceXor(const std::vector<uint8_t>& src,
+                                  std::vector<uint8_t> dst,
+                                  size_t offset,
+                                  size_t length) {
+  for (size_t i = 0; i < length; ++i) {
+    dst[offset + i] ^= src[offset + i];
+  }
+  return dst;
+}
+
+class FecXorTest : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(FecXorTest, GenericMatchesReference) {
+  Random random(0x1234);
+  const size_t length = GetParam();
+  // Exercise unaligned starting points as well.
+  for (size_t offset = 0; offset < 4; ++offset) {
+    std::vector<uint8_t> src = RandomBytes(random, length + offset);
+    std::vector<uint8_t> dst = RandomBytes(random, length + offset);
+    std::vector<uint8_t> expected = ReferenceXor(src, dst, offset, length);
+    XorBytesGeneric(src.data() + offset, length, dst.data() + offset);
+    EXPECT_EQ(dst, expected);
+  }
+}
+
+TEST_P(FecXorTest, DispatchedMatchesReference) {
+  Random random(0x5678);
+  const size_t length = GetParam();
+  for (size_t offset = 0; offset < 4; ++offset) {
+    std::vector<uint8_t> src = RandomBytes(random, length + offset);
+    std::vector<uint8_t> dst = RandomBytes(random, length + offset);
+    std::vector<uint8_t> expected = ReferenceXor(src, dst, offset, length);
+    XorBytes(src.data() + offset, length, dst.data() + offset);
+    EXPECT_EQ(dst, expected);
+  }
+}
+
+TEST_P(FecXorTest, XorTwiceRestoresInput) {
+  Random random(0x9abc);
+  const size_t length = GetParam();
+  std::vector<uint8_t> src = RandomBytes(random, length);
+  std::vector<uint8_t> dst = RandomBytes(random, length);
+  const std::vector<uint8_t> original = dst;
+  XorBytes(src.data(), length, dst.data());
+  XorBytes(src.data(), length, dst.data());
+  EXPECT_EQ(dst, original);
+}
+
+INSTANTIATE_TEST_SUITE_P(Lengths,
+                         FecXorTest,
+                         ::testing::Values(0,
+                                           1,
+                                           7,
+                                           15,
+                                           16,
+                                           17,
+                                           31,
+                                           33,
+                                           63,
+                                           64,
+                                           65,
+                                           127,
+                                           129,
+                                           1200,
+                                           1500));
+
+}  // namespace
+}  // namespace internal
+}  // namespace webrtc
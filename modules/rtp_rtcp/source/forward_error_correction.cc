@@ -24,6 +24,7 @@
 #include "modules/include/module_fec_types.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/source/fec_xor.h"
 #include "modules/rtp_rtcp/source/flexfec_03_header_reader_writer.h"
 #include "modules/rtp_rtcp/source/forward_error_correction_internal.h"
 #include "modules/rtp_rtcp/source/ulpfec_header_reader_writer.h"
@@ -211,47 +212,50 @@ void ForwardErrorCorrection::GenerateFecPayloads(
     const PacketList& media_packets,
     size_t num_fec_packets) {
   RTC_DCHECK(!media_packets.empty());
+  RTC_DCHECK_LE(num_fec_packets, kUlpfecMaxMediaPackets);
+  size_t fec_header_sizes[kUlpfecMaxMediaPackets];
   for (size_t i = 0; i < num_fec_packets; ++i) {
-    Packet* const fec_packet = &generated_fec_packets_[i];
-    size_t pkt_mask_idx = i * packet_mask_size_;
     const size_t min_packet_mask_size = fec_header_writer_->MinPacketMaskSize(
-        &packet_masks_[pkt_mask_idx], packet_mask_size_);
-    const size_t fec_header_size =
+        &packet_masks_[i * packet_mask_size_], packet_mask_size_);
+    fec_header_sizes[i] =
         fec_header_writer_->FecHeaderSize(min_packet_mask_size);
+  }
+
+  // Visit each media packet once and XOR it into every FEC packet whose mask
+  // covers it, so that the media payload is read from memory only once.
+  size_t media_pkt_idx = 0;
+  uint16_t prev_seq_num =
+      ParseSequenceNumber(media_packets.front()->data.data());
+  for (const auto& media_packet : media_packets) {
+    const uint16_t seq_num = ParseSequenceNumber(media_packet->data.data());
+    media_pkt_idx += static_cast<uint16_t>(seq_num - prev_seq_num);
+    prev_seq_num = seq_num;
+    const size_t mask_byte_idx = media_pkt_idx / 8;
+    const uint8_t mask_bit = 1 << (7 - (media_pkt_idx % 8));
+    RTC_DCHECK_LT(mask_byte_idx, packet_mask_size_);
+    const size_t media_payload_length =
+        media_packet->data.size() - kRtpHeaderSize;
 
-    size_t media_pkt_idx = 0;
-    auto media_packets_it = media_packets.cbegin();
-    uint16_t prev_seq_num =
-        ParseSequenceNumber((*media_packets_it)->data.data());
-    while (media_packets_it != media_packets.end()) {
-      Packet* const media_packet = media_packets_it->get();
+    for (size_t i = 0; i < num_fec_packets; ++i) {
       // Should `media_packet` be protected by `fec_packet`?
-      if (packet_masks_[pkt_mask_idx] & (1 << (7 - media_pkt_idx))) {
-        size_t media_payload_length =
-            media_packet->data.size() - kRtpHeaderSize;
-
-        size_t fec_packet_length = fec_header_size + media_payload_length;
-        if (fec_packet_length > fec_packet->data.size()) {
-          size_t old_size = fec_packet->data.size();
-          fec_packet->data.SetSize(fec_packet_length);
-          memset(fec_packet->data.MutableData() + old_size, 0,
-                 fec_packet_length - old_size);
-        }
-        XorHeaders(*media_packet, fec_packet);
-        XorPayloads(*media_packet, media_payload_length, fec_header_size,
-                    fec_packet);
+      if (!(packet_masks_[i * packet_mask_size_ + mask_byte_idx] & mask_bit)) {
+        continue;
       }
-      media_packets_it++;
-      if (media_packets_it != media_packets.end()) {
-        uint16_t seq_num =
-            ParseSequenceNumber((*media_packets_it)->data.data());
-        media_pkt_idx += static_cast<uint16_t>(seq_num - prev_seq_num);
-        prev_seq_num = seq_num;
+      Packet* const fec_packet = &generated_fec_packets_[i];
+      size_t fec_packet_length = fec_header_sizes[i] + media_payload_length;
+      if (fec_packet_length > fec_packet->data.size()) {
+        size_t old_size = fec_packet->data.size();
+        fec_packet->data.SetSize(fec_packet_length);
+        memset(fec_packet->data.MutableData() + old_size, 0,
+               fec_packet_length - old_size);
       }
-      pkt_mask_idx += media_pkt_idx / 8;
-      media_pkt_idx %= 8;
+      XorHeaders(*media_packet, fec_packet);
+      XorPayloads(*media_packet, media_payload_length, fec_header_sizes[i],
+                  fec_packet);
     }
-    RTC_DCHECK_GT(fec_packet->data.size(), 0)
+  }
+  for (size_t i = 0; i < num_fec_packets; ++i) {
+    RTC_DCHECK_GT(generated_fec_packets_[i].data.size(), 0)
         << "Packet mask is wrong or poorly designed.";
   }
 }
@@ -649,11 +653,8 @@ void ForwardErrorCorrection::XorPayloads(const Packet& src,
     dst->data.SetSize(new_size);
     memset(dst->data.MutableData() + old_size, 0, new_size - old_size);
   }
-  uint8_t* dst_data = dst->data.MutableData();
-  const uint8_t* src_data = src.data.cdata();
-  for (size_t i = 0; i < payload_length; ++i) {
-    dst_data[dst_offset + i] ^= src_data[kRtpHeaderSize + i];
-  }
+  internal::XorBytes(src.data.cdata() + kRtpHeaderSize, payload_length,
+                     dst->data.MutableData() + dst_offset);
 }
 
 bool ForwardErrorCorrection::RecoverPacket(const ReceivedFecPacket& fec_packet,
@@ -0,0 +1,88 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "modules/include/module_fec_types.h"
+#include "modules/rtp_rtcp/source/fec_test_helper.h"
+#include "modules/rtp_rtcp/source/fec_xor.h"
+#include "modules/rtp_rtcp/source/forward_error_correction.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace {
+
+constexpr uint32_t kMediaSsrc = 1254983;
+constexpr uint32_t kFecSsrc = 1254984;
+// Roughly 20% protection, as used for screenshare.
+constexpr uint8_t kProtectionFactor = 51;
+
+void BM_XorBytesGeneric(benchmark::State& state) {
+  std::vector<uint8_t> src(state.range(0), 0x5a);
+  std::vector<uint8_t> dst(state.range(0), 0xa5);
+  for (auto _ : state) {
+    internal::XorBytesGeneric(src.data(), src.size(), dst.data());
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_XorBytes(benchmark::State& state) {
+  std::vector<uint8_t> src(state.range(0), 0x5a);
+  std::vector<uint8_t> dst(state.range(0), 0xa5);
+  for (auto _ : state) {
+    internal::XorBytes(src.data(), src.size(), dst.data());
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// Encodes FlexFEC for a frame of `state.range(0)` media packets using the mask
+// table selected by `state.range(1)`.
+void BM_EncodeFlexfec(benchmark::State& state) {
+  const int num_media_packets = state.range(0);
+  const FecMaskType mask_type = static_cast<FecMaskType>(state.range(1));
+  Random random(0xfec);
+  test::fec::MediaPacketGenerator generator(/*min_packet_size=*/1000,
+                                            /*max_packet_size=*/1200,
+                                            kMediaSsrc, &random);
+  ForwardErrorCorrection::PacketList media_packets =
+      generator.ConstructMediaPackets(num_media_packets);
+  std::unique_ptr<ForwardErrorCorrection> fec =
+      ForwardErrorCorrection::CreateFlexfec(kFecSsrc, kMediaSsrc);
+
+  size_t bytes_per_frame = 0;
+  for (const auto& packet : media_packets) {
+    bytes_per_frame += packet->data.size();
+  }
+  std::list<ForwardErrorCorrection::Packet*> fec_packets;
+  for (auto _ : state) {
+    fec_packets.clear();
+    fec->EncodeFec(media_packets, kProtectionFactor,
+                   /*num_important_packets=*/0,
+                   /*use_unequal_protection=*/false, mask_type, &fec_packets);
+    benchmark::DoNotOptimize(fec_packets.size());
+  }
+  state.SetBytesProcessed(state.iterations() * bytes_per_frame);
+}
+
+BENCHMARK(BM_XorBytesGeneric)->Arg(100)->Arg(500)->Arg(1200);
+BENCHMARK(BM_XorBytes)->Arg(100)->Arg(500)->Arg(1200);
+BENCHMARK(BM_EncodeFlexfec)
+    ->ArgsProduct({{4, 12, 24, 48}, {kFecMaskRandom, kFecMaskBursty}})
+    ->ArgNames({"media_packets", "mask_type"});
+
+}  // namespace
+}  // namespace webrtc
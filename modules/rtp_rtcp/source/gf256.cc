@@ -0,0 +1,143 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/gf256.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include "modules/rtp_rtcp/source/gf256_neon.h"
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+#include "modules/rtp_rtcp/source/gf256_avx2.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#endif
+
+namespace webrtc {
+namespace internal {
+namespace {
+
+constexpr int kPrimitivePolynomial = 0x11d;
+
+struct Gf256Tables {
+  Gf256Tables() {
+    int x = 1;
+    for (int i = 0; i < 255; ++i) {
+      exp[i] = static_cast<uint8_t>(x);
+      log[x] = static_cast<uint8_t>(i);
+      x <<= 1;
+      if (x & 0x100) {
+        x ^= kPrimitivePolynomial;
+      }
+    }
+    // Duplicate the table so that exp[log[a] + log[b]] needs no modulo.
+    for (int i = 255; i < 512; ++i) {
+      exp[i] = exp[i - 255];
+    }
+    log[0] = 0;
+  }
+
+  uint8_t exp[512];
+  uint8_t log[256];
+};
+
+const Gf256Tables& Tables() {
+  static const Gf256Tables tables;
+  return tables;
+}
+
+using MultiplyAddFunction = void (*)(const uint8_t*,
+                                     const uint8_t*,
+                                     const uint8_t*,
+                                     size_t,
+                                     uint8_t*);
+
+void MultiplyAddNibbles(const uint8_t low_products[16],
+                        const uint8_t high_products[16],
+                        const uint8_t* src,
+                        size_t length,
+                        uint8_t* dst) {
+  for (size_t i = 0; i < length; ++i) {
+    dst[i] ^= low_products[src[i] & 0x0f] ^ high_products[src[i] >> 4];
+  }
+}
+
+MultiplyAddFunction SelectMultiplyAdd() {
+#if defined(WEBRTC_HAS_NEON)
+  return &Gf256MultiplyAddNeon;
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+  if (GetCPUInfo(kAVX2)) {
+    return &Gf256MultiplyAddAvx2;
+  }
+  return &MultiplyAddNibbles;
+#else
+  return &MultiplyAddNibbles;
+#endif
+}
+
+void ComputeNibbleProducts(uint8_t coefficient,
+                           uint8_t low_products[16],
+                           uint8_t high_products[16]) {
+  for (int i = 0; i < 16; ++i) {
+    low_products[i] = Gf256Multiply(coefficient, i);
+    high_products[i] = Gf256Multiply(coefficient, i << 4);
+  }
+}
+
+}  // namespace
+
+uint8_t Gf256Multiply(uint8_t a, uint8_t b) {
+  if (a == 0 || b == 0) {
+    return 0;
+  }
+  const Gf256Tables& tables = Tables();
+  return tables.exp[tables.log[a] + tables.log[b]];
+}
+
+uint8_t Gf256Inverse(uint8_t a) {
+  RTC_DCHECK_NE(a, 0);
+  const Gf256Tables& tables = Tables();
+  return tables.exp[255 - tables.log[a]];
+}
+
+void Gf256MultiplyAdd(uint8_t coefficient,
+                      const uint8_t* src,
+                      size_t length,
+                      uint8_t* dst) {
+  if (coefficient == 0) {
+    return;
+  }
+  // CPU detection is done once; the function-local static is initialized in
+  // a thread-safe manner.
+  static const MultiplyAddFunction multiply_add = SelectMultiplyAdd();
+  uint8_t low_products[16];
+  uint8_t high_products[16];
+  ComputeNibbleProducts(coefficient, low_products, high_products);
+  multiply_add(low_products, high_products, src, length, dst);
+}
+
+void Gf256MultiplyAddGeneric(uint8_t coefficient,
+                             const uint8_t* src,
+                             size_t length,
+                             uint8_t* dst) {
+  if (coefficient == 0) {
+    return;
+  }
+  uint8_t low_products[16];
+  uint8_t high_products[16];
+  ComputeNibbleProducts(coefficient, low_products, high_products);
+  MultiplyAddNibbles(low_products, high_products, src, length, dst);
+}
+
+}  // namespace internal
+}  // namespace webrtc
@@ -0,0 +1,45 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_GF256_H_
+#define MODULES_RTP_RTCP_SOURCE_GF256_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace webrtc {
+namespace internal {
+
+// Arithmetic over GF(2^8) with the primitive polynomial
+// x^8 + x^4 + x^3 + x^2 + 1 (0x11d). Addition is XOR.
+
+uint8_t Gf256Multiply(uint8_t a, uint8_t b);
+
+// Returns the multiplicative inverse of `a`, which must be non-zero.
+uint8_t Gf256Inverse(uint8_t a);
+
+// Performs `dst[i] ^= coefficient * src[i]` for `length` bytes, using the
+// widest vector instruction set available on the running CPU.
+void Gf256MultiplyAdd(uint8_t coefficient,
+                      const uint8_t* src,
+                      size_t length,
+                      uint8_t* dst);
+
+// Portable implementation of `Gf256MultiplyAdd`, exposed for testing and
+// benchmarking.
+void Gf256MultiplyAddGeneric(uint8_t coefficient,
+                             const uint8_t* src,
+                             size_t length,
+                             uint8_t* dst);
+
+}  // namespace internal
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_GF256_H_
@@ -0,0 +1,63 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/gf256_neon.h"
+
+#include <arm_neon.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rtc_base/system/arch.h"
+
+namespace webrtc {
+namespace internal {
+
+void Gf256MultiplyAddNeon(const uint8_t low_products[16],
+                          const uint8_t high_products[16],
+                          const uint8_t* src,
+                          size_t length,
+                          uint8_t* dst) {
+  const uint8x16_t nibble_mask = vdupq_n_u8(0x0f);
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_ARM64)
+  const uint8x16_t low_table = vld1q_u8(low_products);
+  const uint8x16_t high_table = vld1q_u8(high_products);
+  for (; i + 16 <= length; i += 16) {
+    const uint8x16_t x = vld1q_u8(src + i);
+    const uint8x16_t product =
+        veorq_u8(vqtbl1q_u8(low_table, vandq_u8(x, nibble_mask)),
+                 vqtbl1q_u8(high_table, vshrq_n_u8(x, 4)));
+    vst1q_u8(dst + i, veorq_u8(vld1q_u8(dst + i), product));
+  }
+#else
+  // ARMv7 only has 8-lane table lookups.
+  const uint8x8x2_t low_table = {
+      {vld1_u8(low_products), vld1_u8(low_products + 8)}};
+  const uint8x8x2_t high_table = {
+      {vld1_u8(high_products), vld1_u8(high_products + 8)}};
+  for (; i + 16 <= length; i += 16) {
+    const uint8x16_t x = vld1q_u8(src + i);
+    const uint8x16_t low = vandq_u8(x, nibble_mask);
+    const uint8x16_t high = vshrq_n_u8(x, 4);
+    const uint8x16_t product = veorq_u8(
+        vcombine_u8(vtbl2_u8(low_table, vget_low_u8(low)),
+                    vtbl2_u8(low_table, vget_high_u8(low))),
+        vcombine_u8(vtbl2_u8(high_table, vget_low_u8(high)),
+                    vtbl2_u8(high_table, vget_high_u8(high))));
+    vst1q_u8(dst + i, veorq_u8(vld1q_u8(dst + i), product));
+  }
+#endif
+  for (; i < length; ++i) {
+    dst[i] ^= low_products[src[i] & 0x0f] ^ high_products[src[i] >> 4];
+  }
+}
+
+}  // namespace internal
+}  // namespace webrtc
@@ -0,0 +1,32 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_GF256_NEON_H_
+#define MODULES_RTP_RTCP_SOURCE_GF256_NEON_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace webrtc {
+namespace internal {
+
+// NEON implementation of `Gf256MultiplyAdd`, see gf256.h. The product with
+// the coefficient is looked up per nibble: `low_products[x & 0xf]` XOR
+// `high_products[x >> 4]`.
+void Gf256MultiplyAddNeon(const uint8_t low_products[16],
+                          const uint8_t high_products[16],
+                          const uint8_t* src,
+                          size_t length,
+                          uint8_t* dst);
+
+}  // namespace internal
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_GF256_NEON_H_
@@ -0,0 +1,95 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/gf256.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "rtc_base/random.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace internal {
+namespace {
+
+// Bitwise "Russian peasant" multiplication, independent of the lookup tables.
+uint8_t ReferenceMultiply(uint8_t a, uint8_t b) {
+  uint16_t x = a;
+  uint8_t product = 0;
+  while (b != 0) {
+    if (b & 1) {
+      product ^= static_cast<uint8_t>(x);
+    }
+    x <<= 1;
+    if (x & 0x100) {
+      x ^= 0x11d;
+    }
+    b >>= 1;
+  }
+  return product;
+}
+
+std::vector<uint8_t> RandomBytes(Random& random, size_t size) {
+  std::vector<uint8_t> bytes(size);
+  for (uint8_t& byte : bytes) {
+    byte = random.Rand<uint8_t>();
+  }
+  return bytes;
+}
+
+TEST(Gf256Test, MultiplyMatchesReference) {
+  for (int a = 0; a < 256; ++a) {
+    for (int b = 0; b < 256; ++b) {
+      ASSERT_EQ(Gf256Multiply(a, b), ReferenceMultiply(a, b))
+          << "a=" << a << " b=" << b;
+    }
+  }
+}
+
+TEST(Gf256Test, InverseIsMultiplicativeInverse) {
+  for (int a = 1; a < 256; ++a) {
+    EXPECT_EQ(Gf256Multiply(a, Gf256Inverse(a)), 1) << "a=" << a;
+  }
+}
+
+class Gf256MultiplyAddTest : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(Gf256MultiplyAddTest, GenericAndDispatchedMatchReference) {
+  Random random(0x1234);
+  const size_t length = GetParam();
+  for (int coefficient : {0, 1, 2, 0x53, 0xff}) {
+    // Exercise unaligned starting points as well.
+    for (size_t offset = 0; offset < 4; ++offset) {
+      std::vector<uint8_t> src = RandomBytes(random, length + offset);
+      std::vector<uint8_t> dst = RandomBytes(random, length + offset);
+      std::vector<uint8_t> expected = dst;
+      for (size_t i = offset; i < length + offset; ++i) {
+        expected[i] ^= ReferenceMultiply(coefficient, src[i]);
+      }
+      std::vector<uint8_t> generic = dst;
+      Gf256MultiplyAddGeneric(coefficient, src.data() + offset, length,
+                              generic.data() + offset);
+      EXPECT_EQ(generic, expected);
+      Gf256MultiplyAdd(coefficient, src.data() + offset, length,
+                       dst.data() + offset);
+      EXPECT_EQ(dst, expected);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Lengths,
+                         Gf256MultiplyAddTest,
+                         ::testing::Values(0, 1, 15, 16, 31, 32, 33, 1202));
+
+}  // namespace
+}  // namespace internal
+}  // namespace webrtc
@@ -0,0 +1,158 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_codec.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "api/array_view.h"
+#include "modules/rtp_rtcp/source/gf256.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+using internal::Gf256Inverse;
+using internal::Gf256Multiply;
+using internal::Gf256MultiplyAdd;
+
+ReedSolomonCodec::ReedSolomonCodec(int num_data_shards, int num_parity_shards)
+    : num_data_shards_(num_data_shards),
+      num_parity_shards_(num_parity_shards),
+      parity_matrix_(num_parity_shards * num_data_shards) {
+  RTC_DCHECK_GT(num_data_shards_, 0);
+  RTC_DCHECK_GE(num_parity_shards_, 0);
+  RTC_DCHECK_LE(num_data_shards_ + num_parity_shards_, kMaxShards);
+  // Element (i, j) is 1 / (x_i + y_j) with x_i = num_data_shards + i and
+  // y_j = j. Every square submatrix of a Cauchy matrix is invertible, which
+  // makes every square submatrix of the stacked [identity; Cauchy] matrix
+  // formed from distinct rows invertible too.
+  for (int i = 0; i < num_parity_shards_; ++i) {
+    for (int j = 0; j < num_data_shards_; ++j) {
+      parity_matrix_[i * num_data_shards_ + j] =
+          Gf256Inverse(static_cast<uint8_t>((num_data_shards_ + i) ^ j));
+    }
+  }
+}
+
+ReedSolomonCodec::~ReedSolomonCodec() = default;
+
+void ReedSolomonCodec::Encode(ArrayView<const uint8_t* const> data,
+                              ArrayView<uint8_t* const> parity,
+                              size_t shard_length) const {
+  RTC_DCHECK_EQ(data.size(), num_data_shards_);
+  RTC_DCHECK_EQ(parity.size(), num_parity_shards_);
+  for (int i = 0; i < num_parity_shards_; ++i) {
+    memset(parity[i], 0, shard_length);
+  }
+  // Iterate data shards in the outer loop so that each data shard is read
+  // from memory once while it is folded into all parity shards.
+  for (int j = 0; j < num_data_shards_; ++j) {
+    for (int i = 0; i < num_parity_shards_; ++i) {
+      Gf256MultiplyAdd(ParityCoefficient(i, j), data[j], shard_length,
+                       parity[i]);
+    }
+  }
+}
+
+bool ReedSolomonCodec::Decode(ArrayView<const uint8_t* const> shards,
+                              ArrayView<uint8_t* const> recovered_data,
+                              size_t shard_length) const {
+  const int k = num_data_shards_;
+  RTC_DCHECK_EQ(shards.size(), k + num_parity_shards_);
+  RTC_DCHECK_EQ(recovered_data.size(), k);
+
+  // Pick `k` present shards, preferring data shards since their rows of the
+  // generator matrix are trivial.
+  std::vector<int> rows;
+  rows.reserve(k);
+  std::vector<int> missing_data;
+  for (int j = 0; j < k; ++j) {
+    if (shards[j] != nullptr) {
+      rows.push_back(j);
+    } else {
+      missing_data.push_back(j);
+    }
+  }
+  if (missing_data.empty()) {
+    return true;
+  }
+  for (int i = 0; i < num_parity_shards_ && static_cast<int>(rows.size()) < k;
+       ++i) {
+    if (shards[k + i] != nullptr) {
+      rows.push_back(k + i);
+    }
+  }
+  if (static_cast<int>(rows.size()) < k) {
+    return false;
+  }
+
+  // Build the k x k submatrix of the generator matrix for the chosen shards
+  // and invert it with Gauss-Jordan elimination.
+  std::vector<uint8_t> matrix(k * k, 0);
+  std::vector<uint8_t> inverse(k * k, 0);
+  for (int r = 0; r < k; ++r) {
+    if (rows[r] < k) {
+      matrix[r * k + rows[r]] = 1;
+    } else {
+      for (int c = 0; c < k; ++c) {
+        matrix[r * k + c] = ParityCoefficient(rows[r] - k, c);
+      }
+    }
+    inverse[r * k + r] = 1;
+  }
+  for (int c = 0; c < k; ++c) {
+    int pivot = c;
+    while (matrix[pivot * k + c] == 0) {
+      ++pivot;
+      // Cannot happen for a Cauchy based generator matrix.
+      RTC_CHECK_LT(pivot, k);
+    }
+    if (pivot != c) {
+      std::swap_ranges(&matrix[pivot * k], &matrix[pivot * k] + k,
+                       &matrix[c * k]);
+      std::swap_ranges(&inverse[pivot * k], &inverse[pivot * k] + k,
+                       &inverse[c * k]);
+    }
+    const uint8_t scale = Gf256Inverse(matrix[c * k + c]);
+    for (int i = 0; i < k; ++i) {
+      matrix[c * k + i] = Gf256Multiply(matrix[c * k + i], scale);
+      inverse[c * k + i] = Gf256Multiply(inverse[c * k + i], scale);
+    }
+    for (int r = 0; r < k; ++r) {
+      const uint8_t factor = matrix[r * k + c];
+      if (r == c || factor == 0) {
+        continue;
+      }
+      for (int i = 0; i < k; ++i) {
+        matrix[r * k + i] ^= Gf256Multiply(factor, matrix[c * k + i]);
+        inverse[r * k + i] ^= Gf256Multiply(factor, inverse[c * k + i]);
+      }
+    }
+  }
+
+  // Data shard j is row j of the inverse applied to the chosen shards.
+  for (int j : missing_data) {
+    uint8_t* const out = recovered_data[j];
+    RTC_DCHECK(out);
+    memset(out, 0, shard_length);
+    for (int r = 0; r < k; ++r) {
+      Gf256MultiplyAdd(inverse[j * k + r], shards[rows[r]], shard_length, out);
+    }
+  }
+  return true;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_CODEC_H_
+#define MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_CODEC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "api/array_view.h"
+
+namespace webrtc {
+
+// Systematic Reed-Solomon erasure code over GF(2^8). `num_data_shards` data
+// shards are extended with `num_parity_shards` parity shards generated from a
+// Cauchy matrix, so that any `num_data_shards` of the resulting shards are
+// sufficient to reconstruct all data shards. All shards of a block have the
+// same length.
+class ReedSolomonCodec {
+ public:
+  // The Cauchy construction requires all shard indices to be distinct field
+  // elements.
+  static constexpr int kMaxShards = 256;
+
+  ReedSolomonCodec(int num_data_shards, int num_parity_shards);
+  ~ReedSolomonCodec();
+
+  int num_data_shards() const { return num_data_shards_; }
+  int num_parity_shards() const { return num_parity_shards_; }
+
+  // Computes the parity shards. `data` holds `num_data_shards` and `parity`
+  // holds `num_parity_shards` pointers, each to `shard_length` bytes.
+  void Encode(ArrayView<const uint8_t* const> data,
+              ArrayView<uint8_t* const> parity,
+              size_t shard_length) const;
+
+  // Reconstructs missing data shards. `shards` holds the
+  // `num_data_shards + num_parity_shards` shards of a block, data shards
+  // first, with nullptr marking a lost shard. For every lost data shard `i`,
+  // the reconstruction is written to `recovered_data[i]`. Returns false, and
+  // leaves `recovered_data` untouched, if fewer than `num_data_shards` shards
+  // are present.
+  bool Decode(ArrayView<const uint8_t* const> shards,
+              ArrayView<uint8_t* const> recovered_data,
+              size_t shard_length) const;
+
+ private:
+  uint8_t ParityCoefficient(int parity_index, int data_index) const {
+    return parity_matrix_[parity_index * num_data_shards_ + data_index];
+  }
+
+  const int num_data_shards_;
+  const int num_parity_shards_;
+  // Row-major `num_parity_shards` x `num_data_shards` Cauchy matrix.
+  std::vector<uint8_t> parity_matrix_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_CODEC_H_
@@ -0,0 +1,128 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_codec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "rtc_base/random.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr size_t kShardLength = 103;
+
+class ReedSolomonCodecTest
+    : public ::testing::TestWithParam<std::tuple<int, int>> {
+ protected:
+  ReedSolomonCodecTest()
+      : num_data_(std::get<0>(GetParam())),
+        num_parity_(std::get<1>(GetParam())),
+        codec_(num_data_, num_parity_),
+        random_(0x7e57),
+        shards_(num_data_ + num_parity_, std::vector<uint8_t>(kShardLength)) {
+    for (int i = 0; i < num_data_; ++i) {
+      for (uint8_t& byte : shards_[i]) {
+        byte = random_.Rand<uint8_t>();
+      }
+    }
+    std::vector<const uint8_t*> data;
+    std::vector<uint8_t*> parity;
+    for (int i = 0; i < num_data_; ++i) {
+      data.push_back(shards_[i].data());
+    }
+    for (int i = 0; i < num_parity_; ++i) {
+      parity.push_back(shards_[num_data_ + i].data());
+    }
+    codec_.Encode(data, parity, kShardLength);
+  }
+
+  // Drops `num_lost` random shards and tries to reconstruct the data shards.
+  bool DecodeWithLosses(int num_lost) {
+    std::vector<const uint8_t*> received;
+    for (const std::vector<uint8_t>& shard : shards_) {
+      received.push_back(shard.data());
+    }
+    for (int lost = 0; lost < num_lost;) {
+      int index = random_.Rand(0, num_data_ + num_parity_ - 1);
+      if (received[index] != nullptr) {
+        received[index] = nullptr;
+        ++lost;
+      }
+    }
+    recovered_.assign(num_data_, std::vector<uint8_t>(kShardLength, 0xaa));
+    std::vector<uint8_t*> recovered_data;
+    for (int i = 0; i < num_data_; ++i) {
+      recovered_data.push_back(received[i] == nullptr ? recovered_[i].data()
+                                                      : nullptr);
+    }
+    if (!codec_.Decode(received, recovered_data, kShardLength)) {
+      return false;
+    }
+    for (int i = 0; i < num_data_; ++i) {
+      if (recovered_data[i] != nullptr) {
+        EXPECT_EQ(recovered_[i], shards_[i]) << "data shard " << i;
+      }
+    }
+    return true;
+  }
+
+  const int num_data_;
+  const int num_parity_;
+  const ReedSolomonCodec codec_;
+  Random random_;
+  std::vector<std::vector<uint8_t>> shards_;
+  std::vector<std::vector<uint8_t>> recovered_;
+};
+
+TEST_P(ReedSolomonCodecTest, RecoversFromUpToParityCountLosses) {
+  for (int num_lost = 0; num_lost <= num_parity_; ++num_lost) {
+    for (int trial = 0; trial < 10; ++trial) {
+      EXPECT_TRUE(DecodeWithLosses(num_lost)) << num_lost << " lost";
+    }
+  }
+}
+
+TEST_P(ReedSolomonCodecTest, FailsWithMoreLossesThanParityCount) {
+  EXPECT_FALSE(DecodeWithLosses(num_parity_ + 1));
+}
+
+TEST_P(ReedSolomonCodecTest, RecoversFromLossOfFirstDataShards) {
+  // A burst at the start of the block.
+  std::vector<const uint8_t*> received;
+  for (const std::vector<uint8_t>& shard : shards_) {
+    received.push_back(shard.data());
+  }
+  recovered_.assign(num_parity_, std::vector<uint8_t>(kShardLength));
+  std::vector<uint8_t*> recovered_data(num_data_, nullptr);
+  for (int i = 0; i < num_parity_ && i < num_data_; ++i) {
+    received[i] = nullptr;
+    recovered_data[i] = recovered_[i].data();
+  }
+  ASSERT_TRUE(codec_.Decode(received, recovered_data, kShardLength));
+  for (int i = 0; i < num_parity_ && i < num_data_; ++i) {
+    EXPECT_EQ(recovered_[i], shards_[i]);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Sizes,
+                         ReedSolomonCodecTest,
+                         ::testing::Values(std::make_tuple(1, 1),
+                                           std::make_tuple(4, 2),
+                                           std::make_tuple(10, 3),
+                                           std::make_tuple(24, 8),
+                                           std::make_tuple(128, 32)));
+
+}  // namespace
+}  // namespace webrtc
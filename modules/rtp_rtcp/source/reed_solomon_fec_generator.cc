@@ -0,0 +1,288 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_fec_generator.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/array_view.h"
+#include "api/environment/environment.h"
+#include "api/rtp_parameters.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/include/module_fec_types.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/source/reed_solomon_codec.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_header.h"
+#include "modules/rtp_rtcp/source/rtp_header_extension_size.h"
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/race_checker.h"
+#include "rtc_base/synchronization/mutex.h"
+
+namespace webrtc {
+
+namespace {
+
+// Let first sequence number be in the first half of the interval.
+constexpr uint16_t kMaxInitRtpSeqNumber = 0x7fff;
+
+// Use the 90 kHz video clock for the RTP timestamps, as FlexFEC does.
+constexpr int kMsToRtpTimestamp = kVideoPayloadTypeFrequency / 1000;
+
+RtpHeaderExtensionMap RegisterSupportedExtensions(
+    const std::vector<RtpExtension>& rtp_header_extensions) {
+  RtpHeaderExtensionMap map;
+  for (const auto& extension : rtp_header_extensions) {
+    if (extension.uri == TransportSequenceNumber::Uri()) {
+      map.Register<TransportSequenceNumber>(extension.id);
+    } else if (extension.uri == AbsoluteSendTime::Uri()) {
+      map.Register<AbsoluteSendTime>(extension.id);
+    } else if (extension.uri == TransmissionOffset::Uri()) {
+      map.Register<TransmissionOffset>(extension.id);
+    } else if (extension.uri == RtpMid::Uri()) {
+      map.Register<RtpMid>(extension.id);
+    }
+  }
+  return map;
+}
+
+}  // namespace
+
+ReedSolomonFecGenerator::ReedSolomonFecGenerator(
+    const Environment& env,
+    int payload_type,
+    uint32_t ssrc,
+    uint32_t protected_media_ssrc,
+    absl::string_view mid,
+    const std::vector<RtpExtension>& rtp_header_extensions,
+    ArrayView<const RtpExtensionSize> extension_sizes,
+    const RtpState* rtp_state)
+    : env_(env),
+      random_(env_.clock().TimeInMicroseconds()),
+      payload_type_(payload_type),
+      timestamp_offset_(rtp_state ? rtp_state->start_timestamp
+                                  : random_.Rand<uint32_t>()),
+      ssrc_(ssrc),
+      protected_media_ssrc_(protected_media_ssrc),
+      mid_(mid),
+      rtp_header_extension_map_(
+          RegisterSupportedExtensions(rtp_header_extensions)),
+      header_extensions_size_(
+          RtpHeaderExtensionSize(extension_sizes, rtp_header_extension_map_)),
+      seq_num_(rtp_state ? rtp_state->sequence_number
+                         : random_.Rand(1, kMaxInitRtpSeqNumber)),
+      fec_bitrate_(/*max_window_size=*/TimeDelta::Seconds(1)) {
+  RTC_DCHECK_GE(payload_type, 0);
+  RTC_DCHECK_LE(payload_type, 127);
+  media_packets_.reserve(kMaxMediaPacketsPerBlock);
+}
+
+ReedSolomonFecGenerator::~ReedSolomonFecGenerator() = default;
+
+void ReedSolomonFecGenerator::SetProtectionParameters(
+    const FecProtectionParams& delta_params,
+    const FecProtectionParams& key_params) {
+  RTC_DCHECK_GE(delta_params.fec_rate, 0);
+  RTC_DCHECK_LE(delta_params.fec_rate, 255);
+  RTC_DCHECK_GE(key_params.fec_rate, 0);
+  RTC_DCHECK_LE(key_params.fec_rate, 255);
+  // Applied from the next block on.
+  MutexLock lock(&mutex_);
+  pending_params_.emplace(Params{delta_params, key_params});
+}
+
+void ReedSolomonFecGenerator::AddPacketAndGenerateFec(
+    const RtpPacketToSend& packet) {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  RTC_DCHECK_EQ(packet.Ssrc(), protected_media_ssrc_);
+  if (media_packets_.empty()) {
+    MutexLock lock(&mutex_);
+    if (pending_params_) {
+      current_params_ = *pending_params_;
+      pending_params_.reset();
+    }
+  }
+
+  // A block protects consecutive sequence numbers only; close the current
+  // block if there is a gap.
+  if (!media_packets_.empty() &&
+      packet.SequenceNumber() !=
+          static_cast<uint16_t>(base_sequence_number_ +
+                                media_packets_.size())) {
+    GenerateFec();
+  }
+  if (media_packets_.empty()) {
+    base_sequence_number_ = packet.SequenceNumber();
+  }
+  media_packets_.push_back(packet.Buffer());
+  if (packet.is_key_frame()) {
+    media_contains_keyframe_ = true;
+  }
+  if (packet.Marker()) {
+    ++num_protected_frames_;
+  }
+
+  if ((packet.Marker() &&
+       num_protected_frames_ >= CurrentParams().max_fec_frames) ||
+      media_packets_.size() >= kMaxMediaPacketsPerBlock) {
+    GenerateFec();
+  }
+}
+
+const FecProtectionParams& ReedSolomonFecGenerator::CurrentParams() const {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  return media_contains_keyframe_ ? current_params_.keyframe_params
+                                  : current_params_.delta_params;
+}
+
+void ReedSolomonFecGenerator::GenerateFec() {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  const int num_media_packets = static_cast<int>(media_packets_.size());
+  const int fec_rate = CurrentParams().fec_rate;
+  if (num_media_packets == 0 || fec_rate <= 0) {
+    ResetBlock();
+    return;
+  }
+  // Round to nearest, but always send at least one parity packet.
+  const int num_parity_packets = std::clamp(
+      (num_media_packets * fec_rate + (1 << 7)) >> 8, 1, num_media_packets);
+
+  size_t max_media_packet_size = 0;
+  for (const CopyOnWriteBuffer& media_packet : media_packets_) {
+    max_media_packet_size =
+        std::max(max_media_packet_size, media_packet.size());
+  }
+  const size_t shard_length =
+      ReedSolomonFecHeader::kShardLengthFieldSize + max_media_packet_size;
+
+  data_shards_.assign(num_media_packets * shard_length, 0);
+  std::vector<const uint8_t*> data(num_media_packets);
+  for (int i = 0; i < num_media_packets; ++i) {
+    uint8_t* shard = &data_shards_[i * shard_length];
+    const CopyOnWriteBuffer& media_packet = media_packets_[i];
+    ByteWriter<uint16_t>::WriteBigEndian(
+        shard, static_cast<uint16_t>(media_packet.size()));
+    memcpy(shard + ReedSolomonFecHeader::kShardLengthFieldSize,
+           media_packet.cdata(), media_packet.size());
+    data[i] = shard;
+  }
+
+  ReedSolomonFecHeader header;
+  header.base_sequence_number = base_sequence_number_;
+  header.num_media_packets = num_media_packets;
+  header.num_parity_packets = num_parity_packets;
+  header.shard_length = shard_length;
+  std::vector<uint8_t*> parity(num_parity_packets);
+  for (int i = 0; i < num_parity_packets; ++i) {
+    CopyOnWriteBuffer payload(ReedSolomonFecHeader::kSize + shard_length);
+    header.parity_index = i;
+    header.Write(ArrayView<uint8_t>(payload.MutableData(), payload.size()));
+    parity[i] = payload.MutableData() + ReedSolomonFecHeader::kSize;
+    generated_fec_payloads_.push_back(std::move(payload));
+  }
+  ReedSolomonCodec codec(num_media_packets, num_parity_packets);
+  codec.Encode(data, parity, shard_length);
+
+  ResetBlock();
+}
+
+void ReedSolomonFecGenerator::ResetBlock() {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  media_packets_.clear();
+  num_protected_frames_ = 0;
+  media_contains_keyframe_ = false;
+}
+
+std::vector<std::unique_ptr<RtpPacketToSend>>
+ReedSolomonFecGenerator::GetFecPackets() {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  std::vector<std::unique_ptr<RtpPacketToSend>> fec_packets_to_send;
+  if (generated_fec_payloads_.empty()) {
+    return fec_packets_to_send;
+  }
+  fec_packets_to_send.reserve(generated_fec_payloads_.size());
+  const Timestamp now = env_.clock().CurrentTime();
+  size_t total_fec_data_bytes = 0;
+  for (const CopyOnWriteBuffer& fec_payload : generated_fec_payloads_) {
+    auto fec_packet_to_send =
+        std::make_unique<RtpPacketToSend>(&rtp_header_extension_map_);
+    fec_packet_to_send->set_packet_type(
+        RtpPacketMediaType::kForwardErrorCorrection);
+    fec_packet_to_send->set_allow_retransmission(false);
+
+    // RTP header.
+    fec_packet_to_send->SetMarker(false);
+    fec_packet_to_send->SetPayloadType(payload_type_);
+    fec_packet_to_send->SetSequenceNumber(seq_num_++);
+    fec_packet_to_send->SetTimestamp(
+        timestamp_offset_ +
+        static_cast<uint32_t>(kMsToRtpTimestamp * now.ms()));
+    fec_packet_to_send->set_capture_time(now);
+    fec_packet_to_send->SetSsrc(ssrc_);
+    // Reserve extensions, if registered. These will be set by the RTPSender.
+    fec_packet_to_send->ReserveExtension<AbsoluteSendTime>();
+    fec_packet_to_send->ReserveExtension<TransmissionOffset>();
+    fec_packet_to_send->ReserveExtension<TransportSequenceNumber>();
+    if (!mid_.empty()) {
+      // This is a no-op if the MID header extension is not registered.
+      fec_packet_to_send->SetExtension<RtpMid>(mid_);
+    }
+
+    // RTP payload.
+    uint8_t* payload = fec_packet_to_send->AllocatePayload(fec_payload.size());
+    memcpy(payload, fec_payload.cdata(), fec_payload.size());
+
+    total_fec_data_bytes += fec_packet_to_send->size();
+    fec_packets_to_send.push_back(std::move(fec_packet_to_send));
+  }
+  generated_fec_payloads_.clear();
+
+  MutexLock lock(&mutex_);
+  fec_bitrate_.Update(total_fec_data_bytes, now);
+  return fec_packets_to_send;
+}
+
+// The parity packet carries, in addition to its own RTP header and the BWE
+// header extensions, the FEC header and the length field of each data shard.
+size_t ReedSolomonFecGenerator::MaxPacketOverhead() const {
+  return kRtpHeaderSize + header_extensions_size_ +
+         ReedSolomonFecHeader::kSize +
+         ReedSolomonFecHeader::kShardLengthFieldSize;
+}
+
+DataRate ReedSolomonFecGenerator::CurrentFecRate() const {
+  MutexLock lock(&mutex_);
+  return fec_bitrate_.Rate(env_.clock().CurrentTime())
+      .value_or(DataRate::Zero());
+}
+
+std::optional<RtpState> ReedSolomonFecGenerator::GetRtpState() {
+  RtpState rtp_state;
+  rtp_state.sequence_number = seq_num_;
+  rtp_state.start_timestamp = timestamp_offset_;
+  return rtp_state;
+}
+
+}  // namespace webrtc
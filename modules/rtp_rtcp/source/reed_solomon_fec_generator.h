@@ -0,0 +1,124 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_GENERATOR_H_
+#define MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_GENERATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/array_view.h"
+#include "api/environment/environment.h"
+#include "api/rtp_parameters.h"
+#include "api/units/data_rate.h"
+#include "modules/include/module_fec_types.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/rtp_header_extension_size.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "modules/rtp_rtcp/source/video_fec_generator.h"
+#include "rtc_base/bitrate_tracker.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/race_checker.h"
+#include "rtc_base/random.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Generates systematic Reed-Solomon parity packets, sent on a separate SSRC in
+// the same way as FlexFEC. Unlike the XOR based codes, a block of N media
+// packets protected by M parity packets can be recovered from any M losses,
+// which makes it robust against bursts. A block spans up to
+// `FecProtectionParams::max_fec_frames` frames. The payload format is
+// described in reed_solomon_fec_header.h and is not standardized, so it must
+// only be used when the receiver is known to run ReedSolomonFecReceiver.
+//
+// Like FlexfecSender this class requires external synchronization, except for
+// SetProtectionParameters() and CurrentFecRate().
+class ReedSolomonFecGenerator : public VideoFecGenerator {
+ public:
+  // Upper bound on media packets per block. Bounds decoding cost and keeps
+  // the total number of shards within the field size.
+  static constexpr size_t kMaxMediaPacketsPerBlock = 128;
+
+  ReedSolomonFecGenerator(
+      const Environment& env,
+      int payload_type,
+      uint32_t ssrc,
+      uint32_t protected_media_ssrc,
+      absl::string_view mid,
+      const std::vector<RtpExtension>& rtp_header_extensions,
+      ArrayView<const RtpExtensionSize> extension_sizes,
+      const RtpState* rtp_state);
+  ~ReedSolomonFecGenerator() override;
+
+  FecType GetFecType() const override {
+    return VideoFecGenerator::FecType::kReedSolomon;
+  }
+  std::optional<uint32_t> FecSsrc() override { return ssrc_; }
+  size_t MaxPacketOverhead() const override;
+  DataRate CurrentFecRate() const override;
+  void SetProtectionParameters(const FecProtectionParams& delta_params,
+                               const FecProtectionParams& key_params) override;
+  void AddPacketAndGenerateFec(const RtpPacketToSend& packet) override;
+  std::vector<std::unique_ptr<RtpPacketToSend>> GetFecPackets() override;
+  std::optional<RtpState> GetRtpState() override;
+
+ private:
+  struct Params {
+    FecProtectionParams delta_params;
+    FecProtectionParams keyframe_params;
+  };
+
+  const FecProtectionParams& CurrentParams() const;
+  // Encodes the buffered media packets into parity payloads and starts a new
+  // block.
+  void GenerateFec();
+  void ResetBlock();
+
+  const Environment env_;
+  Random random_;
+
+  // Config.
+  const int payload_type_;
+  const uint32_t timestamp_offset_;
+  const uint32_t ssrc_;
+  const uint32_t protected_media_ssrc_;
+  const std::string mid_;
+  const RtpHeaderExtensionMap rtp_header_extension_map_;
+  const size_t header_extensions_size_;
+  // Sequence number of next packet to generate.
+  uint16_t seq_num_;
+
+  RaceChecker race_checker_;
+  Params current_params_ RTC_GUARDED_BY(race_checker_);
+  std::vector<CopyOnWriteBuffer> media_packets_ RTC_GUARDED_BY(race_checker_);
+  uint16_t base_sequence_number_ RTC_GUARDED_BY(race_checker_) = 0;
+  int num_protected_frames_ RTC_GUARDED_BY(race_checker_) = 0;
+  bool media_contains_keyframe_ RTC_GUARDED_BY(race_checker_) = false;
+  // Scratch space for the data shards, reused between blocks.
+  std::vector<uint8_t> data_shards_ RTC_GUARDED_BY(race_checker_);
+  std::vector<CopyOnWriteBuffer> generated_fec_payloads_
+      RTC_GUARDED_BY(race_checker_);
+
+  mutable Mutex mutex_;
+  std::optional<Params> pending_params_ RTC_GUARDED_BY(mutex_);
+  BitrateTracker fec_bitrate_ RTC_GUARDED_BY(mutex_);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_GENERATOR_H_
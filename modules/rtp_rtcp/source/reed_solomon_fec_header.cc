@@ -0,0 +1,58 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_fec_header.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "api/array_view.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/source/reed_solomon_codec.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+bool ReedSolomonFecHeader::Parse(ArrayView<const uint8_t> payload) {
+  if (payload.size() < kSize) {
+    return false;
+  }
+  base_sequence_number = ByteReader<uint16_t>::ReadBigEndian(&payload[0]);
+  num_media_packets = payload[2];
+  num_parity_packets = payload[3];
+  parity_index = payload[4];
+  shard_length = ByteReader<uint16_t>::ReadBigEndian(&payload[6]);
+  return num_media_packets > 0 && num_parity_packets > 0 &&
+         parity_index < num_parity_packets &&
+         num_media_packets + num_parity_packets <=
+             ReedSolomonCodec::kMaxShards &&
+         shard_length >= kShardLengthFieldSize + kRtpHeaderSize &&
+         payload.size() == kSize + shard_length;
+}
+
+void ReedSolomonFecHeader::Write(ArrayView<uint8_t> buffer) const {
+  RTC_DCHECK_GE(buffer.size(), kSize);
+  RTC_DCHECK_GT(num_media_packets, 0);
+  RTC_DCHECK_LE(num_media_packets, 255);
+  RTC_DCHECK_GT(num_parity_packets, 0);
+  RTC_DCHECK_LE(num_parity_packets, 255);
+  RTC_DCHECK_LT(parity_index, num_parity_packets);
+  RTC_DCHECK_LE(shard_length, 0xffff);
+  ByteWriter<uint16_t>::WriteBigEndian(&buffer[0], base_sequence_number);
+  buffer[2] = static_cast<uint8_t>(num_media_packets);
+  buffer[3] = static_cast<uint8_t>(num_parity_packets);
+  buffer[4] = static_cast<uint8_t>(parity_index);
+  buffer[5] = 0;
+  ByteWriter<uint16_t>::WriteBigEndian(&buffer[6],
+                                       static_cast<uint16_t>(shard_length));
+}
+
+}  // namespace webrtc
@@ -0,0 +1,54 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_HEADER_H_
+#define MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_HEADER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "api/array_view.h"
+
+namespace webrtc {
+
+// Header that precedes the parity shard in the payload of a Reed-Solomon FEC
+// packet. A block protects `num_media_packets` media packets with consecutive
+// sequence numbers starting at `base_sequence_number`.
+//
+//  0                   1                   2                   3
+//  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+// +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// |     base sequence number      | num media     | num parity    |
+// +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// | parity index  |   reserved    |         shard length          |
+// +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// |                     parity shard ...                          |
+//
+// Data shard i is the complete i:th media RTP packet prefixed with its 16-bit
+// length and zero padded to `shard_length` bytes.
+struct ReedSolomonFecHeader {
+  static constexpr size_t kSize = 8;
+  static constexpr size_t kShardLengthFieldSize = 2;
+
+  // Parses `payload` (the RTP payload of an FEC packet). Returns false if the
+  // header is malformed or inconsistent with the payload size.
+  bool Parse(ArrayView<const uint8_t> payload);
+  void Write(ArrayView<uint8_t> buffer) const;
+
+  uint16_t base_sequence_number = 0;
+  int num_media_packets = 0;
+  int num_parity_packets = 0;
+  int parity_index = 0;
+  size_t shard_length = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_HEADER_H_
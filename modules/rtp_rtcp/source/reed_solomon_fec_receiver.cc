@@ -0,0 +1,271 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_fec_receiver.h"
+
+#include <string.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "api/sequence_checker.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/rtp_rtcp/include/recovered_packet_receiver.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/source/reed_solomon_codec.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_header.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/logging.h"
+
+namespace webrtc {
+
+namespace {
+
+// Media packets and blocks older than this, in sequence numbers, relative to
+// the newest received media packet are forgotten.
+constexpr int64_t kMaxPacketAge = 1000;
+
+// How often to log the recovered packets to the text log.
+constexpr TimeDelta kPacketLogInterval = TimeDelta::Seconds(10);
+
+}  // namespace
+
+ReedSolomonFecReceiver::Block::Block() = default;
+ReedSolomonFecReceiver::Block::Block(Block&&) = default;
+ReedSolomonFecReceiver::Block& ReedSolomonFecReceiver::Block::operator=(
+    Block&&) = default;
+ReedSolomonFecReceiver::Block::~Block() = default;
+
+ReedSolomonFecReceiver::ReedSolomonFecReceiver(
+    Clock* clock,
+    uint32_t ssrc,
+    uint32_t protected_media_ssrc,
+    RecoveredPacketReceiver* recovered_packet_receiver)
+    : ssrc_(ssrc),
+      protected_media_ssrc_(protected_media_ssrc),
+      recovered_packet_receiver_(recovered_packet_receiver),
+      clock_(clock) {
+  // It's OK to create this object on a different thread/task queue than
+  // the one used during main operation.
+  sequence_checker_.Detach();
+}
+
+ReedSolomonFecReceiver::~ReedSolomonFecReceiver() = default;
+
+void ReedSolomonFecReceiver::OnRtpPacket(const RtpPacketReceived& packet) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  // Packets recovered by this object are delivered back here through the
+  // callback; they are already accounted for.
+  if (packet.recovered()) {
+    return;
+  }
+
+  if (packet.Ssrc() == ssrc_) {
+    ++packet_counter_.num_packets;
+    ++packet_counter_.num_fec_packets;
+    InsertFecPacket(packet);
+  } else if (packet.Ssrc() == protected_media_ssrc_) {
+    ++packet_counter_.num_packets;
+    InsertMediaPacket(unwrapper_.Unwrap(packet.SequenceNumber()), packet);
+  } else {
+    return;
+  }
+
+  if (recovered_packets_.empty()) {
+    return;
+  }
+  // The callback may end up in OnRtpPacket() again, so detach the list first.
+  std::vector<RtpPacketReceived> recovered_packets;
+  recovered_packets.swap(recovered_packets_);
+  for (const RtpPacketReceived& recovered_packet : recovered_packets) {
+    ++packet_counter_.num_recovered_packets;
+    recovered_packet_receiver_->OnRecoveredPacket(recovered_packet);
+
+    // Periodically log the recovered packets at LS_INFO.
+    Timestamp now = clock_->CurrentTime();
+    bool should_log_periodically =
+        now - last_recovered_packet_ > kPacketLogInterval;
+    if (RTC_LOG_CHECK_LEVEL(LS_VERBOSE) || should_log_periodically) {
+      LoggingSeverity level = should_log_periodically ? LS_INFO : LS_VERBOSE;
+      RTC_LOG_V(level) << "Recovered media packet with SSRC: "
+                       << recovered_packet.Ssrc() << " seq "
+                       << recovered_packet.SequenceNumber()
+                       << " from Reed-Solomon FEC stream with SSRC: " << ssrc_;
+      if (should_log_periodically) {
+        last_recovered_packet_ = now;
+      }
+    }
+  }
+}
+
+FecPacketCounter ReedSolomonFecReceiver::GetPacketCounter() const {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  return packet_counter_;
+}
+
+void ReedSolomonFecReceiver::InsertMediaPacket(
+    int64_t sequence_number,
+    const RtpPacketReceived& packet) {
+  if (media_packets_.find(sequence_number) != media_packets_.end()) {
+    return;
+  }
+  // The sender protects the packets before mutable extensions are written.
+  RtpPacketReceived packet_copy(packet);
+  packet_copy.ZeroMutableExtensions();
+  media_packets_.emplace(sequence_number, packet_copy.Buffer());
+  DiscardOldPackets(media_packets_.rbegin()->first);
+
+  // Find the block, if any, that covers this packet.
+  auto it = blocks_.upper_bound(sequence_number);
+  if (it == blocks_.begin()) {
+    return;
+  }
+  --it;
+  if (sequence_number < it->first + it->second.num_media_packets) {
+    MaybeRecover(it->first, &packet.extension_manager());
+  }
+}
+
+void ReedSolomonFecReceiver::InsertFecPacket(const RtpPacketReceived& packet) {
+  ReedSolomonFecHeader header;
+  if (!header.Parse(packet.payload())) {
+    RTC_LOG(LS_WARNING) << "Malformed Reed-Solomon FEC packet, discarding.";
+    return;
+  }
+  const int64_t base_sequence_number =
+      unwrapper_.Unwrap(header.base_sequence_number);
+  if (!media_packets_.empty() &&
+      base_sequence_number + header.num_media_packets <
+          media_packets_.rbegin()->first - kMaxPacketAge) {
+    return;
+  }
+
+  Block& block = blocks_[base_sequence_number];
+  if (block.parity_shards.empty()) {
+    block.num_media_packets = header.num_media_packets;
+    block.num_parity_packets = header.num_parity_packets;
+    block.shard_length = header.shard_length;
+  } else if (block.num_media_packets != header.num_media_packets ||
+             block.num_parity_packets != header.num_parity_packets ||
+             block.shard_length != header.shard_length) {
+    RTC_LOG(LS_WARNING) << "Inconsistent Reed-Solomon FEC block, discarding.";
+    return;
+  }
+  block.parity_shards.emplace(
+      header.parity_index,
+      packet.Buffer().Slice(packet.headers_size() + ReedSolomonFecHeader::kSize,
+                            header.shard_length));
+  MaybeRecover(base_sequence_number, &packet.extension_manager());
+}
+
+void ReedSolomonFecReceiver::MaybeRecover(
+    int64_t base_sequence_number,
+    const RtpHeaderExtensionMap* extensions) {
+  auto block_it = blocks_.find(base_sequence_number);
+  RTC_DCHECK(block_it != blocks_.end());
+  const Block& block = block_it->second;
+  const int k = block.num_media_packets;
+  const size_t shard_length = block.shard_length;
+
+  int num_present = 0;
+  auto media_it = media_packets_.lower_bound(base_sequence_number);
+  for (; media_it != media_packets_.end() &&
+         media_it->first < base_sequence_number + k;
+       ++media_it) {
+    ++num_present;
+  }
+  if (num_present == k) {
+    // Nothing to recover.
+    blocks_.erase(block_it);
+    return;
+  }
+  if (num_present + static_cast<int>(block.parity_shards.size()) < k) {
+    return;
+  }
+
+  shard_buffer_.assign(k * shard_length, 0);
+  std::vector<const uint8_t*> shards(k + block.num_parity_packets, nullptr);
+  std::vector<uint8_t*> recovered_data(k, nullptr);
+  for (int j = 0; j < k; ++j) {
+    uint8_t* shard = &shard_buffer_[j * shard_length];
+    auto it = media_packets_.find(base_sequence_number + j);
+    if (it == media_packets_.end()) {
+      recovered_data[j] = shard;
+      continue;
+    }
+    const CopyOnWriteBuffer& media_packet = it->second;
+    if (ReedSolomonFecHeader::kShardLengthFieldSize + media_packet.size() >
+        shard_length) {
+      RTC_LOG(LS_WARNING) << "Media packet does not match Reed-Solomon FEC "
+                             "block, discarding block.";
+      blocks_.erase(block_it);
+      return;
+    }
+    ByteWriter<uint16_t>::WriteBigEndian(
+        shard, static_cast<uint16_t>(media_packet.size()));
+    memcpy(shard + ReedSolomonFecHeader::kShardLengthFieldSize,
+           media_packet.cdata(), media_packet.size());
+    shards[j] = shard;
+  }
+  for (const auto& [parity_index, parity_shard] : block.parity_shards) {
+    shards[k + parity_index] = parity_shard.cdata();
+  }
+
+  ReedSolomonCodec codec(k, block.num_parity_packets);
+  const bool decoded = codec.Decode(shards, recovered_data, shard_length);
+  RTC_DCHECK(decoded);
+
+  for (int j = 0; j < k; ++j) {
+    if (recovered_data[j] == nullptr) {
+      continue;
+    }
+    const uint8_t* shard = recovered_data[j];
+    const size_t length = ByteReader<uint16_t>::ReadBigEndian(shard);
+    if (length < kRtpHeaderSize ||
+        ReedSolomonFecHeader::kShardLengthFieldSize + length > shard_length) {
+      continue;
+    }
+    CopyOnWriteBuffer buffer(
+        shard + ReedSolomonFecHeader::kShardLengthFieldSize, length);
+    RtpPacketReceived recovered_packet(extensions);
+    if (!recovered_packet.Parse(buffer) ||
+        recovered_packet.Ssrc() != protected_media_ssrc_ ||
+        recovered_packet.SequenceNumber() !=
+            static_cast<uint16_t>(base_sequence_number + j)) {
+      continue;
+    }
+    recovered_packet.set_recovered(true);
+    // TODO(bugs.webrtc.org/11340): Update if audio is ever protected.
+    recovered_packet.set_payload_type_frequency(kVideoPayloadTypeFrequency);
+    media_packets_.emplace(base_sequence_number + j, std::move(buffer));
+    recovered_packets_.push_back(std::move(recovered_packet));
+  }
+  blocks_.erase(block_it);
+}
+
+void ReedSolomonFecReceiver::DiscardOldPackets(int64_t newest_sequence_number) {
+  const int64_t oldest_to_keep = newest_sequence_number - kMaxPacketAge;
+  media_packets_.erase(media_packets_.begin(),
+                       media_packets_.lower_bound(oldest_to_keep));
+  auto it = blocks_.begin();
+  while (it != blocks_.end() &&
+         it->first + it->second.num_media_packets < oldest_to_keep) {
+    it = blocks_.erase(it);
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,106 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_RECEIVER_H_
+#define MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_RECEIVER_H_
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "api/sequence_checker.h"
+#include "api/units/timestamp.h"
+#include "modules/rtp_rtcp/include/recovered_packet_receiver.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "modules/rtp_rtcp/source/ulpfec_receiver.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/numerics/sequence_number_unwrapper.h"
+#include "rtc_base/system/no_unique_address.h"
+#include "rtc_base/thread_annotations.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+
+// Receive side counterpart of ReedSolomonFecGenerator. Takes both the media
+// packets of the protected stream and the parity packets, and returns media
+// packets that were lost but could be reconstructed through the callback.
+class ReedSolomonFecReceiver {
+ public:
+  ReedSolomonFecReceiver(Clock* clock,
+                         uint32_t ssrc,
+                         uint32_t protected_media_ssrc,
+                         RecoveredPacketReceiver* recovered_packet_receiver);
+  ~ReedSolomonFecReceiver();
+
+  // Inserts a received media or FEC packet. All newly recovered packets are
+  // sent back through the callback.
+  void OnRtpPacket(const RtpPacketReceived& packet);
+
+  // Returns a counter describing the added and recovered packets.
+  FecPacketCounter GetPacketCounter() const;
+
+ private:
+  struct Block {
+    Block();
+    Block(const Block&) = delete;
+    Block(Block&&);
+    Block& operator=(const Block&) = delete;
+    Block& operator=(Block&&);
+    ~Block();
+
+    int num_media_packets = 0;
+    int num_parity_packets = 0;
+    size_t shard_length = 0;
+    // Parity shards, indexed by parity index.
+    std::map<int, CopyOnWriteBuffer> parity_shards;
+  };
+
+  void InsertMediaPacket(int64_t sequence_number,
+                         const RtpPacketReceived& packet)
+      RTC_RUN_ON(sequence_checker_);
+  void InsertFecPacket(const RtpPacketReceived& packet)
+      RTC_RUN_ON(sequence_checker_);
+  // Reconstructs the missing media packets of the block starting at
+  // `base_sequence_number` if enough shards are available, and forgets blocks
+  // that are complete.
+  void MaybeRecover(int64_t base_sequence_number,
+                    const RtpHeaderExtensionMap* extensions)
+      RTC_RUN_ON(sequence_checker_);
+  void DiscardOldPackets(int64_t newest_sequence_number)
+      RTC_RUN_ON(sequence_checker_);
+
+  // Config.
+  const uint32_t ssrc_;
+  const uint32_t protected_media_ssrc_;
+  RecoveredPacketReceiver* const recovered_packet_receiver_;
+  Clock* const clock_;
+
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker sequence_checker_;
+  // Media and FEC packets share the media sequence number space.
+  RtpSequenceNumberUnwrapper unwrapper_ RTC_GUARDED_BY(sequence_checker_);
+  // Received and recovered media packets, with mutable header extensions
+  // zeroed, keyed by unwrapped sequence number.
+  std::map<int64_t, CopyOnWriteBuffer> media_packets_
+      RTC_GUARDED_BY(sequence_checker_);
+  // Incomplete blocks, keyed by unwrapped base sequence number.
+  std::map<int64_t, Block> blocks_ RTC_GUARDED_BY(sequence_checker_);
+  // Scratch space used while decoding.
+  std::vector<uint8_t> shard_buffer_ RTC_GUARDED_BY(sequence_checker_);
+  std::vector<RtpPacketReceived> recovered_packets_
+      RTC_GUARDED_BY(sequence_checker_);
+
+  Timestamp last_recovered_packet_ RTC_GUARDED_BY(sequence_checker_) =
+      Timestamp::MinusInfinity();
+  FecPacketCounter packet_counter_ RTC_GUARDED_BY(sequence_checker_);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_RECEIVER_H_
@@ -0,0 +1,263 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// End to end tests of ReedSolomonFecGenerator and ReedSolomonFecReceiver.
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/rtp_parameters.h"
+#include "modules/include/module_fec_types.h"
+#include "modules/rtp_rtcp/include/recovered_packet_receiver.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_generator.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_receiver.h"
+#include "modules/rtp_rtcp/source/rtp_header_extension_size.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/random.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kFecPayloadType = 123;
+constexpr int kMediaPayloadType = 96;
+constexpr uint32_t kMediaSsrc = 1234;
+constexpr uint32_t kFecSsrc = 5678;
+constexpr char kNoMid[] = "";
+const std::vector<RtpExtension> kNoRtpHeaderExtensions;
+const std::vector<RtpExtensionSize> kNoRtpHeaderExtensionSizes;
+constexpr int kPacketsPerFrame = 10;
+
+class RecordingRecoveredPacketReceiver : public RecoveredPacketReceiver {
+ public:
+  void OnRecoveredPacket(const RtpPacketReceived& packet) override {
+    EXPECT_TRUE(packet.recovered());
+    EXPECT_TRUE(recovered_.emplace(packet.SequenceNumber(), packet.Buffer())
+                    .second)
+        << "Packet " << packet.SequenceNumber() << " recovered twice.";
+  }
+
+  const std::map<uint16_t, CopyOnWriteBuffer>& recovered() const {
+    return recovered_;
+  }
+
+ private:
+  std::map<uint16_t, CopyOnWriteBuffer> recovered_;
+};
+
+// Two state Markov loss model, the bad state drops every packet.
+class GilbertElliottLoss {
+ public:
+  GilbertElliottLoss(double loss_rate, double mean_burst_length)
+      : random_(0x10552),
+        bad_to_good_(1.0 / mean_burst_length),
+        good_to_bad_(loss_rate * bad_to_good_ / (1.0 - loss_rate)) {}
+
+  bool Drop() {
+    const double p = random_.Rand<double>();
+    bad_ = bad_ ? p >= bad_to_good_ : p < good_to_bad_;
+    return bad_;
+  }
+
+ private:
+  Random random_;
+  const double bad_to_good_;
+  const double good_to_bad_;
+  bool bad_ = false;
+};
+
+class ReedSolomonFecTest : public ::testing::Test {
+ protected:
+  ReedSolomonFecTest()
+      : clock_(1),
+        env_(CreateEnvironment(&clock_)),
+        random_(0x4567),
+        generator_(env_,
+                   kFecPayloadType,
+                   kFecSsrc,
+                   kMediaSsrc,
+                   kNoMid,
+                   kNoRtpHeaderExtensions,
+                   kNoRtpHeaderExtensionSizes,
+                   /*rtp_state=*/nullptr),
+        receiver_(&clock_, kFecSsrc, kMediaSsrc, &recovered_packet_receiver_) {}
+
+  void SetProtection(int fec_rate, int max_fec_frames) {
+    FecProtectionParams params;
+    params.fec_rate = fec_rate;
+    params.max_fec_frames = max_fec_frames;
+    params.fec_mask_type = kFecMaskBursty;
+    generator_.SetProtectionParameters(params, params);
+  }
+
+  // Packetizes a frame, protects it and returns the media packets followed
+  // by the FEC packets, in sending order.
+  std::vector<CopyOnWriteBuffer> SendFrame() {
+    std::vector<CopyOnWriteBuffer> packets;
+    for (int i = 0; i < kPacketsPerFrame; ++i) {
+      RtpPacketToSend packet(/*extensions=*/nullptr);
+      packet.SetPayloadType(kMediaPayloadType);
+      packet.SetSsrc(kMediaSsrc);
+      packet.SetSequenceNumber(media_sequence_number_++);
+      packet.SetTimestamp(rtp_timestamp_);
+      packet.SetMarker(i == kPacketsPerFrame - 1);
+      // Vary the size, so that packets are padded in the shards.
+      const size_t payload_size = random_.Rand(100, 1100);
+      uint8_t* payload = packet.AllocatePayload(payload_size);
+      for (size_t j = 0; j < payload_size; ++j) {
+        payload[j] = random_.Rand<uint8_t>();
+      }
+      generator_.AddPacketAndGenerateFec(packet);
+      packets.push_back(packet.Buffer());
+    }
+    for (const auto& fec_packet : generator_.GetFecPackets()) {
+      packets.push_back(fec_packet->Buffer());
+    }
+    rtp_timestamp_ += 3000;
+    clock_.AdvanceTimeMilliseconds(33);
+    return packets;
+  }
+
+  void Receive(const CopyOnWriteBuffer& buffer) {
+    RtpPacketReceived packet;
+    ASSERT_TRUE(packet.Parse(buffer));
+    receiver_.OnRtpPacket(packet);
+  }
+
+  SimulatedClock clock_;
+  const Environment env_;
+  Random random_;
+  uint16_t media_sequence_number_ = 0xfff0;  // Exercise wrap around.
+  uint32_t rtp_timestamp_ = 0;
+  RecordingRecoveredPacketReceiver recovered_packet_receiver_;
+  ReedSolomonFecGenerator generator_;
+  ReedSolomonFecReceiver receiver_;
+};
+
+TEST_F(ReedSolomonFecTest, NoFecWithZeroRate) {
+  SetProtection(/*fec_rate=*/0, /*max_fec_frames=*/1);
+  EXPECT_EQ(SendFrame().size(), static_cast<size_t>(kPacketsPerFrame));
+}
+
+TEST_F(ReedSolomonFecTest, RecoversBurstAsLongAsParityCount) {
+  // 10 media packets with 30% protection gives 3 parity packets.
+  SetProtection(/*fec_rate=*/77, /*max_fec_frames=*/1);
+  std::vector<CopyOnWriteBuffer> packets = SendFrame();
+  ASSERT_EQ(packets.size(), static_cast<size_t>(kPacketsPerFrame + 3));
+  for (size_t i = 0; i < packets.size(); ++i) {
+    if (i < 4 || i > 6) {
+      Receive(packets[i]);
+    }
+  }
+  ASSERT_EQ(recovered_packet_receiver_.recovered().size(), 3u);
+  for (size_t i = 4; i <= 6; ++i) {
+    RtpPacketReceived original;
+    ASSERT_TRUE(original.Parse(packets[i]));
+    auto it = recovered_packet_receiver_.recovered().find(
+        original.SequenceNumber());
+    ASSERT_NE(it, recovered_packet_receiver_.recovered().end());
+    EXPECT_EQ(it->second, packets[i]);
+  }
+  EXPECT_EQ(receiver_.GetPacketCounter().num_recovered_packets, 3u);
+}
+
+TEST_F(ReedSolomonFecTest, DoesNotRecoverWithMoreLossesThanParityCount) {
+  SetProtection(/*fec_rate=*/77, /*max_fec_frames=*/1);
+  std::vector<CopyOnWriteBuffer> packets = SendFrame();
+  for (size_t i = 0; i < packets.size(); ++i) {
+    if (i < 4 || i > 7) {
+      Receive(packets[i]);
+    }
+  }
+  EXPECT_TRUE(recovered_packet_receiver_.recovered().empty());
+}
+
+// Sends two frame blocks (20 media packets protected by 6 parity packets) over
+// a bursty channel. Since the code is maximum distance separable, every block
+// that loses at most 6 of its 26 packets must be fully recovered.
+class ReedSolomonFecBurstyLossTest
+    : public ReedSolomonFecTest,
+      public ::testing::WithParamInterface<double> {};
+
+TEST_P(ReedSolomonFecBurstyLossTest, RecoversEveryBlockWithinParityCount) {
+  constexpr int kNumBlocks = 500;
+  constexpr int kNumParityPackets = 6;
+  const double loss_rate = GetParam();
+  GilbertElliottLoss channel(loss_rate, /*mean_burst_length=*/3.0);
+  SetProtection(/*fec_rate=*/77, /*max_fec_frames=*/2);
+
+  std::map<uint16_t, CopyOnWriteBuffer> lost_media_packets;
+  std::set<uint16_t> recoverable;
+  int num_media_packets = 0;
+  for (int block = 0; block < kNumBlocks; ++block) {
+    std::vector<CopyOnWriteBuffer> packets = SendFrame();
+    for (const CopyOnWriteBuffer& buffer : SendFrame()) {
+      packets.push_back(buffer);
+    }
+    ASSERT_EQ(packets.size(),
+              static_cast<size_t>(2 * kPacketsPerFrame + kNumParityPackets));
+    num_media_packets += 2 * kPacketsPerFrame;
+
+    std::vector<uint16_t> lost_in_block;
+    int num_lost = 0;
+    for (const CopyOnWriteBuffer& buffer : packets) {
+      if (!channel.Drop()) {
+        Receive(buffer);
+        continue;
+      }
+      ++num_lost;
+      RtpPacketReceived packet;
+      ASSERT_TRUE(packet.Parse(buffer));
+      if (packet.Ssrc() == kMediaSsrc) {
+        lost_media_packets.emplace(packet.SequenceNumber(), buffer);
+        lost_in_block.push_back(packet.SequenceNumber());
+      }
+    }
+    if (num_lost <= kNumParityPackets) {
+      recoverable.insert(lost_in_block.begin(), lost_in_block.end());
+    }
+  }
+
+  // Every recovered packet must be bit exact.
+  const auto& recovered = recovered_packet_receiver_.recovered();
+  for (const auto& [sequence_number, buffer] : recovered) {
+    auto it = lost_media_packets.find(sequence_number);
+    ASSERT_NE(it, lost_media_packets.end());
+    EXPECT_EQ(buffer, it->second);
+  }
+  for (uint16_t sequence_number : recoverable) {
+    EXPECT_TRUE(recovered.contains(sequence_number)) << sequence_number;
+  }
+  EXPECT_EQ(recovered.size(), recoverable.size());
+
+  const double channel_loss =
+      static_cast<double>(lost_media_packets.size()) / num_media_packets;
+  const double residual_loss =
+      static_cast<double>(lost_media_packets.size() - recovered.size()) /
+      num_media_packets;
+  EXPECT_GT(channel_loss, loss_rate / 2);
+  EXPECT_LT(residual_loss, channel_loss / 2);
+}
+
+INSTANTIATE_TEST_SUITE_P(LossRates,
+                         ReedSolomonFecBurstyLossTest,
+                         ::testing::Values(0.05, 0.10, 0.15));
+
+}  // namespace
+}  // namespace webrtc
@@ -0,0 +1,93 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/rtcp_packet/compound_packet_parser.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "api/array_view.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/common_header.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/congestion_control_feedback.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/nack.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/receiver_report.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/rtpfb.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/sender_report.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/transport_feedback.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+namespace rtcp {
+namespace {
+
+// Parses `rtcp_block` into a view of type `View` and passes it to `callback`.
+template <typename View, typename Callback>
+bool ParseAndVisit(const CommonHeader& rtcp_block, Callback callback) {
+  View view;
+  if (!view.Parse(rtcp_block)) {
+    return false;
+  }
+  callback(view);
+  return true;
+}
+
+bool VisitBlock(const CommonHeader& rtcp_block,
+                CompoundPacketVisitor& visitor) {
+  switch (rtcp_block.type()) {
+    case SenderReport::kPacketType:
+      return ParseAndVisit<SenderReportView>(
+          rtcp_block,
+          [&](const SenderReportView& view) { visitor.OnSenderReport(view); });
+    case ReceiverReport::kPacketType:
+      return ParseAndVisit<ReceiverReportView>(
+          rtcp_block, [&](const ReceiverReportView& view) {
+            visitor.OnReceiverReport(view);
+          });
+    case Rtpfb::kPacketType:
+      switch (rtcp_block.fmt()) {
+        case Nack::kFeedbackMessageType:
+          return ParseAndVisit<NackView>(
+              rtcp_block, [&](const NackView& view) { visitor.OnNack(view); });
+        case TransportFeedback::kFeedbackMessageType:
+          return ParseAndVisit<TransportFeedbackView>(
+              rtcp_block, [&](const TransportFeedbackView& view) {
+                visitor.OnTransportFeedback(view);
+              });
+        case CongestionControlFeedback::kFeedbackMessageType:
+          return ParseAndVisit<CongestionControlFeedbackView>(
+              rtcp_block, [&](const CongestionControlFeedbackView& view) {
+                visitor.OnCongestionControlFeedback(view);
+              });
+      }
+      break;
+  }
+  visitor.OnOtherBlock(rtcp_block);
+  return true;
+}
+
+}  // namespace
+
+bool ParseCompoundPacket(ArrayView<const uint8_t> packet,
+                         CompoundPacketVisitor& visitor) {
+  CommonHeader rtcp_block;
+  for (const uint8_t* next_block = packet.begin(); next_block != packet.end();
+       next_block = rtcp_block.NextPacket()) {
+    ptrdiff_t remaining_blocks_size = packet.end() - next_block;
+    RTC_DCHECK_GT(remaining_blocks_size, 0);
+    if (!rtcp_block.Parse(next_block, remaining_blocks_size) ||
+        !VisitBlock(rtcp_block, visitor)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace rtcp
+}  // namespace webrtc
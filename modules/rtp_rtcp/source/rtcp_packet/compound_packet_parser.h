@@ -0,0 +1,53 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_RTCP_PACKET_COMPOUND_PACKET_PARSER_H_
+#define MODULES_RTP_RTCP_SOURCE_RTCP_PACKET_COMPOUND_PACKET_PARSER_H_
+
+#include <cstdint>
+
+#include "api/array_view.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/common_header.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/congestion_control_feedback.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/nack.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/receiver_report.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/sender_report.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/transport_feedback.h"
+
+namespace webrtc {
+namespace rtcp {
+
+// Receives the blocks of a compound RTCP packet as they are parsed. The views
+// point into the parsed buffer and are only valid during the call.
+class CompoundPacketVisitor {
+ public:
+  virtual ~CompoundPacketVisitor() = default;
+
+  virtual void OnSenderReport(const SenderReportView& /* sender_report */) {}
+  virtual void OnReceiverReport(
+      const ReceiverReportView& /* receiver_report */) {}
+  virtual void OnNack(const NackView& /* nack */) {}
+  virtual void OnTransportFeedback(
+      const TransportFeedbackView& /* feedback */) {}
+  virtual void OnCongestionControlFeedback(
+      const CongestionControlFeedbackView& /* feedback */) {}
+  // Called for every well formed block of a type without a view above.
+  virtual void OnOtherBlock(const CommonHeader& /* rtcp_block */) {}
+};
+
+// Walks the compound RTCP `packet` in place and hands each block to `visitor`,
+// without allocating. Returns false when a block is malformed; blocks before
+// it have already been delivered to `visitor` by then.
+bool ParseCompoundPacket(ArrayView<const uint8_t> packet,
+                         CompoundPacketVisitor& visitor);
+
+}  // namespace rtcp
+}  // namespace webrtc
+#endif  // MODULES_RTP_RTCP_SOURCE_RTCP_PACKET_COMPOUND_PACKET_PARSER_H_
@@ -0,0 +1,187 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// Compares parsing a compound RTCP packet into the owning packet classes with
+// the visitor based ParseCompoundPacket(). Both variants touch every report
+// block and every feedback entry, as a receiver would.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/common_header.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/compound_packet.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/compound_packet_parser.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/congestion_control_feedback.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/nack.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/receiver_report.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/rtpfb.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/transport_feedback.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+namespace rtcp {
+namespace {
+
+constexpr uint32_t kSenderSsrc = 0x12345678;
+constexpr uint32_t kMediaSsrc = 0x23456789;
+constexpr int kNumReportBlocks = 50;
+constexpr int kNumFeedbackPackets = 100;
+
+// A compound packet as sent by an SFU receiving many streams: receiver
+// reports for 50 SSRCs, transport wide and RFC 8888 feedback for 100 packets
+// each, and a NACK.
+Buffer CreateCompoundPacket() {
+  CompoundPacket compound;
+  uint32_t source_ssrc = 1000;
+  for (int remaining = kNumReportBlocks; remaining > 0;) {
+    auto rr = std::make_unique<ReceiverReport>();
+    rr->SetSenderSsrc(kSenderSsrc);
+    for (size_t i = 0;
+         i < ReceiverReport::kMaxNumberOfReportBlocks && remaining > 0;
+         ++i, --remaining) {
+      ReportBlock report_block;
+      report_block.SetMediaSsrc(source_ssrc++);
+      report_block.SetExtHighestSeqNum(source_ssrc * 3);
+      report_block.SetJitter(17);
+      report_block.SetLastSr(source_ssrc * 7);
+      report_block.SetDelayLastSr(300);
+      rr->AddReportBlock(report_block);
+    }
+    compound.Append(std::move(rr));
+  }
+
+  auto transport_feedback =
+      std::make_unique<TransportFeedback>(/*include_timestamps=*/true);
+  transport_feedback->SetSenderSsrc(kSenderSsrc);
+  transport_feedback->SetMediaSsrc(kMediaSsrc);
+  Timestamp arrival_time = Timestamp::Millis(1000);
+  transport_feedback->SetBase(/*base_sequence=*/100, arrival_time);
+  std::vector<CongestionControlFeedback::PacketInfo> ccfb_packets;
+  for (int i = 0; i < kNumFeedbackPackets; ++i) {
+    arrival_time += i % 10 == 0 ? TimeDelta::Millis(70) : TimeDelta::Millis(1);
+    if (i % 13 != 7) {
+      transport_feedback->AddReceivedPacket(100 + i, arrival_time);
+    }
+    ccfb_packets.push_back(
+        {.ssrc = kMediaSsrc,
+         .sequence_number = static_cast<uint16_t>(200 + i),
+         .arrival_time_offset = i % 13 == 7 ? TimeDelta::MinusInfinity()
+                                            : TimeDelta::Millis(i)});
+  }
+  compound.Append(std::move(transport_feedback));
+  compound.Append(std::make_unique<CongestionControlFeedback>(
+      std::move(ccfb_packets), /*report_timestamp_compact_ntp=*/0x1234));
+
+  auto nack = std::make_unique<Nack>();
+  nack->SetSenderSsrc(kSenderSsrc);
+  nack->SetMediaSsrc(kMediaSsrc);
+  nack->SetPacketIds({10, 11, 13, 40, 41, 42, 90});
+  compound.Append(std::move(nack));
+
+  return compound.Build();
+}
+
+void BM_ParseOwning(benchmark::State& state) {
+  const Buffer packet = CreateCompoundPacket();
+  for (auto _ : state) {
+    uint64_t checksum = 0;
+    CommonHeader rtcp_block;
+    for (const uint8_t* next_block = packet.begin(); next_block != packet.end();
+         next_block = rtcp_block.NextPacket()) {
+      RTC_CHECK(rtcp_block.Parse(next_block, packet.end() - next_block));
+      switch (rtcp_block.type()) {
+        case ReceiverReport::kPacketType: {
+          ReceiverReport receiver_report;
+          RTC_CHECK(receiver_report.Parse(rtcp_block));
+          for (const ReportBlock& report_block :
+               receiver_report.report_blocks()) {
+            checksum += report_block.extended_high_seq_num();
+          }
+          break;
+        }
+        case Rtpfb::kPacketType:
+          if (rtcp_block.fmt() == TransportFeedback::kFeedbackMessageType) {
+            TransportFeedback feedback;
+            RTC_CHECK(feedback.Parse(rtcp_block));
+            feedback.ForAllPackets([&](uint16_t sequence_number, TimeDelta) {
+              checksum += sequence_number;
+            });
+          } else if (rtcp_block.fmt() ==
+                     CongestionControlFeedback::kFeedbackMessageType) {
+            CongestionControlFeedback feedback;
+            RTC_CHECK(feedback.Parse(rtcp_block));
+            for (const auto& packet_info : feedback.packets()) {
+              checksum += packet_info.sequence_number;
+            }
+          } else if (rtcp_block.fmt() == Nack::kFeedbackMessageType) {
+            Nack nack;
+            RTC_CHECK(nack.Parse(rtcp_block));
+            for (uint16_t packet_id : nack.packet_ids()) {
+              checksum += packet_id;
+            }
+          }
+          break;
+      }
+    }
+    benchmark::DoNotOptimize(checksum);
+  }
+  state.SetBytesProcessed(state.iterations() * packet.size());
+}
+
+class ChecksumVisitor : public CompoundPacketVisitor {
+ public:
+  void OnReceiverReport(const ReceiverReportView& receiver_report) override {
+    for (const ReportBlock report_block : receiver_report.report_blocks()) {
+      checksum += report_block.extended_high_seq_num();
+    }
+  }
+  void OnTransportFeedback(const TransportFeedbackView& feedback) override {
+    feedback.ForAllPackets([&](uint16_t sequence_number, TimeDelta) {
+      checksum += sequence_number;
+    });
+  }
+  void OnCongestionControlFeedback(
+      const CongestionControlFeedbackView& feedback) override {
+    feedback.ForAllPackets(
+        [&](const CongestionControlFeedback::PacketInfo& packet_info) {
+          checksum += packet_info.sequence_number;
+        });
+  }
+  void OnNack(const NackView& nack) override {
+    nack.ForAllPacketIds([&](uint16_t packet_id) { checksum += packet_id; });
+  }
+
+  uint64_t checksum = 0;
+};
+
+void BM_ParseVisitor(benchmark::State& state) {
+  const Buffer packet = CreateCompoundPacket();
+  for (auto _ : state) {
+    ChecksumVisitor visitor;
+    RTC_CHECK(ParseCompoundPacket(packet, visitor));
+    benchmark::DoNotOptimize(visitor.checksum);
+  }
+  state.SetBytesProcessed(state.iterations() * packet.size());
+}
+
+BENCHMARK(BM_ParseOwning);
+BENCHMARK(BM_ParseVisitor);
+
+}  // namespace
+}  // namespace rtcp
+}  // namespace webrtc
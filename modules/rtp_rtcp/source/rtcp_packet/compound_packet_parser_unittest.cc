@@ -0,0 +1,338 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/rtcp_packet/compound_packet_parser.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/transport/ecn_marking.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/bye.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/common_header.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/compound_packet.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/congestion_control_feedback.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/nack.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/receiver_report.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/sender_report.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/transport_feedback.h"
+#include "rtc_base/buffer.h"
+#include "system_wrappers/include/ntp_time.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace rtcp {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
+using ::testing::IsEmpty;
+
+constexpr uint32_t kSenderSsrc = 0x12345678;
+constexpr uint32_t kMediaSsrc = 0x23456789;
+
+struct ReceivedPacket {
+  uint16_t sequence_number;
+  TimeDelta delta_since_base;
+
+  bool operator==(const ReceivedPacket& other) const = default;
+};
+
+std::vector<ReceivedPacket> AllPackets(const TransportFeedback& feedback) {
+  std::vector<ReceivedPacket> packets;
+  feedback.ForAllPackets([&](uint16_t sequence_number, TimeDelta delta) {
+    packets.push_back({sequence_number, delta});
+  });
+  return packets;
+}
+
+ReportBlock CreateReportBlock(uint32_t ssrc) {
+  ReportBlock report_block;
+  report_block.SetMediaSsrc(ssrc);
+  report_block.SetFractionLost(ssrc & 0xff);
+  report_block.SetCumulativeLost(-static_cast<int32_t>(ssrc & 0xffff));
+  report_block.SetExtHighestSeqNum(ssrc * 3);
+  report_block.SetJitter(ssrc * 5);
+  report_block.SetLastSr(ssrc * 7);
+  report_block.SetDelayLastSr(ssrc * 11);
+  return report_block;
+}
+
+void ExpectEqualReportBlocks(const ReportBlock& actual,
+                             const ReportBlock& expected) {
+  EXPECT_EQ(actual.source_ssrc(), expected.source_ssrc());
+  EXPECT_EQ(actual.fraction_lost(), expected.fraction_lost());
+  EXPECT_EQ(actual.cumulative_lost(), expected.cumulative_lost());
+  EXPECT_EQ(actual.extended_high_seq_num(), expected.extended_high_seq_num());
+  EXPECT_EQ(actual.jitter(), expected.jitter());
+  EXPECT_EQ(actual.last_sr(), expected.last_sr());
+  EXPECT_EQ(actual.delay_since_last_sr(), expected.delay_since_last_sr());
+}
+
+// Copies what the views expose, so that it can be inspected after parsing.
+class RecordingVisitor : public CompoundPacketVisitor {
+ public:
+  void OnSenderReport(const SenderReportView& sender_report) override {
+    sender_report_ssrcs.push_back(sender_report.sender_ssrc());
+    ntp = sender_report.ntp();
+    rtp_timestamp = sender_report.rtp_timestamp();
+    sender_packet_count = sender_report.sender_packet_count();
+    sender_octet_count = sender_report.sender_octet_count();
+    for (const ReportBlock report_block : sender_report.report_blocks()) {
+      report_blocks.push_back(report_block);
+    }
+  }
+  void OnReceiverReport(const ReceiverReportView& receiver_report) override {
+    receiver_report_ssrcs.push_back(receiver_report.sender_ssrc());
+    for (const ReportBlock report_block : receiver_report.report_blocks()) {
+      report_blocks.push_back(report_block);
+    }
+  }
+  void OnNack(const NackView& nack) override {
+    nack_media_ssrc = nack.media_ssrc();
+    nack.ForAllPacketIds(
+        [&](uint16_t packet_id) { nacked_packets.push_back(packet_id); });
+  }
+  void OnTransportFeedback(const TransportFeedbackView& feedback) override {
+    feedback_media_ssrc = feedback.media_ssrc();
+    feedback_base_time = feedback.BaseTime();
+    feedback.ForAllPackets([&](uint16_t sequence_number, TimeDelta delta) {
+      feedback_packets.push_back({sequence_number, delta});
+    });
+  }
+  void OnCongestionControlFeedback(
+      const CongestionControlFeedbackView& feedback) override {
+    ccfb_compact_ntp = feedback.report_timestamp_compact_ntp();
+    feedback.ForAllPackets(
+        [&](const CongestionControlFeedback::PacketInfo& packet) {
+          ccfb_packets.push_back(packet);
+        });
+  }
+  void OnOtherBlock(const CommonHeader& rtcp_block) override {
+    other_block_types.push_back(rtcp_block.type());
+  }
+
+  std::vector<uint32_t> sender_report_ssrcs;
+  std::vector<uint32_t> receiver_report_ssrcs;
+  NtpTime ntp;
+  uint32_t rtp_timestamp = 0;
+  uint32_t sender_packet_count = 0;
+  uint32_t sender_octet_count = 0;
+  std::vector<ReportBlock> report_blocks;
+  uint32_t nack_media_ssrc = 0;
+  std::vector<uint16_t> nacked_packets;
+  uint32_t feedback_media_ssrc = 0;
+  Timestamp feedback_base_time = Timestamp::MinusInfinity();
+  std::vector<ReceivedPacket> feedback_packets;
+  uint32_t ccfb_compact_ntp = 0;
+  std::vector<CongestionControlFeedback::PacketInfo> ccfb_packets;
+  std::vector<uint8_t> other_block_types;
+};
+
+TEST(RtcpCompoundPacketParserTest,
+     VisitsReportBlocksOfSenderAndReceiverReports) {
+  auto sr = std::make_unique<SenderReport>();
+  sr->SetSenderSsrc(kSenderSsrc);
+  sr->SetNtp(NtpTime(0x11111111, 0x22222222));
+  sr->SetRtpTimestamp(0x33333333);
+  sr->SetPacketCount(0x44444444);
+  sr->SetOctetCount(0x55555555);
+  std::vector<ReportBlock> expected_blocks;
+  for (uint32_t ssrc = 1; ssrc <= 3; ++ssrc) {
+    expected_blocks.push_back(CreateReportBlock(ssrc));
+    ASSERT_TRUE(sr->AddReportBlock(expected_blocks.back()));
+  }
+  auto rr = std::make_unique<ReceiverReport>();
+  rr->SetSenderSsrc(kSenderSsrc + 1);
+  for (uint32_t ssrc = 100;
+       ssrc < 100 + ReceiverReport::kMaxNumberOfReportBlocks; ++ssrc) {
+    expected_blocks.push_back(CreateReportBlock(ssrc));
+    ASSERT_TRUE(rr->AddReportBlock(expected_blocks.back()));
+  }
+  CompoundPacket compound;
+  compound.Append(std::move(sr));
+  compound.Append(std::move(rr));
+  Buffer packet = compound.Build();
+
+  RecordingVisitor visitor;
+  EXPECT_TRUE(ParseCompoundPacket(packet, visitor));
+
+  EXPECT_THAT(visitor.sender_report_ssrcs, ElementsAre(kSenderSsrc));
+  EXPECT_THAT(visitor.receiver_report_ssrcs, ElementsAre(kSenderSsrc + 1));
+  EXPECT_EQ(visitor.ntp, NtpTime(0x11111111, 0x22222222));
+  EXPECT_EQ(visitor.rtp_timestamp, 0x33333333u);
+  EXPECT_EQ(visitor.sender_packet_count, 0x44444444u);
+  EXPECT_EQ(visitor.sender_octet_count, 0x55555555u);
+  ASSERT_EQ(visitor.report_blocks.size(), expected_blocks.size());
+  for (size_t i = 0; i < expected_blocks.size(); ++i) {
+    ExpectEqualReportBlocks(visitor.report_blocks[i], expected_blocks[i]);
+  }
+}
+
+TEST(RtcpCompoundPacketParserTest, VisitsSameNackedPacketsAsNack) {
+  auto nack = std::make_unique<Nack>();
+  nack->SetSenderSsrc(kSenderSsrc);
+  nack->SetMediaSsrc(kMediaSsrc);
+  nack->SetPacketIds({0, 1, 3, 8, 16, 17, 40, 0xfffe, 0xffff});
+  const std::vector<uint16_t> expected_ids = nack->packet_ids();
+  CompoundPacket compound;
+  compound.Append(std::move(nack));
+  Buffer packet = compound.Build();
+
+  RecordingVisitor visitor;
+  EXPECT_TRUE(ParseCompoundPacket(packet, visitor));
+
+  EXPECT_EQ(visitor.nack_media_ssrc, kMediaSsrc);
+  EXPECT_THAT(visitor.nacked_packets, ElementsAreArray(expected_ids));
+}
+
+class RtcpCompoundPacketParserTransportFeedbackTest
+    : public ::testing::TestWithParam<bool> {};
+
+TEST_P(RtcpCompoundPacketParserTransportFeedbackTest,
+       VisitsSamePacketsAsTransportFeedback) {
+  const bool include_timestamps = GetParam();
+  auto feedback = std::make_unique<TransportFeedback>(include_timestamps);
+  feedback->SetSenderSsrc(kSenderSsrc);
+  feedback->SetMediaSsrc(kMediaSsrc);
+  const Timestamp base_time = Timestamp::Millis(123456);
+  feedback->SetBase(0xfff0, base_time);
+  // Mix small, large and negative deltas with runs and gaps, so that all chunk
+  // types are used.
+  Timestamp arrival_time = base_time;
+  uint16_t sequence_number = 0xfff0;
+  for (int i = 0; i < 60; ++i, ++sequence_number) {
+    if (i % 17 == 5 || (i > 30 && i < 36)) {
+      continue;
+    }
+    arrival_time += i % 7 == 3 ? TimeDelta::Millis(100)
+                    : i % 11 == 4 ? TimeDelta::Millis(-2)
+                                  : TimeDelta::Micros(750);
+    ASSERT_TRUE(feedback->AddReceivedPacket(sequence_number, arrival_time));
+  }
+  Buffer buffer = feedback->Build();
+  // Reparse, the sent feedback packet does not report missing packets.
+  CommonHeader header;
+  ASSERT_TRUE(header.Parse(buffer.data(), buffer.size()));
+  TransportFeedback parsed;
+  ASSERT_TRUE(parsed.Parse(header));
+  const std::vector<ReceivedPacket> expected_packets = AllPackets(parsed);
+
+  RecordingVisitor visitor;
+  EXPECT_TRUE(ParseCompoundPacket(buffer, visitor));
+
+  EXPECT_EQ(visitor.feedback_media_ssrc, kMediaSsrc);
+  EXPECT_EQ(visitor.feedback_base_time, parsed.BaseTime());
+  EXPECT_THAT(visitor.feedback_packets, ElementsAreArray(expected_packets));
+}
+
+INSTANTIATE_TEST_SUITE_P(IncludeTimestamps,
+                         RtcpCompoundPacketParserTransportFeedbackTest,
+                         ::testing::Bool());
+
+TEST(RtcpCompoundPacketParserTest,
+     VisitsSamePacketsAsCongestionControlFeedback) {
+  const std::vector<CongestionControlFeedback::PacketInfo> kPackets = {
+      {.ssrc = 1,
+       .sequence_number = 0xffff,
+       .arrival_time_offset = TimeDelta::Millis(4),
+       .ecn = EcnMarking::kEct1},
+      {.ssrc = 1, .sequence_number = 0},
+      {.ssrc = 1,
+       .sequence_number = 1,
+       .arrival_time_offset = TimeDelta::Millis(1),
+       .ecn = EcnMarking::kCe},
+      {.ssrc = 2,
+       .sequence_number = 7,
+       .arrival_time_offset = TimeDelta::Millis(2)}};
+  auto feedback = std::make_unique<CongestionControlFeedback>(
+      kPackets, /*report_timestamp_compact_ntp=*/0x1234);
+  CompoundPacket compound;
+  compound.Append(std::move(feedback));
+  Buffer packet = compound.Build();
+  CommonHeader header;
+  ASSERT_TRUE(header.Parse(packet.data(), packet.size()));
+  CongestionControlFeedback parsed;
+  ASSERT_TRUE(parsed.Parse(header));
+
+  RecordingVisitor visitor;
+  EXPECT_TRUE(ParseCompoundPacket(packet, visitor));
+
+  EXPECT_EQ(visitor.ccfb_compact_ntp, 0x1234u);
+  ASSERT_EQ(visitor.ccfb_packets.size(), parsed.packets().size());
+  for (size_t i = 0; i < parsed.packets().size(); ++i) {
+    EXPECT_EQ(visitor.ccfb_packets[i].ssrc, parsed.packets()[i].ssrc);
+    EXPECT_EQ(visitor.ccfb_packets[i].sequence_number,
+              parsed.packets()[i].sequence_number);
+    EXPECT_EQ(visitor.ccfb_packets[i].arrival_time_offset,
+              parsed.packets()[i].arrival_time_offset);
+    EXPECT_EQ(visitor.ccfb_packets[i].ecn, parsed.packets()[i].ecn);
+  }
+}
+
+TEST(RtcpCompoundPacketParserTest, ReportsBlocksWithoutViewAsOtherBlocks) {
+  auto rr = std::make_unique<ReceiverReport>();
+  rr->SetSenderSsrc(kSenderSsrc);
+  auto bye = std::make_unique<Bye>();
+  bye->SetSenderSsrc(kSenderSsrc);
+  CompoundPacket compound;
+  compound.Append(std::move(rr));
+  compound.Append(std::move(bye));
+  Buffer packet = compound.Build();
+
+  RecordingVisitor visitor;
+  EXPECT_TRUE(ParseCompoundPacket(packet, visitor));
+
+  EXPECT_THAT(visitor.receiver_report_ssrcs, ElementsAre(kSenderSsrc));
+  EXPECT_THAT(visitor.report_blocks, IsEmpty());
+  EXPECT_THAT(visitor.other_block_types, ElementsAre(Bye::kPacketType));
+}
+
+TEST(RtcpCompoundPacketParserTest, StopsAtTruncatedBlock) {
+  auto rr = std::make_unique<ReceiverReport>();
+  rr->SetSenderSsrc(kSenderSsrc);
+  auto nack = std::make_unique<Nack>();
+  nack->SetMediaSsrc(kMediaSsrc);
+  nack->SetPacketIds({1, 2, 3});
+  CompoundPacket compound;
+  compound.Append(std::move(rr));
+  compound.Append(std::move(nack));
+  Buffer packet = compound.Build();
+
+  RecordingVisitor visitor;
+  EXPECT_FALSE(ParseCompoundPacket(
+      ArrayView<const uint8_t>(packet).subview(0, packet.size() - 4), visitor));
+
+  EXPECT_THAT(visitor.receiver_report_ssrcs, ElementsAre(kSenderSsrc));
+  EXPECT_THAT(visitor.nacked_packets, IsEmpty());
+}
+
+TEST(RtcpCompoundPacketParserTest, StopsAtMalformedBlock) {
+  auto rr = std::make_unique<ReceiverReport>();
+  rr->SetSenderSsrc(kSenderSsrc);
+  ASSERT_TRUE(rr->AddReportBlock(CreateReportBlock(1)));
+  Buffer packet = rr->Build();
+  // Claim one more report block than the packet holds.
+  packet[0] += 1;
+
+  RecordingVisitor visitor;
+  EXPECT_FALSE(ParseCompoundPacket(packet, visitor));
+  EXPECT_THAT(visitor.receiver_report_ssrcs, IsEmpty());
+}
+
+}  // namespace
+}  // namespace rtcp
+}  // namespace webrtc
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "api/array_view.h"
+#include "api/function_view.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "modules/rtp_rtcp/source/byte_io.h"
@@ -270,6 +271,17 @@ size_t CongestionControlFeedback::BlockLength() const {
 }
 
 bool CongestionControlFeedback::Parse(const rtcp::CommonHeader& packet) {
+  CongestionControlFeedbackView view;
+  if (!view.Parse(packet)) {
+    return false;
+  }
+  SetSenderSsrc(view.sender_ssrc());
+  report_timestamp_compact_ntp_ = view.report_timestamp_compact_ntp();
+  view.ForAllPackets(
+      [&](const PacketInfo& packet_info) { packets_.push_back(packet_info); });
+  return true;
+}
+bool CongestionControlFeedbackView::Parse(const rtcp::CommonHeader& packet) {
   const uint8_t* payload = packet.payload();
   const uint8_t* payload_end = packet.payload() + packet.payload_size_bytes();
 
@@ -277,47 +289,63 @@ bool CongestionControlFeedback::Parse(const rtcp::CommonHeader& packet) {
       packet.payload_size_bytes() < kSenderSsrcLength + kTimestampLength) {
     return false;
   }
+  payload_ = payload;
+  reports_end_ = payload_end - kTimestampLength;
 
-  SetSenderSsrc(ByteReader<uint32_t>::ReadBigEndian(payload));
-  payload += 4;
-
-  report_timestamp_compact_ntp_ =
-      ByteReader<uint32_t>::ReadBigEndian(payload_end - 4);
-  payload_end -= 4;
-
-  while (payload + kHeaderPerMediaSssrcLength < payload_end) {
-    uint32_t ssrc = ByteReader<uint32_t>::ReadBigEndian(payload);
-    payload += 4;
-
-    uint16_t base_seqno = ByteReader<uint16_t>::ReadBigEndian(payload);
-    payload += 2;
-    uint16_t num_reports = ByteReader<uint16_t>::ReadBigEndian(payload);
-    payload += 2;
+  // Validate the per SSRC report blocks.
+  payload += kSenderSsrcLength;
+  while (payload + kHeaderPerMediaSssrcLength < reports_end_) {
+    uint16_t num_reports = ByteReader<uint16_t>::ReadBigEndian(payload + 6);
+    payload += kHeaderPerMediaSssrcLength;
 
     constexpr size_t kPerPacketLength = 2;
-    if (payload + kPerPacketLength * num_reports > payload_end) {
+    if (payload + kPerPacketLength * num_reports > reports_end_) {
       return false;
     }
+    payload += kPerPacketLength * num_reports;
+    if (num_reports % 2) {
+      // 2 bytes padding
+      payload += 2;
+    }
+  }
+  return payload == reports_end_;
+}
+
+uint32_t CongestionControlFeedbackView::sender_ssrc() const {
+  return ByteReader<uint32_t>::ReadBigEndian(payload_);
+}
+
+uint32_t CongestionControlFeedbackView::report_timestamp_compact_ntp() const {
+  return ByteReader<uint32_t>::ReadBigEndian(reports_end_);
+}
+
+void CongestionControlFeedbackView::ForAllPackets(
+    FunctionView<void(const CongestionControlFeedback::PacketInfo&)> handler)
+    const {
+  const uint8_t* payload = payload_ + kSenderSsrcLength;
+  while (payload + kHeaderPerMediaSssrcLength < reports_end_) {
+    uint32_t ssrc = ByteReader<uint32_t>::ReadBigEndian(payload);
+    uint16_t base_seqno = ByteReader<uint16_t>::ReadBigEndian(payload + 4);
+    uint16_t num_reports = ByteReader<uint16_t>::ReadBigEndian(payload + 6);
+    payload += kHeaderPerMediaSssrcLength;
 
     for (int i = 0; i < num_reports; ++i) {
       uint16_t packet_info = ByteReader<uint16_t>::ReadBigEndian(payload);
       payload += 2;
 
-      uint16_t seq_no = base_seqno + i;
       bool received = (packet_info & 0x8000);
-      packets_.push_back(
-          {.ssrc = ssrc,
-           .sequence_number = seq_no,
-           .arrival_time_offset = received ? AtoToTimeDelta(packet_info)
-                                           : TimeDelta::MinusInfinity(),
-           .ecn = ToEcnMarking(packet_info)});
+      handler({.ssrc = ssrc,
+               .sequence_number = static_cast<uint16_t>(base_seqno + i),
+               .arrival_time_offset = received ? AtoToTimeDelta(packet_info)
+                                               : TimeDelta::MinusInfinity(),
+               .ecn = ToEcnMarking(packet_info)});
     }
     if (num_reports % 2) {
       // 2 bytes padding
       payload += 2;
     }
   }
-  return payload == payload_end;
 }
+
 }  // namespace rtcp
 }  // namespace webrtc
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "api/array_view.h"
+#include "api/function_view.h"
 #include "api/units/time_delta.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/common_header.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/rtpfb.h"
@@ -65,6 +66,27 @@ class CongestionControlFeedback : public Rtpfb {
   uint32_t report_timestamp_compact_ntp_ = 0;
 };
 
+// Non-owning view of a received CongestionControlFeedback. Parsing validates
+// the packet, the per packet reports are decoded on access. The parsed buffer
+// must outlive the view.
+class CongestionControlFeedbackView {
+ public:
+  bool Parse(const CommonHeader& packet);
+
+  uint32_t sender_ssrc() const;
+  uint32_t report_timestamp_compact_ntp() const;
+
+  // Calls `handler` for every reported packet, in packet order.
+  void ForAllPackets(
+      FunctionView<void(const CongestionControlFeedback::PacketInfo& packet)>
+          handler) const;
+
+ private:
+  const uint8_t* payload_ = nullptr;
+  // End of the per SSRC report blocks, i.e. start of the report timestamp.
+  const uint8_t* reports_end_ = nullptr;
+};
+
 }  // namespace rtcp
 }  // namespace webrtc
 
@@ -16,6 +16,7 @@
 #include <utility>
 #include <vector>
 
+#include "api/function_view.h"
 #include "modules/rtp_rtcp/source/byte_io.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/common_header.h"
 #include "rtc_base/checks.h"
@@ -171,5 +172,44 @@ void Nack::Unpack() {
   }
 }
 
+bool NackView::Parse(const CommonHeader& packet) {
+  RTC_DCHECK_EQ(packet.type(), Nack::kPacketType);
+  RTC_DCHECK_EQ(packet.fmt(), Nack::kFeedbackMessageType);
+
+  if (packet.payload_size_bytes() <
+      Nack::kCommonFeedbackLength + Nack::kNackItemLength) {
+    RTC_LOG(LS_WARNING) << "Payload length " << packet.payload_size_bytes()
+                        << " is too small for a Nack.";
+    return false;
+  }
+  payload_ = packet.payload();
+  num_items_ = (packet.payload_size_bytes() - Nack::kCommonFeedbackLength) /
+               Nack::kNackItemLength;
+  return true;
+}
+
+uint32_t NackView::sender_ssrc() const {
+  return ByteReader<uint32_t>::ReadBigEndian(&payload_[0]);
+}
+
+uint32_t NackView::media_ssrc() const {
+  return ByteReader<uint32_t>::ReadBigEndian(&payload_[4]);
+}
+
+void NackView::ForAllPacketIds(
+    FunctionView<void(uint16_t packet_id)> handler) const {
+  const uint8_t* next_nack = payload_ + Nack::kCommonFeedbackLength;
+  for (size_t index = 0; index < num_items_; ++index) {
+    uint16_t pid = ByteReader<uint16_t>::ReadBigEndian(next_nack);
+    uint16_t bitmask = ByteReader<uint16_t>::ReadBigEndian(next_nack + 2);
+    next_nack += Nack::kNackItemLength;
+    handler(pid);
+    for (++pid; bitmask != 0; bitmask >>= 1, ++pid) {
+      if (bitmask & 1)
+        handler(pid);
+    }
+  }
+}
+
 }  // namespace rtcp
 }  // namespace webrtc
@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <vector>
 
+#include "api/function_view.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/rtpfb.h"
 
 namespace webrtc {
@@ -54,6 +55,27 @@ class Nack : public Rtpfb {
 
   std::vector<PackedNack> packed_;
   std::vector<uint16_t> packet_ids_;
+
+  friend class NackView;
+};
+
+// Non-owning view of a received Nack. The requested sequence numbers are
+// unpacked on access instead of into a vector. The parsed buffer must outlive
+// the view.
+class NackView {
+ public:
+  // Parse assumes header is already parsed and validated.
+  bool Parse(const CommonHeader& packet);
+
+  uint32_t sender_ssrc() const;
+  uint32_t media_ssrc() const;
+
+  // Calls `handler` for every requested sequence number, in packet order.
+  void ForAllPacketIds(FunctionView<void(uint16_t packet_id)> handler) const;
+
+ private:
+  const uint8_t* payload_ = nullptr;
+  size_t num_items_ = 0;
 };
 
 }  // namespace rtcp
@@ -110,5 +110,22 @@ bool ReceiverReport::SetReportBlocks(std::vector<ReportBlock> blocks) {
   return true;
 }
 
+bool ReceiverReportView::Parse(const CommonHeader& packet) {
+  RTC_DCHECK_EQ(packet.type(), ReceiverReport::kPacketType);
+
+  const uint8_t report_blocks_count = packet.count();
+  if (packet.payload_size_bytes() <
+      ReceiverReport::kRrBaseLength +
+          report_blocks_count * ReportBlock::kLength) {
+    RTC_LOG(LS_WARNING) << "Packet is too small to contain all the data.";
+    return false;
+  }
+  sender_ssrc_ = ByteReader<uint32_t>::ReadBigEndian(packet.payload());
+  report_blocks_ =
+      ReportBlocksView(packet.payload() + ReceiverReport::kRrBaseLength,
+                       report_blocks_count);
+  return true;
+}
+
 }  // namespace rtcp
 }  // namespace webrtc
@@ -53,6 +53,24 @@ class ReceiverReport : public RtcpPacket {
   static constexpr size_t kRrBaseLength = 4;
 
   std::vector<ReportBlock> report_blocks_;
+
+  friend class ReceiverReportView;
+};
+
+// Non-owning view of a received receiver report. Unlike ReceiverReport,
+// parsing does not copy the report blocks. The parsed buffer must outlive the
+// view.
+class ReceiverReportView {
+ public:
+  // Parse assumes header is already parsed and validated.
+  bool Parse(const CommonHeader& packet);
+
+  uint32_t sender_ssrc() const { return sender_ssrc_; }
+  ReportBlocksView report_blocks() const { return report_blocks_; }
+
+ private:
+  uint32_t sender_ssrc_ = 0;
+  ReportBlocksView report_blocks_;
 };
 
 }  // namespace rtcp
@@ -90,5 +90,17 @@ bool ReportBlock::SetCumulativeLost(int32_t cumulative_lost) {
   return true;
 }
 
+ReportBlock ReportBlocksView::Iterator::operator*() const {
+  ReportBlock block;
+  bool block_parsed = block.Parse(position_, ReportBlock::kLength);
+  RTC_DCHECK(block_parsed);
+  return block;
+}
+
+ReportBlock ReportBlocksView::operator[](size_t index) const {
+  RTC_DCHECK_LT(index, count_);
+  return *Iterator(buffer_ + index * ReportBlock::kLength);
+}
+
 }  // namespace rtcp
 }  // namespace webrtc
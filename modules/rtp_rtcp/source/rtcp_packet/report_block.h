@@ -15,6 +15,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <iterator>
+
 namespace webrtc {
 namespace rtcp {
 
@@ -65,6 +67,60 @@ class ReportBlock {
   uint32_t delay_since_last_sr_;    // 32 bits, units of 1/65536 seconds
 };
 
+// Non-owning view of consecutive report blocks in a received packet. Blocks
+// are decoded on access, so iterating over them does not allocate. The
+// underlying buffer must outlive the view.
+class ReportBlocksView {
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ReportBlock;
+    using difference_type = ptrdiff_t;
+    using pointer = const ReportBlock*;
+    using reference = ReportBlock;
+
+    Iterator() = default;
+    explicit Iterator(const uint8_t* position) : position_(position) {}
+
+    ReportBlock operator*() const;
+    Iterator& operator++() {
+      position_ += ReportBlock::kLength;
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+    bool operator==(const Iterator& other) const {
+      return position_ == other.position_;
+    }
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+   private:
+    const uint8_t* position_ = nullptr;
+  };
+
+  ReportBlocksView() = default;
+  // `buffer` must hold `count` * ReportBlock::kLength bytes.
+  ReportBlocksView(const uint8_t* buffer, size_t count)
+      : buffer_(buffer), count_(count) {}
+
+  size_t size() const { return count_; }
+  bool empty() const { return count_ == 0; }
+  ReportBlock operator[](size_t index) const;
+
+  Iterator begin() const { return Iterator(buffer_); }
+  Iterator end() const {
+    return Iterator(buffer_ + count_ * ReportBlock::kLength);
+  }
+
+ private:
+  const uint8_t* buffer_ = nullptr;
+  size_t count_ = 0;
+};
+
 }  // namespace rtcp
 }  // namespace webrtc
 #endif  // MODULES_RTP_RTCP_SOURCE_RTCP_PACKET_REPORT_BLOCK_H_
@@ -20,6 +20,7 @@
 #include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
+#include "system_wrappers/include/ntp_time.h"
 
 namespace webrtc {
 namespace rtcp {
@@ -138,5 +139,42 @@ bool SenderReport::SetReportBlocks(std::vector<ReportBlock> blocks) {
   return true;
 }
 
+bool SenderReportView::Parse(const CommonHeader& packet) {
+  RTC_DCHECK_EQ(packet.type(), SenderReport::kPacketType);
+
+  const uint8_t report_block_count = packet.count();
+  if (packet.payload_size_bytes() <
+      SenderReport::kSenderBaseLength +
+          report_block_count * ReportBlock::kLength) {
+    RTC_LOG(LS_WARNING) << "Packet is too small to contain all the data.";
+    return false;
+  }
+  payload_ = packet.payload();
+  report_blocks_ = ReportBlocksView(
+      payload_ + SenderReport::kSenderBaseLength, report_block_count);
+  return true;
+}
+
+uint32_t SenderReportView::sender_ssrc() const {
+  return ByteReader<uint32_t>::ReadBigEndian(&payload_[0]);
+}
+
+NtpTime SenderReportView::ntp() const {
+  return NtpTime(ByteReader<uint32_t>::ReadBigEndian(&payload_[4]),
+                 ByteReader<uint32_t>::ReadBigEndian(&payload_[8]));
+}
+
+uint32_t SenderReportView::rtp_timestamp() const {
+  return ByteReader<uint32_t>::ReadBigEndian(&payload_[12]);
+}
+
+uint32_t SenderReportView::sender_packet_count() const {
+  return ByteReader<uint32_t>::ReadBigEndian(&payload_[16]);
+}
+
+uint32_t SenderReportView::sender_octet_count() const {
+  return ByteReader<uint32_t>::ReadBigEndian(&payload_[20]);
+}
+
 }  // namespace rtcp
 }  // namespace webrtc
@@ -76,6 +76,28 @@ class SenderReport : public RtcpPacket {
   uint32_t sender_packet_count_;
   uint32_t sender_octet_count_;
   std::vector<ReportBlock> report_blocks_;
+
+  friend class SenderReportView;
+};
+
+// Non-owning view of a received sender report. Unlike SenderReport, parsing
+// does not copy the report blocks. The parsed buffer must outlive the view.
+class SenderReportView {
+ public:
+  // Parse assumes header is already parsed and validated.
+  bool Parse(const CommonHeader& packet);
+
+  uint32_t sender_ssrc() const;
+  NtpTime ntp() const;
+  uint32_t rtp_timestamp() const;
+  uint32_t sender_packet_count() const;
+  uint32_t sender_octet_count() const;
+
+  ReportBlocksView report_blocks() const { return report_blocks_; }
+
+ private:
+  const uint8_t* payload_ = nullptr;
+  ReportBlocksView report_blocks_;
 };
 
 }  // namespace rtcp
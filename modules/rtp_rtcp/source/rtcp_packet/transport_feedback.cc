@@ -50,6 +50,56 @@ constexpr size_t kMaxSizeBytes = (1 << 16) * 4;
 constexpr size_t kMinPayloadSizeBytes = 8 + 8 + 2;
 constexpr TimeDelta kBaseTimeTick = TransportFeedback::kDeltaTick * (1 << 8);
 constexpr TimeDelta kTimeWrapPeriod = kBaseTimeTick * (1 << 24);
+// Offset of the first packet chunk in the payload.
+constexpr size_t kFirstChunkOffset = 16;
+
+Timestamp BaseTimeFromTicks(uint32_t base_time_ticks) {
+  // Add an extra kTimeWrapPeriod to allow add received packets arrived earlier
+  // than the first added packet (and thus allow to record negative deltas)
+  // even when base_time_ticks_ == 0.
+  return Timestamp::Zero() + kTimeWrapPeriod +
+         int64_t{base_time_ticks} * kBaseTimeTick;
+}
+
+TimeDelta UnwrapBaseDelta(Timestamp base_time, Timestamp prev_timestamp) {
+  TimeDelta delta = base_time - prev_timestamp;
+  // Compensate for wrap around.
+  if ((delta - kTimeWrapPeriod).Abs() < delta.Abs()) {
+    delta -= kTimeWrapPeriod;  // Wrap backwards.
+  } else if ((delta + kTimeWrapPeriod).Abs() < delta.Abs()) {
+    delta += kTimeWrapPeriod;  // Wrap forwards.
+  }
+  return delta;
+}
+
+// Calls `handler` with the delta size of each packet described by the packet
+// chunk `chunk`, up to `max_size` packets, without materializing them.
+// Returns the number of packets described.
+template <typename Handler>
+size_t ForEachDeltaSizeInChunk(uint16_t chunk,
+                               size_t max_size,
+                               Handler&& handler) {
+  if ((chunk & 0x8000) == 0) {
+    // Run length chunk.
+    const size_t size = std::min<size_t>(chunk & 0x1fff, max_size);
+    const uint8_t delta_size = (chunk >> 13) & 0x03;
+    for (size_t i = 0; i < size; ++i)
+      handler(delta_size);
+    return size;
+  }
+  if ((chunk & 0x4000) == 0) {
+    // One bit status vector chunk.
+    const size_t size = std::min<size_t>(14, max_size);
+    for (size_t i = 0; i < size; ++i)
+      handler((chunk >> (13 - i)) & 0x01);
+    return size;
+  }
+  // Two bit status vector chunk.
+  const size_t size = std::min<size_t>(7, max_size);
+  for (size_t i = 0; i < size; ++i)
+    handler((chunk >> 2 * (6 - i)) & 0x03);
+  return size;
+}
 
 //    Message format
 //
@@ -394,22 +444,11 @@ uint16_t TransportFeedback::GetBaseSequence() const {
 }
 
 Timestamp TransportFeedback::BaseTime() const {
-  // Add an extra kTimeWrapPeriod to allow add received packets arrived earlier
-  // than the first added packet (and thus allow to record negative deltas)
-  // even when base_time_ticks_ == 0.
-  return Timestamp::Zero() + kTimeWrapPeriod +
-         int64_t{base_time_ticks_} * kBaseTimeTick;
+  return BaseTimeFromTicks(base_time_ticks_);
 }
 
 TimeDelta TransportFeedback::GetBaseDelta(Timestamp prev_timestamp) const {
-  TimeDelta delta = BaseTime() - prev_timestamp;
-  // Compensate for wrap around.
-  if ((delta - kTimeWrapPeriod).Abs() < delta.Abs()) {
-    delta -= kTimeWrapPeriod;  // Wrap backwards.
-  } else if ((delta + kTimeWrapPeriod).Abs() < delta.Abs()) {
-    delta += kTimeWrapPeriod;  // Wrap forwards.
-  }
-  return delta;
+  return UnwrapBaseDelta(BaseTime(), prev_timestamp);
 }
 
 // De-serialize packet.
@@ -731,5 +770,104 @@ bool TransportFeedback::AddMissingPackets(size_t num_missing_packets) {
   num_seq_no_ = new_num_seq_no;
   return true;
 }
+bool TransportFeedbackView::Parse(const CommonHeader& packet) {
+  RTC_DCHECK_EQ(packet.type(), TransportFeedback::kPacketType);
+  RTC_DCHECK_EQ(packet.fmt(), TransportFeedback::kFeedbackMessageType);
+
+  if (packet.payload_size_bytes() < kMinPayloadSizeBytes) {
+    RTC_LOG(LS_WARNING) << "Buffer too small (" << packet.payload_size_bytes()
+                        << " bytes) to fit a "
+                           "FeedbackPacket. Minimum size = "
+                        << kMinPayloadSizeBytes;
+    return false;
+  }
+
+  payload_ = packet.payload();
+  base_seq_no_ = ByteReader<uint16_t>::ReadBigEndian(&payload_[8]);
+  num_seq_no_ = ByteReader<uint16_t>::ReadBigEndian(&payload_[10]);
+  base_time_ticks_ = ByteReader<uint32_t, 3>::ReadBigEndian(&payload_[12]);
+  if (num_seq_no_ == 0) {
+    RTC_LOG(LS_WARNING) << "Empty feedback messages not allowed.";
+    return false;
+  }
+
+  // Walk the packet chunks to find where the receive deltas start and how
+  // many bytes they take.
+  const size_t end_index = packet.payload_size_bytes();
+  size_t index = kFirstChunkOffset;
+  size_t num_statuses = 0;
+  size_t recv_delta_size = 0;
+  bool has_invalid_delta_size = false;
+  while (num_statuses < num_seq_no_) {
+    if (index + kChunkSizeBytes > end_index) {
+      RTC_LOG(LS_WARNING) << "Buffer overflow while parsing packet.";
+      return false;
+    }
+    uint16_t chunk = ByteReader<uint16_t>::ReadBigEndian(&payload_[index]);
+    index += kChunkSizeBytes;
+    num_statuses += ForEachDeltaSizeInChunk(
+        chunk, num_seq_no_ - num_statuses, [&](uint8_t delta_size) {
+          recv_delta_size += delta_size;
+          has_invalid_delta_size |= delta_size == 3;
+        });
+  }
+  receive_deltas_offset_ = index;
+
+  // Determine if timestamps, that is, recv_delta are included in the packet.
+  include_timestamps_ = end_index >= index + recv_delta_size;
+  if (include_timestamps_ && has_invalid_delta_size) {
+    RTC_LOG(LS_WARNING) << "Invalid delta_size in feedback packet.";
+    return false;
+  }
+  return true;
+}
+
+uint32_t TransportFeedbackView::sender_ssrc() const {
+  return ByteReader<uint32_t>::ReadBigEndian(&payload_[0]);
+}
+
+uint32_t TransportFeedbackView::media_ssrc() const {
+  return ByteReader<uint32_t>::ReadBigEndian(&payload_[4]);
+}
+
+void TransportFeedbackView::ForAllPackets(
+    FunctionView<void(uint16_t, TimeDelta)> handler) const {
+  size_t index = kFirstChunkOffset;
+  size_t delta_index = receive_deltas_offset_;
+  size_t num_statuses = 0;
+  uint16_t seq_no = base_seq_no_;
+  TimeDelta delta_since_base = TimeDelta::Zero();
+  while (num_statuses < num_seq_no_) {
+    uint16_t chunk = ByteReader<uint16_t>::ReadBigEndian(&payload_[index]);
+    index += kChunkSizeBytes;
+    num_statuses += ForEachDeltaSizeInChunk(
+        chunk, num_seq_no_ - num_statuses, [&](uint8_t delta_size) {
+          if (delta_size == 0) {
+            handler(seq_no++, TimeDelta::PlusInfinity());
+            return;
+          }
+          if (include_timestamps_) {
+            const uint8_t* delta_position = &payload_[delta_index];
+            int16_t delta = delta_size == 1
+                                ? *delta_position
+                                : ByteReader<int16_t>::ReadBigEndian(
+                                      delta_position);
+            delta_index += delta_size;
+            delta_since_base += delta * TransportFeedback::kDeltaTick;
+          }
+          handler(seq_no++, delta_since_base);
+        });
+  }
+  RTC_DCHECK_EQ(index, receive_deltas_offset_);
+}
+
+Timestamp TransportFeedbackView::BaseTime() const {
+  return BaseTimeFromTicks(base_time_ticks_);
+}
+
+TimeDelta TransportFeedbackView::GetBaseDelta(Timestamp prev_timestamp) const {
+  return UnwrapBaseDelta(BaseTime(), prev_timestamp);
+}
+
 }  // namespace rtcp
 }  // namespace webrtc
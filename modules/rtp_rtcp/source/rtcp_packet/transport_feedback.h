@@ -179,6 +179,40 @@ class TransportFeedback : public Rtpfb {
   std::vector<uint16_t> encoded_chunks_;
   LastChunk last_chunk_;
   size_t size_bytes_;
+
+  friend class TransportFeedbackView;
+};
+
+// Non-owning view of a received TransportFeedback. Parsing validates the
+// packet but, unlike TransportFeedback::Parse, keeps neither the packet
+// chunks nor the received packets; they are decoded again on access. The
+// parsed buffer must outlive the view.
+class TransportFeedbackView {
+ public:
+  // Parse assumes header is already parsed and validated.
+  bool Parse(const CommonHeader& packet);
+
+  uint32_t sender_ssrc() const;
+  uint32_t media_ssrc() const;
+
+  // Same as the TransportFeedback methods of the same name.
+  void ForAllPackets(
+      FunctionView<void(uint16_t sequence_number, TimeDelta delta_since_base)>
+          handler) const;
+  uint16_t GetBaseSequence() const { return base_seq_no_; }
+  size_t GetPacketStatusCount() const { return num_seq_no_; }
+  Timestamp BaseTime() const;
+  TimeDelta GetBaseDelta(Timestamp prev_timestamp) const;
+  bool IncludeTimestamps() const { return include_timestamps_; }
+
+ private:
+  const uint8_t* payload_ = nullptr;
+  // Offset in `payload_` of the first receive delta.
+  size_t receive_deltas_offset_ = 0;
+  uint16_t base_seq_no_ = 0;
+  uint16_t num_seq_no_ = 0;
+  uint32_t base_time_ticks_ = 0;
+  bool include_timestamps_ = false;
 };
 
 }  // namespace rtcp
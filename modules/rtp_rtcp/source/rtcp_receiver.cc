@@ -533,7 +533,7 @@ bool RTCPReceiver::ParseCompoundPacket(ArrayView<const uint8_t> packet,
 
 bool RTCPReceiver::HandleSenderReport(const CommonHeader& rtcp_block,
                                       PacketInformation* packet_information) {
-  rtcp::SenderReport sender_report;
+  rtcp::SenderReportView sender_report;
   if (!sender_report.Parse(rtcp_block)) {
     return false;
   }
@@ -562,7 +562,7 @@ bool RTCPReceiver::HandleSenderReport(const CommonHeader& rtcp_block,
     packet_information->packet_type_flags |= kRtcpRr;
   }
 
-  for (const rtcp::ReportBlock& report_block : sender_report.report_blocks()) {
+  for (const rtcp::ReportBlock report_block : sender_report.report_blocks()) {
     HandleReportBlock(report_block, packet_information, remote_ssrc);
   }
 
@@ -571,7 +571,7 @@ bool RTCPReceiver::HandleSenderReport(const CommonHeader& rtcp_block,
 
 bool RTCPReceiver::HandleReceiverReport(const CommonHeader& rtcp_block,
                                         PacketInformation* packet_information) {
-  rtcp::ReceiverReport receiver_report;
+  rtcp::ReceiverReportView receiver_report;
   if (!receiver_report.Parse(rtcp_block)) {
     return false;
   }
@@ -584,7 +584,7 @@ bool RTCPReceiver::HandleReceiverReport(const CommonHeader& rtcp_block,
 
   packet_information->packet_type_flags |= kRtcpRr;
 
-  for (const ReportBlock& report_block : receiver_report.report_blocks()) {
+  for (const ReportBlock report_block : receiver_report.report_blocks()) {
     HandleReportBlock(report_block, packet_information, remote_ssrc);
   }
 
@@ -750,7 +750,7 @@ bool RTCPReceiver::HandleSdes(const CommonHeader& rtcp_block,
 
 bool RTCPReceiver::HandleNack(const CommonHeader& rtcp_block,
                               PacketInformation* packet_information) {
-  rtcp::Nack nack;
+  rtcp::NackView nack;
   if (!nack.Parse(rtcp_block)) {
     return false;
   }
@@ -758,13 +758,14 @@ bool RTCPReceiver::HandleNack(const CommonHeader& rtcp_block,
   if (receiver_only_ || local_media_ssrc() != nack.media_ssrc())  // Not to us.
     return true;
 
-  packet_information->nack_sequence_numbers.insert(
-      packet_information->nack_sequence_numbers.end(),
-      nack.packet_ids().begin(), nack.packet_ids().end());
-  for (uint16_t packet_id : nack.packet_ids())
+  bool has_packet_ids = false;
+  nack.ForAllPacketIds([&](uint16_t packet_id) {
+    packet_information->nack_sequence_numbers.push_back(packet_id);
     nack_stats_.ReportRequest(packet_id);
+    has_packet_ids = true;
+  });
 
-  if (!nack.packet_ids().empty()) {
+  if (has_packet_ids) {
     packet_information->packet_type_flags |= kRtcpNack;
     ++packet_type_counter_.nack_packets;
     packet_type_counter_.nack_requests = nack_stats_.requests();
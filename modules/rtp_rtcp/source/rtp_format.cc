@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "api/array_view.h"
+#include "api/video/nalu_index.h"
 #include "api/video/video_codec_type.h"
 #include "modules/rtp_rtcp/source/rtp_format_h264.h"
 #include "modules/rtp_rtcp/source/rtp_format_video_generic.h"
@@ -37,7 +38,8 @@ std::unique_ptr<RtpPacketizer> RtpPacketizer::Create(
     ArrayView<const uint8_t> payload,
     PayloadSizeLimits limits,
     // Codec-specific details.
-    const RTPVideoHeader& rtp_video_header) {
+    const RTPVideoHeader& rtp_video_header,
+    ArrayView<const NaluIndex> nalu_indices) {
   if (!type) {
     // Use raw packetizer.
     return std::make_unique<RtpPacketizerGeneric>(payload, limits);
@@ -47,8 +49,8 @@ std::unique_ptr<RtpPacketizer> RtpPacketizer::Create(
     case kVideoCodecH264: {
       const auto& h264 =
           std::get<RTPVideoHeaderH264>(rtp_video_header.video_type_header);
-      return std::make_unique<RtpPacketizerH264>(payload, limits,
-                                                 h264.packetization_mode);
+      return std::make_unique<RtpPacketizerH264>(
+          payload, limits, h264.packetization_mode, nalu_indices);
     }
     case kVideoCodecVP8: {
       const auto& vp8 =
@@ -66,7 +68,8 @@ std::unique_ptr<RtpPacketizer> RtpPacketizer::Create(
           rtp_video_header.is_last_frame_in_picture);
 #ifdef RTC_ENABLE_H265
     case kVideoCodecH265: {
-      return std::make_unique<RtpPacketizerH265>(payload, limits);
+      return std::make_unique<RtpPacketizerH265>(payload, limits,
+                                                 nalu_indices);
     }
 #endif
     default: {
@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "api/array_view.h"
+#include "api/video/nalu_index.h"
 #include "api/video/video_codec_type.h"
 #include "modules/rtp_rtcp/source/rtp_video_header.h"
 
@@ -36,13 +37,16 @@ class RtpPacketizer {
     int single_packet_reduction_len = 0;
   };
 
-  // If type is not set, returns a raw packetizer.
+  // If type is not set, returns a raw packetizer. For H.264 and H.265,
+  // `nalu_indices` are the known positions of the NAL units of `payload`, if
+  // any. The payload is searched for them otherwise.
   static std::unique_ptr<RtpPacketizer> Create(
       std::optional<VideoCodecType> type,
       ArrayView<const uint8_t> payload,
       PayloadSizeLimits limits,
       // Codec-specific details.
-      const RTPVideoHeader& rtp_video_header);
+      const RTPVideoHeader& rtp_video_header,
+      ArrayView<const NaluIndex> nalu_indices = {});
 
   virtual ~RtpPacketizer() = default;
 
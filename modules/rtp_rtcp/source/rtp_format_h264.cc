@@ -18,6 +18,7 @@
 
 #include "absl/algorithm/container.h"
 #include "api/array_view.h"
+#include "api/video/nalu_index.h"
 #include "common_video/h264/h264_common.h"
 #include "modules/rtp_rtcp/source/byte_io.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
@@ -36,13 +37,19 @@ constexpr size_t kLengthFieldSize = 2;
 
 RtpPacketizerH264::RtpPacketizerH264(ArrayView<const uint8_t> payload,
                                      PayloadSizeLimits limits,
-                                     H264PacketizationMode packetization_mode)
+                                     H264PacketizationMode packetization_mode,
+                                     ArrayView<const NaluIndex> nalu_indices)
     : limits_(limits), num_packets_left_(0) {
   // Guard against uninitialized memory in packetization_mode.
   RTC_CHECK(packetization_mode == H264PacketizationMode::NonInterleaved ||
             packetization_mode == H264PacketizationMode::SingleNalUnit);
 
-  for (const auto& nalu : H264::FindNaluIndices(payload)) {
+  std::vector<NaluIndex> found_nalu_indices;
+  if (nalu_indices.empty()) {
+    found_nalu_indices = H264::FindNaluIndices(payload);
+    nalu_indices = found_nalu_indices;
+  }
+  for (const NaluIndex& nalu : nalu_indices) {
     input_fragments_.push_back(
         payload.subview(nalu.payload_start_offset, nalu.payload_size));
   }
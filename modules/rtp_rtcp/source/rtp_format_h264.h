@@ -18,6 +18,7 @@
 #include <queue>
 
 #include "api/array_view.h"
+#include "api/video/nalu_index.h"
 #include "modules/rtp_rtcp/source/rtp_format.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 #include "modules/video_coding/codecs/h264/include/h264_globals.h"
@@ -37,10 +38,12 @@ constexpr uint8_t kH264RBit = 0x20;
 class RtpPacketizerH264 : public RtpPacketizer {
  public:
   // Initialize with payload from encoder.
-  // The payload_data must be exactly one encoded H264 frame.
+  // The payload_data must be exactly one encoded H264 frame. `nalu_indices`
+  // are the positions of its NAL units, if known.
   RtpPacketizerH264(ArrayView<const uint8_t> payload,
                     PayloadSizeLimits limits,
-                    H264PacketizationMode packetization_mode);
+                    H264PacketizationMode packetization_mode,
+                    ArrayView<const NaluIndex> nalu_indices = {});
 
   ~RtpPacketizerH264() override;
 
@@ -18,6 +18,7 @@
 
 #include "absl/algorithm/container.h"
 #include "api/array_view.h"
+#include "api/video/nalu_index.h"
 #include "modules/rtp_rtcp/source/rtp_format.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 #include "modules/video_coding/codecs/h264/include/h264_globals.h"
@@ -248,6 +249,22 @@ TEST(RtpPacketizerH264Test, StapA) {
   EXPECT_THAT(payload.subview(kLengthFieldLength), ElementsAreArray(nalus[2]));
 }
 
+TEST(RtpPacketizerH264Test, UsesKnownNaluIndices) {
+  Buffer nalus[] = {GenerateNalUnit(/*size=*/2), GenerateNalUnit(/*size=*/2)};
+  Buffer frame = CreateFrame(nalus);
+  // Known indices are used as is rather than searching the frame.
+  const NaluIndex nalu_indices[] = {
+      {.start_offset = 0, .payload_start_offset = 3, .payload_size = 2}};
+
+  RtpPacketizerH264 packetizer(frame, kNoLimits,
+                               H264PacketizationMode::NonInterleaved,
+                               nalu_indices);
+  std::vector<RtpPacketToSend> packets = FetchAllPackets(&packetizer);
+
+  ASSERT_THAT(packets, SizeIs(1));
+  EXPECT_THAT(packets[0].payload(), ElementsAreArray(nalus[0]));
+}
+
 TEST(RtpPacketizerH264Test, SingleNalUnitModeHasNoStapA) {
   // This is the same setup as for the StapA test.
   Buffer frame = CreateFrame({2, 2, 0x123});
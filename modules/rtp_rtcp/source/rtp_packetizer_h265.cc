@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "api/array_view.h"
+#include "api/video/nalu_index.h"
 #include "common_video/h264/h264_common.h"
 #include "common_video/h265/h265_common.h"
 #include "modules/rtp_rtcp/source/byte_io.h"
@@ -27,9 +28,15 @@
 namespace webrtc {
 
 RtpPacketizerH265::RtpPacketizerH265(ArrayView<const uint8_t> payload,
-                                     PayloadSizeLimits limits)
+                                     PayloadSizeLimits limits,
+                                     ArrayView<const NaluIndex> nalu_indices)
     : limits_(limits), num_packets_left_(0) {
-  for (const auto& nalu : H264::FindNaluIndices(payload)) {
+  std::vector<NaluIndex> found_nalu_indices;
+  if (nalu_indices.empty()) {
+    found_nalu_indices = H264::FindNaluIndices(payload);
+    nalu_indices = found_nalu_indices;
+  }
+  for (const NaluIndex& nalu : nalu_indices) {
     if (!nalu.payload_size) {
       input_fragments_.clear();
       return;
@@ -17,6 +17,7 @@
 #include <queue>
 
 #include "api/array_view.h"
+#include "api/video/nalu_index.h"
 #include "modules/rtp_rtcp/source/rtp_format.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 
@@ -26,8 +27,11 @@ class RtpPacketizerH265 : public RtpPacketizer {
  public:
   // Initialize with payload from encoder.
   // The payload_data must be exactly one encoded H.265 frame.
-  // For H265 we only support tx-mode SRST.
-  RtpPacketizerH265(ArrayView<const uint8_t> payload, PayloadSizeLimits limits);
+  // For H265 we only support tx-mode SRST. `nalu_indices` are the positions
+  // of the NAL units of the frame, if known.
+  RtpPacketizerH265(ArrayView<const uint8_t> payload,
+                    PayloadSizeLimits limits,
+                    ArrayView<const NaluIndex> nalu_indices = {});
 
   RtpPacketizerH265(const RtpPacketizerH265&) = delete;
   RtpPacketizerH265& operator=(const RtpPacketizerH265&) = delete;
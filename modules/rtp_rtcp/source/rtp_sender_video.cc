@@ -35,6 +35,7 @@
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "api/video/encoded_image.h"
+#include "api/video/nalu_index.h"
 #include "api/video/video_codec_type.h"
 #include "api/video/video_content_type.h"
 #include "api/video/video_frame_type.h"
@@ -518,6 +519,24 @@ bool RTPSenderVideo::SendVideo(int payload_type,
                                RTPVideoHeader video_header,
                                TimeDelta expected_retransmission_time,
                                std::vector<uint32_t> csrcs) {
+  return SendVideoInternal(payload_type, codec_type, rtp_timestamp,
+                           capture_time, payload, encoder_output_size,
+                           std::move(video_header),
+                           expected_retransmission_time, std::move(csrcs),
+                           /*nalu_indices=*/{});
+}
+
+bool RTPSenderVideo::SendVideoInternal(
+    int payload_type,
+    std::optional<VideoCodecType> codec_type,
+    uint32_t rtp_timestamp,
+    Timestamp capture_time,
+    ArrayView<const uint8_t> payload,
+    size_t encoder_output_size,
+    RTPVideoHeader video_header,
+    TimeDelta expected_retransmission_time,
+    std::vector<uint32_t> csrcs,
+    ArrayView<const NaluIndex> nalu_indices) {
   RTC_CHECK_RUNS_SERIALIZED(&send_checker_);
 
   if (video_header.frame_type == VideoFrameType::kEmptyFrame)
@@ -689,6 +708,8 @@ bool RTPSenderVideo::SendVideo(int payload_type,
 
     encrypted_video_payload.SetSize(bytes_written);
     payload = encrypted_video_payload;
+    // The NAL units of the encoder output are not those of the ciphertext.
+    nalu_indices = {};
   } else if (require_frame_encryption_) {
     RTC_LOG(LS_WARNING)
         << "No FrameEncryptor is attached to this video sending stream but "
@@ -696,7 +717,8 @@ bool RTPSenderVideo::SendVideo(int payload_type,
   }
 
   std::unique_ptr<RtpPacketizer> packetizer =
-      RtpPacketizer::Create(codec_type, payload, limits, video_header);
+      RtpPacketizer::Create(codec_type, payload, limits, video_header,
+                            nalu_indices);
 
   const size_t num_packets = packetizer->NumPackets();
 
@@ -811,10 +833,11 @@ bool RTPSenderVideo::SendEncodedImage(int payload_type,
         payload_type, codec_type, rtp_timestamp, encoded_image, video_header,
         expected_retransmission_time);
   }
-  return SendVideo(payload_type, codec_type, rtp_timestamp,
-                   encoded_image.CaptureTime(), encoded_image,
-                   encoded_image.size(), video_header,
-                   expected_retransmission_time, /*csrcs=*/{});
+  return SendVideoInternal(payload_type, codec_type, rtp_timestamp,
+                           encoded_image.CaptureTime(), encoded_image,
+                           encoded_image.size(), video_header,
+                           expected_retransmission_time, /*csrcs=*/{},
+                           encoded_image.NaluIndices());
 }
 
 DataRate RTPSenderVideo::PostEncodeOverhead() const {
@@ -29,6 +29,7 @@
 #include "api/units/timestamp.h"
 #include "api/video/color_space.h"
 #include "api/video/encoded_image.h"
+#include "api/video/nalu_index.h"
 #include "api/video/video_codec_type.h"
 #include "api/video/video_layers_allocation.h"
 #include "api/video/video_rotation.h"
@@ -170,6 +171,19 @@ class RTPSenderVideo : public RTPVideoFrameSenderInterface {
     kDontSend
   };
 
+  // Like SendVideo(), but uses the already known positions `nalu_indices` of
+  // the NAL units of an H.264 or H.265 `payload`, if not empty.
+  bool SendVideoInternal(int payload_type,
+                         std::optional<VideoCodecType> codec_type,
+                         uint32_t rtp_timestamp,
+                         Timestamp capture_time,
+                         ArrayView<const uint8_t> payload,
+                         size_t encoder_output_size,
+                         RTPVideoHeader video_header,
+                         TimeDelta expected_retransmission_time,
+                         std::vector<uint32_t> csrcs,
+                         ArrayView<const NaluIndex> nalu_indices);
+
   void SetVideoStructureInternal(
       const FrameDependencyStructure* video_structure);
   void SetVideoLayersAllocationInternal(VideoLayersAllocation allocation);
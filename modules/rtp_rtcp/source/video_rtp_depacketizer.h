@@ -35,6 +35,9 @@ class VideoRtpDepacketizer {
       CopyOnWriteBuffer rtp_payload) = 0;
   virtual scoped_refptr<EncodedImageBuffer> AssembleFrame(
       ArrayView<const ArrayView<const uint8_t>> rtp_payloads);
+  // Returns true if AssembleFrame() only concatenates the payloads, in which
+  // case the caller may assemble the frame itself as the packets arrive.
+  virtual bool AssemblesFrameByConcatenation() const { return true; }
 };
 
 }  // namespace webrtc
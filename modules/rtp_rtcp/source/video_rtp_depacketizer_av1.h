@@ -33,6 +33,7 @@ class VideoRtpDepacketizerAv1 : public VideoRtpDepacketizer {
 
   scoped_refptr<EncodedImageBuffer> AssembleFrame(
       ArrayView<const ArrayView<const uint8_t>> rtp_payloads) override;
+  bool AssemblesFrameByConcatenation() const override { return false; }
 
   std::optional<ParsedRtpPayload> Parse(CopyOnWriteBuffer rtp_payload) override;
 };
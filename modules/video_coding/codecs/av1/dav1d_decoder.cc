@@ -11,6 +11,7 @@
 #include "modules/video_coding/codecs/av1/dav1d_decoder.h"
 
 #include <algorithm>
+#include <cerrno>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -19,12 +20,17 @@
 #include "api/ref_counted_base.h"
 #include "api/scoped_refptr.h"
 #include "api/video/encoded_image.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/i444_buffer.h"
 #include "api/video/video_frame.h"
 #include "api/video/video_frame_buffer.h"
 #include "api/video_codecs/video_decoder.h"
 #include "common_video/include/video_frame_buffer.h"
+#include "common_video/include/video_frame_buffer_pool.h"
 #include "modules/video_coding/include/video_error_codes.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
 #include "third_party/dav1d/libdav1d/include/dav1d/data.h"
 #include "third_party/dav1d/libdav1d/include/dav1d/dav1d.h"
 #include "third_party/dav1d/libdav1d/include/dav1d/headers.h"
@@ -52,10 +58,20 @@ class Dav1dDecoder : public VideoDecoder {
   const char* ImplementationName() const override;
 
  private:
+  // Picture allocator callbacks that let dav1d decode directly into buffers
+  // from `buffer_pool_`.
+  static int AllocPicture(Dav1dPicture* picture, void* cookie);
+  static void ReleasePicture(Dav1dPicture* picture, void* cookie);
+
   Dav1dContext* context_ = nullptr;
   DecodedImageCallback* decode_complete_callback_ = nullptr;
 
   const bool crop_to_render_resolution_ = false;
+
+  // dav1d may allocate pictures from its worker threads.
+  Mutex buffer_pool_lock_;
+  VideoFrameBufferPool buffer_pool_ RTC_GUARDED_BY(buffer_pool_lock_){
+      /*zero_initialize=*/false, /*max_number_of_buffers=*/300};
 };
 
 class ScopedDav1dData {
@@ -104,10 +120,76 @@ bool Dav1dDecoder::Configure(const Settings& settings) {
   // Limit max frame size to avoid OOM'ing fuzzers. crbug.com/325284120.
   s.frame_size_limit = 16384 * 16384;
   s.operating_point = 31;  // Decode all operating points.
+  s.allocator.cookie = this;
+  s.allocator.alloc_picture_callback = &Dav1dDecoder::AllocPicture;
+  s.allocator.release_picture_callback = &Dav1dDecoder::ReleasePicture;
+
+  if (std::optional<int> buffer_pool_size = settings.buffer_pool_size()) {
+    MutexLock lock(&buffer_pool_lock_);
+    if (!buffer_pool_.Resize(*buffer_pool_size)) {
+      return false;
+    }
+  }
 
   return dav1d_open(&context_, &s) == 0;
 }
 
+int Dav1dDecoder::AllocPicture(Dav1dPicture* picture, void* cookie) {
+  Dav1dDecoder* decoder = static_cast<Dav1dDecoder*>(cookie);
+  if (picture->p.bpc != 8) {
+    return DAV1D_ERR(EINVAL);
+  }
+  // dav1d requires the planes to be DAV1D_PICTURE_ALIGNMENT aligned, with a
+  // size that is a multiple of 128 pixels and DAV1D_PICTURE_ALIGNMENT bytes of
+  // padding after each plane. Pooled buffers are 64 byte aligned, so an
+  // aligned width keeps every plane aligned, and the extra rows give the
+  // padding.
+  const int aligned_width = (picture->p.w + 127) & ~127;
+  const int aligned_height = (picture->p.h + 127) & ~127;
+  scoped_refptr<VideoFrameBuffer> buffer;
+  MutexLock lock(&decoder->buffer_pool_lock_);
+  if (picture->p.layout == DAV1D_PIXEL_LAYOUT_I420) {
+    scoped_refptr<I420Buffer> i420_buffer =
+        decoder->buffer_pool_.CreateI420Buffer(aligned_width,
+                                               aligned_height + 2);
+    if (i420_buffer) {
+      picture->data[0] = i420_buffer->MutableDataY();
+      picture->data[1] = i420_buffer->MutableDataU();
+      picture->data[2] = i420_buffer->MutableDataV();
+      picture->stride[0] = i420_buffer->StrideY();
+      picture->stride[1] = i420_buffer->StrideU();
+      buffer = std::move(i420_buffer);
+    }
+  } else if (picture->p.layout == DAV1D_PIXEL_LAYOUT_I444) {
+    scoped_refptr<I444Buffer> i444_buffer =
+        decoder->buffer_pool_.CreateI444Buffer(aligned_width,
+                                               aligned_height + 1);
+    if (i444_buffer) {
+      picture->data[0] = i444_buffer->MutableDataY();
+      picture->data[1] = i444_buffer->MutableDataU();
+      picture->data[2] = i444_buffer->MutableDataV();
+      picture->stride[0] = i444_buffer->StrideY();
+      picture->stride[1] = i444_buffer->StrideU();
+      buffer = std::move(i444_buffer);
+    }
+  } else {
+    return DAV1D_ERR(EINVAL);
+  }
+  if (!buffer) {
+    // Pool has too many pending frames.
+    return DAV1D_ERR(ENOMEM);
+  }
+  // The reference is dropped in ReleasePicture().
+  picture->allocator_data = buffer.release();
+  return 0;
+}
+
+void Dav1dDecoder::ReleasePicture(Dav1dPicture* picture, void* /* cookie */) {
+  // May run after the decoder is destroyed, when a decoded frame outlives it,
+  // so only the buffer itself is touched.
+  static_cast<VideoFrameBuffer*>(picture->allocator_data)->Release();
+}
+
 int32_t Dav1dDecoder::RegisterDecodeCompleteCallback(
     DecodedImageCallback* decode_complete_callback) {
   decode_complete_callback_ = decode_complete_callback;
@@ -119,6 +201,8 @@ int32_t Dav1dDecoder::Release() {
   if (context_ != nullptr) {
     return WEBRTC_VIDEO_CODEC_MEMORY;
   }
+  MutexLock lock(&buffer_pool_lock_);
+  buffer_pool_.Release();
   return WEBRTC_VIDEO_CODEC_OK;
 }
 
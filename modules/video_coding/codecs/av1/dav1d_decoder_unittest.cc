@@ -47,13 +47,14 @@ EncodedImage CreateEncodedImage(ArrayView<const uint8_t> data) {
 
 class TestAv1Decoder : public DecodedImageCallback {
  public:
-  explicit TestAv1Decoder(const Environment& env)
+  explicit TestAv1Decoder(const Environment& env,
+                          const VideoDecoder::Settings& settings = {})
       : decoder_(CreateDav1dDecoder(env)) {
     if (decoder_ == nullptr) {
       ADD_FAILURE() << "Failed to create decoder";
       return;
     }
-    EXPECT_TRUE(decoder_->Configure({}));
+    EXPECT_TRUE(decoder_->Configure(settings));
     EXPECT_EQ(decoder_->RegisterDecodeCompleteCallback(this),
               WEBRTC_VIDEO_CODEC_OK);
   }
@@ -62,14 +63,16 @@ class TestAv1Decoder : public DecodedImageCallback {
   TestAv1Decoder& operator=(const TestAv1Decoder&) = delete;
 
   void Decode(const EncodedImage& image) {
-    ASSERT_THAT(decoder_, NotNull());
-    decoded_frame_ = std::nullopt;
-    int32_t error =
-        decoder_->Decode(image, /*render_time_ms=*/image.capture_time_ms_);
-    ASSERT_EQ(error, WEBRTC_VIDEO_CODEC_OK);
+    ASSERT_EQ(TryDecode(image), WEBRTC_VIDEO_CODEC_OK);
     ASSERT_THAT(decoded_frame_, Not(Eq(std::nullopt)));
   }
 
+  int32_t TryDecode(const EncodedImage& image) {
+    EXPECT_THAT(decoder_, NotNull());
+    decoded_frame_ = std::nullopt;
+    return decoder_->Decode(image, /*render_time_ms=*/image.capture_time_ms_);
+  }
+
   VideoFrame& decoded_frame() { return *decoded_frame_; }
 
  private:
@@ -115,6 +118,27 @@ TEST(Dav1dDecoderTest, DoesNotCropToRenderResolutionWhenCropIsDisabled) {
   EXPECT_EQ(decoder.decoded_frame().height(), 20);
 }
 
+TEST(Dav1dDecoderTest, DecodesIntoBufferPool) {
+  VideoDecoder::Settings settings;
+  settings.set_buffer_pool_size(2);
+  TestAv1Decoder decoder(CreateEnvironment(), settings);
+  const EncodedImage image =
+      CreateEncodedImage(kAv1FrameWith36x20EncodededAnd32x16RenderResolution);
+
+  decoder.Decode(image);
+  VideoFrame first_frame = decoder.decoded_frame();
+  decoder.Decode(image);
+  VideoFrame second_frame = decoder.decoded_frame();
+  EXPECT_EQ(second_frame.width(), 36);
+  EXPECT_EQ(second_frame.height(), 20);
+  EXPECT_NE(first_frame.video_frame_buffer()->GetI420()->DataY(),
+            second_frame.video_frame_buffer()->GetI420()->DataY());
+
+  // Both pooled buffers are held by the decoded frames, so the pool is
+  // exhausted.
+  EXPECT_EQ(decoder.TryDecode(image), WEBRTC_VIDEO_CODEC_ERROR);
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace webrtc
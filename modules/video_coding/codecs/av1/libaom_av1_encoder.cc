@@ -37,11 +37,14 @@
 #include "api/video_codecs/video_codec.h"
 #include "api/video_codecs/video_encoder.h"
 #include "common_video/generic_frame_descriptor/generic_frame_info.h"
+#include "common_video/include/encoded_image_buffer_pool.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "modules/video_coding/include/video_codec_interface.h"
 #include "modules/video_coding/include/video_error_codes.h"
 #include "modules/video_coding/svc/create_scalability_structure.h"
 #include "modules/video_coding/svc/scalable_video_controller.h"
+#include "modules/video_coding/utility/active_map_tracker.h"
+#include "modules/video_coding/utility/encoder_threading_policy.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/experiments/encoder_info_settings.h"
 #include "rtc_base/logging.h"
@@ -50,11 +53,6 @@
 #include "third_party/libaom/source/libaom/aom/aom_image.h"
 #include "third_party/libaom/source/libaom/aom/aomcx.h"
 
-#if (defined(WEBRTC_ARCH_ARM) || defined(WEBRTC_ARCH_ARM64)) && \
-    (defined(WEBRTC_ANDROID) || defined(WEBRTC_IOS))
-#define MOBILE_ARM
-#endif
-
 #define SET_ENCODER_PARAM_OR_RETURN_ERROR(param_id, param_value) \
   do {                                                           \
     if (!SetEncoderControlParameters(param_id, param_value)) {   \
@@ -110,9 +108,6 @@ class LibaomAv1Encoder final : public VideoEncoder {
   // Get value to be used for encoder cpu_speed setting
   int GetCpuSpeed(int width, int height);
 
-  // Determine number of encoder threads to use.
-  int NumberOfThreads(int width, int height, int number_of_cores);
-
   bool SvcEnabled() const { return svc_params_.has_value(); }
   // Fills svc_params_ memeber value. Returns false on error.
   bool SetSvcParams(ScalableVideoController::StreamLayersConfig svc_config,
@@ -130,6 +125,8 @@ class LibaomAv1Encoder final : public VideoEncoder {
   std::optional<ScalabilityMode> scalability_mode_;
   bool inited_;
   bool rates_configured_;
+  EncoderCoreBudget::Reservation core_reservation_;
+  EncoderThreadingSettings threading_;
   std::optional<aom_svc_params_t> svc_params_;
   VideoCodec encoder_settings_;
   LibaomAv1EncoderSettings settings_;
@@ -139,6 +136,9 @@ class LibaomAv1Encoder final : public VideoEncoder {
   EncodedImageCallback* encoded_image_callback_;
   double framerate_fps_;  // Current target frame rate.
   int64_t timestamp_;
+  ActiveMapTracker active_map_tracker_;
+  EncodedImageBufferPool encoded_image_buffer_pool_;
+  bool active_map_set_ = false;
   const LibaomAv1EncoderInfoSettings encoder_info_override_;
   // TODO(webrtc:351644568): Remove this kill-switch after the feature is fully
   // deployed.
@@ -241,8 +241,11 @@ int LibaomAv1Encoder::InitEncode(const VideoCodec* codec_settings,
   // Overwrite default config with input encoder settings & RTC-relevant values.
   cfg_.g_w = encoder_settings_.width;
   cfg_.g_h = encoder_settings_.height;
-  cfg_.g_threads =
-      NumberOfThreads(cfg_.g_w, cfg_.g_h, settings.number_of_cores);
+  threading_ = ReserveEncoderThreading(kVideoCodecAV1, cfg_.g_w, cfg_.g_h,
+                                       encoder_settings_.mode,
+                                       settings.number_of_cores,
+                                       &core_reservation_);
+  cfg_.g_threads = threading_.num_threads;
   cfg_.g_timebase.num = 1;
   cfg_.g_timebase.den = kVideoPayloadTypeFrequency;
   cfg_.rc_target_bitrate = encoder_settings_.startBitrate;  // kilobits/sec.
@@ -306,7 +309,14 @@ int LibaomAv1Encoder::InitEncode(const VideoCodec* codec_settings,
     SET_ENCODER_PARAM_OR_RETURN_ERROR(AV1E_SET_ENABLE_PALETTE, 0);
   }
 
-  SET_ENCODER_PARAM_OR_RETURN_ERROR(AV1E_SET_AUTO_TILES, 1);
+  if (threading_.auto_tiles) {
+    SET_ENCODER_PARAM_OR_RETURN_ERROR(AV1E_SET_AUTO_TILES, 1);
+  } else {
+    SET_ENCODER_PARAM_OR_RETURN_ERROR(AV1E_SET_TILE_COLUMNS,
+                                      threading_.log2_tile_columns);
+    SET_ENCODER_PARAM_OR_RETURN_ERROR(AV1E_SET_TILE_ROWS,
+                                      threading_.log2_tile_rows);
+  }
   SET_ENCODER_PARAM_OR_RETURN_ERROR(AV1E_SET_ROW_MT, 1);
   SET_ENCODER_PARAM_OR_RETURN_ERROR(AV1E_SET_ENABLE_OBMC, 0);
   SET_ENCODER_PARAM_OR_RETURN_ERROR(AV1E_SET_NOISE_SENSITIVITY, 0);
@@ -408,30 +418,6 @@ int LibaomAv1Encoder::GetCpuSpeed(int width, int height) {
   }
 }
 
-int LibaomAv1Encoder::NumberOfThreads(int width,
-                                      int height,
-                                      int number_of_cores) {
-  // Keep the number of encoder threads equal to the possible number of
-  // column/row tiles, which is (1, 2, 4, 8). See comments below for
-  // AV1E_SET_TILE_COLUMNS/ROWS.
-  if (width * height > 1280 * 720 && number_of_cores > 8) {
-    return 8;
-  } else if (width * height >= 640 * 360 && number_of_cores > 4) {
-    return 4;
-  } else if (width * height >= 320 * 180 && number_of_cores > 2) {
-    return 2;
-  } else {
-// Use 2 threads for low res on ARM.
-#ifdef MOBILE_ARM
-    if (width * height >= 320 * 180 && number_of_cores > 2) {
-      return 2;
-    }
-#endif
-    // 1 thread less than VGA.
-    return 1;
-  }
-}
-
 bool LibaomAv1Encoder::SetSvcParams(
     ScalableVideoController::StreamLayersConfig svc_config,
     const aom_codec_enc_cfg_t& encoder_config) {
@@ -537,6 +523,10 @@ int32_t LibaomAv1Encoder::Release() {
     inited_ = false;
   }
   rates_configured_ = false;
+  core_reservation_ = EncoderCoreBudget::Reservation();
+  active_map_tracker_.Reset();
+  active_map_set_ = false;
+  encoded_image_buffer_pool_.Release();
   return WEBRTC_VIDEO_CODEC_OK;
 }
 
@@ -561,6 +551,7 @@ int32_t LibaomAv1Encoder::Encode(
   if (!inited_ || encoded_image_callback_ == nullptr || !rates_configured_) {
     return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
   }
+  active_map_tracker_.OnInputFrame(frame);
 
   bool keyframe_required =
       frame_types != nullptr &&
@@ -649,6 +640,34 @@ int32_t LibaomAv1Encoder::Encode(
   const uint32_t duration = kVideoPayloadTypeFrequency / framerate_fps_;
   timestamp_ += duration;
 
+  // Skip the blocks that did not change since the last encoded frame. Inactive
+  // blocks are copied from the previous frame, so this is only done without
+  // SVC, where every frame predicts from the previous one.
+  const bool use_active_map =
+      !SvcEnabled() && !layer_frames.front().IsKeyframe() &&
+      active_map_tracker_.ComputeActiveMap() &&
+      active_map_tracker_.MatchesFrameSize(cfg_.g_w, cfg_.g_h);
+  if (use_active_map || active_map_set_) {
+    aom_active_map_t active_map;
+    active_map.active_map =
+        use_active_map ? active_map_tracker_.active_map() : nullptr;
+    if (use_active_map) {
+      active_map.rows = active_map_tracker_.rows();
+      active_map.cols = active_map_tracker_.cols();
+    } else {
+      // Clearing the map also takes the size of the encoded frames.
+      active_map.rows = ActiveMapTracker::NumMacroblocks(cfg_.g_h);
+      active_map.cols = ActiveMapTracker::NumMacroblocks(cfg_.g_w);
+    }
+    if (aom_codec_control(&ctx_, AOME_SET_ACTIVEMAP, &active_map) ==
+        AOM_CODEC_OK) {
+      active_map_set_ = use_active_map;
+    } else {
+      RTC_LOG(LS_WARNING) << "LibaomAv1Encoder::Encode failed to set the "
+                             "active map.";
+    }
+  }
+
   const size_t num_spatial_layers =
       svc_params_ ? svc_params_->number_spatial_layers : 1;
   auto next_layer_frame = layer_frames.begin();
@@ -706,7 +725,7 @@ int32_t LibaomAv1Encoder::Encode(
                                  "one data packet for an input video frame.";
           Release();
         }
-        encoded_image.SetEncodedData(EncodedImageBuffer::Create(
+        encoded_image.SetEncodedData(encoded_image_buffer_pool_.CreateBuffer(
             /*data=*/static_cast<const uint8_t*>(pkt->data.frame.buf),
             /*size=*/pkt->data.frame.sz));
 
@@ -777,6 +796,7 @@ int32_t LibaomAv1Encoder::Encode(
   }
   if (!encoded_images.empty()) {
     encoded_images.back().second.end_of_picture = true;
+    active_map_tracker_.OnFrameEncoded();
   }
   for (auto& [encoded_image, codec_specific_info] : encoded_images) {
     encoded_image_callback_->OnEncodedImage(encoded_image,
@@ -20,10 +20,14 @@
 #include <limits>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/strings/match.h"
+#include "api/video/nalu_index.h"
 #include "api/video/video_codec_constants.h"
 #include "api/video_codecs/scalability_mode.h"
+#include "common_video/include/encoded_image_buffer_pool.h"
 #include "common_video/libyuv/include/webrtc_libyuv.h"
 #include "modules/video_coding/include/video_codec_interface.h"
 #include "modules/video_coding/include/video_error_codes.h"
@@ -122,15 +126,16 @@ std::optional<ScalabilityMode> ScalabilityModeFromTemporalLayers(
 }  // namespace
 
 // Helper method used by H264EncoderImpl::Encode.
-// Copies the encoded bytes from `info` to `encoded_image`. The
-// `encoded_image->_buffer` may be deleted and reallocated if a bigger buffer is
-// required.
+// Copies the encoded bytes from `info` to `encoded_image`, into a buffer taken
+// from `buffer_pool`.
 //
 // After OpenH264 encoding, the encoded bytes are stored in `info` spread out
 // over a number of layers and "NAL units". Each NAL unit is a fragment starting
 // with the four-byte start code {0,0,0,1}. All of this data (including the
 // start codes) is copied to the `encoded_image->_buffer`.
-static void RtpFragmentize(EncodedImage* encoded_image, SFrameBSInfo* info) {
+static void RtpFragmentize(EncodedImage* encoded_image,
+                           SFrameBSInfo* info,
+                           EncodedImageBufferPool& buffer_pool) {
   // Calculate minimum buffer size required to hold encoded data.
   size_t required_capacity = 0;
   size_t fragments_count = 0;
@@ -144,13 +149,15 @@ static void RtpFragmentize(EncodedImage* encoded_image, SFrameBSInfo* info) {
       required_capacity += layerInfo.pNalLengthInByte[nal];
     }
   }
-  auto buffer = EncodedImageBuffer::Create(required_capacity);
+  auto buffer = buffer_pool.CreateBuffer(required_capacity);
   encoded_image->SetEncodedData(buffer);
 
   // Iterate layers and NAL units, note each NAL unit as a fragment and copy
   // the data to `encoded_image->_buffer`.
   const uint8_t start_code[4] = {0, 0, 0, 1};
   size_t frag = 0;
+  std::vector<NaluIndex> nalu_indices;
+  nalu_indices.reserve(fragments_count);
   encoded_image->set_size(0);
   for (int layer = 0; layer < info->iLayerNum; ++layer) {
     const SLayerBSInfo& layerInfo = info->sLayerInfo[layer];
@@ -164,12 +171,21 @@ static void RtpFragmentize(EncodedImage* encoded_image, SFrameBSInfo* info) {
       RTC_DCHECK_EQ(layerInfo.pBsBuf[layer_len + 1], start_code[1]);
       RTC_DCHECK_EQ(layerInfo.pBsBuf[layer_len + 2], start_code[2]);
       RTC_DCHECK_EQ(layerInfo.pBsBuf[layer_len + 3], start_code[3]);
+      // Noting the NAL units here spares later users of the image from
+      // searching for them.
+      const size_t start_offset = encoded_image->size() + layer_len;
+      const size_t nal_length = layerInfo.pNalLengthInByte[nal];
+      nalu_indices.push_back({.start_offset = start_offset,
+                              .payload_start_offset =
+                                  start_offset + sizeof(start_code),
+                              .payload_size = nal_length - sizeof(start_code)});
       layer_len += layerInfo.pNalLengthInByte[nal];
     }
     // Copy the entire layer's data (including start codes).
     memcpy(buffer->data() + encoded_image->size(), layerInfo.pBsBuf, layer_len);
     encoded_image->set_size(encoded_image->size() + layer_len);
   }
+  encoded_image->SetNaluIndices(std::move(nalu_indices));
 }
 
 H264EncoderImpl::H264EncoderImpl(const Environment& env,
@@ -347,6 +363,7 @@ int32_t H264EncoderImpl::Release() {
   downscaled_buffers_.clear();
   configurations_.clear();
   encoded_images_.clear();
+  encoded_image_buffer_pool_.Release();
   pictures_.clear();
   tl0sync_limit_.clear();
   svc_controllers_.clear();
@@ -537,13 +554,14 @@ int32_t H264EncoderImpl::Encode(
 
     // Split encoded image up into fragments. This also updates
     // `encoded_image_`.
-    RtpFragmentize(&encoded_images_[i], &info);
+    RtpFragmentize(&encoded_images_[i], &info, encoded_image_buffer_pool_);
 
     // Encoder can skip frames to save bandwidth in which case
     // `encoded_images_[i]._length` == 0.
     if (encoded_images_[i].size() > 0) {
       // Parse QP.
-      h264_bitstream_parser_.ParseBitstream(encoded_images_[i]);
+      h264_bitstream_parser_.ParseBitstream(encoded_images_[i],
+                                            encoded_images_[i].NaluIndices());
       encoded_images_[i].qp_ =
           h264_bitstream_parser_.GetLastSliceQp().value_or(-1);
 
@@ -0,0 +1,140 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/video/encoded_image.h"
+#include "api/video/render_resolution.h"
+#include "api/video/video_bitrate_allocation.h"
+#include "api/video/video_codec_type.h"
+#include "api/video/video_frame.h"
+#include "api/video_codecs/scalability_mode.h"
+#include "api/video_codecs/video_codec.h"
+#include "api/video_codecs/video_decoder.h"
+#include "api/video_codecs/video_encoder.h"
+#include "benchmark/benchmark.h"
+#include "modules/video_coding/codecs/av1/dav1d_decoder.h"
+#include "modules/video_coding/codecs/av1/libaom_av1_encoder.h"
+#include "modules/video_coding/codecs/test/encoded_video_frame_producer.h"
+#include "modules/video_coding/codecs/vp8/include/vp8.h"
+#include "modules/video_coding/include/video_error_codes.h"
+#include "rtc_base/checks.h"
+#include "test/video_codec_settings.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kWidth = 1280;
+constexpr int kHeight = 720;
+constexpr int kFramerate = 30;
+constexpr int kBitrateBps = 1'500'000;
+constexpr int kNumFrames = 60;
+
+std::vector<EncodedImage> EncodeClip(VideoCodecType codec_type) {
+  const Environment env = CreateEnvironment();
+  std::unique_ptr<VideoEncoder> encoder = codec_type == kVideoCodecVP8
+                                              ? CreateVp8Encoder(env)
+                                              : CreateLibaomAv1Encoder(env);
+  VideoCodec codec_settings;
+  test::CodecSettings(codec_type, &codec_settings);
+  codec_settings.width = kWidth;
+  codec_settings.height = kHeight;
+  codec_settings.startBitrate = kBitrateBps / 1000;
+  codec_settings.maxBitrate = kBitrateBps / 1000;
+  codec_settings.SetScalabilityMode(ScalabilityMode::kL1T1);
+  RTC_CHECK_EQ(
+      encoder->InitEncode(
+          &codec_settings,
+          VideoEncoder::Settings(
+              VideoEncoder::Capabilities(/*loss_notification=*/false),
+              /*number_of_cores=*/1, /*max_payload_size=*/1200)),
+      WEBRTC_VIDEO_CODEC_OK);
+  VideoBitrateAllocation allocation;
+  allocation.SetBitrate(0, 0, kBitrateBps);
+  encoder->SetRates(
+      VideoEncoder::RateControlParameters(allocation, kFramerate));
+
+  std::vector<EncodedImage> clip;
+  for (EncodedVideoFrameProducer::EncodedFrame& frame :
+       EncodedVideoFrameProducer(*encoder)
+           .SetNumInputFrames(kNumFrames)
+           .SetResolution(RenderResolution(kWidth, kHeight))
+           .SetFramerateFps(kFramerate)
+           .Encode()) {
+    clip.push_back(std::move(frame.encoded_image));
+  }
+  encoder->Release();
+  return clip;
+}
+
+const std::vector<EncodedImage>& GetClip(VideoCodecType codec_type) {
+  static const auto* const kVp8Clip =
+      new std::vector<EncodedImage>(EncodeClip(kVideoCodecVP8));
+  static const auto* const kAv1Clip =
+      new std::vector<EncodedImage>(EncodeClip(kVideoCodecAV1));
+  return codec_type == kVideoCodecVP8 ? *kVp8Clip : *kAv1Clip;
+}
+
+// Holds on to the last decoded frame, like a renderer would.
+class LastFrameSink : public DecodedImageCallback {
+ public:
+  int32_t Decoded(VideoFrame& decoded_image) override {
+    last_frame_ = decoded_image;
+    return 0;
+  }
+
+ private:
+  std::optional<VideoFrame> last_frame_;
+};
+
+// Decodes a 720p clip with one decoder per benchmark thread, each thread
+// acting as one of several simultaneously received streams.
+void BM_DecodeStreams(benchmark::State& state) {
+  const VideoCodecType codec_type =
+      state.range(0) == 0 ? kVideoCodecVP8 : kVideoCodecAV1;
+  const std::vector<EncodedImage>& clip = GetClip(codec_type);
+
+  const Environment env = CreateEnvironment();
+  std::unique_ptr<VideoDecoder> decoder = codec_type == kVideoCodecVP8
+                                              ? CreateVp8Decoder(env)
+                                              : CreateDav1dDecoder(env);
+  VideoDecoder::Settings settings;
+  settings.set_codec_type(codec_type);
+  settings.set_max_render_resolution({kWidth, kHeight});
+  settings.set_number_of_cores(1);
+  RTC_CHECK(decoder->Configure(settings));
+  LastFrameSink sink;
+  decoder->RegisterDecodeCompleteCallback(&sink);
+
+  for (auto _ : state) {
+    for (const EncodedImage& frame : clip) {
+      RTC_CHECK_EQ(decoder->Decode(frame, /*render_time_ms=*/0),
+                   WEBRTC_VIDEO_CODEC_OK);
+    }
+  }
+  decoder->Release();
+  state.SetItemsProcessed(state.iterations() * clip.size());
+}
+
+BENCHMARK(BM_DecodeStreams)
+    ->Arg(0)
+    ->Arg(1)
+    ->ArgNames({"av1"})
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace webrtc
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstdio>
 #include <iterator>
 #include <limits>
 #include <map>
@@ -21,9 +22,13 @@
 #include <vector>
 
 #include "absl/flags/flag.h"
+#include "absl/strings/string_view.h"
 #include "api/environment/environment.h"
 #include "api/environment/environment_factory.h"
+#include "api/numerics/samples_stats_counter.h"
 #include "api/test/metrics/global_metrics_logger_and_exporter.h"
+#include "api/test/metrics/metric.h"
+#include "api/test/metrics/metrics_logger.h"
 #include "api/units/data_rate.h"
 #include "api/units/frequency.h"
 #include "api/video/resolution.h"
@@ -38,8 +43,12 @@
 #include "modules/video_coding/codecs/test/android_codec_factory_helper.h"
 #endif
 #include "modules/video_coding/svc/scalability_mode_util.h"
+#include "rtc_base/cpu_time.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/random.h"
+#include "rtc_base/string_to_number.h"
 #include "rtc_base/strings/string_builder.h"
+#include "rtc_base/time_utils.h"
 #include "test/explicit_key_value_config.h"
 #include "test/field_trial.h"
 #include "test/gtest.h"
@@ -83,6 +92,7 @@ ABSL_FLAG(int,
           std::numeric_limits<int>::max(),
           "Keyframe interval in frames.");
 ABSL_FLAG(int, num_frames, 300, "Number of frames to encode and/or decode.");
+ABSL_FLAG(int, num_cores, 1, "Number of cores the encoder may use.");
 ABSL_FLAG(std::string, field_trials, "", "Field trials to apply.");
 ABSL_FLAG(std::string, test_name, "", "Test name.");
 ABSL_FLAG(bool, dump_decoder_input, false, "Dump decoder input.");
@@ -90,6 +100,21 @@ ABSL_FLAG(bool, dump_decoder_output, false, "Dump decoder output.");
 ABSL_FLAG(bool, dump_encoder_input, false, "Dump encoder input.");
 ABSL_FLAG(bool, dump_encoder_output, false, "Dump encoder output.");
 ABSL_FLAG(bool, write_csv, false, "Write metrics to a CSV file.");
+ABSL_FLAG(std::vector<std::string>,
+          batch_input_paths,
+          {},
+          "Input video files of a batch run. Each file is encoded at each of "
+          "--batch_bitrates_kbps, with the other settings given by the flags "
+          "above, so all files must have the same resolution and frame rate.");
+ABSL_FLAG(std::vector<std::string>,
+          batch_bitrates_kbps,
+          {},
+          "Encode target bitrates of a batch run in kbps.");
+ABSL_FLAG(std::optional<int>,
+          batch_num_workers,
+          std::nullopt,
+          "Number of sessions of a batch run that run at a time. Defaults to "
+          "the number of cores.");
 
 namespace webrtc {
 namespace test {
@@ -240,6 +265,7 @@ std::unique_ptr<VideoCodecStats> RunEncodeDecodeTest(
   VideoCodecTester::EncoderSettings encoder_settings;
   encoder_settings.pacing_settings.mode =
       encoder_impl == "builtin" ? PacingMode::kNoPacing : PacingMode::kRealTime;
+  encoder_settings.number_of_cores = absl::GetFlag(FLAGS_num_cores);
   if (absl::GetFlag(FLAGS_dump_encoder_input)) {
     encoder_settings.encoder_input_base_path = output_path + "_enc_input";
   }
@@ -285,6 +311,7 @@ std::unique_ptr<VideoCodecStats> RunEncodeTest(
   VideoCodecTester::EncoderSettings encoder_settings;
   encoder_settings.pacing_settings.mode =
       encoder_impl == "builtin" ? PacingMode::kNoPacing : PacingMode::kRealTime;
+  encoder_settings.number_of_cores = absl::GetFlag(FLAGS_num_cores);
   if (absl::GetFlag(FLAGS_dump_encoder_input)) {
     encoder_settings.encoder_input_base_path = output_path + "_enc_input";
   }
@@ -575,26 +602,119 @@ INSTANTIATE_TEST_SUITE_P(All,
                                  Values(std::pair(30, 15), std::pair(15, 30))),
                          FramerateAdaptationTest::TestParamsToString);
 
-TEST(VideoCodecTest, DISABLED_EncodeDecode) {
-  ScopedFieldTrials field_trials(absl::GetFlag(FLAGS_field_trials));
-  const Environment env =
-      CreateEnvironment(std::make_unique<ExplicitKeyValueConfig>(
-          absl::GetFlag(FLAGS_field_trials)));
+// Writes a screen-like clip to a temporary file and returns its path. The
+// clip shows a static pattern of 8x8 blocks, except for a 128x64 area in the
+// middle whose content changes in every frame, like a clock or typed text.
+std::string CreateLocalChangesClip(Resolution resolution, int num_frames) {
+  constexpr int kBlockSize = 8;
+  constexpr Resolution kChangingArea = {.width = 128, .height = 64};
+  const int width = resolution.width;
+  const int height = resolution.height;
+  Random random(/*seed=*/42);
+  auto fill_blocks = [&](std::vector<uint8_t>& y_plane, int x0, int y0,
+                         int x1, int y1) {
+    for (int y = y0; y < y1; y += kBlockSize) {
+      for (int x = x0; x < x1; x += kBlockSize) {
+        const uint8_t value = random.Rand(1) == 0 ? 16 : 235;
+        for (int row = y; row < std::min(y + kBlockSize, y1); ++row) {
+          std::fill_n(y_plane.begin() + row * width + x,
+                      std::min(kBlockSize, x1 - x), value);
+        }
+      }
+    }
+  };
+  std::vector<uint8_t> y_plane(width * height);
+  fill_blocks(y_plane, 0, 0, width, height);
+  const std::vector<uint8_t> uv_planes(
+      2 * ((width + 1) / 2) * ((height + 1) / 2), 128);
+
+  std::string path = TempFilename(OutputPath(), "local_changes");
+  FILE* file = fopen(path.c_str(), "wb");
+  RTC_CHECK(file) << "Cannot open " << path;
+  const int x0 = (width - kChangingArea.width) / 2;
+  const int y0 = (height - kChangingArea.height) / 2;
+  for (int i = 0; i < num_frames; ++i) {
+    fill_blocks(y_plane, x0, y0, x0 + kChangingArea.width,
+                y0 + kChangingArea.height);
+    fwrite(y_plane.data(), 1, y_plane.size(), file);
+    fwrite(uv_planes.data(), 1, uv_planes.size(), file);
+  }
+  fclose(file);
+  return path;
+}
+
+// Measures the bitrate and encode time savings of passing the update region
+// of screen content to the encoder, which lets it skip the unchanged blocks.
+class UpdateRegionTest
+    : public ::testing::TestWithParam<
+          std::tuple</*codec_type=*/std::string,
+                     /*detect_update_regions=*/bool>> {
+ public:
+  static std::string TestParamsToString(
+      const ::testing::TestParamInfo<UpdateRegionTest::ParamType>& info) {
+    auto [codec_type, detect_update_regions] = info.param;
+    return codec_type + (detect_update_regions ? "WithUpdateRegions"
+                                               : "WithoutUpdateRegions");
+  }
+};
+
+TEST_P(UpdateRegionTest, LocalChanges) {
+  auto [codec_type, detect_update_regions] = GetParam();
+  const Environment env = CreateEnvironment();
+  const Resolution resolution = {.width = 1280, .height = 720};
+  const Frequency framerate = Frequency::Hertz(30);
+  int num_frames = 300;
+
+  VideoSourceSettings source_settings = {
+      .file_path = CreateLocalChangesClip(resolution, num_frames),
+      .resolution = resolution,
+      .framerate = framerate,
+      .detect_update_regions = detect_update_regions};
+
+  EncodingSettings encoding_settings = VideoCodecTester::CreateEncodingSettings(
+      env, codec_type, /*scalability_mode=*/"L1T1", resolution.width,
+      resolution.height, {DataRate::KilobitsPerSec(512)}, framerate,
+      /*screencast=*/true);
+
+  std::map<uint32_t, EncodingSettings> frame_settings =
+      VideoCodecTester::CreateFrameSettings(encoding_settings, num_frames);
+
+  std::unique_ptr<VideoCodecStats> stats = RunEncodeDecodeTest(
+      env, "builtin", "builtin", source_settings, frame_settings);
+  RemoveFile(source_settings.file_path);
+
+  VideoCodecStats::Stream stream;
+  if (stats != nullptr) {
+    stream = stats->Aggregate(Filter{});
+  }
+
+  stream.LogMetrics(
+      GetGlobalMetricsLogger(),
+      ::testing::UnitTest::GetInstance()->current_test_info()->name(),
+      /*prefix=*/"",
+      /*metadata=*/
+      {{"codec_type", codec_type},
+       {"update_regions", detect_update_regions ? "true" : "false"}});
+}
 
-  VideoSourceSettings source_settings{
+INSTANTIATE_TEST_SUITE_P(All,
+                         UpdateRegionTest,
+                         Combine(Values("AV1", "VP9", "VP8"),
+                                 Values(false, true)),
+                         UpdateRegionTest::TestParamsToString);
+
+VideoSourceSettings SourceSettingsFromFlags() {
+  return VideoSourceSettings{
       .file_path = absl::GetFlag(FLAGS_input_path),
       .resolution = {.width = absl::GetFlag(FLAGS_input_width),
                      .height = absl::GetFlag(FLAGS_input_height)},
       .framerate =
           Frequency::Hertz<double>(absl::GetFlag(FLAGS_input_framerate_fps))};
+}
 
-  std::vector<std::string> bitrate_str = absl::GetFlag(FLAGS_bitrate_kbps);
-  std::vector<DataRate> bitrate;
-  std::transform(bitrate_str.begin(), bitrate_str.end(),
-                 std::back_inserter(bitrate), [](const std::string& str) {
-                   return DataRate::KilobitsPerSec(std::stoi(str));
-                 });
-
+std::map<uint32_t, EncodingSettings> FrameSettingsFromFlags(
+    const Environment& env,
+    std::vector<DataRate> bitrate) {
   Frequency framerate = Frequency::Hertz<double>(
       absl::GetFlag(FLAGS_framerate_fps)
           .value_or(absl::GetFlag(FLAGS_input_framerate_fps)));
@@ -618,6 +738,30 @@ TEST(VideoCodecTest, DISABLED_EncodeDecode) {
     timestamp_rtp += k90kHz / framerate;
   }
 
+  return frame_settings;
+}
+
+std::map<uint32_t, EncodingSettings> FrameSettingsFromFlags(
+    const Environment& env) {
+  std::vector<std::string> bitrate_str = absl::GetFlag(FLAGS_bitrate_kbps);
+  std::vector<DataRate> bitrate;
+  std::transform(bitrate_str.begin(), bitrate_str.end(),
+                 std::back_inserter(bitrate), [](const std::string& str) {
+                   return DataRate::KilobitsPerSec(std::stoi(str));
+                 });
+  return FrameSettingsFromFlags(env, bitrate);
+}
+
+TEST(VideoCodecTest, DISABLED_EncodeDecode) {
+  ScopedFieldTrials field_trials(absl::GetFlag(FLAGS_field_trials));
+  const Environment env =
+      CreateEnvironment(std::make_unique<ExplicitKeyValueConfig>(
+          absl::GetFlag(FLAGS_field_trials)));
+
+  VideoSourceSettings source_settings = SourceSettingsFromFlags();
+  std::map<uint32_t, EncodingSettings> frame_settings =
+      FrameSettingsFromFlags(env);
+
   std::unique_ptr<VideoCodecStats> stats;
   std::string decoder = absl::GetFlag(FLAGS_decoder);
   if (decoder == "null") {
@@ -664,6 +808,176 @@ TEST(VideoCodecTest, DISABLED_EncodeDecode) {
   }
 }
 
+// Appends `value` as a JSON string, with quotes, backslashes and control
+// characters escaped.
+void AppendJsonString(StringBuilder& json, absl::string_view value) {
+  std::string escaped;
+  for (char c : value) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+      escaped += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char code[7];
+      snprintf(code, sizeof(code), "\\u%04x", c);
+      escaped += code;
+    } else {
+      escaped += c;
+    }
+  }
+  json << "\"" << escaped << "\"";
+}
+
+// Appends the mean of `counter` as the member `name` of a JSON object, unless
+// `counter` has no samples.
+void AppendJsonMean(StringBuilder& json,
+                    absl::string_view name,
+                    const SamplesStatsCounter& counter) {
+  if (!counter.IsEmpty()) {
+    json << ",\"" << name << "\":" << counter.GetAverage();
+  }
+}
+
+// Encodes and decodes each of --batch_input_paths at each of
+// --batch_bitrates_kbps, e.g. for a regression sweep over many videos, with
+// --batch_num_workers sessions running at a time. The metrics of all sessions
+// are written to one JSON file in the test output directory. Use
+// --num_cores=1 to run one session per core.
+TEST(VideoCodecTest, DISABLED_EncodeDecodeBatch) {
+  ScopedFieldTrials field_trials(absl::GetFlag(FLAGS_field_trials));
+  const Environment env =
+      CreateEnvironment(std::make_unique<ExplicitKeyValueConfig>(
+          absl::GetFlag(FLAGS_field_trials)));
+
+  const std::string encoder_impl =
+      CodecNameToCodecImpl(absl::GetFlag(FLAGS_encoder));
+  const std::string decoder_impl =
+      CodecNameToCodecImpl(absl::GetFlag(FLAGS_decoder));
+  std::unique_ptr<VideoEncoderFactory> encoder_factory =
+      CreateEncoderFactory(encoder_impl);
+  std::unique_ptr<VideoDecoderFactory> decoder_factory =
+      CreateDecoderFactory(decoder_impl);
+  ASSERT_NE(encoder_factory, nullptr);
+  ASSERT_NE(decoder_factory, nullptr);
+
+  const std::vector<std::string> input_paths =
+      absl::GetFlag(FLAGS_batch_input_paths);
+  ASSERT_FALSE(input_paths.empty()) << "No --batch_input_paths";
+  ASSERT_FALSE(absl::GetFlag(FLAGS_batch_bitrates_kbps).empty())
+      << "No --batch_bitrates_kbps";
+  std::vector<int> bitrates_kbps;
+  for (const std::string& flag : absl::GetFlag(FLAGS_batch_bitrates_kbps)) {
+    std::optional<int> bitrate_kbps = StringToNumber<int>(flag);
+    ASSERT_TRUE(bitrate_kbps.has_value() && *bitrate_kbps > 0)
+        << "Invalid --batch_bitrates_kbps value " << flag;
+    bitrates_kbps.push_back(*bitrate_kbps);
+  }
+
+  std::vector<VideoCodecTester::EncodeDecodeJob> jobs;
+  // The target bitrate of each job, in kbps.
+  std::vector<int> job_bitrates_kbps;
+  for (const std::string& input_path : input_paths) {
+    for (int bitrate_kbps : bitrates_kbps) {
+      job_bitrates_kbps.push_back(bitrate_kbps);
+      VideoCodecTester::EncodeDecodeJob& job = jobs.emplace_back();
+      job.source_settings = SourceSettingsFromFlags();
+      job.source_settings.file_path = input_path;
+      job.encoder_settings.pacing_settings.mode =
+          encoder_impl == "builtin" ? PacingMode::kNoPacing
+                                    : PacingMode::kRealTime;
+      job.encoder_settings.number_of_cores = absl::GetFlag(FLAGS_num_cores);
+      job.decoder_settings.pacing_settings.mode =
+          decoder_impl == "builtin" ? PacingMode::kNoPacing
+                                    : PacingMode::kRealTime;
+      job.encoding_settings = FrameSettingsFromFlags(
+          env, {DataRate::KilobitsPerSec(bitrate_kbps)});
+    }
+  }
+
+  int64_t start_time_ns = TimeNanos();
+  std::vector<std::unique_ptr<VideoCodecStats>> stats =
+      VideoCodecTester::RunEncodeDecodeTests(
+          env, jobs, encoder_factory.get(), decoder_factory.get(),
+          absl::GetFlag(FLAGS_batch_num_workers));
+  double elapsed_s = (TimeNanos() - start_time_ns) / 1e9;
+
+  StringBuilder json;
+  json << "{\"elapsed_s\":" << elapsed_s << ",\"sessions\":[";
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    ASSERT_NE(stats[i], nullptr);
+    VideoCodecStats::Stream stream = stats[i]->Aggregate(Filter{});
+    json << (i > 0 ? "," : "") << "{\"input_path\":";
+    AppendJsonString(json, jobs[i].source_settings.file_path);
+    json << ",\"bitrate_kbps\":" << job_bitrates_kbps[i];
+    AppendJsonMean(json, "encoded_bitrate_kbps", stream.encoded_bitrate_kbps);
+    AppendJsonMean(json, "encoded_framerate_fps",
+                   stream.encoded_framerate_fps);
+    AppendJsonMean(json, "qp", stream.qp);
+    AppendJsonMean(json, "encode_time_ms", stream.encode_time_ms);
+    AppendJsonMean(json, "decode_time_ms", stream.decode_time_ms);
+    AppendJsonMean(json, "psnr_y_db", stream.psnr.y);
+    AppendJsonMean(json, "psnr_u_db", stream.psnr.u);
+    AppendJsonMean(json, "psnr_v_db", stream.psnr.v);
+    AppendJsonMean(json, "ssim", stream.ssim);
+    json << "}";
+  }
+  json << "]}";
+
+  std::string json_path = TestOutputPath() + ".json";
+  FILE* json_file = fopen(json_path.c_str(), "w");
+  ASSERT_NE(json_file, nullptr) << "Cannot create " << json_path;
+  fwrite(json.str().c_str(), 1, json.size(), json_file);
+  fclose(json_file);
+  RTC_LOG(LS_INFO) << "Ran " << jobs.size() << " sessions in " << elapsed_s
+                   << " s. Wrote metrics to " << json_path;
+}
+
+// Measures how fast the encoder given by the flags runs with --num_cores, e.g.
+// --encoder=libaom-av1 --screencast --num_cores=32, encoding back-to-back.
+TEST(VideoCodecTest, DISABLED_EncodeSpeed) {
+  ScopedFieldTrials field_trials(absl::GetFlag(FLAGS_field_trials));
+  const Environment env =
+      CreateEnvironment(std::make_unique<ExplicitKeyValueConfig>(
+          absl::GetFlag(FLAGS_field_trials)));
+
+  VideoSourceSettings source_settings = SourceSettingsFromFlags();
+  std::map<uint32_t, EncodingSettings> frame_settings =
+      FrameSettingsFromFlags(env);
+
+  int64_t start_time_ns = TimeNanos();
+  int64_t start_cpu_time_ns = GetProcessCpuTimeNanos();
+  std::unique_ptr<VideoCodecStats> stats =
+      RunEncodeTest(env, CodecNameToCodecImpl(absl::GetFlag(FLAGS_encoder)),
+                    source_settings, frame_settings);
+  ASSERT_NE(nullptr, stats);
+  double elapsed_s = (TimeNanos() - start_time_ns) / 1e9;
+  double cpu_time_s = (GetProcessCpuTimeNanos() - start_cpu_time_ns) / 1e9;
+
+  // Frames of all layers of a temporal unit count as one.
+  int num_frames = stats->Slice(Filter{}, /*merge=*/true).size();
+  VideoCodecStats::Stream stream = stats->Aggregate(Filter{});
+  std::map<std::string, std::string> metadata = {
+      {"num_cores", std::to_string(absl::GetFlag(FLAGS_num_cores))}};
+  MetricsLogger* logger = GetGlobalMetricsLogger();
+  logger->LogSingleValueMetric("encode_fps", TestName(),
+                               num_frames / elapsed_s, Unit::kHertz,
+                               ImprovementDirection::kBiggerIsBetter, metadata);
+  logger->LogSingleValueMetric("encode_time_p99_ms", TestName(),
+                               stream.encode_time_ms.GetPercentile(0.99),
+                               Unit::kMilliseconds,
+                               ImprovementDirection::kSmallerIsBetter,
+                               metadata);
+  // Average number of busy cores while encoding, in percent of one core.
+  logger->LogSingleValueMetric("cpu_usage_pct", TestName(),
+                               100 * cpu_time_s / elapsed_s, Unit::kPercent,
+                               ImprovementDirection::kSmallerIsBetter,
+                               metadata);
+  logger->LogSingleValueMetric("cpu_time_per_frame_ms", TestName(),
+                               1000 * cpu_time_s / num_frames,
+                               Unit::kMilliseconds,
+                               ImprovementDirection::kSmallerIsBetter,
+                               metadata);
+}
+
 }  // namespace test
 
 }  // namespace webrtc
@@ -362,6 +362,7 @@ int LibvpxVp8Encoder::Release() {
   int ret_val = WEBRTC_VIDEO_CODEC_OK;
 
   encoded_images_.clear();
+  encoded_image_buffer_pool_.Release();
 
   if (inited_) {
     for (auto it = encoders_.rbegin(); it != encoders_.rend(); ++it) {
@@ -383,7 +384,10 @@ int LibvpxVp8Encoder::Release() {
   raw_images_.clear();
 
   frame_buffer_controller_.reset();
+  active_map_tracker_.Reset();
+  active_map_set_ = false;
   inited_ = false;
+  core_reservation_ = EncoderCoreBudget::Reservation();
   return ret_val;
 }
 
@@ -681,16 +685,18 @@ int LibvpxVp8Encoder::InitEncode(const VideoCodec* inst,
   vpx_configs_[0].g_w = inst->width;
   vpx_configs_[0].g_h = inst->height;
 
-  // Determine number of threads based on the image size and #cores.
+  // Determine number of threads based on the image size and #cores, limited
+  // to the cores not taken by other encoders.
   // TODO(fbarchard): Consider number of Simulcast layers.
-  vpx_configs_[0].g_threads = NumberOfThreads(
-      vpx_configs_[0].g_w, vpx_configs_[0].g_h, settings.number_of_cores);
+  int num_threads = NumberOfThreads(vpx_configs_[0].g_w, vpx_configs_[0].g_h,
+                                    settings.number_of_cores);
   if (settings.encoder_thread_limit.has_value()) {
     RTC_DCHECK_GE(settings.encoder_thread_limit.value(), 1);
-    vpx_configs_[0].g_threads = std::min(
-        vpx_configs_[0].g_threads,
-        static_cast<unsigned int>(settings.encoder_thread_limit.value()));
+    num_threads = std::min(num_threads, settings.encoder_thread_limit.value());
   }
+  core_reservation_ = EncoderCoreBudget::Reservation();
+  core_reservation_ = EncoderCoreBudget::ProcessWide().Reserve(num_threads);
+  vpx_configs_[0].g_threads = core_reservation_.num_cores();
 
   // Creating a wrapper to the image - setting image data to NULL.
   // Actual pointer will be set in encode. Setting align to 1, as it
@@ -1023,6 +1029,8 @@ int LibvpxVp8Encoder::Encode(const VideoFrame& frame,
   if (encoded_complete_callback_ == NULL)
     return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
 
+  active_map_tracker_.OnInputFrame(frame);
+
   bool key_frame_requested = false;
   for (size_t i = 0; i < key_frame_request_.size() && i < send_stream_.size();
        ++i) {
@@ -1130,6 +1138,32 @@ int LibvpxVp8Encoder::Encode(const VideoFrame& frame,
     std::fill(key_frame_request_.begin(), key_frame_request_.end(), false);
   }
 
+  // Skip the macroblocks that did not change since the last encoded frame.
+  // Inactive macroblocks are copied from the last frame buffer, so this needs
+  // a single stream where every frame predicts from the previous one.
+  const bool use_active_map =
+      encoders_.size() == 1 && codec_.VP8()->numberOfTemporalLayers <= 1 &&
+      !send_key_frame && active_map_tracker_.ComputeActiveMap() &&
+      active_map_tracker_.MatchesFrameSize(vpx_configs_[0].g_w,
+                                           vpx_configs_[0].g_h);
+  if (use_active_map || active_map_set_) {
+    vpx_active_map_t active_map;
+    active_map.active_map =
+        use_active_map ? active_map_tracker_.active_map() : nullptr;
+    if (use_active_map) {
+      active_map.rows = active_map_tracker_.rows();
+      active_map.cols = active_map_tracker_.cols();
+    } else {
+      // Clearing the map also takes the size of the encoded frames.
+      active_map.rows = ActiveMapTracker::NumMacroblocks(vpx_configs_[0].g_h);
+      active_map.cols = ActiveMapTracker::NumMacroblocks(vpx_configs_[0].g_w);
+    }
+    if (libvpx_->codec_control(&encoders_[0], VP8E_SET_ACTIVEMAP,
+                               &active_map) == VPX_CODEC_OK) {
+      active_map_set_ = use_active_map;
+    }
+  }
+
   // Set the encoder frame flags and temporal layer_id for each spatial stream.
   // Note that streams are defined starting from lowest resolution at
   // position 0 to highest resolution at position |encoders_.size() - 1|,
@@ -1179,6 +1213,9 @@ int LibvpxVp8Encoder::Encode(const VideoFrame& frame,
     // Examines frame timestamps only.
     error = GetEncodedPartitions(frame, retransmission_allowed);
   }
+  if (encoded_images_[0].size() > 0) {
+    active_map_tracker_.OnFrameEncoded();
+  }
   // TODO(sprang): Shouldn't we use the frame timestamp instead?
   timestamp_ += duration;
   return error;
@@ -1250,7 +1287,7 @@ int LibvpxVp8Encoder::GetEncodedPartitions(const VideoFrame& input_image,
       }
     }
 
-    auto buffer = EncodedImageBuffer::Create(encoded_size);
+    auto buffer = encoded_image_buffer_pool_.CreateBuffer(encoded_size);
 
     iter = NULL;
     size_t encoded_pos = 0;
@@ -1507,8 +1544,13 @@ std::vector<scoped_refptr<VideoFrameBuffer>> LibvpxVp8Encoder::PrepareBuffers(
             ? buffer.get()
             : prepared_buffers.back().get();
 
-    auto scaled_buffer =
-        buffer_to_scale->Scale(raw_images_[i].d_w, raw_images_[i].d_h);
+    // Use the resolution if the producer of `buffer` has already built it.
+    scoped_refptr<VideoFrameBuffer> scaled_buffer =
+        buffer->GetPrescaledBuffer(raw_images_[i].d_w, raw_images_[i].d_h);
+    if (!scaled_buffer) {
+      scaled_buffer =
+          buffer_to_scale->Scale(raw_images_[i].d_w, raw_images_[i].d_h);
+    }
     if (scaled_buffer->type() == VideoFrameBuffer::Type::kNative) {
       auto mapped_scaled_buffer =
           scaled_buffer->GetMappedFrameBuffer(mapped_type);
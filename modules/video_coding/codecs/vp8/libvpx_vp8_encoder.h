@@ -30,10 +30,13 @@
 #include "api/video_codecs/video_encoder.h"
 #include "api/video_codecs/vp8_frame_buffer_controller.h"
 #include "api/video_codecs/vp8_frame_config.h"
+#include "common_video/include/encoded_image_buffer_pool.h"
 #include "modules/video_coding/codecs/interface/libvpx_interface.h"
 #include "modules/video_coding/codecs/vp8/include/vp8.h"
 #include "modules/video_coding/include/video_codec_interface.h"
+#include "modules/video_coding/utility/active_map_tracker.h"
 #include "modules/video_coding/utility/corruption_detection_settings_generator.h"
+#include "modules/video_coding/utility/encoder_threading_policy.h"
 #include "modules/video_coding/utility/framerate_controller_deprecated.h"
 #include "rtc_base/experiments/encoder_info_settings.h"
 #include "rtc_base/experiments/rate_control_settings.h"
@@ -126,6 +129,7 @@ class LibvpxVp8Encoder : public VideoEncoder {
   int qp_max_ = 56;
   int cpu_speed_default_ = -6;
   int number_of_cores_ = 0;
+  EncoderCoreBudget::Reservation core_reservation_;
   uint32_t rc_max_intra_target_ = 0;
   int num_active_streams_ = 0;
   std::unique_ptr<Vp8FrameBufferController> frame_buffer_controller_;
@@ -136,6 +140,8 @@ class LibvpxVp8Encoder : public VideoEncoder {
   std::vector<int> cpu_speed_;
   std::vector<vpx_image_t> raw_images_;
   std::vector<EncodedImage> encoded_images_;
+  // Output buffers, shared by all simulcast streams.
+  EncodedImageBufferPool encoded_image_buffer_pool_;
   std::vector<vpx_codec_ctx_t> encoders_;
   std::vector<vpx_codec_enc_cfg_t> vpx_configs_;
   std::vector<Vp8EncoderConfig> config_overrides_;
@@ -145,6 +151,9 @@ class LibvpxVp8Encoder : public VideoEncoder {
   FramerateControllerDeprecated framerate_controller_;
   int num_steady_state_frames_ = 0;
 
+  ActiveMapTracker active_map_tracker_;
+  bool active_map_set_ = false;
+
   FecControllerOverride* fec_controller_override_ = nullptr;
 
   const LibvpxVp8EncoderInfoSettings encoder_info_override_;
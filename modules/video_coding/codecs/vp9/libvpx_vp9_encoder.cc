@@ -59,6 +59,7 @@
 #include "modules/video_coding/svc/scalable_video_controller_no_layering.h"
 #include "modules/video_coding/svc/simulcast_to_svc_converter.h"
 #include "modules/video_coding/svc/svc_rate_allocator.h"
+#include "modules/video_coding/utility/encoder_threading_policy.h"
 #include "modules/video_coding/utility/framerate_controller_deprecated.h"
 #include "modules/video_coding/utility/simulcast_rate_allocator.h"
 #include "rtc_base/checks.h"
@@ -323,7 +324,11 @@ int LibvpxVp9Encoder::Release() {
     libvpx_->img_free(raw_);
     raw_ = nullptr;
   }
+  encoded_image_buffer_pool_.Release();
+  active_map_tracker_.Reset();
+  active_map_set_ = false;
   inited_ = false;
+  core_reservation_ = EncoderCoreBudget::Reservation();
   return ret_val;
 }
 
@@ -697,9 +702,13 @@ int LibvpxVp9Encoder::InitEncode(const VideoCodec* inst,
   } else {
     config_->rc_resize_allowed = codec_.VP9()->automaticResizeOn ? 1 : 0;
   }
-  // Determine number of threads based on the image size and #cores.
-  config_->g_threads =
-      NumberOfThreads(config_->g_w, config_->g_h, settings.number_of_cores);
+  // Determine number of threads and tiles based on the image size, the content
+  // type and the cores not taken by other encoders.
+  threading_ = ReserveEncoderThreading(kVideoCodecVP9, config_->g_w,
+                                       config_->g_h, codec_.mode,
+                                       settings.number_of_cores,
+                                       &core_reservation_);
+  config_->g_threads = threading_.num_threads;
 
   is_flexible_mode_ = codec_.VP9()->flexibleMode;
 
@@ -754,27 +763,6 @@ int LibvpxVp9Encoder::InitEncode(const VideoCodec* inst,
   return InitAndSetControlSettings();
 }
 
-int LibvpxVp9Encoder::NumberOfThreads(int width,
-                                      int height,
-                                      int number_of_cores) {
-  // Keep the number of encoder threads equal to the possible number of column
-  // tiles, which is (1, 2, 4, 8). See comments below for VP9E_SET_TILE_COLUMNS.
-  if (width * height >= 1280 * 720 && number_of_cores > 4) {
-    return 4;
-  } else if (width * height >= 640 * 360 && number_of_cores > 2) {
-    return 2;
-  } else {
-// Use 2 threads for low res on mobile ARM.
-#ifdef MOBILE_ARM
-    if (width * height >= 320 * 180 && number_of_cores > 2) {
-      return 2;
-    }
-#endif
-    // 1 thread less than VGA.
-    return 1;
-  }
-}
-
 int LibvpxVp9Encoder::InitAndSetControlSettings() {
   // Set QP-min/max per spatial and temporal layer.
   int tot_num_layers = num_spatial_layers_ * num_temporal_layers_;
@@ -944,7 +932,7 @@ int LibvpxVp9Encoder::InitAndSetControlSettings() {
   // The number tile columns will be capped by the encoder based on image size
   // (minimum width of tile column is 256 pixels, maximum is 4096).
   libvpx_->codec_control(encoder_, VP9E_SET_TILE_COLUMNS,
-                         static_cast<int>((config_->g_threads >> 1)));
+                         threading_.log2_tile_columns);
 
   // Turn on row-based multithreading.
   libvpx_->codec_control(encoder_, VP9E_SET_ROW_MT, 1);
@@ -992,6 +980,7 @@ int LibvpxVp9Encoder::Encode(const VideoFrame& input_image,
   if (encoded_complete_callback_ == nullptr) {
     return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
   }
+  active_map_tracker_.OnInputFrame(input_image);
   if (num_active_spatial_layers_ == 0) {
     // All spatial layers are disabled, return without encoding anything.
     return WEBRTC_VIDEO_CODEC_OK;
@@ -1271,6 +1260,32 @@ int LibvpxVp9Encoder::Encode(const VideoFrame& input_image,
                          .GetTargetRate())
           : codec_.maxFramerate;
   uint32_t duration = static_cast<uint32_t>(90000 / target_framerate_fps);
+
+  // Skip the macroblocks that did not change since the last encoded frame.
+  // Inactive macroblocks are copied from the previous frame, so this needs a
+  // single layer where every frame predicts from the previous one.
+  const bool use_active_map =
+      num_spatial_layers_ == 1 && num_temporal_layers_ == 1 &&
+      !force_key_frame_ && active_map_tracker_.ComputeActiveMap() &&
+      active_map_tracker_.MatchesFrameSize(config_->g_w, config_->g_h);
+  if (use_active_map || active_map_set_) {
+    vpx_active_map_t active_map;
+    active_map.active_map =
+        use_active_map ? active_map_tracker_.active_map() : nullptr;
+    if (use_active_map) {
+      active_map.rows = active_map_tracker_.rows();
+      active_map.cols = active_map_tracker_.cols();
+    } else {
+      // Clearing the map also takes the size of the encoded frames.
+      active_map.rows = ActiveMapTracker::NumMacroblocks(config_->g_h);
+      active_map.cols = ActiveMapTracker::NumMacroblocks(config_->g_w);
+    }
+    if (libvpx_->codec_control(encoder_, VP8E_SET_ACTIVEMAP, &active_map) ==
+        VPX_CODEC_OK) {
+      active_map_set_ = use_active_map;
+    }
+  }
+
   const vpx_codec_err_t rv = libvpx_->codec_encode(
       encoder_, raw_, timestamp_, duration, flags, VPX_DL_REALTIME);
   if (rv != VPX_CODEC_OK) {
@@ -1729,7 +1744,7 @@ void LibvpxVp9Encoder::GetEncodedLayerFrame(const vpx_codec_cx_pkt* pkt) {
   vpx_svc_layer_id_t layer_id = {0};
   libvpx_->codec_control(encoder_, VP9E_GET_SVC_LAYER_ID, &layer_id);
 
-  encoded_image_.SetEncodedData(EncodedImageBuffer::Create(
+  encoded_image_.SetEncodedData(encoded_image_buffer_pool_.CreateBuffer(
       static_cast<const uint8_t*>(pkt->data.frame.buf), pkt->data.frame.sz));
 
   codec_specific_ = {};
@@ -1759,6 +1774,7 @@ void LibvpxVp9Encoder::GetEncodedLayerFrame(const vpx_codec_cx_pkt* pkt) {
   }
 
   UpdateReferenceBuffers(*pkt, pics_since_key_);
+  active_map_tracker_.OnFrameEncoded();
 
   TRACE_COUNTER1("webrtc", "EncodedFrameSize", encoded_image_.size());
   encoded_image_.SetRtpTimestamp(input_image_->rtp_timestamp());
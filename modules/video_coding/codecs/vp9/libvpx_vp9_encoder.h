@@ -34,12 +34,15 @@
 #include "api/video_codecs/video_codec.h"
 #include "api/video_codecs/video_encoder.h"
 #include "api/video_codecs/vp9_profile.h"
+#include "common_video/include/encoded_image_buffer_pool.h"
 #include "modules/video_coding/codecs/interface/libvpx_interface.h"
 #include "modules/video_coding/codecs/vp9/include/vp9.h"
 #include "modules/video_coding/codecs/vp9/include/vp9_globals.h"
 #include "modules/video_coding/include/video_codec_interface.h"
 #include "modules/video_coding/svc/scalable_video_controller.h"
 #include "modules/video_coding/svc/simulcast_to_svc_converter.h"
+#include "modules/video_coding/utility/active_map_tracker.h"
+#include "modules/video_coding/utility/encoder_threading_policy.h"
 #include "modules/video_coding/utility/framerate_controller_deprecated.h"
 #include "rtc_base/containers/flat_map.h"
 #include "rtc_base/experiments/encoder_info_settings.h"
@@ -76,9 +79,6 @@ class LibvpxVp9Encoder : public VideoEncoder {
   EncoderInfo GetEncoderInfo() const override;
 
  private:
-  // Determine number of encoder threads to use.
-  int NumberOfThreads(int width, int height, int number_of_cores);
-
   // Call encoder initialize function and set control settings.
   int InitAndSetControlSettings();
 
@@ -140,11 +140,14 @@ class LibvpxVp9Encoder : public VideoEncoder {
   const Environment env_;
   const std::unique_ptr<LibvpxInterface> libvpx_;
   EncodedImage encoded_image_;
+  EncodedImageBufferPool encoded_image_buffer_pool_;
   CodecSpecificInfo codec_specific_;
   EncodedImageCallback* encoded_complete_callback_;
   VideoCodec codec_;
   const VP9Profile profile_;
   bool inited_;
+  EncoderCoreBudget::Reservation core_reservation_;
+  EncoderThreadingSettings threading_;
   int64_t timestamp_;
   uint32_t rc_max_intra_target_;
   vpx_codec_ctx_t* encoder_;
@@ -195,6 +198,9 @@ class LibvpxVp9Encoder : public VideoEncoder {
 
   FramerateControllerDeprecated variable_framerate_controller_;
 
+  ActiveMapTracker active_map_tracker_;
+  bool active_map_set_ = false;
+
   // Original scaling factors for all configured layers active and inactive.
   // `svc_config_` stores factors ignoring top inactive layers.
   std::vector<int> scaling_factors_num_, scaling_factors_den_;
@@ -42,6 +42,8 @@
 namespace webrtc {
 namespace {
 
+constexpr uint8_t kStartCode[] = {0, 0, 0, 1};
+
 int64_t EuclideanMod(int64_t n, int64_t div) {
   RTC_DCHECK_GT(div, 0);
   return (n %= div) < 0 ? n + div : n;
@@ -287,6 +289,8 @@ bool H26xPacketBuffer::MaybeAssembleFrame(int64_t start_seq_num_unwrapped,
     height = std::max<int>(packet->video_header.height, height);
   }
 
+  payload_views_.clear();
+  const size_t first_packet_index = result.packets.size();
   for (int64_t seq_num = start_seq_num_unwrapped;
        seq_num <= end_sequence_number_unwrapped; ++seq_num) {
     auto& packet = GetPacket(seq_num);
@@ -310,17 +314,36 @@ bool H26xPacketBuffer::MaybeAssembleFrame(int64_t start_seq_num_unwrapped,
     // Only applies to H.264 because start code is inserted by depacktizer for
     // H.265 and out-of-band parameter sets is not supported by H.265.
     if (packet->codec() == kVideoCodecH264) {
-      if (!FixH264Packet(*packet)) {
+      if (!FixH264Packet(*packet, payload_views_)) {
         // The buffer is not cleared actually, but a key frame request is
         // needed.
         result.buffer_cleared = true;
         return false;
       }
+    } else {
+      payload_views_.emplace_back(packet->video_payload.cdata(),
+                                  packet->video_payload.size());
     }
 
     result.packets.push_back(std::move(packet));
   }
 
+  // The views point into the payloads of the packets, which are owned by
+  // `result` now, and into the stored parameter sets.
+  size_t frame_size = 0;
+  for (ArrayView<const uint8_t> view : payload_views_) {
+    frame_size += view.size();
+  }
+  Packet& last_packet = *result.packets.back();
+  last_packet.assembled_payload.emplace(/*size=*/0, /*capacity=*/frame_size);
+  for (ArrayView<const uint8_t> view : payload_views_) {
+    last_packet.assembled_payload->AppendData(view.data(), view.size());
+  }
+  payload_views_.clear();
+  for (size_t i = first_packet_index; i < result.packets.size(); ++i) {
+    result.packets[i]->video_payload.Clear();
+  }
+
   return true;
 }
 
@@ -401,15 +424,13 @@ void H26xPacketBuffer::InsertSpsPpsNalus(const std::vector<uint8_t>& sps,
 
 // TODO(bugs.webrtc.org/13157): Update the H264 depacketizer so we don't have to
 //                              fiddle with the payload at this point.
-bool H26xPacketBuffer::FixH264Packet(Packet& packet) {
-  constexpr uint8_t kStartCode[] = {0, 0, 0, 1};
-
+bool H26xPacketBuffer::FixH264Packet(
+    Packet& packet,
+    std::vector<ArrayView<const uint8_t>>& payload_views) {
   RTPVideoHeader& video_header = packet.video_header;
   RTPVideoHeaderH264& h264_header =
       std::get<RTPVideoHeaderH264>(video_header.video_type_header);
 
-  CopyOnWriteBuffer result;
-
   if (h264_idr_only_keyframes_allowed_) {
     // Check if sps and pps insertion is needed.
     bool prepend_sps_pps = false;
@@ -480,12 +501,12 @@ bool H26xPacketBuffer::FixH264Packet(Packet& packet) {
     // Insert SPS and PPS if they are missing.
     if (prepend_sps_pps) {
       // Insert SPS.
-      result.AppendData(kStartCode);
-      result.AppendData(sps->second.payload.get(), sps->second.size);
+      payload_views.emplace_back(kStartCode);
+      payload_views.emplace_back(sps->second.payload.get(), sps->second.size);
 
       // Insert PPS.
-      result.AppendData(kStartCode);
-      result.AppendData(pps->second.payload.get(), pps->second.size);
+      payload_views.emplace_back(kStartCode);
+      payload_views.emplace_back(pps->second.payload.get(), pps->second.size);
 
       // Update codec header to reflect the newly added SPS and PPS.
       h264_header.nalus.push_back(
@@ -497,11 +518,12 @@ bool H26xPacketBuffer::FixH264Packet(Packet& packet) {
   }
 
   // Insert start code.
+  ArrayView<const uint8_t> payload(packet.video_payload.cdata(),
+                                   packet.video_payload.size());
   switch (h264_header.packetization_type) {
     case kH264StapA: {
-      const uint8_t* payload_end =
-          packet.video_payload.data() + packet.video_payload.size();
-      const uint8_t* nalu_ptr = packet.video_payload.data() + 1;
+      const uint8_t* payload_end = payload.data() + payload.size();
+      const uint8_t* nalu_ptr = payload.data() + 1;
       while (nalu_ptr < payload_end - 1) {
         // The first two bytes describe the length of the segment, where a
         // segment is the nalu type plus nalu payload.
@@ -509,28 +531,25 @@ bool H26xPacketBuffer::FixH264Packet(Packet& packet) {
         nalu_ptr += 2;
 
         if (nalu_ptr + segment_length <= payload_end) {
-          result.AppendData(kStartCode);
-          result.AppendData(nalu_ptr, segment_length);
+          payload_views.emplace_back(kStartCode);
+          payload_views.emplace_back(nalu_ptr, segment_length);
         }
         nalu_ptr += segment_length;
       }
-      packet.video_payload = result;
       return true;
     }
 
     case kH264FuA: {
       if (IsFirstPacketOfFragment(h264_header)) {
-        result.AppendData(kStartCode);
+        payload_views.emplace_back(kStartCode);
       }
-      result.AppendData(packet.video_payload);
-      packet.video_payload = result;
+      payload_views.push_back(payload);
       return true;
     }
 
     case kH264SingleNalu: {
-      result.AppendData(kStartCode);
-      result.AppendData(packet.video_payload);
-      packet.video_payload = result;
+      payload_views.emplace_back(kStartCode);
+      payload_views.push_back(payload);
       return true;
     }
   }
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "absl/base/attributes.h"
+#include "api/array_view.h"
 #include "modules/video_coding/packet_buffer.h"
 
 namespace webrtc {
@@ -85,10 +86,11 @@ class H26xPacketBuffer {
   // received without SPS/PPS.
   void InsertSpsPpsNalus(const std::vector<uint8_t>& sps,
                          const std::vector<uint8_t>& pps);
-  // Insert start code and paramter sets for H.264 payload, also update header
-  // if parameter sets are inserted. Return false if required SPS or PPS is not
-  // found.
-  bool FixH264Packet(Packet& packet);
+  // Appends views of the H.264 payload with start codes and parameter sets
+  // inserted to `payload_views`, also update header if parameter sets are
+  // inserted. Return false if required SPS or PPS is not found.
+  bool FixH264Packet(Packet& packet,
+                     std::vector<ArrayView<const uint8_t>>& payload_views);
 
   // Indicates whether IDR frames without SPS and PPS are allowed.
   const bool h264_idr_only_keyframes_allowed_;
@@ -102,6 +104,11 @@ class H26xPacketBuffer {
   // Map from sps_video_parameter_set_id to the SPS payload associated with this
   // ID.
   std::map<int, SpsInfo> sps_data_;
+
+  // Views of the bitstream of the frame being assembled, in decoding order.
+  // The frame is copied once from these views into the `assembled_payload` of
+  // its last packet. Kept as a member to reuse the allocation across frames.
+  std::vector<ArrayView<const uint8_t>> payload_views_;
 };
 
 }  // namespace webrtc
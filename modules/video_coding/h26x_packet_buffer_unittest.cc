@@ -378,9 +378,14 @@ H265Packet& H265Packet::SeqNum(int64_t rtp_seq_num) {
 }
 #endif
 
-ArrayView<const uint8_t> PacketPayload(
-    const std::unique_ptr<H26xPacketBuffer::Packet>& packet) {
-  return packet->video_payload;
+// Returns the bitstream of the frame that ends with the last of `packets`.
+ArrayView<const uint8_t> FrameBitstream(
+    const std::vector<std::unique_ptr<H26xPacketBuffer::Packet>>& packets) {
+  const H26xPacketBuffer::Packet& last_packet = *packets.back();
+  if (!last_packet.assembled_payload) {
+    return {};
+  }
+  return *last_packet.assembled_payload;
 }
 
 std::vector<uint8_t> FlatVector(
@@ -404,7 +409,7 @@ TEST(H26xPacketBufferTest, IdrOnlyKeyframeWithSprop) {
                                        .Build())
                      .packets;
   EXPECT_THAT(packets, SizeIs(1));
-  EXPECT_THAT(PacketPayload(packets[0]),
+  EXPECT_THAT(FrameBitstream(packets),
               ElementsAreArray(FlatVector({StartCode(),
                                            kExampleSpropRawSps,
                                            StartCode(),
@@ -490,7 +495,7 @@ TEST(H26xPacketBufferTest, IdrOnlyKeyframeInTheMiddle) {
                                        .Build())
                      .packets;
   EXPECT_THAT(packets, SizeIs(1));
-  EXPECT_THAT(PacketPayload(packets[0]),
+  EXPECT_THAT(FrameBitstream(packets),
               ElementsAreArray(FlatVector({StartCode(),
                                            kExampleSpropRawSps,
                                            StartCode(),
@@ -606,12 +611,13 @@ TEST(H26xPacketBufferTest, SpsPpsIdrIsKeyframeIgnoresSprop) {
                                        .Build())
                      .packets;
   EXPECT_THAT(packets, SizeIs(3));
-  EXPECT_THAT(PacketPayload(packets[0]),
-              ElementsAreArray(FlatVector({StartCode(), {kSps, 1, 2, 3}})));
-  EXPECT_THAT(PacketPayload(packets[1]),
-              ElementsAreArray(FlatVector({StartCode(), {kPps, 4, 5, 6}})));
-  EXPECT_THAT(PacketPayload(packets[2]),
-              ElementsAreArray(FlatVector({StartCode(), {kIdr, 7, 8, 9}})));
+  EXPECT_THAT(FrameBitstream(packets),
+              ElementsAreArray(FlatVector({StartCode(),
+                                           {kSps, 1, 2, 3},
+                                           StartCode(),
+                                           {kPps, 4, 5, 6},
+                                           StartCode(),
+                                           {kIdr, 7, 8, 9}})));
 }
 
 TEST(H26xPacketBufferTest, PpsIdrIsNotKeyframeSingleNalus) {
@@ -1068,7 +1074,7 @@ TEST(H26xPacketBufferTest, StapAFixedBitstream) {
                      .packets;
 
   ASSERT_THAT(packets, SizeIs(1));
-  EXPECT_THAT(PacketPayload(packets[0]),
+  EXPECT_THAT(FrameBitstream(packets),
               ElementsAreArray(FlatVector({StartCode(),
                                            {kSps, 1, 2, 3},
                                            StartCode(),
@@ -1103,12 +1109,13 @@ TEST(H26xPacketBufferTest, SingleNaluFixedBitstream) {
                      .packets;
 
   ASSERT_THAT(packets, SizeIs(3));
-  EXPECT_THAT(PacketPayload(packets[0]),
-              ElementsAreArray(FlatVector({StartCode(), {kSps, 1, 2, 3}})));
-  EXPECT_THAT(PacketPayload(packets[1]),
-              ElementsAreArray(FlatVector({StartCode(), {kPps, 4, 5, 6}})));
-  EXPECT_THAT(PacketPayload(packets[2]),
-              ElementsAreArray(FlatVector({StartCode(), {kIdr, 7, 8, 9}})));
+  EXPECT_THAT(FrameBitstream(packets),
+              ElementsAreArray(FlatVector({StartCode(),
+                                           {kSps, 1, 2, 3},
+                                           StartCode(),
+                                           {kPps, 4, 5, 6},
+                                           StartCode(),
+                                           {kIdr, 7, 8, 9}})));
 }
 
 TEST(H26xPacketBufferTest, StapaAndFuaFixedBitstream) {
@@ -1138,15 +1145,45 @@ TEST(H26xPacketBufferTest, StapaAndFuaFixedBitstream) {
                      .packets;
 
   ASSERT_THAT(packets, SizeIs(3));
-  EXPECT_THAT(
-      PacketPayload(packets[0]),
-      ElementsAreArray(FlatVector(
-          {StartCode(), {kSps, 1, 2, 3}, StartCode(), {kPps, 4, 5, 6}})));
-  EXPECT_THAT(PacketPayload(packets[1]),
-              ElementsAreArray(FlatVector({StartCode(), {8, 8, 8}})));
   // Third is a continuation of second, so only the payload is expected.
-  EXPECT_THAT(PacketPayload(packets[2]),
-              ElementsAreArray(FlatVector({{9, 9, 9}})));
+  EXPECT_THAT(FrameBitstream(packets),
+              ElementsAreArray(FlatVector({StartCode(),
+                                           {kSps, 1, 2, 3},
+                                           StartCode(),
+                                           {kPps, 4, 5, 6},
+                                           StartCode(),
+                                           {8, 8, 8},
+                                           {9, 9, 9}})));
+}
+
+TEST(H26xPacketBufferTest, AssemblesFrameIntoLastPacket) {
+  H26xPacketBuffer packet_buffer(/*h264_allow_idr_only_keyframes=*/false);
+
+  RTC_UNUSED(packet_buffer.InsertPacket(H264Packet(kH264StapA)
+                                            .Sps({1, 2, 3})
+                                            .Pps({4, 5, 6})
+                                            .SeqNum(0)
+                                            .Time(0)
+                                            .AsFirstPacket()
+                                            .Build()));
+  auto packets = packet_buffer
+                     .InsertPacket(H264Packet(kH264SingleNalu)
+                                       .Idr({7, 8, 9})
+                                       .SeqNum(1)
+                                       .Time(0)
+                                       .Marker()
+                                       .Build())
+                     .packets;
+
+  ASSERT_THAT(packets, SizeIs(2));
+  EXPECT_FALSE(packets[0]->assembled_payload);
+  ASSERT_TRUE(packets[1]->assembled_payload);
+  // The frame is copied once, with a buffer of exactly the frame size.
+  EXPECT_EQ(packets[1]->assembled_payload->capacity(),
+            packets[1]->assembled_payload->size());
+  for (const auto& packet : packets) {
+    EXPECT_EQ(packet->video_payload.size(), 0u);
+  }
 }
 
 TEST(H26xPacketBufferTest, FullPacketBufferDoesNotBlockKeyframe) {
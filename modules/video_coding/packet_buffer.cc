@@ -13,6 +13,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -25,7 +26,9 @@
 #include "modules/rtp_rtcp/source/rtp_packet_received.h"
 #include "modules/rtp_rtcp/source/rtp_video_header.h"
 #include "modules/video_coding/codecs/h264/include/h264_globals.h"
+#include "rtc_base/buffer.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/mod_ops.h"
 #include "rtc_base/numerics/sequence_number_util.h"
@@ -253,7 +256,10 @@ std::vector<std::unique_ptr<PacketBuffer::Packet>> PacketBuffer::FindFrames(
     }
 
     size_t index = seq_num % buffer_.size();
-    buffer_[index]->continuous = true;
+    if (!buffer_[index]->continuous) {
+      buffer_[index]->continuous = true;
+      AppendToAssembledPayload(index);
+    }
 
     // If all packets of the frame is continuous, find the first packet of the
     // frame and add all packets of the frame to the returned packets.
@@ -436,5 +442,41 @@ void PacketBuffer::UpdateMissingPackets(uint16_t seq_num) {
   }
 }
 
+void PacketBuffer::AppendToAssembledPayload(size_t index) {
+  Packet& packet = *buffer_[index];
+  if (packet.is_first_packet_in_frame()) {
+    // Without the generic frame descriptor H.264 frame boundaries are found by
+    // the RTP timestamp instead, so the first packet may not start the frame.
+    if (!packet.assemble_in_place ||
+        (packet.codec() == kVideoCodecH264 && !packet.video_header.generic)) {
+      return;
+    }
+    // A single packet frame is reserved exactly, otherwise guess from the
+    // previous frame and let the buffer grow if this one is larger.
+    size_t capacity = packet.video_payload.size();
+    if (!packet.is_last_packet_in_frame()) {
+      capacity = std::max(capacity, assembled_frame_size_hint_);
+    }
+    packet.assembled_payload.emplace(/*size=*/0, capacity);
+  } else {
+    // Since the packet is continuous, the previous packet is part of the same
+    // frame and is continuous too.
+    Packet& prev_packet = *buffer_[index > 0 ? index - 1 : buffer_.size() - 1];
+    if (!prev_packet.assembled_payload) {
+      return;
+    }
+    packet.assembled_payload = std::move(prev_packet.assembled_payload);
+    prev_packet.assembled_payload.reset();
+  }
+
+  packet.assembled_payload->AppendData(packet.video_payload.cdata(),
+                                       packet.video_payload.size());
+  // Release the received RTP packet as early as possible.
+  packet.video_payload = CopyOnWriteBuffer();
+  if (packet.is_last_packet_in_frame()) {
+    assembled_frame_size_hint_ = packet.assembled_payload->size();
+  }
+}
+
 }  // namespace video_coding
 }  // namespace webrtc
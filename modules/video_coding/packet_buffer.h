@@ -22,6 +22,7 @@
 #include "api/video/video_codec_type.h"
 #include "modules/rtp_rtcp/source/rtp_packet_received.h"
 #include "modules/rtp_rtcp/source/rtp_video_header.h"
+#include "rtc_base/buffer.h"
 #include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/numerics/sequence_number_util.h"
 
@@ -61,8 +62,17 @@ class PacketBuffer {
     int64_t sequence_number = 0;
     uint32_t timestamp = 0;
     int times_nacked = -1;
+    // If set on the first packet of a frame, the payloads of the frame are
+    // copied into `assembled_payload` as the packets become continuous, so
+    // that the frame needs no concatenation once it is complete. Only valid
+    // for depacketizers that assemble frames by concatenating the payloads.
+    bool assemble_in_place = false;
 
     CopyOnWriteBuffer video_payload;
+    // The payloads of the frame assembled so far, held by the last continuous
+    // packet of the frame. `video_payload` is cleared once it has been copied.
+    // When a frame is returned, its last packet holds the complete bitstream.
+    std::optional<Buffer> assembled_payload;
     RTPVideoHeader video_header;
   };
   struct InsertResult {
@@ -100,6 +110,10 @@ class PacketBuffer {
 
   void UpdateMissingPackets(uint16_t seq_num);
 
+  // Copies the payload of the packet at `index`, which just became continuous,
+  // to the end of the payload assembled for its frame.
+  void AppendToAssembledPayload(size_t index);
+
   // buffer_.size() and max_size_ must always be a power of two.
   const size_t max_size_;
 
@@ -124,6 +138,10 @@ class PacketBuffer {
   // Indicates if we should require SPS, PPS, and IDR for a particular
   // RTP timestamp to treat the corresponding frame as a keyframe.
   bool sps_pps_idr_is_h264_keyframe_;
+
+  // Size of the last frame assembled in place, used to reserve the payload
+  // buffer for the next one.
+  size_t assembled_frame_size_hint_ = 0;
 };
 
 }  // namespace video_coding
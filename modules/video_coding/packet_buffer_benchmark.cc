@@ -0,0 +1,226 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/video/encoded_image.h"
+#include "api/video/video_codec_type.h"
+#include "benchmark/benchmark.h"
+#include "common_video/h264/h264_common.h"
+#include "modules/rtp_rtcp/source/rtp_video_header.h"
+#include "modules/video_coding/codecs/h264/include/h264_globals.h"
+#include "modules/video_coding/h26x_packet_buffer.h"
+#include "modules/video_coding/packet_buffer.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace video_coding {
+namespace {
+
+constexpr int kBitrateBps = 10'000'000;
+constexpr int kFramerate = 30;
+constexpr size_t kPayloadSize = 1200;
+constexpr size_t kFrameSize = kBitrateBps / 8 / kFramerate;
+constexpr size_t kPacketsPerFrame =
+    (kFrameSize + kPayloadSize - 1) / kPayloadSize;
+// Probability that a packet is swapped with the next one of the frame.
+constexpr double kReorderProbability = 0.1;
+
+// Same as the default VideoRtpDepacketizer::AssembleFrame().
+scoped_refptr<EncodedImageBuffer> Concatenate(
+    const std::vector<std::unique_ptr<PacketBuffer::Packet>>& packets) {
+  size_t frame_size = 0;
+  for (const auto& packet : packets) {
+    frame_size += packet->video_payload.size();
+  }
+  scoped_refptr<EncodedImageBuffer> bitstream =
+      EncodedImageBuffer::Create(frame_size);
+  uint8_t* write_at = bitstream->data();
+  for (const auto& packet : packets) {
+    memcpy(write_at, packet->video_payload.cdata(),
+           packet->video_payload.size());
+    write_at += packet->video_payload.size();
+  }
+  return bitstream;
+}
+
+// Receives one second of a 10 Mbps stream, with packets reordered within each
+// frame, and assembles the frames either by concatenating the payloads once
+// the frame is complete or in place as the packets arrive.
+void BM_ReceiveFrames(benchmark::State& state) {
+  const bool assemble_in_place = state.range(0) != 0;
+  Random random(0x5eed);
+  std::vector<uint8_t> payload(kPayloadSize, 0x5a);
+  PacketBuffer packet_buffer(/*start_buffer_size=*/512,
+                             /*max_buffer_size=*/2048);
+  int64_t seq_num = 0;
+  uint32_t timestamp = 0;
+  std::vector<int64_t> order(kPacketsPerFrame);
+
+  for (auto _ : state) {
+    for (int frame = 0; frame < kFramerate; ++frame) {
+      for (size_t i = 0; i < kPacketsPerFrame; ++i) {
+        order[i] = seq_num + i;
+      }
+      for (size_t i = 0; i + 1 < kPacketsPerFrame; ++i) {
+        if (random.Rand<double>() < kReorderProbability) {
+          std::swap(order[i], order[i + 1]);
+        }
+      }
+
+      size_t num_frames = 0;
+      for (int64_t packet_seq_num : order) {
+        auto packet = std::make_unique<PacketBuffer::Packet>();
+        packet->video_header.codec = kVideoCodecGeneric;
+        packet->video_header.is_first_packet_in_frame =
+            packet_seq_num == seq_num;
+        packet->video_header.is_last_packet_in_frame =
+            packet_seq_num == seq_num + (kPacketsPerFrame - 1);
+        packet->sequence_number = packet_seq_num;
+        packet->timestamp = timestamp;
+        packet->assemble_in_place = assemble_in_place;
+        // Like a packet received from the network.
+        packet->video_payload.SetData(payload.data(), payload.size());
+
+        PacketBuffer::InsertResult result =
+            packet_buffer.InsertPacket(std::move(packet));
+        if (result.packets.empty()) {
+          continue;
+        }
+        PacketBuffer::Packet& last_packet = *result.packets.back();
+        scoped_refptr<EncodedImageBuffer> bitstream =
+            last_packet.assembled_payload
+                ? EncodedImageBuffer::Create(
+                      std::move(*last_packet.assembled_payload))
+                : Concatenate(result.packets);
+        benchmark::DoNotOptimize(bitstream->data());
+        packet_buffer.ClearTo(last_packet.seq_num());
+        ++num_frames;
+      }
+      RTC_CHECK_EQ(num_frames, 1);
+      seq_num += kPacketsPerFrame;
+      timestamp += 90'000 / kFramerate;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kFramerate * kPacketsPerFrame *
+                          kPayloadSize);
+}
+
+BENCHMARK(BM_ReceiveFrames)->Arg(0)->Arg(1)->ArgNames({"in_place"});
+
+// Receives one second of a 10 Mbps H.264 stream with one key frame, where
+// each frame is a single slice sent as FU-A fragments and the key frame is
+// preceded by a STAP-A with its parameter sets, and assembles the Annex B
+// bitstream of the frames like the receive stream does. The
+// copied_per_received counter is the number of bytes copied after a packet is
+// received per received byte, both by the packet buffer and to assemble the
+// frame.
+void BM_ReceiveH264Frames(benchmark::State& state) {
+  std::vector<uint8_t> payload(kPayloadSize, 0x5a);
+  // SPS and PPS, each prefixed by its size.
+  const std::vector<uint8_t> stap_a_payload = {
+      H264::NaluType::kStapA, 0, 4, H264::NaluType::kSps, 1, 2, 3,
+      0, 4, H264::NaluType::kPps, 4, 5, 6};
+  int64_t received_bytes = 0;
+  int64_t copied_bytes = 0;
+  // The sequence numbers and payloads of the packets of the current frame, as
+  // received.
+  std::vector<std::pair<int64_t, const uint8_t*>> received_payloads;
+  H26xPacketBuffer packet_buffer(/*h264_idr_only_keyframes_allowed=*/false);
+  int64_t seq_num = 0;
+  uint32_t timestamp = 0;
+
+  for (auto _ : state) {
+    for (int frame = 0; frame < kFramerate; ++frame) {
+      const bool key_frame = frame == 0;
+      const size_t num_packets = kPacketsPerFrame + (key_frame ? 1 : 0);
+      size_t num_frames = 0;
+      for (size_t i = 0; i < num_packets; ++i) {
+        auto packet = std::make_unique<PacketBuffer::Packet>();
+        packet->video_header.codec = kVideoCodecH264;
+        RTPVideoHeaderH264& h264_header =
+            packet->video_header.video_type_header
+                .emplace<RTPVideoHeaderH264>();
+        if (key_frame && i == 0) {
+          h264_header.packetization_type = kH264StapA;
+          h264_header.nalus = {{.type = H264::NaluType::kSps},
+                               {.type = H264::NaluType::kPps}};
+        } else {
+          h264_header.packetization_type = kH264FuA;
+          if (i == (key_frame ? 1 : 0)) {
+            h264_header.nalus = {{.type = key_frame ? H264::NaluType::kIdr
+                                                    : H264::NaluType::kSlice}};
+          }
+        }
+        packet->sequence_number = seq_num++;
+        packet->timestamp = timestamp;
+        packet->marker_bit = i == num_packets - 1;
+        // Like a packet received from the network.
+        if (h264_header.packetization_type == kH264StapA) {
+          packet->video_payload.SetData(stap_a_payload.data(),
+                                        stap_a_payload.size());
+        } else {
+          packet->video_payload.SetData(payload.data(), payload.size());
+        }
+        received_bytes += packet->video_payload.size();
+        received_payloads.emplace_back(packet->sequence_number,
+                                       packet->video_payload.cdata());
+
+        PacketBuffer::InsertResult result =
+            packet_buffer.InsertPacket(std::move(packet));
+        if (result.packets.empty()) {
+          continue;
+        }
+        // A payload that is not the one the packet was received with was
+        // copied by the packet buffer.
+        for (const auto& frame_packet : result.packets) {
+          if (!frame_packet->video_payload.empty() &&
+              std::find(received_payloads.begin(), received_payloads.end(),
+                        std::make_pair(frame_packet->sequence_number,
+                                       frame_packet->video_payload.cdata())) ==
+                  received_payloads.end()) {
+            copied_bytes += frame_packet->video_payload.size();
+          }
+        }
+        PacketBuffer::Packet& last_packet = *result.packets.back();
+        scoped_refptr<EncodedImageBuffer> bitstream =
+            last_packet.assembled_payload
+                ? EncodedImageBuffer::Create(
+                      std::move(*last_packet.assembled_payload))
+                : Concatenate(result.packets);
+        benchmark::DoNotOptimize(bitstream->data());
+        // Both the in-place assembly and the concatenation copy the frame
+        // once.
+        copied_bytes += bitstream->size();
+        received_payloads.clear();
+        ++num_frames;
+      }
+      RTC_CHECK_EQ(num_frames, 1);
+      timestamp += 90'000 / kFramerate;
+    }
+  }
+  state.SetBytesProcessed(received_bytes);
+  state.counters["copied_per_received"] =
+      static_cast<double>(copied_bytes) / received_bytes;
+}
+
+BENCHMARK(BM_ReceiveH264Frames);
+
+}  // namespace
+}  // namespace video_coding
+}  // namespace webrtc
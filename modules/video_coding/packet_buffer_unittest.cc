@@ -129,6 +129,7 @@ class PacketBufferTest : public ::testing::Test {
     packet->video_header.is_first_packet_in_frame = first == kFirst;
     packet->video_header.is_last_packet_in_frame = last == kLast;
     packet->video_payload.SetData(data.data(), data.size());
+    packet->assemble_in_place = assemble_in_place_;
 
     return PacketBufferInsertResult(
         packet_buffer_.InsertPacket(std::move(packet)));
@@ -136,6 +137,7 @@ class PacketBufferTest : public ::testing::Test {
 
   Random rand_;
   PacketBuffer packet_buffer_;
+  bool assemble_in_place_ = false;
 };
 
 TEST_F(PacketBufferTest, InsertOnePacket) {
@@ -202,6 +204,64 @@ TEST_F(PacketBufferTest, FrameSize) {
   EXPECT_THAT(packets, SizeIs(4));
 }
 
+TEST_F(PacketBufferTest, AssemblesReorderedFrameInPlace) {
+  assemble_in_place_ = true;
+  const int64_t seq_num = Rand();
+  const uint8_t data1[] = {1, 2};
+  const uint8_t data2[] = {3};
+  const uint8_t data3[] = {4, 5, 6};
+
+  EXPECT_THAT(Insert(seq_num + 2, kKeyFrame, kNotFirst, kLast, data3).packets,
+              IsEmpty());
+  EXPECT_THAT(Insert(seq_num, kKeyFrame, kFirst, kNotLast, data1).packets,
+              IsEmpty());
+  auto packets =
+      Insert(seq_num + 1, kKeyFrame, kNotFirst, kNotLast, data2).packets;
+
+  ASSERT_THAT(packets, SizeIs(3));
+  EXPECT_THAT(StartSeqNums(packets), ElementsAre(seq_num));
+  EXPECT_FALSE(packets[0]->assembled_payload);
+  EXPECT_FALSE(packets[1]->assembled_payload);
+  ASSERT_TRUE(packets[2]->assembled_payload);
+  EXPECT_THAT(*packets[2]->assembled_payload, ElementsAre(1, 2, 3, 4, 5, 6));
+  for (const auto& packet : packets) {
+    EXPECT_EQ(packet->video_payload.size(), 0u);
+  }
+}
+
+TEST_F(PacketBufferTest, AssemblesFrameInPlaceOnceWhenRevisited) {
+  assemble_in_place_ = true;
+  const int64_t seq_num = Rand();
+  const uint8_t data1[] = {1};
+  const uint8_t data2[] = {2};
+  const uint8_t data3[] = {3};
+  const uint8_t data4[] = {4};
+
+  // The first packet of the second frame becomes continuous before, and is
+  // visited again when, the first frame completes.
+  Insert(seq_num + 2, kDeltaFrame, kFirst, kNotLast, data3);
+  Insert(seq_num + 1, kKeyFrame, kNotFirst, kLast, data2);
+  auto packets = Insert(seq_num, kKeyFrame, kFirst, kNotLast, data1).packets;
+  ASSERT_THAT(packets, SizeIs(2));
+  ASSERT_TRUE(packets[1]->assembled_payload);
+  EXPECT_THAT(*packets[1]->assembled_payload, ElementsAre(1, 2));
+
+  packets = Insert(seq_num + 3, kDeltaFrame, kNotFirst, kLast, data4).packets;
+  ASSERT_THAT(packets, SizeIs(2));
+  ASSERT_TRUE(packets[1]->assembled_payload);
+  EXPECT_THAT(*packets[1]->assembled_payload, ElementsAre(3, 4));
+}
+
+TEST_F(PacketBufferTest, KeepsPayloadsUnlessAssemblingInPlace) {
+  const int64_t seq_num = Rand();
+  const uint8_t data[] = {1, 2};
+
+  auto packets = Insert(seq_num, kKeyFrame, kFirst, kLast, data).packets;
+  ASSERT_THAT(packets, SizeIs(1));
+  EXPECT_FALSE(packets[0]->assembled_payload);
+  EXPECT_EQ(packets[0]->video_payload, CopyOnWriteBuffer(data));
+}
+
 TEST_F(PacketBufferTest, ExpandBuffer) {
   const int64_t seq_num = Rand();
 
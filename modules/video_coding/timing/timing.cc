@@ -109,6 +109,11 @@ void VCMTiming::set_playout_delay(const VideoPlayoutDelay& playout_delay) {
   max_playout_delay_ = playout_delay.max();
 }
 
+void VCMTiming::set_low_latency_mode(bool low_latency_mode) {
+  MutexLock lock(&mutex_);
+  low_latency_mode_ = low_latency_mode;
+}
+
 void VCMTiming::SetJitterDelay(TimeDelta jitter_delay) {
   MutexLock lock(&mutex_);
   if (jitter_delay != jitter_delay_) {
@@ -235,6 +240,9 @@ TimeDelta VCMTiming::MaxWaitingTime(Timestamp render_time,
                                     bool too_many_frames_queued) const {
   MutexLock lock(&mutex_);
 
+  if (low_latency_mode_) {
+    return TimeDelta::Zero();
+  }
   if (render_time.IsZero() && zero_playout_delay_min_pacing_->us() > 0 &&
       min_playout_delay_.IsZero() && max_playout_delay_ > TimeDelta::Zero()) {
     // `render_time` == 0 indicates that the frame should be decoded and
@@ -283,8 +291,9 @@ bool VCMTiming::UseLowLatencyRendering() const {
   // max_playout_delay_<=kLowLatencyStreamMaxPlayoutDelayThreshold indicates
   // that the low-latency path should be used, which means that frames should be
   // decoded and rendered as soon as possible.
-  return min_playout_delay_.IsZero() &&
-         max_playout_delay_ <= kLowLatencyStreamMaxPlayoutDelayThreshold;
+  return low_latency_mode_ ||
+         (min_playout_delay_.IsZero() &&
+          max_playout_delay_ <= kLowLatencyStreamMaxPlayoutDelayThreshold);
 }
 
 VCMTiming::VideoDelayTimings VCMTiming::GetTimings() const {
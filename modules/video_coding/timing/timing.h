@@ -79,6 +79,11 @@ class VCMTiming {
   // Set the minimum and maximum playout delay from capture to render.
   void set_playout_delay(const VideoPlayoutDelay& playout_delay);
 
+  // In low-latency mode frames are rendered as soon as they are decoded and
+  // decoded without waiting, regardless of the playout delay and of the
+  // jitter, decode time and render delay estimates.
+  void set_low_latency_mode(bool low_latency_mode);
+
   // Increases or decreases the current delay to get closer to the target delay.
   // Calculates how long it has been since the previous call to this function,
   // and increases/decreases the delay in proportion to the time difference.
@@ -156,6 +161,7 @@ class VCMTiming {
   // in which case the receiver tries to play the frames as they arrive.
   TimeDelta min_playout_delay_ RTC_GUARDED_BY(mutex_);
   TimeDelta max_playout_delay_ RTC_GUARDED_BY(mutex_);
+  bool low_latency_mode_ RTC_GUARDED_BY(mutex_) = false;
   TimeDelta jitter_delay_ RTC_GUARDED_BY(mutex_);
   TimeDelta current_delay_ RTC_GUARDED_BY(mutex_);
   uint32_t prev_frame_timestamp_ RTC_GUARDED_BY(mutex_);
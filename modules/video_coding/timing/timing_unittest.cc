@@ -224,6 +224,27 @@ TEST(VCMTimingTest, UseLowLatencyRenderer) {
   EXPECT_THAT(timing.GetTimings(), HasConsistentVideoDelayTimings());
 }
 
+TEST(VCMTimingTest, LowLatencyModeIgnoresPlayoutDelay) {
+  test::ScopedKeyValueConfig field_trials;
+  SimulatedClock clock(Timestamp::Seconds(1));
+  VCMTiming timing(&clock, field_trials);
+  timing.Reset();
+  timing.set_playout_delay({TimeDelta::Millis(100), TimeDelta::Seconds(1)});
+  timing.set_low_latency_mode(true);
+  timing.IncomingTimestamp(90'000, clock.CurrentTime());
+
+  EXPECT_TRUE(timing.RenderParameters().use_low_latency_rendering);
+  EXPECT_EQ(timing.RenderTime(90'000, clock.CurrentTime()), Timestamp::Zero());
+  EXPECT_EQ(timing.MaxWaitingTime(Timestamp::Zero(), clock.CurrentTime(),
+                                  /*too_many_frames_queued=*/false),
+            TimeDelta::Zero());
+
+  timing.set_low_latency_mode(false);
+  EXPECT_FALSE(timing.RenderParameters().use_low_latency_rendering);
+  EXPECT_GT(timing.RenderTime(90'000, clock.CurrentTime()),
+            clock.CurrentTime());
+}
+
 TEST(VCMTimingTest, MaxWaitingTimeIsZeroForZeroRenderTime) {
   // This is the default path when the RTP playout delay header extension is set
   // to min==0 and max==0.
@@ -0,0 +1,84 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/video_coding/utility/active_map_tracker.h"
+
+#include <algorithm>
+
+#include "api/video/video_frame.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+ActiveMapTracker::ActiveMapTracker() = default;
+
+ActiveMapTracker::~ActiveMapTracker() = default;
+
+void ActiveMapTracker::OnInputFrame(const VideoFrame& frame) {
+  if (frame.width() != width_ || frame.height() != height_) {
+    width_ = frame.width();
+    height_ = frame.height();
+    Reset();
+    return;
+  }
+  if (full_update_) {
+    return;
+  }
+  if (!frame.has_update_rect()) {
+    Reset();
+    return;
+  }
+  for (const VideoFrame::UpdateRect& rect : frame.update_region()) {
+    updates_.push_back(rect);
+  }
+  if (updates_.size() > VideoFrame::kMaxUpdateRegionRects) {
+    VideoFrame::UpdateRect bounding_box = updates_.front();
+    for (const VideoFrame::UpdateRect& rect : updates_) {
+      bounding_box.Union(rect);
+    }
+    updates_ = {bounding_box};
+  }
+}
+
+void ActiveMapTracker::OnFrameEncoded() {
+  full_update_ = false;
+  updates_.clear();
+}
+
+void ActiveMapTracker::Reset() {
+  full_update_ = true;
+  updates_.clear();
+}
+
+bool ActiveMapTracker::ComputeActiveMap() {
+  if (full_update_ || updates_.empty()) {
+    return false;
+  }
+  cols_ = NumMacroblocks(width_);
+  rows_ = NumMacroblocks(height_);
+  active_map_.assign(rows_ * cols_, 0);
+  for (const VideoFrame::UpdateRect& rect : updates_) {
+    RTC_DCHECK(!rect.IsEmpty());
+    int first_col = rect.offset_x / kMacroblockSize;
+    int last_col = std::min((rect.offset_x + rect.width - 1) / kMacroblockSize,
+                            cols_ - 1);
+    int first_row = rect.offset_y / kMacroblockSize;
+    int last_row = std::min((rect.offset_y + rect.height - 1) / kMacroblockSize,
+                            rows_ - 1);
+    for (int row = first_row; row <= last_row; ++row) {
+      std::fill(active_map_.begin() + row * cols_ + first_col,
+                active_map_.begin() + row * cols_ + last_col + 1, 1);
+    }
+  }
+  return std::find(active_map_.begin(), active_map_.end(), 0) !=
+         active_map_.end();
+}
+
+}  // namespace webrtc
@@ -0,0 +1,87 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_VIDEO_CODING_UTILITY_ACTIVE_MAP_TRACKER_H_
+#define MODULES_VIDEO_CODING_UTILITY_ACTIVE_MAP_TRACKER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "api/video/video_frame.h"
+
+namespace webrtc {
+
+// Turns the update regions of the frames passed to an encoder into active
+// maps, i.e. one byte per 16x16 macroblock that is 1 for the macroblocks that
+// changed and 0 for those that can be skipped, as used by VP8E_SET_ACTIVEMAP
+// and AOME_SET_ACTIVEMAP.
+//
+// The inactive macroblocks are copied from the last encoded frame, so the map
+// has to cover every change since that frame, including changes in frames
+// the encoder dropped. The tracker therefore accumulates the updates until
+// OnFrameEncoded() is called. The map is only correct when the encoded frame
+// predicts from the last encoded frame, which the encoder has to ensure.
+class ActiveMapTracker {
+ public:
+  static constexpr int kMacroblockSize = 16;
+
+  // Number of macroblocks needed to cover `size` pixels.
+  static constexpr int NumMacroblocks(int size) {
+    return (size + kMacroblockSize - 1) / kMacroblockSize;
+  }
+
+  ActiveMapTracker();
+  ~ActiveMapTracker();
+
+  // Adds the update region of `frame`, which is about to be encoded.
+  void OnInputFrame(const VideoFrame& frame);
+
+  // Called when a frame was encoded, after which only the updates of later
+  // frames need to be encoded.
+  void OnFrameEncoded();
+
+  // Forgets the accumulated updates, e.g. on key frames or reconfiguration,
+  // so that the next map covers the whole frame.
+  void Reset();
+
+  // Computes the active map for the accumulated updates, to be retrieved with
+  // active_map(). Returns false if the whole frame should be encoded: when
+  // some frame carried no update information, when everything changed, or
+  // when nothing changed, since unchanged frames are sent to refine the
+  // quality of static content.
+  bool ComputeActiveMap();
+
+  // The map computed by the last successful ComputeActiveMap(), in raster
+  // order.
+  uint8_t* active_map() { return active_map_.data(); }
+  int rows() const { return rows_; }
+  int cols() const { return cols_; }
+
+  // Returns true if the computed map has the macroblock rows and columns of
+  // `width` x `height` frames. An encoder must not use a map of another size,
+  // since the encoder reads as many bytes as its own frames have macroblocks.
+  bool MatchesFrameSize(int width, int height) const {
+    return rows_ == NumMacroblocks(height) && cols_ == NumMacroblocks(width);
+  }
+
+ private:
+  int width_ = 0;
+  int height_ = 0;
+  // Set when the accumulated updates are unknown or cover the whole frame.
+  bool full_update_ = true;
+  std::vector<VideoFrame::UpdateRect> updates_;
+  std::vector<uint8_t> active_map_;
+  int rows_ = 0;
+  int cols_ = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_VIDEO_CODING_UTILITY_ACTIVE_MAP_TRACKER_H_
@@ -0,0 +1,135 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/video_coding/utility/active_map_tracker.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "api/video/i420_buffer.h"
+#include "api/video/video_frame.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAreArray;
+
+// 64x32 pixels, i.e. 4x2 macroblocks.
+VideoFrame CreateFrame(
+    std::optional<std::vector<VideoFrame::UpdateRect>> update_region) {
+  VideoFrame frame = VideoFrame::Builder()
+                         .set_video_frame_buffer(I420Buffer::Create(64, 32))
+                         .build();
+  if (update_region.has_value()) {
+    frame.set_update_region(*update_region);
+  }
+  return frame;
+}
+
+std::vector<uint8_t> ActiveMap(ActiveMapTracker& tracker) {
+  return std::vector<uint8_t>(
+      tracker.active_map(),
+      tracker.active_map() + tracker.rows() * tracker.cols());
+}
+
+TEST(ActiveMapTrackerTest, EncodesFirstFrameFully) {
+  ActiveMapTracker tracker;
+  tracker.OnInputFrame(CreateFrame({{{0, 0, 1, 1}}}));
+  EXPECT_FALSE(tracker.ComputeActiveMap());
+}
+
+TEST(ActiveMapTrackerTest, MarksChangedMacroblocks) {
+  ActiveMapTracker tracker;
+  tracker.OnInputFrame(CreateFrame(std::nullopt));
+  tracker.OnFrameEncoded();
+
+  tracker.OnInputFrame(CreateFrame({{{0, 0, 1, 1}, {20, 10, 20, 10}}}));
+  ASSERT_TRUE(tracker.ComputeActiveMap());
+  EXPECT_EQ(tracker.rows(), 2);
+  EXPECT_EQ(tracker.cols(), 4);
+  EXPECT_THAT(ActiveMap(tracker), ElementsAreArray({1, 1, 1, 0,  //
+                                                    0, 1, 1, 0}));
+}
+
+TEST(ActiveMapTrackerTest, MatchesFrameSizeOfTrackedFrames) {
+  ActiveMapTracker tracker;
+  tracker.OnInputFrame(CreateFrame(std::nullopt));
+  tracker.OnFrameEncoded();
+
+  tracker.OnInputFrame(CreateFrame({{{0, 0, 1, 1}}}));
+  ASSERT_TRUE(tracker.ComputeActiveMap());
+  EXPECT_TRUE(tracker.MatchesFrameSize(64, 32));
+  EXPECT_TRUE(tracker.MatchesFrameSize(63, 17));
+  EXPECT_FALSE(tracker.MatchesFrameSize(64, 48));
+  EXPECT_FALSE(tracker.MatchesFrameSize(32, 32));
+}
+
+TEST(ActiveMapTrackerTest, AccumulatesUpdatesUntilFrameIsEncoded) {
+  ActiveMapTracker tracker;
+  tracker.OnInputFrame(CreateFrame(std::nullopt));
+  tracker.OnFrameEncoded();
+
+  // The encoder drops the first frame.
+  tracker.OnInputFrame(CreateFrame({{{0, 0, 16, 16}}}));
+  tracker.OnInputFrame(CreateFrame({{{48, 16, 16, 16}}}));
+  ASSERT_TRUE(tracker.ComputeActiveMap());
+  EXPECT_THAT(ActiveMap(tracker), ElementsAreArray({1, 0, 0, 0,  //
+                                                    0, 0, 0, 1}));
+  tracker.OnFrameEncoded();
+
+  tracker.OnInputFrame(CreateFrame({{{16, 0, 16, 16}}}));
+  ASSERT_TRUE(tracker.ComputeActiveMap());
+  EXPECT_THAT(ActiveMap(tracker), ElementsAreArray({0, 1, 0, 0,  //
+                                                    0, 0, 0, 0}));
+}
+
+TEST(ActiveMapTrackerTest, EncodesFullyWithoutUpdateInformation) {
+  ActiveMapTracker tracker;
+  tracker.OnInputFrame(CreateFrame(std::nullopt));
+  tracker.OnFrameEncoded();
+
+  tracker.OnInputFrame(CreateFrame(std::nullopt));
+  tracker.OnInputFrame(CreateFrame({{{0, 0, 16, 16}}}));
+  EXPECT_FALSE(tracker.ComputeActiveMap());
+}
+
+TEST(ActiveMapTrackerTest, EncodesUnchangedFramesFully) {
+  ActiveMapTracker tracker;
+  tracker.OnInputFrame(CreateFrame(std::nullopt));
+  tracker.OnFrameEncoded();
+
+  tracker.OnInputFrame(CreateFrame(std::vector<VideoFrame::UpdateRect>()));
+  EXPECT_FALSE(tracker.ComputeActiveMap());
+}
+
+TEST(ActiveMapTrackerTest, EncodesFullyWhenEverythingChanged) {
+  ActiveMapTracker tracker;
+  tracker.OnInputFrame(CreateFrame(std::nullopt));
+  tracker.OnFrameEncoded();
+
+  tracker.OnInputFrame(CreateFrame({{{0, 0, 64, 16}, {0, 16, 64, 16}}}));
+  EXPECT_FALSE(tracker.ComputeActiveMap());
+}
+
+TEST(ActiveMapTrackerTest, EncodesFullyAfterReset) {
+  ActiveMapTracker tracker;
+  tracker.OnInputFrame(CreateFrame(std::nullopt));
+  tracker.OnFrameEncoded();
+
+  tracker.Reset();
+  tracker.OnInputFrame(CreateFrame({{{0, 0, 16, 16}}}));
+  EXPECT_FALSE(tracker.ComputeActiveMap());
+}
+
+}  // namespace
+}  // namespace webrtc
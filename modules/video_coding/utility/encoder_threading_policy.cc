@@ -0,0 +1,261 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/video_coding/utility/encoder_threading_policy.h"
+
+#include <algorithm>
+
+#include "api/video/video_codec_type.h"
+#include "api/video_codecs/video_codec.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system/arch.h"
+#include "system_wrappers/include/cpu_info.h"
+
+#if (defined(WEBRTC_ARCH_ARM) || defined(WEBRTC_ARCH_ARM64)) && \
+    (defined(WEBRTC_ANDROID) || defined(WEBRTC_IOS))
+#define MOBILE_ARM
+#endif
+
+namespace webrtc {
+namespace {
+
+// Pixels per encoder thread for screen content.
+constexpr int kScreenPixelsPerThread = 640 * 360 / 4;
+constexpr int kMaxThreads = 16;
+// Tiles narrower than this are not allowed by VP9 and are not worth it for
+// AV1. The same limit is used for the height of AV1 tile rows.
+constexpr int kMinTileSize = 256;
+constexpr int kMaxLog2Tiles = 6;
+
+int FloorLog2(int value) {
+  RTC_DCHECK_GT(value, 0);
+  int log2 = 0;
+  while (value > 1) {
+    value >>= 1;
+    ++log2;
+  }
+  return log2;
+}
+
+int MaxLog2Tiles(int size) {
+  return size < 2 * kMinTileSize
+             ? 0
+             : std::min(FloorLog2(size / kMinTileSize), kMaxLog2Tiles);
+}
+
+// Number of threads of the VP9 encoder for camera content.
+int Vp9CameraThreads(int width, int height, int number_of_cores) {
+  // Keep the number of encoder threads equal to the possible number of column
+  // tiles, which is (1, 2, 4, 8).
+  if (width * height >= 1280 * 720 && number_of_cores > 4) {
+    return 4;
+  } else if (width * height >= 640 * 360 && number_of_cores > 2) {
+    return 2;
+  } else {
+// Use 2 threads for low res on mobile ARM.
+#ifdef MOBILE_ARM
+    if (width * height >= 320 * 180 && number_of_cores > 2) {
+      return 2;
+    }
+#endif
+    // 1 thread less than VGA.
+    return 1;
+  }
+}
+
+// Number of threads of the AV1 encoder for camera content.
+int Av1CameraThreads(int width, int height, int number_of_cores) {
+  // Keep the number of encoder threads equal to the possible number of
+  // column/row tiles, which is (1, 2, 4, 8).
+  if (width * height > 1280 * 720 && number_of_cores > 8) {
+    return 8;
+  } else if (width * height >= 640 * 360 && number_of_cores > 4) {
+    return 4;
+  } else if (width * height >= 320 * 180 && number_of_cores > 2) {
+    return 2;
+  } else {
+    // 1 thread less than VGA.
+    return 1;
+  }
+}
+
+// Returns the settings for `num_threads` threads, with the tiling that goes
+// with them.
+EncoderThreadingSettings SettingsForThreads(VideoCodecType codec_type,
+                                            int width,
+                                            int height,
+                                            VideoCodecMode mode,
+                                            int num_threads) {
+  EncoderThreadingSettings settings;
+  settings.num_threads = num_threads;
+  if (mode != VideoCodecMode::kScreensharing) {
+    if (codec_type == kVideoCodecVP9) {
+      // The number of tile columns is capped by the encoder based on the
+      // image size (minimum width of a tile column is 256 pixels).
+      settings.log2_tile_columns = num_threads >> 1;
+    } else {
+      settings.auto_tiles = true;
+    }
+    return settings;
+  }
+
+  int log2_threads = FloorLog2(num_threads);
+  settings.log2_tile_columns = std::min(log2_threads, MaxLog2Tiles(width));
+  if (codec_type == kVideoCodecAV1) {
+    settings.log2_tile_rows = std::min(
+        log2_threads - settings.log2_tile_columns, MaxLog2Tiles(height));
+  }
+  return settings;
+}
+
+}  // namespace
+
+EncoderThreadingSettings GetEncoderThreadingSettings(VideoCodecType codec_type,
+                                                     int width,
+                                                     int height,
+                                                     VideoCodecMode mode,
+                                                     int number_of_cores) {
+  RTC_DCHECK(codec_type == kVideoCodecVP9 || codec_type == kVideoCodecAV1);
+  RTC_DCHECK_GT(number_of_cores, 0);
+  int num_threads;
+  if (mode != VideoCodecMode::kScreensharing) {
+    num_threads = codec_type == kVideoCodecVP9
+                      ? Vp9CameraThreads(width, height, number_of_cores)
+                      : Av1CameraThreads(width, height, number_of_cores);
+  } else {
+    num_threads = std::clamp(
+        (width * height + kScreenPixelsPerThread - 1) / kScreenPixelsPerThread,
+        1, std::min(kMaxThreads, number_of_cores));
+  }
+  return SettingsForThreads(codec_type, width, height, mode, num_threads);
+}
+
+EncoderCoreBudget::Reservation::Reservation(EncoderCoreBudget* budget,
+                                            int num_cores)
+    : budget_(budget), num_cores_(num_cores) {}
+
+EncoderCoreBudget::Reservation::Reservation(Reservation&& other)
+    : budget_(other.budget_), num_cores_(other.num_cores_) {
+  other.budget_ = nullptr;
+  other.num_cores_ = 0;
+}
+
+EncoderCoreBudget::Reservation& EncoderCoreBudget::Reservation::operator=(
+    Reservation&& other) {
+  if (this != &other) {
+    Release();
+    budget_ = other.budget_;
+    num_cores_ = other.num_cores_;
+    other.budget_ = nullptr;
+    other.num_cores_ = 0;
+  }
+  return *this;
+}
+
+EncoderCoreBudget::Reservation::~Reservation() {
+  Release();
+}
+
+void EncoderCoreBudget::Reservation::ShrinkTo(int num_cores) {
+  RTC_DCHECK_GT(num_cores, 0);
+  if (budget_ != nullptr && num_cores < num_cores_) {
+    budget_->ReturnCores(num_cores_ - num_cores);
+    num_cores_ = num_cores;
+  }
+}
+
+void EncoderCoreBudget::Reservation::Release() {
+  if (budget_ != nullptr) {
+    budget_->Release(num_cores_);
+    budget_ = nullptr;
+    num_cores_ = 0;
+  }
+}
+
+EncoderCoreBudget::EncoderCoreBudget(int num_cores)
+    : num_cores_(std::max(num_cores, 1)) {}
+
+EncoderCoreBudget::~EncoderCoreBudget() {
+  RTC_DCHECK_EQ(num_reservations_, 0);
+}
+
+EncoderCoreBudget& EncoderCoreBudget::ProcessWide() {
+  static EncoderCoreBudget* const budget =
+      new EncoderCoreBudget(CpuInfo::DetectNumberOfCores());
+  return *budget;
+}
+
+EncoderCoreBudget::Reservation EncoderCoreBudget::Reserve(int max_cores) {
+  RTC_DCHECK_GT(max_cores, 0);
+  MutexLock lock(&mutex_);
+  int fair_share = std::max(num_cores_ / (num_reservations_ + 1), 1);
+  int num_cores = std::clamp(max_cores, 1, fair_share);
+  ++num_reservations_;
+  num_reserved_cores_ += num_cores;
+  return Reservation(this, num_cores);
+}
+
+int EncoderCoreBudget::num_reserved_cores() const {
+  MutexLock lock(&mutex_);
+  return num_reserved_cores_;
+}
+
+void EncoderCoreBudget::Release(int num_cores) {
+  MutexLock lock(&mutex_);
+  RTC_DCHECK_GT(num_reservations_, 0);
+  --num_reservations_;
+  num_reserved_cores_ -= num_cores;
+}
+
+void EncoderCoreBudget::ReturnCores(int num_cores) {
+  MutexLock lock(&mutex_);
+  RTC_DCHECK_GE(num_reserved_cores_, num_cores);
+  num_reserved_cores_ -= num_cores;
+}
+
+EncoderThreadingSettings ReserveEncoderThreading(
+    VideoCodecType codec_type,
+    int width,
+    int height,
+    VideoCodecMode mode,
+    int number_of_cores,
+    EncoderCoreBudget::Reservation* reservation) {
+  return ReserveEncoderThreading(codec_type, width, height, mode,
+                                 number_of_cores,
+                                 EncoderCoreBudget::ProcessWide(), reservation);
+}
+
+EncoderThreadingSettings ReserveEncoderThreading(
+    VideoCodecType codec_type,
+    int width,
+    int height,
+    VideoCodecMode mode,
+    int number_of_cores,
+    EncoderCoreBudget& budget,
+    EncoderCoreBudget::Reservation* reservation) {
+  RTC_DCHECK(reservation);
+  // Return the cores of the previous reservation before taking the fair share.
+  *reservation = EncoderCoreBudget::Reservation();
+  EncoderThreadingSettings wanted = GetEncoderThreadingSettings(
+      codec_type, width, height, mode, number_of_cores);
+  *reservation = budget.Reserve(wanted.num_threads);
+  if (reservation->num_cores() >= wanted.num_threads) {
+    return wanted;
+  }
+  // The reserved cores are all the encoder gets, so use one thread per core
+  // rather than the camera heuristics, which leave cores unused. Round down to
+  // a thread count that tiles evenly, and return the cores that are not used.
+  const int num_threads = 1 << FloorLog2(reservation->num_cores());
+  reservation->ShrinkTo(num_threads);
+  return SettingsForThreads(codec_type, width, height, mode, num_threads);
+}
+
+}  // namespace webrtc
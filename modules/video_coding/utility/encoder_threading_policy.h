@@ -0,0 +1,129 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_VIDEO_CODING_UTILITY_ENCODER_THREADING_POLICY_H_
+#define MODULES_VIDEO_CODING_UTILITY_ENCODER_THREADING_POLICY_H_
+
+#include "api/video/video_codec_type.h"
+#include "api/video_codecs/video_codec.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system/rtc_export.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+struct EncoderThreadingSettings {
+  int num_threads = 1;
+  // Number of tile columns and rows, in log2 units.
+  int log2_tile_columns = 0;
+  int log2_tile_rows = 0;
+  // If true, the encoder picks the tiles and the tile counts above are unused.
+  bool auto_tiles = false;
+};
+
+// Returns the number of threads and the tiling the libvpx VP9 or libaom AV1
+// encoder should use for `width` x `height` frames of `mode` content when it
+// may use up to `number_of_cores` cores.
+//
+// Camera content keeps the per-codec thread counts the encoders have always
+// used, with VP9 tile columns following the threads and AV1 tiles picked by
+// libaom. For screen content, where encode latency is dominated by large key
+// frames and scroll updates, the number of threads grows with the number of
+// pixels up to 16, and tile columns are added until there is one tile per
+// thread. Tile rows are only used for AV1, since libvpx does not encode VP9
+// tile rows in parallel.
+RTC_EXPORT EncoderThreadingSettings
+GetEncoderThreadingSettings(VideoCodecType codec_type,
+                            int width,
+                            int height,
+                            VideoCodecMode mode,
+                            int number_of_cores);
+
+// Shares a number of cores between the software encoders running in the same
+// process, so that concurrent encoders do not each size their thread pools
+// for the whole machine. This class is thread safe.
+class RTC_EXPORT EncoderCoreBudget {
+ public:
+  // Cores reserved by one encoder. They are returned to the budget when the
+  // reservation is destroyed or reassigned.
+  class Reservation {
+   public:
+    Reservation() = default;
+    Reservation(Reservation&& other);
+    Reservation& operator=(Reservation&& other);
+    ~Reservation();
+
+    int num_cores() const { return num_cores_; }
+
+    // Returns the cores above `num_cores` to the budget.
+    void ShrinkTo(int num_cores);
+
+   private:
+    friend class EncoderCoreBudget;
+    Reservation(EncoderCoreBudget* budget, int num_cores);
+    void Release();
+
+    EncoderCoreBudget* budget_ = nullptr;
+    int num_cores_ = 0;
+  };
+
+  explicit EncoderCoreBudget(int num_cores);
+  ~EncoderCoreBudget();
+
+  // The budget of all cores of the machine, shared by the encoders of the
+  // process.
+  static EncoderCoreBudget& ProcessWide();
+
+  // Reserves at least one and at most `max_cores` cores. An encoder gets no
+  // more than its fair share, i.e. the budget divided evenly between it and
+  // the encoders already holding reservations. Reservations that were made
+  // earlier are not reduced, so the reserved total may exceed the budget until
+  // those encoders reserve again.
+  Reservation Reserve(int max_cores);
+
+  int num_cores() const { return num_cores_; }
+  int num_reserved_cores() const;
+
+ private:
+  void Release(int num_cores);
+  void ReturnCores(int num_cores);
+
+  const int num_cores_;
+  mutable Mutex mutex_;
+  int num_reserved_cores_ RTC_GUARDED_BY(mutex_) = 0;
+  int num_reservations_ RTC_GUARDED_BY(mutex_) = 0;
+};
+
+// Replaces `reservation` with a reservation from `budget` for the threads
+// GetEncoderThreadingSettings() asks for, and returns the settings for the
+// cores that could be reserved. If fewer cores than threads were reserved, the
+// encoder uses one thread per reserved core, rounded down to 1, 2, 4 or 8 so
+// that the threads match the tiles, and the reservation is shrunk to that.
+RTC_EXPORT EncoderThreadingSettings
+ReserveEncoderThreading(VideoCodecType codec_type,
+                        int width,
+                        int height,
+                        VideoCodecMode mode,
+                        int number_of_cores,
+                        EncoderCoreBudget& budget,
+                        EncoderCoreBudget::Reservation* reservation);
+
+// Same as above, with the process-wide budget.
+RTC_EXPORT EncoderThreadingSettings
+ReserveEncoderThreading(VideoCodecType codec_type,
+                        int width,
+                        int height,
+                        VideoCodecMode mode,
+                        int number_of_cores,
+                        EncoderCoreBudget::Reservation* reservation);
+
+}  // namespace webrtc
+
+#endif  // MODULES_VIDEO_CODING_UTILITY_ENCODER_THREADING_POLICY_H_
@@ -0,0 +1,226 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/video_coding/utility/encoder_threading_policy.h"
+
+#include <utility>
+
+#include "api/video/video_codec_type.h"
+#include "api/video_codecs/video_codec.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr VideoCodecMode kCamera = VideoCodecMode::kRealtimeVideo;
+constexpr VideoCodecMode kScreen = VideoCodecMode::kScreensharing;
+
+TEST(EncoderThreadingPolicyTest, UsesOneThreadForLowResolutions) {
+  EncoderThreadingSettings settings = GetEncoderThreadingSettings(
+      kVideoCodecVP9, 320, 180, kScreen, /*number_of_cores=*/32);
+  EXPECT_EQ(settings.num_threads, 1);
+  EXPECT_EQ(settings.log2_tile_columns, 0);
+  EXPECT_EQ(settings.log2_tile_rows, 0);
+}
+
+TEST(EncoderThreadingPolicyTest, CameraKeepsPerCodecThreadCounts) {
+  EncoderThreadingSettings vp9 = GetEncoderThreadingSettings(
+      kVideoCodecVP9, 1920, 1080, kCamera, /*number_of_cores=*/32);
+  EXPECT_EQ(vp9.num_threads, 4);
+  EXPECT_EQ(vp9.log2_tile_columns, 2);
+  EXPECT_FALSE(vp9.auto_tiles);
+
+  EncoderThreadingSettings av1 = GetEncoderThreadingSettings(
+      kVideoCodecAV1, 1920, 1080, kCamera, /*number_of_cores=*/32);
+  EXPECT_EQ(av1.num_threads, 8);
+  EXPECT_TRUE(av1.auto_tiles);
+
+  EXPECT_EQ(GetEncoderThreadingSettings(kVideoCodecAV1, 1280, 720, kCamera,
+                                        /*number_of_cores=*/32)
+                .num_threads,
+            4);
+  EXPECT_EQ(GetEncoderThreadingSettings(kVideoCodecVP9, 640, 360, kCamera,
+                                        /*number_of_cores=*/4)
+                .num_threads,
+            2);
+}
+
+TEST(EncoderThreadingPolicyTest, ThreadsAreLimitedByNumberOfCores) {
+  EXPECT_EQ(GetEncoderThreadingSettings(kVideoCodecAV1, 1920, 1080, kCamera,
+                                        /*number_of_cores=*/1)
+                .num_threads,
+            1);
+  EXPECT_EQ(GetEncoderThreadingSettings(kVideoCodecAV1, 1920, 1080, kScreen,
+                                        /*number_of_cores=*/6)
+                .num_threads,
+            6);
+}
+
+TEST(EncoderThreadingPolicyTest, ScreenContentUsesMoreThreads) {
+  EncoderThreadingSettings camera = GetEncoderThreadingSettings(
+      kVideoCodecAV1, 1280, 720, kCamera, /*number_of_cores=*/32);
+  EncoderThreadingSettings screen = GetEncoderThreadingSettings(
+      kVideoCodecAV1, 1280, 720, kScreen, /*number_of_cores=*/32);
+  EXPECT_EQ(camera.num_threads, 4);
+  EXPECT_EQ(screen.num_threads, 16);
+  EXPECT_FALSE(screen.auto_tiles);
+}
+
+TEST(EncoderThreadingPolicyTest, Av1ScreenshareOnManyCores) {
+  EncoderThreadingSettings settings = GetEncoderThreadingSettings(
+      kVideoCodecAV1, 1920, 1080, kScreen, /*number_of_cores=*/32);
+  EXPECT_EQ(settings.num_threads, 16);
+  // 1920 pixels fit at most 4 tile columns, the rest is split in rows.
+  EXPECT_EQ(settings.log2_tile_columns, 2);
+  EXPECT_EQ(settings.log2_tile_rows, 2);
+}
+
+TEST(EncoderThreadingPolicyTest, Vp9UsesTileColumnsOnly) {
+  EncoderThreadingSettings settings = GetEncoderThreadingSettings(
+      kVideoCodecVP9, 1920, 1080, kScreen, /*number_of_cores=*/32);
+  EXPECT_EQ(settings.num_threads, 16);
+  EXPECT_EQ(settings.log2_tile_columns, 2);
+  EXPECT_EQ(settings.log2_tile_rows, 0);
+}
+
+TEST(EncoderThreadingPolicyTest, TileColumnsFollowThreads) {
+  EncoderThreadingSettings settings = GetEncoderThreadingSettings(
+      kVideoCodecVP9, 3840, 2160, kScreen, /*number_of_cores=*/4);
+  EXPECT_EQ(settings.num_threads, 4);
+  EXPECT_EQ(settings.log2_tile_columns, 2);
+}
+
+TEST(EncoderCoreBudgetTest, ReservesUpToFairShare) {
+  EncoderCoreBudget budget(/*num_cores=*/32);
+  EncoderCoreBudget::Reservation first = budget.Reserve(/*max_cores=*/16);
+  EncoderCoreBudget::Reservation second = budget.Reserve(/*max_cores=*/32);
+  EncoderCoreBudget::Reservation third = budget.Reserve(/*max_cores=*/32);
+  EXPECT_EQ(first.num_cores(), 16);
+  EXPECT_EQ(second.num_cores(), 16);
+  EXPECT_EQ(third.num_cores(), 10);
+  EXPECT_EQ(budget.num_reserved_cores(), 42);
+}
+
+TEST(EncoderCoreBudgetTest, AlwaysReservesAtLeastOneCore) {
+  EncoderCoreBudget budget(/*num_cores=*/1);
+  EncoderCoreBudget::Reservation first = budget.Reserve(/*max_cores=*/4);
+  EncoderCoreBudget::Reservation second = budget.Reserve(/*max_cores=*/4);
+  EXPECT_EQ(first.num_cores(), 1);
+  EXPECT_EQ(second.num_cores(), 1);
+}
+
+TEST(EncoderCoreBudgetTest, ReleasesCoresWhenReservationIsDestroyed) {
+  EncoderCoreBudget budget(/*num_cores=*/8);
+  {
+    EncoderCoreBudget::Reservation reservation = budget.Reserve(8);
+    EXPECT_EQ(budget.num_reserved_cores(), 8);
+  }
+  EXPECT_EQ(budget.num_reserved_cores(), 0);
+  EXPECT_EQ(budget.Reserve(8).num_cores(), 8);
+}
+
+TEST(EncoderCoreBudgetTest, MovingReservationKeepsCoresReserved) {
+  EncoderCoreBudget budget(/*num_cores=*/8);
+  EncoderCoreBudget::Reservation reservation;
+  EXPECT_EQ(reservation.num_cores(), 0);
+  reservation = budget.Reserve(4);
+  EncoderCoreBudget::Reservation moved = std::move(reservation);
+  EXPECT_EQ(moved.num_cores(), 4);
+  EXPECT_EQ(budget.num_reserved_cores(), 4);
+  moved = EncoderCoreBudget::Reservation();
+  EXPECT_EQ(budget.num_reserved_cores(), 0);
+}
+
+TEST(EncoderCoreBudgetTest, ShrinkingReservationReturnsCores) {
+  EncoderCoreBudget budget(/*num_cores=*/8);
+  EncoderCoreBudget::Reservation reservation = budget.Reserve(6);
+  reservation.ShrinkTo(4);
+  EXPECT_EQ(reservation.num_cores(), 4);
+  EXPECT_EQ(budget.num_reserved_cores(), 4);
+  reservation = EncoderCoreBudget::Reservation();
+  EXPECT_EQ(budget.num_reserved_cores(), 0);
+}
+
+TEST(ReserveEncoderThreadingTest, UsesWantedSettingsWhenFullyReserved) {
+  EncoderCoreBudget budget(/*num_cores=*/16);
+  EncoderCoreBudget::Reservation reservation;
+  EncoderThreadingSettings settings = ReserveEncoderThreading(
+      kVideoCodecAV1, 1920, 1080, kCamera, /*number_of_cores=*/16, budget,
+      &reservation);
+  EXPECT_EQ(settings.num_threads, 8);
+  EXPECT_TRUE(settings.auto_tiles);
+  EXPECT_EQ(reservation.num_cores(), 8);
+  EXPECT_EQ(budget.num_reserved_cores(), 8);
+}
+
+TEST(ReserveEncoderThreadingTest, ReplacesPreviousReservation) {
+  EncoderCoreBudget budget(/*num_cores=*/16);
+  EncoderCoreBudget::Reservation reservation;
+  ReserveEncoderThreading(kVideoCodecAV1, 1920, 1080, kCamera,
+                          /*number_of_cores=*/16, budget, &reservation);
+  ReserveEncoderThreading(kVideoCodecAV1, 640, 360, kCamera,
+                          /*number_of_cores=*/16, budget, &reservation);
+  EXPECT_EQ(reservation.num_cores(), 4);
+  EXPECT_EQ(budget.num_reserved_cores(), 4);
+}
+
+TEST(ReserveEncoderThreadingTest, UsesOneThreadPerCoreOfPartialReservation) {
+  // Another encoder holds a reservation, so the fair share is 4 cores.
+  EncoderCoreBudget budget(/*num_cores=*/8);
+  EncoderCoreBudget::Reservation other = budget.Reserve(4);
+  EncoderCoreBudget::Reservation reservation;
+  EncoderThreadingSettings av1 = ReserveEncoderThreading(
+      kVideoCodecAV1, 1920, 1080, kCamera, /*number_of_cores=*/16, budget,
+      &reservation);
+  EXPECT_EQ(av1.num_threads, 4);
+  EXPECT_TRUE(av1.auto_tiles);
+  EXPECT_EQ(reservation.num_cores(), 4);
+
+  // The fair share of a budget of 4 cores with one other encoder is 2 cores.
+  EncoderCoreBudget small_budget(/*num_cores=*/4);
+  EncoderCoreBudget::Reservation small_other = small_budget.Reserve(1);
+  EncoderCoreBudget::Reservation vp9_reservation;
+  EncoderThreadingSettings vp9 = ReserveEncoderThreading(
+      kVideoCodecVP9, 1280, 720, kCamera, /*number_of_cores=*/8, small_budget,
+      &vp9_reservation);
+  EXPECT_EQ(vp9.num_threads, 2);
+  EXPECT_EQ(vp9.log2_tile_columns, 1);
+  EXPECT_EQ(vp9_reservation.num_cores(), 2);
+}
+
+TEST(ReserveEncoderThreadingTest, ShrinksPartialReservationToThreadsUsed) {
+  // The fair share is 3 cores, of which 2 are used.
+  EncoderCoreBudget budget(/*num_cores=*/6);
+  EncoderCoreBudget::Reservation other = budget.Reserve(1);
+  EncoderCoreBudget::Reservation reservation;
+  EncoderThreadingSettings settings = ReserveEncoderThreading(
+      kVideoCodecAV1, 1920, 1080, kCamera, /*number_of_cores=*/16, budget,
+      &reservation);
+  EXPECT_EQ(settings.num_threads, 2);
+  EXPECT_EQ(reservation.num_cores(), 2);
+  EXPECT_EQ(budget.num_reserved_cores(), 3);
+}
+
+TEST(ReserveEncoderThreadingTest, TilesScreenContentForPartialReservation) {
+  // The fair share is 6 cores, of which 4 are used.
+  EncoderCoreBudget budget(/*num_cores=*/12);
+  EncoderCoreBudget::Reservation other = budget.Reserve(1);
+  EncoderCoreBudget::Reservation reservation;
+  EncoderThreadingSettings settings = ReserveEncoderThreading(
+      kVideoCodecAV1, 3840, 2160, kScreen, /*number_of_cores=*/16, budget,
+      &reservation);
+  EXPECT_EQ(settings.num_threads, 4);
+  EXPECT_EQ(settings.log2_tile_columns, 2);
+  EXPECT_EQ(settings.log2_tile_rows, 0);
+  EXPECT_EQ(reservation.num_cores(), 4);
+}
+
+}  // namespace
+}  // namespace webrtc
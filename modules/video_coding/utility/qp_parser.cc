@@ -15,6 +15,7 @@
 #include <optional>
 
 #include "api/array_view.h"
+#include "api/video/nalu_index.h"
 #include "api/video/video_codec_constants.h"
 #include "api/video/video_codec_type.h"
 #include "modules/video_coding/utility/vp8_header_parser.h"
@@ -23,10 +24,12 @@
 
 namespace webrtc {
 
-std::optional<uint32_t> QpParser::Parse(VideoCodecType codec_type,
-                                        size_t spatial_idx,
-                                        const uint8_t* frame_data,
-                                        size_t frame_size) {
+std::optional<uint32_t> QpParser::Parse(
+    VideoCodecType codec_type,
+    size_t spatial_idx,
+    const uint8_t* frame_data,
+    size_t frame_size,
+    ArrayView<const NaluIndex> nalu_indices) {
   if (frame_data == nullptr || frame_size == 0 ||
       spatial_idx >= kMaxSimulcastStreams) {
     return std::nullopt;
@@ -43,31 +46,45 @@ std::optional<uint32_t> QpParser::Parse(VideoCodecType codec_type,
       return qp;
     }
   } else if (codec_type == kVideoCodecH264) {
-    return h264_parsers_[spatial_idx].Parse(frame_data, frame_size);
+    return h264_parsers_[spatial_idx].Parse(frame_data, frame_size,
+                                            nalu_indices);
   } else if (codec_type == kVideoCodecH265) {
     // H.265 bitstream parser is conditionally built.
 #ifdef RTC_ENABLE_H265
-    return h265_parsers_[spatial_idx].Parse(frame_data, frame_size);
+    return h265_parsers_[spatial_idx].Parse(frame_data, frame_size,
+                                            nalu_indices);
 #endif
   }
 
   return std::nullopt;
 }
 
-std::optional<uint32_t> QpParser::H264QpParser::Parse(const uint8_t* frame_data,
-                                                      size_t frame_size) {
+std::optional<uint32_t> QpParser::H264QpParser::Parse(
+    const uint8_t* frame_data,
+    size_t frame_size,
+    ArrayView<const NaluIndex> nalu_indices) {
   MutexLock lock(&mutex_);
-  bitstream_parser_.ParseBitstream(
-      ArrayView<const uint8_t>(frame_data, frame_size));
+  ArrayView<const uint8_t> bitstream(frame_data, frame_size);
+  if (nalu_indices.empty()) {
+    bitstream_parser_.ParseBitstream(bitstream);
+  } else {
+    bitstream_parser_.ParseBitstream(bitstream, nalu_indices);
+  }
   return bitstream_parser_.GetLastSliceQp();
 }
 
 #ifdef RTC_ENABLE_H265
-std::optional<uint32_t> QpParser::H265QpParser::Parse(const uint8_t* frame_data,
-                                                      size_t frame_size) {
+std::optional<uint32_t> QpParser::H265QpParser::Parse(
+    const uint8_t* frame_data,
+    size_t frame_size,
+    ArrayView<const NaluIndex> nalu_indices) {
   MutexLock lock(&mutex_);
-  bitstream_parser_.ParseBitstream(
-      ArrayView<const uint8_t>(frame_data, frame_size));
+  ArrayView<const uint8_t> bitstream(frame_data, frame_size);
+  if (nalu_indices.empty()) {
+    bitstream_parser_.ParseBitstream(bitstream);
+  } else {
+    bitstream_parser_.ParseBitstream(bitstream, nalu_indices);
+  }
   return bitstream_parser_.GetLastSliceQp();
 }
 #endif
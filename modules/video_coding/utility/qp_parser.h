@@ -15,6 +15,8 @@
 #include <cstdint>
 #include <optional>
 
+#include "api/array_view.h"
+#include "api/video/nalu_index.h"
 #include "api/video/video_codec_constants.h"
 #include "api/video/video_codec_type.h"
 #include "common_video/h264/h264_bitstream_parser.h"
@@ -28,16 +30,21 @@
 namespace webrtc {
 class QpParser {
  public:
+  // For H.264 and H.265, `nalu_indices` are the known positions of the NAL
+  // units of the frame, if any. The frame is searched for them otherwise.
   std::optional<uint32_t> Parse(VideoCodecType codec_type,
                                 size_t spatial_idx,
                                 const uint8_t* frame_data,
-                                size_t frame_size);
+                                size_t frame_size,
+                                ArrayView<const NaluIndex> nalu_indices = {});
 
  private:
   // A thread safe wrapper for H264 bitstream parser.
   class H264QpParser {
    public:
-    std::optional<uint32_t> Parse(const uint8_t* frame_data, size_t frame_size);
+    std::optional<uint32_t> Parse(const uint8_t* frame_data,
+                                  size_t frame_size,
+                                  ArrayView<const NaluIndex> nalu_indices);
 
    private:
     Mutex mutex_;
@@ -50,7 +57,9 @@ class QpParser {
   // A thread safe wrapper for H.265 bitstream parser.
   class H265QpParser {
    public:
-    std::optional<uint32_t> Parse(const uint8_t* frame_data, size_t frame_size);
+    std::optional<uint32_t> Parse(const uint8_t* frame_data,
+                                  size_t frame_size,
+                                  ArrayView<const NaluIndex> nalu_indices);
 
    private:
     Mutex mutex_;
@@ -207,6 +207,9 @@ void VideoRtpReceiver::RestartMediaChannel_w(
   if (encoded_sink_enabled) {
     SetEncodedSinkEnabled(true);
   }
+  if (saved_sinks_paused_) {
+    media_channel_->SetSinkPaused(signaled_ssrc_.value_or(0), true);
+  }
 
   if (frame_transformer_ && media_channel_) {
     media_channel_->SetDepacketizerToDecoderFrameTransformer(
@@ -354,6 +357,9 @@ void VideoRtpReceiver::SetMediaChannel_w(
     if (encoded_sink_enabled) {
       SetEncodedSinkEnabled(true);
     }
+    if (saved_sinks_paused_) {
+      media_channel_->SetSinkPaused(signaled_ssrc_.value_or(0), true);
+    }
     if (frame_transformer_) {
       media_channel_->SetDepacketizerToDecoderFrameTransformer(
           signaled_ssrc_.value_or(0), frame_transformer_);
@@ -418,6 +424,16 @@ void VideoRtpReceiver::OnEncodedSinkEnabled(bool enable) {
   saved_encoded_sink_enabled_ = enable;
 }
 
+void VideoRtpReceiver::OnSinksPaused(bool paused) {
+  RTC_DCHECK_RUN_ON(worker_thread_);
+  // Saved to be applied to the receive stream of a new media channel or ssrc.
+  saved_sinks_paused_ = paused;
+  if (media_channel_) {
+    // TODO(bugs.webrtc.org/8694): Stop using 0 to mean unsignalled SSRC
+    media_channel_->SetSinkPaused(signaled_ssrc_.value_or(0), paused);
+  }
+}
+
 void VideoRtpReceiver::SetEncodedSinkEnabled(bool enable) {
   RTC_DCHECK_RUN_ON(worker_thread_);
   if (!media_channel_)
@@ -131,6 +131,7 @@ class VideoRtpReceiver : public RtpReceiverInternal,
   // VideoRtpTrackSource::Callback
   void OnGenerateKeyFrame();
   void OnEncodedSinkEnabled(bool enable);
+  void OnSinksPaused(bool paused);
 
   void SetEncodedSinkEnabled(bool enable) RTC_RUN_ON(worker_thread_);
 
@@ -144,6 +145,9 @@ class VideoRtpReceiver : public RtpReceiverInternal,
     void OnEncodedSinkEnabled(bool enable) override {
       receiver_->OnEncodedSinkEnabled(enable);
     }
+    void OnSinksPaused(bool paused) override {
+      receiver_->OnSinksPaused(paused);
+    }
 
     VideoRtpReceiver* const receiver_;
   } source_callback_{this};
@@ -182,6 +186,7 @@ class VideoRtpReceiver : public RtpReceiverInternal,
   // or switched.
   bool saved_generate_keyframe_ RTC_GUARDED_BY(worker_thread_) = false;
   bool saved_encoded_sink_enabled_ RTC_GUARDED_BY(worker_thread_) = false;
+  bool saved_sinks_paused_ RTC_GUARDED_BY(worker_thread_) = false;
   const webrtc::scoped_refptr<PendingTaskSafetyFlag> worker_thread_safety_;
 };
 
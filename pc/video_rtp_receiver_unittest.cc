@@ -22,7 +22,9 @@
 #include "api/task_queue/task_queue_base.h"
 #include "api/video/recordable_encoded_frame.h"
 #include "api/video/test/mock_recordable_encoded_frame.h"
+#include "api/video/video_frame.h"
 #include "api/video/video_sink_interface.h"
+#include "api/video/video_source_interface.h"
 #include "media/base/fake_media_engine.h"
 #include "media/base/media_channel.h"
 #include "rtc_base/task_queue_for_test.h"
@@ -69,6 +71,7 @@ class VideoRtpReceiverTest : public testing::Test {
                 (uint32_t),
                 (override));
     MOCK_METHOD(void, RequestRecvKeyFrame, (uint32_t), (override));
+    MOCK_METHOD(void, SetSinkPaused, (uint32_t, bool), (override));
   };
 
   class MockVideoSink : public VideoSinkInterface<RecordableEncodedFrame> {
@@ -76,6 +79,11 @@ class VideoRtpReceiverTest : public testing::Test {
     MOCK_METHOD(void, OnFrame, (const RecordableEncodedFrame&), (override));
   };
 
+  class FrameSink : public VideoSinkInterface<VideoFrame> {
+   public:
+    void OnFrame(const VideoFrame& frame) override {}
+  };
+
   VideoRtpReceiverTest()
       : worker_thread_(Thread::Create()),
         channel_(VideoOptions()),
@@ -211,5 +219,18 @@ TEST_F(VideoRtpReceiverTest, EnablesEncodedOutputOnChannelRestart) {
   receiver_->SetupUnsignaledMediaChannel();
 }
 
+TEST_F(VideoRtpReceiverTest, PausesStreamWhileAllSinksArePaused) {
+  InSequence s;
+  EXPECT_CALL(channel_, SetSinkPaused(/*ssrc=*/0, true));
+  EXPECT_CALL(channel_, SetSinkPaused(4711, true));
+  EXPECT_CALL(channel_, SetSinkPaused(4711, false));
+  VideoSinkWants wants;
+  wants.paused = true;
+  FrameSink sink;
+  Source()->AddOrUpdateSink(&sink, wants);
+  receiver_->SetupMediaChannel(4711);
+  Source()->RemoveSink(&sink);
+}
+
 }  // namespace
 }  // namespace webrtc
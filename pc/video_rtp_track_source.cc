@@ -40,6 +40,19 @@ VideoSinkInterface<VideoFrame>* VideoRtpTrackSource::sink() {
   return &broadcaster_;
 }
 
+void VideoRtpTrackSource::AddOrUpdateSink(VideoSinkInterface<VideoFrame>* sink,
+                                          const VideoSinkWants& wants) {
+  RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
+  VideoTrackSource::AddOrUpdateSink(sink, wants);
+  UpdateSinksPaused();
+}
+
+void VideoRtpTrackSource::RemoveSink(VideoSinkInterface<VideoFrame>* sink) {
+  RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
+  VideoTrackSource::RemoveSink(sink);
+  UpdateSinksPaused();
+}
+
 void VideoRtpTrackSource::BroadcastRecordableEncodedFrame(
     const RecordableEncodedFrame& frame) const {
   MutexLock lock(&mu_);
@@ -93,4 +106,16 @@ void VideoRtpTrackSource::RemoveEncodedSink(
   }
 }
 
+void VideoRtpTrackSource::UpdateSinksPaused() {
+  RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
+  const bool paused = broadcaster_.wants().paused;
+  if (paused == sinks_paused_) {
+    return;
+  }
+  sinks_paused_ = paused;
+  if (callback_) {
+    callback_->OnSinksPaused(paused);
+  }
+}
+
 }  // namespace webrtc
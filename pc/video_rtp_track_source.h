@@ -40,6 +40,11 @@ class VideoRtpTrackSource : public VideoTrackSource {
     // frames using BroadcastEncodedFrameBuffer.
     // The implementor should cause a keyframe to be eventually generated.
     virtual void OnEncodedSinkEnabled(bool enable) = 0;
+
+    // Called when all the sinks become paused, see VideoSinkWants::paused, or
+    // when one of them no longer is. While paused, the implementor may decode
+    // only key frames.
+    virtual void OnSinksPaused(bool paused) = 0;
   };
 
   explicit VideoRtpTrackSource(Callback* callback);
@@ -60,6 +65,9 @@ class VideoRtpTrackSource : public VideoTrackSource {
   // VideoTrackSource
   VideoSourceInterface<VideoFrame>* source() override;
   VideoSinkInterface<VideoFrame>* sink();
+  void AddOrUpdateSink(VideoSinkInterface<VideoFrame>* sink,
+                       const VideoSinkWants& wants) override;
+  void RemoveSink(VideoSinkInterface<VideoFrame>* sink) override;
 
   // Returns true. This method can be called on any thread.
   bool SupportsEncodedOutput() const override;
@@ -76,6 +84,8 @@ class VideoRtpTrackSource : public VideoTrackSource {
       VideoSinkInterface<RecordableEncodedFrame>* sink) override;
 
  private:
+  void UpdateSinksPaused();
+
   RTC_NO_UNIQUE_ADDRESS SequenceChecker worker_sequence_checker_{
       SequenceChecker::kDetached};
   // `broadcaster_` is needed since the decoder can only handle one sink.
@@ -86,6 +96,7 @@ class VideoRtpTrackSource : public VideoTrackSource {
   std::vector<VideoSinkInterface<RecordableEncodedFrame>*> encoded_sinks_
       RTC_GUARDED_BY(mu_);
   Callback* callback_ RTC_GUARDED_BY(worker_sequence_checker_);
+  bool sinks_paused_ RTC_GUARDED_BY(worker_sequence_checker_) = false;
 };
 
 }  // namespace webrtc
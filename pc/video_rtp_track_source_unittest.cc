@@ -19,7 +19,9 @@
 #include "api/video/encoded_image.h"
 #include "api/video/recordable_encoded_frame.h"
 #include "api/video/video_codec_type.h"
+#include "api/video/video_frame.h"
 #include "api/video/video_sink_interface.h"
+#include "api/video/video_source_interface.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
 
@@ -30,6 +32,7 @@ class MockCallback : public VideoRtpTrackSource::Callback {
  public:
   MOCK_METHOD(void, OnGenerateKeyFrame, (), (override));
   MOCK_METHOD(void, OnEncodedSinkEnabled, (bool), (override));
+  MOCK_METHOD(void, OnSinksPaused, (bool), (override));
 };
 
 class MockSink : public VideoSinkInterface<RecordableEncodedFrame> {
@@ -111,6 +114,30 @@ TEST(VideoRtpTrackSourceTest, NoCallbacksAfterClearedCallback) {
   source->RemoveEncodedSink(&sink);
 }
 
+class FrameSink : public VideoSinkInterface<VideoFrame> {
+ public:
+  void OnFrame(const VideoFrame& /* frame */) override {}
+};
+
+TEST(VideoRtpTrackSourceTest, NotifiesWhenAllSinksArePaused) {
+  testing::StrictMock<MockCallback> mock_callback;
+  auto source = MakeSource(&mock_callback);
+  VideoSinkWants paused_wants;
+  paused_wants.paused = true;
+  FrameSink sink;
+  FrameSink sink2;
+  source->AddOrUpdateSink(&sink, VideoSinkWants());
+  source->AddOrUpdateSink(&sink2, paused_wants);
+
+  EXPECT_CALL(mock_callback, OnSinksPaused(true));
+  source->AddOrUpdateSink(&sink, paused_wants);
+  testing::Mock::VerifyAndClearExpectations(&mock_callback);
+
+  EXPECT_CALL(mock_callback, OnSinksPaused(false));
+  source->RemoveSink(&sink);
+  source->RemoveSink(&sink2);
+}
+
 class TestFrame : public RecordableEncodedFrame {
  public:
   scoped_refptr<const EncodedImageBufferInterface> encoded_buffer()
@@ -0,0 +1,267 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_tools/bwe_replay/bwe_replay.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/transport/network_control.h"
+#include "api/transport/network_types.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "logging/rtc_event_log/rtc_event_log_parser.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/time_utils.h"
+#include "rtc_tools/rtc_event_log_visualizer/log_simulation.h"
+
+namespace webrtc {
+namespace {
+
+// Records the calls made by LogBasedNetworkControllerSimulation instead of
+// acting on them.
+class RecordingNetworkController : public NetworkControllerInterface {
+ public:
+  explicit RecordingNetworkController(std::vector<BweReplayEvent>& events)
+      : events_(events) {}
+
+  NetworkControlUpdate OnNetworkRouteChange(NetworkRouteChange msg) override {
+    return Record(msg);
+  }
+  NetworkControlUpdate OnProcessInterval(ProcessInterval msg) override {
+    return Record(msg);
+  }
+  NetworkControlUpdate OnRoundTripTimeUpdate(RoundTripTimeUpdate msg) override {
+    return Record(msg);
+  }
+  NetworkControlUpdate OnSentPacket(SentPacket msg) override {
+    return Record(msg);
+  }
+  NetworkControlUpdate OnTransportLossReport(TransportLossReport msg) override {
+    return Record(msg);
+  }
+  NetworkControlUpdate OnTransportPacketsFeedback(
+      TransportPacketsFeedback msg) override {
+    return Record(msg);
+  }
+
+  // Not used by LogBasedNetworkControllerSimulation.
+  NetworkControlUpdate OnNetworkAvailability(NetworkAvailability) override {
+    return NetworkControlUpdate();
+  }
+  NetworkControlUpdate OnRemoteBitrateReport(RemoteBitrateReport) override {
+    return NetworkControlUpdate();
+  }
+  NetworkControlUpdate OnReceivedPacket(ReceivedPacket) override {
+    return NetworkControlUpdate();
+  }
+  NetworkControlUpdate OnStreamsConfig(StreamsConfig) override {
+    return NetworkControlUpdate();
+  }
+  NetworkControlUpdate OnTargetRateConstraints(
+      TargetRateConstraints) override {
+    return NetworkControlUpdate();
+  }
+  NetworkControlUpdate OnNetworkStateEstimate(NetworkStateEstimate) override {
+    return NetworkControlUpdate();
+  }
+
+ private:
+  template <typename T>
+  NetworkControlUpdate Record(T& msg) {
+    events_.emplace_back(std::move(msg));
+    return NetworkControlUpdate();
+  }
+
+  std::vector<BweReplayEvent>& events_;
+};
+
+class RecordingNetworkControllerFactory
+    : public NetworkControllerFactoryInterface {
+ public:
+  RecordingNetworkControllerFactory(BweReplayTrace& trace,
+                                    TimeDelta process_interval)
+      : trace_(trace), process_interval_(process_interval) {}
+
+  std::unique_ptr<NetworkControllerInterface> Create(
+      NetworkControllerConfig config) override {
+    trace_.initial_constraints = config.constraints;
+    return std::make_unique<RecordingNetworkController>(trace_.events);
+  }
+  TimeDelta GetProcessInterval() const override { return process_interval_; }
+
+ private:
+  BweReplayTrace& trace_;
+  const TimeDelta process_interval_;
+};
+
+struct EventDispatcher {
+  NetworkControlUpdate operator()(const NetworkRouteChange& msg) {
+    return controller.OnNetworkRouteChange(msg);
+  }
+  NetworkControlUpdate operator()(const ProcessInterval& msg) {
+    return controller.OnProcessInterval(msg);
+  }
+  NetworkControlUpdate operator()(const RoundTripTimeUpdate& msg) {
+    return controller.OnRoundTripTimeUpdate(msg);
+  }
+  NetworkControlUpdate operator()(const SentPacket& msg) {
+    return controller.OnSentPacket(msg);
+  }
+  NetworkControlUpdate operator()(const TransportLossReport& msg) {
+    return controller.OnTransportLossReport(msg);
+  }
+  NetworkControlUpdate operator()(const TransportPacketsFeedback& msg) {
+    return controller.OnTransportPacketsFeedback(msg);
+  }
+
+  NetworkControllerInterface& controller;
+};
+
+double PerSecond(int64_t count, TimeDelta duration) {
+  if (duration <= TimeDelta::Zero()) {
+    return 0.0;
+  }
+  return count / duration.seconds<double>();
+}
+
+}  // namespace
+
+BweReplayTrace ExtractBweReplayTrace(
+    const ParsedRtcEventLog& parsed_log,
+    const NetworkControllerFactoryInterface& factory) {
+  BweReplayTrace trace;
+  LogBasedNetworkControllerSimulation simulation(
+      std::make_unique<RecordingNetworkControllerFactory>(
+          trace, factory.GetProcessInterval()),
+      [](const NetworkControlUpdate&, Timestamp) {});
+  simulation.ProcessEventsInLog(parsed_log);
+  return trace;
+}
+
+double BweReplayResult::events_per_second() const {
+  return PerSecond(num_events, replay_time);
+}
+
+double BweReplayResult::target_rate_updates_per_second() const {
+  return PerSecond(num_target_rate_updates, replay_time);
+}
+
+int BweReplayResult::num_target_rate_changes() const {
+  int changes = 0;
+  for (size_t i = 1; i < target_rates.size(); ++i) {
+    if (target_rates[i].target_rate != target_rates[i - 1].target_rate) {
+      ++changes;
+    }
+  }
+  return changes;
+}
+
+BweReplayResult ReplayBweTrace(const Environment& env,
+                               const BweReplayTrace& trace,
+                               NetworkControllerFactoryInterface& factory,
+                               const BweReplayOptions& options) {
+  RTC_CHECK_GT(options.repetitions, 0);
+  BweReplayResult result;
+  // At most one target rate per event, reserved up front so that the
+  // allocations counted are the ones made by the controller.
+  std::vector<TargetRateSample> target_rates;
+  target_rates.reserve(trace.events.size());
+
+  const int64_t start_allocations =
+      options.allocation_count ? options.allocation_count() : 0;
+  const int64_t start_time_ns = TimeNanos();
+  for (int i = 0; i < options.repetitions; ++i) {
+    target_rates.clear();
+    NetworkControllerConfig config(env);
+    config.constraints = trace.initial_constraints;
+    std::unique_ptr<NetworkControllerInterface> controller =
+        factory.Create(config);
+    EventDispatcher dispatcher{.controller = *controller};
+    for (const BweReplayEvent& event : trace.events) {
+      NetworkControlUpdate update = std::visit(dispatcher, event);
+      if (update.target_rate) {
+        target_rates.push_back({.at_time = update.target_rate->at_time,
+                                .target_rate =
+                                    update.target_rate->target_rate});
+      }
+    }
+    result.num_target_rate_updates += target_rates.size();
+  }
+  result.replay_time = TimeDelta::Micros((TimeNanos() - start_time_ns) /
+                                         kNumNanosecsPerMicrosec);
+  if (options.allocation_count) {
+    result.allocations = options.allocation_count() - start_allocations;
+  }
+  result.num_events =
+      static_cast<int64_t>(trace.events.size()) * options.repetitions;
+  result.target_rates = std::move(target_rates);
+  return result;
+}
+
+TargetRateDifference CompareTargetRates(
+    const std::vector<TargetRateSample>& reference,
+    const std::vector<TargetRateSample>& test,
+    double relative_tolerance) {
+  TargetRateDifference difference;
+  std::optional<DataRate> reference_rate;
+  std::optional<DataRate> test_rate;
+  bool rates_differ = false;
+  Timestamp previous_time = Timestamp::MinusInfinity();
+  size_t i = 0;
+  size_t j = 0;
+  while (i < reference.size() || j < test.size()) {
+    Timestamp time = Timestamp::PlusInfinity();
+    if (i < reference.size()) {
+      time = std::min(time, reference[i].at_time);
+    }
+    if (j < test.size()) {
+      time = std::min(time, test[j].at_time);
+    }
+    if (reference_rate && test_rate) {
+      difference.time_compared += time - previous_time;
+      if (rates_differ) {
+        difference.time_different += time - previous_time;
+      }
+    }
+    for (; i < reference.size() && reference[i].at_time == time; ++i) {
+      reference_rate = reference[i].target_rate;
+    }
+    for (; j < test.size() && test[j].at_time == time; ++j) {
+      test_rate = test[j].target_rate;
+    }
+    previous_time = time;
+    if (!reference_rate || !test_rate) {
+      continue;
+    }
+    DataRate rate_difference = *reference_rate > *test_rate
+                                   ? *reference_rate - *test_rate
+                                   : *test_rate - *reference_rate;
+    rates_differ = rate_difference > *reference_rate * relative_tolerance;
+    if (rates_differ) {
+      difference.max_difference =
+          std::max(difference.max_difference, rate_difference);
+      if (!difference.first_difference) {
+        difference.first_difference = time;
+      }
+    }
+  }
+  return difference;
+}
+
+}  // namespace webrtc
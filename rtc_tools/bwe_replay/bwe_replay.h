@@ -0,0 +1,114 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_TOOLS_BWE_REPLAY_BWE_REPLAY_H_
+#define RTC_TOOLS_BWE_REPLAY_BWE_REPLAY_H_
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <variant>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/transport/network_control.h"
+#include "api/transport/network_types.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "logging/rtc_event_log/rtc_event_log_parser.h"
+
+namespace webrtc {
+
+// A call into NetworkControllerInterface, recorded from an event log.
+using BweReplayEvent = std::variant<NetworkRouteChange,
+                                    ProcessInterval,
+                                    RoundTripTimeUpdate,
+                                    SentPacket,
+                                    TransportLossReport,
+                                    TransportPacketsFeedback>;
+
+// The input of a network controller during a call, in the order the
+// controller sees it. Replaying a trace only runs the controller, all the
+// work of parsing the log and matching feedback to sent packets is done once
+// when the trace is extracted.
+struct BweReplayTrace {
+  // The constraints the controller is created with.
+  TargetRateConstraints initial_constraints;
+  std::vector<BweReplayEvent> events;
+};
+
+// Extracts the input of a network controller from the outgoing packets,
+// incoming feedback and ICE events in `parsed_log`, as done by
+// LogBasedNetworkControllerSimulation. ProcessInterval events are added with
+// the process interval of `factory`.
+BweReplayTrace ExtractBweReplayTrace(
+    const ParsedRtcEventLog& parsed_log,
+    const NetworkControllerFactoryInterface& factory);
+
+struct TargetRateSample {
+  Timestamp at_time = Timestamp::MinusInfinity();
+  DataRate target_rate = DataRate::Zero();
+};
+
+struct BweReplayOptions {
+  // Number of times the trace is replayed, each time with a new controller.
+  // Timing and allocations are accumulated over all repetitions.
+  int repetitions = 1;
+  // Returns the number of heap allocations made by the process so far. If set,
+  // the allocations made while replaying are reported.
+  std::function<int64_t()> allocation_count;
+};
+
+struct BweReplayResult {
+  // Number of events delivered to a controller, over all repetitions.
+  int64_t num_events = 0;
+  // Number of target rate updates, over all repetitions.
+  int64_t num_target_rate_updates = 0;
+  // Wall time spent replaying, including creating the controllers.
+  TimeDelta replay_time = TimeDelta::Zero();
+  std::optional<int64_t> allocations;
+  // The target rate updates of the last repetition.
+  std::vector<TargetRateSample> target_rates;
+
+  double events_per_second() const;
+  double target_rate_updates_per_second() const;
+  // Number of target rate updates in `target_rates` that changed the rate.
+  int num_target_rate_changes() const;
+};
+
+// Replays `trace` on controllers created by `factory`, as fast as possible.
+BweReplayResult ReplayBweTrace(const Environment& env,
+                               const BweReplayTrace& trace,
+                               NetworkControllerFactoryInterface& factory,
+                               const BweReplayOptions& options);
+
+struct TargetRateDifference {
+  // Time during which both series have a target rate.
+  TimeDelta time_compared = TimeDelta::Zero();
+  // Part of `time_compared` during which the rates differ by more than the
+  // tolerance.
+  TimeDelta time_different = TimeDelta::Zero();
+  DataRate max_difference = DataRate::Zero();
+  // Start of the first period in which the rates differ.
+  std::optional<Timestamp> first_difference;
+};
+
+// Compares two series of target rate updates as step functions, e.g. the
+// output of two versions of a controller replaying the same trace. Rates that
+// differ by at most `relative_tolerance` of `reference` are considered equal.
+TargetRateDifference CompareTargetRates(
+    const std::vector<TargetRateSample>& reference,
+    const std::vector<TargetRateSample>& test,
+    double relative_tolerance);
+
+}  // namespace webrtc
+
+#endif  // RTC_TOOLS_BWE_REPLAY_BWE_REPLAY_H_
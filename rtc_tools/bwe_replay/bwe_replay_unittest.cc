@@ -0,0 +1,159 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_tools/bwe_replay/bwe_replay.h"
+
+#include <cstdint>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/transport/goog_cc_factory.h"
+#include "api/transport/network_types.h"
+#include "api/units/data_rate.h"
+#include "api/units/data_size.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "logging/rtc_event_log/rtc_event_log_parser.h"
+#include "test/gtest.h"
+#include "test/testsupport/file_utils.h"
+
+namespace webrtc {
+namespace {
+
+constexpr Timestamp kStartTime = Timestamp::Seconds(1000);
+constexpr TimeDelta kProcessInterval = TimeDelta::Millis(25);
+constexpr TimeDelta kPacketInterval = TimeDelta::Millis(5);
+constexpr TimeDelta kFeedbackInterval = TimeDelta::Millis(50);
+constexpr TimeDelta kOneWayDelay = TimeDelta::Millis(20);
+constexpr DataSize kPacketSize = DataSize::Bytes(1200);
+
+// Packets sent at a constant rate over a link without queuing or loss.
+BweReplayTrace CreateConstantRateTrace(TimeDelta duration) {
+  BweReplayTrace trace;
+  trace.initial_constraints.at_time = kStartTime;
+  trace.initial_constraints.min_data_rate = DataRate::KilobitsPerSec(30);
+  trace.initial_constraints.starting_rate = DataRate::KilobitsPerSec(300);
+
+  int64_t sequence_number = 0;
+  Timestamp next_process = kStartTime;
+  Timestamp next_feedback = kStartTime + kFeedbackInterval;
+  TransportPacketsFeedback feedback;
+  for (Timestamp now = kStartTime; now < kStartTime + duration;
+       now += kPacketInterval) {
+    if (now >= next_process) {
+      trace.events.push_back(ProcessInterval{.at_time = now});
+      next_process += kProcessInterval;
+    }
+    if (now >= next_feedback) {
+      feedback.feedback_time = now;
+      trace.events.push_back(feedback);
+      feedback.packet_feedbacks.clear();
+      next_feedback += kFeedbackInterval;
+    }
+    SentPacket sent_packet;
+    sent_packet.send_time = now;
+    sent_packet.size = kPacketSize;
+    sent_packet.sequence_number = sequence_number++;
+    trace.events.push_back(sent_packet);
+
+    PacketResult result;
+    result.sent_packet = sent_packet;
+    result.receive_time = now + kOneWayDelay;
+    feedback.packet_feedbacks.push_back(result);
+  }
+  return trace;
+}
+
+TEST(BweReplayTest, ReplaysTraceOnController) {
+  BweReplayTrace trace = CreateConstantRateTrace(TimeDelta::Seconds(10));
+  GoogCcNetworkControllerFactory factory;
+  int64_t allocations = 0;
+  BweReplayResult result =
+      ReplayBweTrace(CreateEnvironment(), trace, factory,
+                     {.repetitions = 3,
+                      .allocation_count = [&] { return allocations++; }});
+
+  EXPECT_EQ(result.num_events, static_cast<int64_t>(trace.events.size()) * 3);
+  ASSERT_FALSE(result.target_rates.empty());
+  EXPECT_EQ(result.num_target_rate_updates,
+            static_cast<int64_t>(result.target_rates.size()) * 3);
+  EXPECT_GT(result.num_target_rate_changes(), 0);
+  EXPECT_EQ(result.allocations, 1);
+  EXPECT_GE(result.events_per_second(), 0.0);
+}
+
+TEST(BweReplayTest, ReplayIsDeterministic) {
+  BweReplayTrace trace = CreateConstantRateTrace(TimeDelta::Seconds(10));
+  GoogCcNetworkControllerFactory factory;
+  BweReplayResult first =
+      ReplayBweTrace(CreateEnvironment(), trace, factory, {});
+  BweReplayResult second =
+      ReplayBweTrace(CreateEnvironment(), trace, factory, {});
+
+  TargetRateDifference difference = CompareTargetRates(
+      first.target_rates, second.target_rates, /*relative_tolerance=*/0.0);
+  EXPECT_FALSE(difference.first_difference.has_value());
+  EXPECT_EQ(difference.time_different, TimeDelta::Zero());
+  EXPECT_GT(difference.time_compared, TimeDelta::Seconds(9));
+}
+
+TEST(BweReplayTest, CompareTargetRatesFindsDifferences) {
+  std::vector<TargetRateSample> reference = {
+      {.at_time = kStartTime, .target_rate = DataRate::KilobitsPerSec(300)},
+      {.at_time = kStartTime + TimeDelta::Seconds(1),
+       .target_rate = DataRate::KilobitsPerSec(500)},
+      {.at_time = kStartTime + TimeDelta::Seconds(4),
+       .target_rate = DataRate::KilobitsPerSec(500)}};
+  std::vector<TargetRateSample> test = {
+      {.at_time = kStartTime, .target_rate = DataRate::KilobitsPerSec(300)},
+      {.at_time = kStartTime + TimeDelta::Seconds(2),
+       .target_rate = DataRate::KilobitsPerSec(540)},
+      {.at_time = kStartTime + TimeDelta::Seconds(3),
+       .target_rate = DataRate::KilobitsPerSec(510)}};
+
+  TargetRateDifference difference =
+      CompareTargetRates(reference, test, /*relative_tolerance=*/0.0);
+  EXPECT_EQ(difference.time_compared, TimeDelta::Seconds(4));
+  EXPECT_EQ(difference.time_different, TimeDelta::Seconds(3));
+  EXPECT_EQ(difference.max_difference, DataRate::KilobitsPerSec(200));
+  EXPECT_EQ(difference.first_difference, kStartTime + TimeDelta::Seconds(1));
+
+  // Only the 300 vs 500 kbps period is outside a 10% tolerance.
+  difference = CompareTargetRates(reference, test, /*relative_tolerance=*/0.1);
+  EXPECT_EQ(difference.time_different, TimeDelta::Seconds(1));
+  EXPECT_EQ(difference.max_difference, DataRate::KilobitsPerSec(200));
+}
+
+TEST(BweReplayTest, ExtractsControllerInputFromEventLog) {
+  ParsedRtcEventLog parsed_log;
+  ASSERT_TRUE(parsed_log
+                  .ParseFile(test::ResourcePath(
+                      "rtc_event_log/rtc_event_log_500kbps", "binarypb"))
+                  .ok());
+  GoogCcNetworkControllerFactory factory;
+  BweReplayTrace trace = ExtractBweReplayTrace(parsed_log, factory);
+
+  int num_feedbacks = 0;
+  for (const BweReplayEvent& event : trace.events) {
+    num_feedbacks += std::holds_alternative<TransportPacketsFeedback>(event);
+  }
+  EXPECT_GT(num_feedbacks, 0);
+  EXPECT_TRUE(trace.initial_constraints.starting_rate.has_value());
+
+  BweReplayResult result =
+      ReplayBweTrace(CreateEnvironment(), trace, factory, {});
+  EXPECT_FALSE(result.target_rates.empty());
+}
+
+}  // namespace
+}  // namespace webrtc
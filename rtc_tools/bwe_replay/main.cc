@@ -0,0 +1,231 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/flags/usage.h"
+#include "absl/strings/string_view.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/field_trials.h"
+#include "api/transport/goog_cc_factory.h"
+#include "api/units/data_rate.h"
+#include "api/units/timestamp.h"
+#include "logging/rtc_event_log/rtc_event_log_parser.h"
+#include "rtc_base/logging.h"
+#include "rtc_tools/bwe_replay/bwe_replay.h"
+
+ABSL_FLAG(int,
+          repetitions,
+          10,
+          "Number of times the trace is replayed when measuring speed.");
+
+ABSL_FLAG(
+    std::string,
+    force_fieldtrials,
+    "",
+    "Field trials control experimental feature code which can be forced. "
+    "E.g. running with --force_fieldtrials=WebRTC-FooFeature/Enabled/"
+    " will assign the group Enable to field trial WebRTC-FooFeature. Multiple "
+    "trials are separated by \"/\"");
+
+ABSL_FLAG(std::string,
+          output_target_rates,
+          "",
+          "If set, the target rates are written to this file, one "
+          "'<time_us> <target_bps>' pair per line.");
+
+ABSL_FLAG(std::string,
+          reference_target_rates,
+          "",
+          "If set, the target rates are compared to the ones in this file, as "
+          "written by --output_target_rates by another version.");
+
+ABSL_FLAG(double,
+          tolerance,
+          0.0,
+          "Relative difference between target rates that is not reported "
+          "when comparing to --reference_target_rates.");
+
+namespace {
+
+std::atomic<int64_t> allocation_count{0};
+
+int64_t GetAllocationCount() {
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+bool WriteTargetRates(const std::vector<webrtc::TargetRateSample>& samples,
+                      const std::string& file_name) {
+  FILE* file = fopen(file_name.c_str(), "w");
+  if (file == nullptr) {
+    return false;
+  }
+  for (const webrtc::TargetRateSample& sample : samples) {
+    fprintf(file, "%" PRId64 " %" PRId64 "\n", sample.at_time.us(),
+            sample.target_rate.bps());
+  }
+  fclose(file);
+  return true;
+}
+
+std::optional<std::vector<webrtc::TargetRateSample>> ReadTargetRates(
+    const std::string& file_name) {
+  FILE* file = fopen(file_name.c_str(), "r");
+  if (file == nullptr) {
+    return std::nullopt;
+  }
+  std::vector<webrtc::TargetRateSample> samples;
+  int64_t time_us;
+  int64_t target_bps;
+  while (fscanf(file, "%" SCNd64 " %" SCNd64, &time_us, &target_bps) == 2) {
+    samples.push_back(
+        {.at_time = webrtc::Timestamp::Micros(time_us),
+         .target_rate = webrtc::DataRate::BitsPerSec(target_bps)});
+  }
+  fclose(file);
+  return samples;
+}
+
+}  // namespace
+
+// Counts every allocation made by the process, to report the allocations made
+// by the network controller while replaying.
+void* operator new(size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  void* p = malloc(size == 0 ? 1 : size);
+  if (p == nullptr) {
+    abort();
+  }
+  return p;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+  free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+  free(p);
+}
+
+// Replays the network controller input extracted from an RTC event log on
+// GoogCcNetworkController, without the rest of the call, and reports how fast
+// it runs and the target rates it produces.
+int main(int argc, char* argv[]) {
+  absl::SetProgramUsageMessage(
+      "A tool for measuring the speed and output of the GoogCC network\n"
+      "controller on the feedback recorded in a WebRTC event log.\n"
+      "\n"
+      "Example usage:\n"
+      "./bwe_replay --output_target_rates=new.txt <inputfile>\n"
+      "./bwe_replay --reference_target_rates=old.txt <inputfile>\n");
+  std::vector<char*> args = absl::ParseCommandLine(argc, argv);
+  if (args.size() != 2) {
+    absl::string_view usage = absl::ProgramUsageMessage();
+    fwrite(usage.data(), usage.size(), 1, stderr);
+    return 1;
+  }
+
+  // Print RTC_LOG warnings and errors even in release builds.
+  if (webrtc::LogMessage::GetLogToDebug() > webrtc::LS_WARNING) {
+    webrtc::LogMessage::LogToDebug(webrtc::LS_WARNING);
+  }
+  webrtc::LogMessage::SetLogToStderr(true);
+
+  webrtc::ParsedRtcEventLog parsed_log(
+      webrtc::ParsedRtcEventLog::UnconfiguredHeaderExtensions::
+          kAttemptWebrtcDefaultConfig);
+  auto status = parsed_log.ParseFile(args[1]);
+  if (!status.ok()) {
+    fprintf(stderr, "Failed to parse %s: %s\n", args[1],
+            std::string(status.message()).c_str());
+    return 1;
+  }
+
+  webrtc::GoogCcNetworkControllerFactory factory;
+  webrtc::BweReplayTrace trace =
+      webrtc::ExtractBweReplayTrace(parsed_log, factory);
+  printf("Extracted %zu controller events.\n", trace.events.size());
+
+  webrtc::Environment env =
+      webrtc::CreateEnvironment(std::make_unique<webrtc::FieldTrials>(
+          absl::GetFlag(FLAGS_force_fieldtrials)));
+  webrtc::BweReplayResult result = webrtc::ReplayBweTrace(
+      env, trace, factory,
+      {.repetitions = absl::GetFlag(FLAGS_repetitions),
+       .allocation_count = &GetAllocationCount});
+  printf("Replayed %d times in %.3f s.\n", absl::GetFlag(FLAGS_repetitions),
+         result.replay_time.seconds<double>());
+  printf("  events/s:               %.0f\n", result.events_per_second());
+  printf("  target rate updates/s:  %.0f\n",
+         result.target_rate_updates_per_second());
+  if (result.num_events > 0) {
+    printf("  allocations/event:      %.2f\n",
+           static_cast<double>(*result.allocations) / result.num_events);
+  }
+  printf("  target rate updates:    %zu (%d changes)\n",
+         result.target_rates.size(), result.num_target_rate_changes());
+
+  std::string output_file = absl::GetFlag(FLAGS_output_target_rates);
+  if (!output_file.empty() &&
+      !WriteTargetRates(result.target_rates, output_file)) {
+    fprintf(stderr, "Failed to write %s\n", output_file.c_str());
+    return 1;
+  }
+
+  std::string reference_file = absl::GetFlag(FLAGS_reference_target_rates);
+  if (reference_file.empty()) {
+    return 0;
+  }
+  std::optional<std::vector<webrtc::TargetRateSample>> reference =
+      ReadTargetRates(reference_file);
+  if (!reference) {
+    fprintf(stderr, "Failed to read %s\n", reference_file.c_str());
+    return 1;
+  }
+  webrtc::TargetRateDifference difference = webrtc::CompareTargetRates(
+      *reference, result.target_rates, absl::GetFlag(FLAGS_tolerance));
+  if (!difference.first_difference) {
+    printf("Target rates match the reference.\n");
+    return 0;
+  }
+  printf("Target rates differ from the reference:\n");
+  printf("  first difference at:    %.3f s\n",
+         difference.first_difference->seconds<double>());
+  printf("  time different:         %.3f s of %.3f s\n",
+         difference.time_different.seconds<double>(),
+         difference.time_compared.seconds<double>());
+  printf("  max difference:         %" PRId64 " kbps\n",
+         difference.max_difference.kbps());
+  return 2;
+}
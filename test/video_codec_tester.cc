@@ -78,12 +78,14 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/event.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/platform_thread.h"
 #include "rtc_base/strings/string_builder.h"
 #include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/system/file_wrapper.h"
 #include "rtc_base/task_queue_for_test.h"
 #include "rtc_base/thread_annotations.h"
 #include "rtc_base/time_utils.h"
+#include "system_wrappers/include/cpu_info.h"
 #include "system_wrappers/include/sleep.h"
 #include "test/testsupport/file_utils.h"
 #include "test/testsupport/frame_reader.h"
@@ -134,6 +136,50 @@ scoped_refptr<VideoFrameBuffer> ScaleFrame(
   return buffer->Scale(scaled_width, scaled_height);
 }
 
+// Returns the parts of `frame` that differ from `prev_frame`, as one rect per
+// run of rows of 16x16 luma blocks with the same changed columns.
+std::vector<VideoFrame::UpdateRect> DetectUpdateRegion(
+    const I420BufferInterface& prev_frame,
+    const I420BufferInterface& frame) {
+  constexpr int kBlockSize = 16;
+  std::vector<VideoFrame::UpdateRect> update_region;
+  for (int y = 0; y < frame.height(); y += kBlockSize) {
+    const int block_height = std::min(kBlockSize, frame.height() - y);
+    int first_changed_x = -1;
+    int end_changed_x = -1;
+    for (int x = 0; x < frame.width(); x += kBlockSize) {
+      const int block_width = std::min(kBlockSize, frame.width() - x);
+      for (int row = y; row < y + block_height; ++row) {
+        if (memcmp(prev_frame.DataY() + row * prev_frame.StrideY() + x,
+                   frame.DataY() + row * frame.StrideY() + x,
+                   block_width) != 0) {
+          if (first_changed_x < 0) {
+            first_changed_x = x;
+          }
+          end_changed_x = x + block_width;
+          break;
+        }
+      }
+    }
+    if (first_changed_x < 0) {
+      continue;
+    }
+    VideoFrame::UpdateRect rect = {.offset_x = first_changed_x,
+                                   .offset_y = y,
+                                   .width = end_changed_x - first_changed_x,
+                                   .height = block_height};
+    if (!update_region.empty() &&
+        update_region.back().offset_x == rect.offset_x &&
+        update_region.back().width == rect.width &&
+        update_region.back().offset_y + update_region.back().height == y) {
+      update_region.back().height += block_height;
+    } else {
+      update_region.push_back(rect);
+    }
+  }
+  return update_region;
+}
+
 // A video source that reads frames from YUV, Y4M or IVF (compressed with VPx,
 // AV1 or H264) files.
 class VideoSource {
@@ -184,11 +230,21 @@ class VideoSource {
 
     scoped_refptr<VideoFrameBuffer> buffer = ScaleFrame(
         last_frame_, output_resolution.width, output_resolution.height);
-    return VideoFrame::Builder()
-        .set_video_frame_buffer(buffer)
-        .set_rtp_timestamp(timestamp_rtp)
-        .set_timestamp_us((timestamp_rtp / k90kHz).us())
-        .build();
+    VideoFrame frame = VideoFrame::Builder()
+                           .set_video_frame_buffer(buffer)
+                           .set_rtp_timestamp(timestamp_rtp)
+                           .set_timestamp_us((timestamp_rtp / k90kHz).us())
+                           .build();
+    if (source_settings_.detect_update_regions) {
+      scoped_refptr<I420BufferInterface> i420_buffer = buffer->ToI420();
+      if (last_output_ && last_output_->width() == i420_buffer->width() &&
+          last_output_->height() == i420_buffer->height()) {
+        frame.set_update_region(
+            DetectUpdateRegion(*last_output_, *i420_buffer));
+      }
+      last_output_ = i420_buffer;
+    }
+    return frame;
   }
 
  private:
@@ -196,6 +252,8 @@ class VideoSource {
   std::unique_ptr<FrameReader> yuv_reader_;
   std::unique_ptr<FrameGeneratorInterface> ivf_reader_;
   scoped_refptr<VideoFrameBuffer> last_frame_;
+  // Last output frame, used to detect update regions.
+  scoped_refptr<I420BufferInterface> last_output_;
   // Time delta between the source and output video. Used for frame rate
   // scaling. This value increases by the source frame duration each time a
   // frame is read from the source, and decreases by the output frame duration
@@ -533,6 +591,7 @@ class VideoCodecAnalyzer : public VideoCodecTester::VideoCodecStats {
                 ->ToI420();
         Frame& frame = frames_.at(timestamp_rtp).at(spatial_idx);
         frame.psnr = CalcPsnr(*decoded_buffer, *ref_buffer);
+        frame.ssim = CalcSsim(*decoded_buffer, *ref_buffer);
       });
     }
   }
@@ -644,6 +703,9 @@ class VideoCodecAnalyzer : public VideoCodecTester::VideoCodecStats {
         stream.psnr.u.AddSample(StatsSample(frame.psnr->u, time));
         stream.psnr.v.AddSample(StatsSample(frame.psnr->v, time));
       }
+      if (frame.ssim) {
+        stream.ssim.AddSample(StatsSample(*frame.ssim, time));
+      }
       if (frame.target_framerate) {
         stream.target_framerate_fps.AddSample(
             StatsSample(frame.target_framerate->hertz<double>(), time));
@@ -803,6 +865,18 @@ class VideoCodecAnalyzer : public VideoCodecTester::VideoCodecStats {
     return psnr;
   }
 
+  double CalcSsim(const I420BufferInterface& ref_buffer,
+                  const I420BufferInterface& dec_buffer) {
+    RTC_CHECK_EQ(ref_buffer.width(), dec_buffer.width());
+    RTC_CHECK_EQ(ref_buffer.height(), dec_buffer.height());
+    return libyuv::I420Ssim(
+        ref_buffer.DataY(), ref_buffer.StrideY(), ref_buffer.DataU(),
+        ref_buffer.StrideU(), ref_buffer.DataV(), ref_buffer.StrideV(),
+        dec_buffer.DataY(), dec_buffer.StrideY(), dec_buffer.DataU(),
+        dec_buffer.StrideU(), dec_buffer.DataV(), dec_buffer.StrideV(),
+        dec_buffer.width(), dec_buffer.height());
+  }
+
   DataRate GetTargetBitrate(const EncodingSettings& encoding_settings,
                             std::optional<LayerId> layer_id) const {
     int base_spatial_idx;
@@ -993,7 +1067,8 @@ class Encoder : public EncodedImageCallback {
       : env_(env),
         encoder_factory_(encoder_factory),
         analyzer_(analyzer),
-        pacer_(encoder_settings.pacing_settings) {
+        pacer_(encoder_settings.pacing_settings),
+        number_of_cores_(encoder_settings.number_of_cores) {
     RTC_CHECK(analyzer_) << "Analyzer must be provided";
 
     if (encoder_settings.encoder_input_base_path) {
@@ -1214,7 +1289,7 @@ class Encoder : public EncodedImageCallback {
 
     VideoEncoder::Settings ves(
         VideoEncoder::Capabilities(/*loss_notification=*/false),
-        /*number_of_cores=*/1,
+        number_of_cores_,
         /*max_payload_size=*/1440);
 
     int result = encoder_->InitEncode(&vc, ves);
@@ -1305,6 +1380,7 @@ class Encoder : public EncodedImageCallback {
   std::unique_ptr<VideoEncoder> encoder_;
   VideoCodecAnalyzer* const analyzer_;
   Pacer pacer_;
+  const int number_of_cores_;
   std::optional<EncodingSettings> last_encoding_settings_;
   std::unique_ptr<VideoBitrateAllocator> bitrate_allocator_;
   LimitedTaskQueue task_queue_;
@@ -1570,6 +1646,8 @@ void VideoCodecStats::Stream::LogMetrics(
   logger->LogMetric(prefix + "psnr_v_db", test_case_name, psnr.v,
                     Unit::kUnitless, ImprovementDirection::kBiggerIsBetter,
                     metadata);
+  logger->LogMetric(prefix + "ssim", test_case_name, ssim, Unit::kUnitless,
+                    ImprovementDirection::kBiggerIsBetter, metadata);
 }
 
 EncodingSettings VideoCodecTester::CreateEncodingSettings(
@@ -1736,5 +1814,38 @@ VideoCodecTester::RunEncodeDecodeTest(
   return std::move(analyzer);
 }
 
+std::vector<std::unique_ptr<VideoCodecTester::VideoCodecStats>>
+VideoCodecTester::RunEncodeDecodeTests(
+    const Environment& env,
+    const std::vector<EncodeDecodeJob>& jobs,
+    VideoEncoderFactory* encoder_factory,
+    VideoDecoderFactory* decoder_factory,
+    std::optional<int> num_workers) {
+  std::vector<std::unique_ptr<VideoCodecStats>> stats(jobs.size());
+  const int num_threads = std::min<int>(
+      num_workers.value_or(CpuInfo::DetectNumberOfCores()), jobs.size());
+  RTC_CHECK(jobs.empty() || num_threads > 0);
+
+  // Each worker runs the next job that has not been started until all jobs
+  // are started. Every job writes its own element of `stats`.
+  std::atomic<size_t> next_job(0);
+  std::vector<PlatformThread> workers;
+  for (int i = 0; i < num_threads; ++i) {
+    workers.push_back(PlatformThread::SpawnJoinable(
+        [&] {
+          for (size_t job = next_job++; job < jobs.size(); job = next_job++) {
+            stats[job] = RunEncodeDecodeTest(
+                env, jobs[job].source_settings, encoder_factory,
+                decoder_factory, jobs[job].encoder_settings,
+                jobs[job].decoder_settings, jobs[job].encoding_settings);
+          }
+        },
+        "VideoCodecTesterWorker" + std::to_string(i)));
+  }
+  // Joins the workers.
+  workers.clear();
+  return stats;
+}
+
 }  // namespace test
 }  // namespace webrtc
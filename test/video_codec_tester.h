@@ -94,6 +94,8 @@ class VideoCodecTester {
         double v = 0.0;
       };
       std::optional<Psnr> psnr;
+      // SSIM of the Y, U and V planes, weighted like libyuv::I420Ssim().
+      std::optional<double> ssim;
     };
 
     struct Stream {
@@ -117,6 +119,7 @@ class VideoCodecTester {
         SamplesStatsCounter u;
         SamplesStatsCounter v;
       } psnr;
+      SamplesStatsCounter ssim;
 
       // Logs `Stream` metrics to provided `MetricsLogger`.
       void LogMetrics(MetricsLogger* logger,
@@ -162,6 +165,9 @@ class VideoCodecTester {
     std::string file_path;
     Resolution resolution;
     Frequency framerate;
+    // If true, source frames carry the region that changed since the previous
+    // frame, detected in 16x16 luma blocks, like a screen capturer reports it.
+    bool detect_update_regions = false;
   };
 
   struct DecoderSettings {
@@ -172,10 +178,20 @@ class VideoCodecTester {
 
   struct EncoderSettings {
     PacingSettings pacing_settings;
+    // Number of cores the encoder may use.
+    int number_of_cores = 1;
     std::optional<std::string> encoder_input_base_path;
     std::optional<std::string> encoder_output_base_path;
   };
 
+  // Settings of one encode and decode session of a batch.
+  struct EncodeDecodeJob {
+    VideoSourceSettings source_settings;
+    EncoderSettings encoder_settings;
+    DecoderSettings decoder_settings;
+    std::map<uint32_t, EncodingSettings> encoding_settings;
+  };
+
   virtual ~VideoCodecTester() = default;
 
   // Interface for a coded video frames source.
@@ -236,6 +252,20 @@ class VideoCodecTester {
       const EncoderSettings& encoder_settings,
       const DecoderSettings& decoder_settings,
       const std::map<uint32_t, EncodingSettings>& encoding_settings);
+
+  // Runs the sessions of `jobs` like RunEncodeDecodeTest(), up to
+  // `num_workers` at a time, and returns their metrics in the order of `jobs`.
+  // Each session is pipelined over its own threads but rarely keeps more than
+  // a few cores busy, so a sweep over many videos and bitrates finishes much
+  // sooner when the sessions run side by side. If `num_workers` is not set,
+  // as many sessions as there are cores run at a time. The factories are used
+  // by all sessions at once and must be thread safe.
+  static std::vector<std::unique_ptr<VideoCodecStats>> RunEncodeDecodeTests(
+      const Environment& env,
+      const std::vector<EncodeDecodeJob>& jobs,
+      VideoEncoderFactory* encoder_factory,
+      VideoDecoderFactory* decoder_factory,
+      std::optional<int> num_workers = std::nullopt);
 };
 
 }  // namespace test
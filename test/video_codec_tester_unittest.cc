@@ -916,6 +916,60 @@ INSTANTIATE_TEST_SUITE_P(
                 DataRate::KilobitsPerSec(700), DataRate::KilobitsPerSec(800),
                 DataRate::KilobitsPerSec(900)}}));
 
+TEST(VideoCodecTester, RunEncodeDecodeTestsReturnsStatsInJobOrder) {
+  const Environment env = CreateEnvironment();
+  constexpr int kNumJobs = 5;
+  std::string yuv_path = CreateYuvFile(kWidth, kHeight, kNumJobs);
+
+  NiceMock<MockVideoEncoderFactory> encoder_factory;
+  ON_CALL(encoder_factory, Create).WillByDefault(WithoutArgs([] {
+    std::vector<std::vector<Frame>> encoded_frames(
+        kNumJobs, {{.frame_size = DataSize::Bytes(1)}});
+    return std::make_unique<NiceMock<TestVideoEncoder>>(ScalabilityMode::kL1T1,
+                                                        encoded_frames);
+  }));
+  NiceMock<MockVideoDecoderFactory> decoder_factory;
+  ON_CALL(decoder_factory, Create).WillByDefault(WithoutArgs([] {
+    return std::make_unique<NiceMock<TestVideoDecoder>>();
+  }));
+
+  EncodingSettings encoding_settings = {
+      .layers_settings = {{LayerId{.spatial_idx = 0, .temporal_idx = 0},
+                           LayerSettings{.resolution = {.width = kWidth,
+                                                        .height = kHeight},
+                                         .framerate = kFramerate,
+                                         .bitrate = kBitrate}}}};
+  // Job `i` encodes `i + 1` frames.
+  std::vector<VideoCodecTester::EncodeDecodeJob> jobs;
+  for (int i = 0; i < kNumJobs; ++i) {
+    jobs.push_back(
+        {.source_settings = {.file_path = yuv_path,
+                             .resolution = {.width = kWidth,
+                                            .height = kHeight},
+                             .framerate = kFramerate},
+         .encoding_settings =
+             VideoCodecTester::CreateFrameSettings(encoding_settings, i + 1)});
+  }
+
+  std::vector<std::unique_ptr<VideoCodecStats>> stats =
+      VideoCodecTester::RunEncodeDecodeTests(env, jobs, &encoder_factory,
+                                             &decoder_factory,
+                                             /*num_workers=*/2);
+  remove(yuv_path.c_str());
+
+  ASSERT_THAT(stats, SizeIs(kNumJobs));
+  for (int i = 0; i < kNumJobs; ++i) {
+    ASSERT_NE(stats[i], nullptr);
+    std::vector<Frame> slice = stats[i]->Slice(Filter{}, /*merge=*/false);
+    EXPECT_THAT(slice, SizeIs(i + 1));
+    for (const Frame& frame : slice) {
+      EXPECT_TRUE(frame.decoded);
+      EXPECT_TRUE(frame.psnr.has_value());
+      EXPECT_TRUE(frame.ssim.has_value());
+    }
+  }
+}
+
 // TODO(webrtc:42225151): Add an IVF test stream and enable the test.
 TEST(VideoCodecTester, DISABLED_CompressedVideoSource) {
   const Environment env = CreateEnvironment();
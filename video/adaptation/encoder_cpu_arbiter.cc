@@ -0,0 +1,264 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/adaptation/encoder_cpu_arbiter.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "absl/algorithm/container.h"
+#include "absl/strings/string_view.h"
+#include "api/adaptation/resource.h"
+#include "api/make_ref_counted.h"
+#include "api/scoped_refptr.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/task_utils/repeating_task.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+namespace {
+
+// Expected encode usage after one adaptation step relative to before it.
+// VideoStreamAdapter steps the resolution down to 3/5 of the pixels and the
+// frame rate down to 2/3.
+constexpr double kUsagePerAdaptationStep = 0.6;
+
+}  // namespace
+
+EncoderCpuArbiter::Share::Share(absl::string_view name,
+                                double priority,
+                                int num_viewers)
+    : name_(name), priority_(priority), num_viewers_(num_viewers) {
+  RTC_DCHECK_GT(priority, 0.0);
+}
+
+EncoderCpuArbiter::Share::~Share() = default;
+
+void EncoderCpuArbiter::Share::SetPriority(double priority) {
+  RTC_DCHECK_GT(priority, 0.0);
+  MutexLock lock(&mutex_);
+  priority_ = priority;
+}
+
+void EncoderCpuArbiter::Share::SetNumViewers(int num_viewers) {
+  MutexLock lock(&mutex_);
+  num_viewers_ = num_viewers;
+}
+
+double EncoderCpuArbiter::Share::weight() const {
+  MutexLock lock(&mutex_);
+  return priority_ * std::max(num_viewers_, 1);
+}
+
+void EncoderCpuArbiter::Share::SetResourceListener(
+    ResourceListener* listener) {
+  MutexLock lock(&mutex_);
+  listener_ = listener;
+}
+
+void EncoderCpuArbiter::Share::OnEncodeCompleted(TimeDelta encode_duration) {
+  MutexLock lock(&mutex_);
+  encode_time_ += encode_duration;
+}
+
+TimeDelta EncoderCpuArbiter::Share::TakeEncodeTime() {
+  MutexLock lock(&mutex_);
+  TimeDelta encode_time = encode_time_;
+  encode_time_ = TimeDelta::Zero();
+  return encode_time;
+}
+
+void EncoderCpuArbiter::Share::ReportUsage(ResourceUsageState usage_state) {
+  MutexLock lock(&mutex_);
+  if (listener_) {
+    listener_->OnResourceUsageStateMeasured(scoped_refptr<Resource>(this),
+                                            usage_state);
+  }
+}
+
+EncoderCpuArbiter::EncoderCpuArbiter(Clock* clock,
+                                     TaskQueueBase* task_queue,
+                                     Config config)
+    : clock_(clock),
+      task_queue_(task_queue),
+      config_(config),
+      last_evaluation_(clock->CurrentTime()) {
+  RTC_DCHECK_RUN_ON(task_queue_);
+  RTC_DCHECK_GT(config_.num_cores, 0.0);
+  RTC_DCHECK_LT(config_.underuse_fraction, config_.overuse_fraction);
+  repeating_task_ = RepeatingTaskHandle::DelayedStart(
+      task_queue_, config_.evaluation_interval, [this] { return Evaluate(); },
+      TaskQueueBase::DelayPrecision::kLow, clock_);
+}
+
+EncoderCpuArbiter::~EncoderCpuArbiter() {
+  RTC_DCHECK_RUN_ON(task_queue_);
+  repeating_task_.Stop();
+}
+
+scoped_refptr<EncoderCpuArbiter::Share> EncoderCpuArbiter::AddEncoder(
+    absl::string_view name,
+    double priority,
+    int num_viewers) {
+  auto share = make_ref_counted<Share>(name, priority, num_viewers);
+  MutexLock lock(&mutex_);
+  encoders_.push_back({.share = share});
+  return share;
+}
+
+void EncoderCpuArbiter::RemoveEncoder(const scoped_refptr<Share>& share) {
+  MutexLock lock(&mutex_);
+  auto it = absl::c_find_if(encoders_, [&](const Encoder& encoder) {
+    return encoder.share == share;
+  });
+  RTC_DCHECK(it != encoders_.end());
+  if (it != encoders_.end()) {
+    encoders_.erase(it);
+  }
+}
+
+double EncoderCpuArbiter::cpu_usage() const {
+  MutexLock lock(&mutex_);
+  return cpu_usage_;
+}
+
+bool EncoderCpuArbiter::IsHeld(const Encoder& encoder, Timestamp now) const {
+  return encoder.last_adaptation.has_value() &&
+         now - *encoder.last_adaptation < config_.adaptation_hold_time;
+}
+
+void EncoderCpuArbiter::Allocate(double budget) {
+  std::vector<Encoder*> unsatisfied;
+  for (Encoder& encoder : encoders_) {
+    encoder.allocation = 0.0;
+    unsatisfied.push_back(&encoder);
+  }
+  double remaining = budget;
+  while (!unsatisfied.empty()) {
+    double total_weight = 0.0;
+    for (const Encoder* encoder : unsatisfied) {
+      total_weight += encoder->weight;
+    }
+    auto satisfied =
+        std::stable_partition(unsatisfied.begin(), unsatisfied.end(),
+                              [&](const Encoder* encoder) {
+                                return encoder->demand >
+                                       remaining * encoder->weight /
+                                           total_weight;
+                              });
+    if (satisfied == unsatisfied.end()) {
+      for (Encoder* encoder : unsatisfied) {
+        encoder->allocation = remaining * encoder->weight / total_weight;
+      }
+      return;
+    }
+    for (auto it = satisfied; it != unsatisfied.end(); ++it) {
+      (*it)->allocation = (*it)->demand;
+      remaining -= (*it)->demand;
+    }
+    unsatisfied.erase(satisfied, unsatisfied.end());
+  }
+}
+
+TimeDelta EncoderCpuArbiter::Evaluate() {
+  RTC_DCHECK_RUN_ON(task_queue_);
+  Timestamp now = clock_->CurrentTime();
+  TimeDelta window = now - last_evaluation_;
+  last_evaluation_ = now;
+  if (window <= TimeDelta::Zero()) {
+    return config_.evaluation_interval;
+  }
+
+  MutexLock lock(&mutex_);
+  double total_usage = 0.0;
+  for (Encoder& encoder : encoders_) {
+    encoder.usage = encoder.share->TakeEncodeTime() / window;
+    encoder.weight = encoder.share->weight();
+    total_usage += encoder.usage;
+  }
+  cpu_usage_ = total_usage;
+  const double budget = config_.num_cores * config_.overuse_fraction;
+
+  if (total_usage > budget) {
+    for (Encoder& encoder : encoders_) {
+      encoder.demand = encoder.usage;
+    }
+    Allocate(budget);
+    // Adapt the encoders furthest above their allocation first, until the
+    // expected savings cover the excess. Encoders that adapted recently are
+    // skipped since their usage does not reflect the adaptation yet.
+    std::vector<Encoder*> candidates;
+    for (Encoder& encoder : encoders_) {
+      if (encoder.usage > encoder.allocation && !IsHeld(encoder, now)) {
+        candidates.push_back(&encoder);
+      }
+    }
+    absl::c_sort(candidates, [](const Encoder* a, const Encoder* b) {
+      return a->usage - a->allocation > b->usage - b->allocation;
+    });
+    double excess = total_usage - budget;
+    for (Encoder* encoder : candidates) {
+      if (excess <= 0.0) {
+        break;
+      }
+      RTC_LOG(LS_INFO) << "Encoder " << encoder->share->Name() << " uses "
+                       << encoder->usage << " of " << encoder->allocation
+                       << " allocated cores, adapting down.";
+      encoder->share->ReportUsage(ResourceUsageState::kOveruse);
+      ++encoder->num_adaptations_down;
+      encoder->last_adaptation = now;
+      excess -= encoder->usage * (1.0 - kUsagePerAdaptationStep);
+    }
+    return config_.evaluation_interval;
+  }
+
+  if (total_usage >= config_.num_cores * config_.underuse_fraction) {
+    return config_.evaluation_interval;
+  }
+  // Let one encoder adapt back up, the one that is furthest below its weighted
+  // part, if its usage after adapting fits both the budget and its allocation.
+  // The allocation is computed as if the encoders that were adapted down had
+  // adapted up, so that encoders compete for the room on equal terms.
+  for (Encoder& encoder : encoders_) {
+    encoder.demand = encoder.num_adaptations_down > 0
+                         ? encoder.usage / kUsagePerAdaptationStep
+                         : encoder.usage;
+  }
+  Allocate(budget);
+  Encoder* selected = nullptr;
+  for (Encoder& encoder : encoders_) {
+    if (encoder.num_adaptations_down == 0 || IsHeld(encoder, now) ||
+        encoder.demand > encoder.allocation ||
+        total_usage + encoder.demand - encoder.usage > budget) {
+      continue;
+    }
+    if (!selected ||
+        encoder.usage / encoder.weight < selected->usage / selected->weight) {
+      selected = &encoder;
+    }
+  }
+  if (selected) {
+    RTC_LOG(LS_INFO) << "Encoder " << selected->share->Name() << " uses "
+                     << selected->usage << " of " << selected->allocation
+                     << " allocated cores, adapting up.";
+    selected->share->ReportUsage(ResourceUsageState::kUnderuse);
+    --selected->num_adaptations_down;
+    selected->last_adaptation = now;
+  }
+  return config_.evaluation_interval;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,135 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VIDEO_ADAPTATION_ENCODER_CPU_ARBITER_H_
+#define VIDEO_ADAPTATION_ENCODER_CPU_ARBITER_H_
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/adaptation/encoder_cpu_share_resource.h"
+#include "api/adaptation/resource.h"
+#include "api/scoped_refptr.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/task_utils/repeating_task.h"
+#include "rtc_base/thread_annotations.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+
+// Shares a CPU budget for encoding between video encoders, typically all the
+// encoders of a process. When every encoder adapts on its own encode usage,
+// many encoders on one host see the overload at the same time, all adapt
+// down, all see the headroom and adapt up again. The arbiter instead sees the
+// encode times of all encoders, computes a weighted fair share of the budget
+// for each of them and asks only the encoders furthest above their share to
+// adapt down, only as many as needed to get within the budget. When there is
+// room again, one encoder per evaluation is allowed to adapt back up.
+//
+// Each encoder is represented by a Share, an EncoderCpuShareResource that is
+// set in VideoStreamEncoderSettings::encoder_cpu_share. The arbiter must be
+// created and destroyed on `task_queue`, where it evaluates the usage;
+// AddEncoder() and RemoveEncoder() may be called on any thread.
+class EncoderCpuArbiter {
+ public:
+  struct Config {
+    // Number of cores of the budget.
+    double num_cores = 1.0;
+    // Encoders are asked to adapt down when their total usage is above this
+    // fraction of the budget, and up when it would stay below it.
+    double overuse_fraction = 0.85;
+    // No encoder adapts up unless the total usage is below this fraction.
+    double underuse_fraction = 0.6;
+    TimeDelta evaluation_interval = TimeDelta::Seconds(1);
+    // An encoder that was asked to adapt is left alone for this long, so that
+    // its encode times reflect the new resolution or frame rate.
+    TimeDelta adaptation_hold_time = TimeDelta::Seconds(4);
+  };
+
+  class Share : public EncoderCpuShareResource {
+   public:
+    Share(absl::string_view name, double priority, int num_viewers);
+    ~Share() override;
+
+    // The weight of the encoder in the budget is `priority` times the number
+    // of viewers, counting at least one viewer.
+    void SetPriority(double priority);
+    void SetNumViewers(int num_viewers);
+    double weight() const;
+
+    // EncoderCpuShareResource implementation.
+    std::string Name() const override { return name_; }
+    void SetResourceListener(ResourceListener* listener) override;
+    void OnEncodeCompleted(TimeDelta encode_duration) override;
+
+   private:
+    friend class EncoderCpuArbiter;
+
+    // Returns the encode time reported since the last call.
+    TimeDelta TakeEncodeTime();
+    void ReportUsage(ResourceUsageState usage_state);
+
+    const std::string name_;
+    mutable Mutex mutex_;
+    ResourceListener* listener_ RTC_GUARDED_BY(mutex_) = nullptr;
+    double priority_ RTC_GUARDED_BY(mutex_);
+    int num_viewers_ RTC_GUARDED_BY(mutex_);
+    TimeDelta encode_time_ RTC_GUARDED_BY(mutex_) = TimeDelta::Zero();
+  };
+
+  EncoderCpuArbiter(Clock* clock, TaskQueueBase* task_queue, Config config);
+  ~EncoderCpuArbiter();
+
+  scoped_refptr<Share> AddEncoder(absl::string_view name,
+                                  double priority,
+                                  int num_viewers);
+  void RemoveEncoder(const scoped_refptr<Share>& share);
+
+  // CPU used for encoding in the last evaluation interval, in cores.
+  double cpu_usage() const;
+
+ private:
+  struct Encoder {
+    scoped_refptr<Share> share;
+    // Number of times the encoder was asked to adapt down and not back up.
+    int num_adaptations_down = 0;
+    std::optional<Timestamp> last_adaptation;
+    // Filled in by Evaluate(), in cores.
+    double usage = 0.0;
+    double weight = 0.0;
+    double demand = 0.0;
+    double allocation = 0.0;
+  };
+
+  TimeDelta Evaluate();
+  // Divides `budget` between the encoders in proportion to their weights,
+  // giving encoders that demand less than their part only what they demand
+  // and dividing the rest between the others.
+  void Allocate(double budget) RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  bool IsHeld(const Encoder& encoder, Timestamp now) const;
+
+  Clock* const clock_;
+  TaskQueueBase* const task_queue_;
+  const Config config_;
+  mutable Mutex mutex_;
+  std::vector<Encoder> encoders_ RTC_GUARDED_BY(mutex_);
+  double cpu_usage_ RTC_GUARDED_BY(mutex_) = 0.0;
+  Timestamp last_evaluation_ RTC_GUARDED_BY(task_queue_);
+  RepeatingTaskHandle repeating_task_ RTC_GUARDED_BY(task_queue_);
+};
+
+}  // namespace webrtc
+
+#endif  // VIDEO_ADAPTATION_ENCODER_CPU_ARBITER_H_
@@ -0,0 +1,257 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/adaptation/encoder_cpu_arbiter.h"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/adaptation/resource.h"
+#include "api/scoped_refptr.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "call/adaptation/test/mock_resource_listener.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+#include "test/time_controller/simulated_time_controller.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::_;
+
+constexpr TimeDelta kFrameInterval = TimeDelta::Millis(40);
+
+// An encoder that encodes 25 frames per second and, like VideoStreamAdapter
+// would, encodes 40% faster for every step it is adapted down.
+class SimulatedEncoder : public ResourceListener {
+ public:
+  SimulatedEncoder(EncoderCpuArbiter* arbiter,
+                   absl::string_view name,
+                   int num_viewers,
+                   TimeDelta encode_time)
+      : arbiter_(arbiter),
+        share_(arbiter->AddEncoder(name, /*priority=*/1.0, num_viewers)),
+        encode_time_(encode_time) {
+    share_->SetResourceListener(this);
+  }
+  ~SimulatedEncoder() override {
+    share_->SetResourceListener(nullptr);
+    arbiter_->RemoveEncoder(share_);
+  }
+
+  void OnResourceUsageStateMeasured(scoped_refptr<Resource> resource,
+                                    ResourceUsageState usage_state) override {
+    EXPECT_EQ(resource, share_);
+    if (last_usage_state_.has_value() && *last_usage_state_ != usage_state) {
+      ++num_direction_changes_;
+    }
+    last_usage_state_ = usage_state;
+    if (usage_state == ResourceUsageState::kOveruse) {
+      ++num_steps_down_;
+    } else if (num_steps_down_ > 0) {
+      --num_steps_down_;
+    }
+  }
+
+  void EncodeFrame() {
+    TimeDelta encode_time = encode_time_;
+    for (int i = 0; i < num_steps_down_; ++i) {
+      encode_time = encode_time * 0.6;
+    }
+    share_->OnEncodeCompleted(encode_time);
+  }
+
+  int num_steps_down() const { return num_steps_down_; }
+  int num_direction_changes() const { return num_direction_changes_; }
+
+ private:
+  EncoderCpuArbiter* const arbiter_;
+  const scoped_refptr<EncoderCpuArbiter::Share> share_;
+  const TimeDelta encode_time_;
+  int num_steps_down_ = 0;
+  int num_direction_changes_ = 0;
+  std::optional<ResourceUsageState> last_usage_state_;
+};
+
+class EncoderCpuArbiterTest : public ::testing::Test {
+ protected:
+  EncoderCpuArbiterTest() : time_controller_(Timestamp::Seconds(1000)) {}
+
+  std::unique_ptr<EncoderCpuArbiter> CreateArbiter(double num_cores) {
+    return std::make_unique<EncoderCpuArbiter>(
+        time_controller_.GetClock(), time_controller_.GetMainThread(),
+        EncoderCpuArbiter::Config{.num_cores = num_cores});
+  }
+
+  // Encodes a frame on every encoder every frame interval for `duration`.
+  void EncodeFor(std::vector<std::unique_ptr<SimulatedEncoder>>& encoders,
+                 TimeDelta duration) {
+    for (TimeDelta elapsed = TimeDelta::Zero(); elapsed < duration;
+         elapsed += kFrameInterval) {
+      for (auto& encoder : encoders) {
+        encoder->EncodeFrame();
+      }
+      time_controller_.AdvanceTime(kFrameInterval);
+    }
+  }
+
+  GlobalSimulatedTimeController time_controller_;
+};
+
+TEST_F(EncoderCpuArbiterTest, IsSilentWithinBudget) {
+  std::unique_ptr<EncoderCpuArbiter> arbiter = CreateArbiter(/*num_cores=*/4);
+  testing::StrictMock<MockResourceListener> listener;
+  scoped_refptr<EncoderCpuArbiter::Share> share =
+      arbiter->AddEncoder("encoder", /*priority=*/1.0, /*num_viewers=*/1);
+  share->SetResourceListener(&listener);
+  for (int i = 0; i < 250; ++i) {
+    share->OnEncodeCompleted(TimeDelta::Millis(20));
+    time_controller_.AdvanceTime(kFrameInterval);
+  }
+  EXPECT_NEAR(arbiter->cpu_usage(), 0.5, 0.01);
+  share->SetResourceListener(nullptr);
+  arbiter->RemoveEncoder(share);
+}
+
+TEST_F(EncoderCpuArbiterTest, AdaptsOnlyAsManyEncodersAsNeeded) {
+  std::unique_ptr<EncoderCpuArbiter> arbiter = CreateArbiter(/*num_cores=*/3);
+  std::vector<std::unique_ptr<SimulatedEncoder>> encoders;
+  for (int i = 0; i < 10; ++i) {
+    // 0.3 cores each, 3 cores in total.
+    encoders.push_back(std::make_unique<SimulatedEncoder>(
+        arbiter.get(), "encoder" + std::to_string(i), /*num_viewers=*/1,
+        TimeDelta::Millis(12)));
+  }
+  EncodeFor(encoders, TimeDelta::Seconds(1));
+  EXPECT_NEAR(arbiter->cpu_usage(), 3.0, 0.01);
+
+  // The budget is 0.85 * 3 = 2.55 cores, so the excess is 0.45 cores. Every
+  // adapted encoder is expected to save 0.12 cores.
+  int num_adapted = 0;
+  for (const auto& encoder : encoders) {
+    num_adapted += encoder->num_steps_down();
+  }
+  EXPECT_EQ(num_adapted, 4);
+}
+
+TEST_F(EncoderCpuArbiterTest, AdaptsEncodersWithFewerViewersFirst) {
+  std::unique_ptr<EncoderCpuArbiter> arbiter = CreateArbiter(/*num_cores=*/1);
+  testing::StrictMock<MockResourceListener> popular_listener;
+  testing::StrictMock<MockResourceListener> unpopular_listener;
+  scoped_refptr<EncoderCpuArbiter::Share> popular =
+      arbiter->AddEncoder("popular", /*priority=*/1.0, /*num_viewers=*/10);
+  scoped_refptr<EncoderCpuArbiter::Share> unpopular =
+      arbiter->AddEncoder("unpopular", /*priority=*/1.0, /*num_viewers=*/1);
+  popular->SetResourceListener(&popular_listener);
+  unpopular->SetResourceListener(&unpopular_listener);
+
+  EXPECT_CALL(unpopular_listener,
+              OnResourceUsageStateMeasured(_, ResourceUsageState::kOveruse))
+      .Times(1);
+  for (int i = 0; i < 25; ++i) {
+    popular->OnEncodeCompleted(TimeDelta::Millis(24));
+    unpopular->OnEncodeCompleted(TimeDelta::Millis(24));
+    time_controller_.AdvanceTime(kFrameInterval);
+  }
+
+  popular->SetResourceListener(nullptr);
+  unpopular->SetResourceListener(nullptr);
+  arbiter->RemoveEncoder(popular);
+  arbiter->RemoveEncoder(unpopular);
+}
+
+TEST_F(EncoderCpuArbiterTest, AdaptsUpOneEncoderAtATime) {
+  std::unique_ptr<EncoderCpuArbiter> arbiter = CreateArbiter(/*num_cores=*/2);
+  std::vector<std::unique_ptr<SimulatedEncoder>> encoders;
+  for (int i = 0; i < 4; ++i) {
+    // 0.5 cores each, 2 cores in total.
+    encoders.push_back(std::make_unique<SimulatedEncoder>(
+        arbiter.get(), "encoder" + std::to_string(i), /*num_viewers=*/1,
+        TimeDelta::Millis(20)));
+  }
+  EncodeFor(encoders, TimeDelta::Seconds(1));
+  int num_adapted = 0;
+  for (const auto& encoder : encoders) {
+    num_adapted += encoder->num_steps_down();
+  }
+  ASSERT_EQ(num_adapted, 2);
+
+  // The encoders that were not adapted go away, which leaves room for the
+  // adapted encoders to adapt back up.
+  std::erase_if(encoders, [](const std::unique_ptr<SimulatedEncoder>& encoder) {
+    return encoder->num_steps_down() == 0;
+  });
+  ASSERT_EQ(encoders.size(), 2u);
+  while (true) {
+    int num_adapted_before = 0;
+    for (const auto& encoder : encoders) {
+      num_adapted_before += encoder->num_steps_down();
+    }
+    EncodeFor(encoders, TimeDelta::Seconds(1));
+    int num_adapted_after = 0;
+    for (const auto& encoder : encoders) {
+      num_adapted_after += encoder->num_steps_down();
+    }
+    EXPECT_GE(num_adapted_after, num_adapted_before - 1);
+    if (num_adapted_after == 0 || time_controller_.GetClock()->CurrentTime() >
+                                      Timestamp::Seconds(1100)) {
+      break;
+    }
+  }
+  for (const auto& encoder : encoders) {
+    EXPECT_EQ(encoder->num_steps_down(), 0);
+  }
+}
+
+// Twenty encoders that together need almost twice the budget. Popular streams
+// are weighted ten times higher. The encoders should settle within the budget,
+// without oscillating, and with the popular streams adapted the least.
+TEST_F(EncoderCpuArbiterTest, TwentyConcurrentEncodersConverge) {
+  std::unique_ptr<EncoderCpuArbiter> arbiter = CreateArbiter(/*num_cores=*/4);
+  std::vector<std::unique_ptr<SimulatedEncoder>> encoders;
+  for (int i = 0; i < 20; ++i) {
+    // 0.375 cores each, 7.5 cores in total.
+    encoders.push_back(std::make_unique<SimulatedEncoder>(
+        arbiter.get(), "encoder" + std::to_string(i),
+        /*num_viewers=*/i % 4 == 0 ? 10 : 1, TimeDelta::Millis(15)));
+  }
+  EncodeFor(encoders, TimeDelta::Seconds(60));
+
+  // Nothing changes once the encoders have settled.
+  std::vector<int> settled_steps;
+  for (const auto& encoder : encoders) {
+    settled_steps.push_back(encoder->num_steps_down());
+  }
+  EncodeFor(encoders, TimeDelta::Seconds(60));
+  EXPECT_LE(arbiter->cpu_usage(), 4 * 0.85);
+  int max_popular_steps = 0;
+  int min_unpopular_steps = 100;
+  for (size_t i = 0; i < encoders.size(); ++i) {
+    const SimulatedEncoder& encoder = *encoders[i];
+    EXPECT_EQ(encoder.num_steps_down(), settled_steps[i]);
+    EXPECT_LE(encoder.num_direction_changes(), 1);
+    if (i % 4 == 0) {
+      max_popular_steps =
+          std::max(max_popular_steps, encoder.num_steps_down());
+    } else {
+      min_unpopular_steps =
+          std::min(min_unpopular_steps, encoder.num_steps_down());
+    }
+  }
+  EXPECT_LE(max_popular_steps, min_unpopular_steps);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -24,6 +24,7 @@
 #include "api/field_trials_view.h"
 #include "api/sequence_checker.h"
 #include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
 #include "api/video/video_adaptation_reason.h"
 #include "api/video/video_source_interface.h"
 #include "call/adaptation/video_source_restrictions.h"
@@ -319,6 +320,9 @@ VideoStreamEncoderResourceManager::degradation_preference() const {
 void VideoStreamEncoderResourceManager::ConfigureEncodeUsageResource() {
   RTC_DCHECK_RUN_ON(encoder_queue_);
   RTC_DCHECK(encoder_settings_.has_value());
+  if (encoder_cpu_share_resource_) {
+    return;
+  }
   if (encode_usage_resource_->is_started()) {
     encode_usage_resource_->StopCheckForOveruse();
   } else {
@@ -328,6 +332,16 @@ void VideoStreamEncoderResourceManager::ConfigureEncodeUsageResource() {
   encode_usage_resource_->StartCheckForOveruse(GetCpuOveruseOptions());
 }
 
+void VideoStreamEncoderResourceManager::AddEncoderCpuShareResource(
+    scoped_refptr<EncoderCpuShareResource> share) {
+  RTC_DCHECK_RUN_ON(encoder_queue_);
+  RTC_DCHECK(share);
+  RTC_DCHECK(!encoder_cpu_share_resource_);
+  RTC_DCHECK(!encode_usage_resource_->is_started());
+  encoder_cpu_share_resource_ = std::move(share);
+  AddResource(encoder_cpu_share_resource_, VideoAdaptationReason::kCpu);
+}
+
 void VideoStreamEncoderResourceManager::MaybeInitializePixelLimitResource() {
   RTC_DCHECK_RUN_ON(encoder_queue_);
   RTC_DCHECK(adaptation_processor_);
@@ -371,6 +385,10 @@ void VideoStreamEncoderResourceManager::StopManagedResources() {
     RemoveResource(pixel_limit_resource_);
     pixel_limit_resource_ = nullptr;
   }
+  if (encoder_cpu_share_resource_) {
+    RemoveResource(encoder_cpu_share_resource_);
+    encoder_cpu_share_resource_ = nullptr;
+  }
   if (bandwidth_quality_scaler_resource_->is_started()) {
     bandwidth_quality_scaler_resource_->StopCheckForOveruse();
     RemoveResource(bandwidth_quality_scaler_resource_);
@@ -484,6 +502,10 @@ void VideoStreamEncoderResourceManager::OnEncodeCompleted(
       encoded_image.capture_time_ms_ * kNumMicrosecsPerMillisec;
   encode_usage_resource_->OnEncodeCompleted(
       timestamp, time_sent_in_us, capture_time_us, encode_duration_us);
+  if (encoder_cpu_share_resource_ && encode_duration_us.has_value()) {
+    encoder_cpu_share_resource_->OnEncodeCompleted(
+        TimeDelta::Micros(*encode_duration_us));
+  }
   quality_scaler_resource_->OnEncodeCompleted(encoded_image, time_sent_in_us);
   bandwidth_quality_scaler_resource_->OnEncodeCompleted(
       encoded_image, time_sent_in_us, frame_size.bytes());
@@ -20,6 +20,7 @@
 #include <utility>
 #include <vector>
 
+#include "api/adaptation/encoder_cpu_share_resource.h"
 #include "api/adaptation/resource.h"
 #include "api/field_trials_view.h"
 #include "api/rtp_parameters.h"
@@ -92,12 +93,20 @@ class VideoStreamEncoderResourceManager
   void SetDegradationPreferences(DegradationPreference degradation_preference);
   DegradationPreference degradation_preference() const;
 
+  // Does nothing if a CPU share was added, which then takes the place of the
+  // encode usage resource.
   void ConfigureEncodeUsageResource();
+  // Adapts to CPU load through `share`, reporting encode times to it, instead
+  // of through the encode usage resource. Must be called before
+  // ConfigureEncodeUsageResource().
+  void AddEncoderCpuShareResource(
+      scoped_refptr<EncoderCpuShareResource> share);
   // Initializes the pixel limit resource if the "WebRTC-PixelLimitResource"
   // field trial is enabled. This can be used for testing.
   void MaybeInitializePixelLimitResource();
   // Stops the encode usage and quality scaler resources if not already stopped.
-  // If the pixel limit resource was created it is also stopped and nulled.
+  // If the pixel limit resource was created it is also stopped and nulled, and
+  // so is the CPU share.
   void StopManagedResources();
 
   // Settings that affect the VideoStreamEncoder-specific resources.
@@ -189,6 +198,8 @@ class VideoStreamEncoderResourceManager
   const scoped_refptr<EncodeUsageResource> encode_usage_resource_;
   const scoped_refptr<QualityScalerResource> quality_scaler_resource_;
   scoped_refptr<PixelLimitResource> pixel_limit_resource_;
+  scoped_refptr<EncoderCpuShareResource> encoder_cpu_share_resource_
+      RTC_GUARDED_BY(encoder_queue_);
   const scoped_refptr<BandwidthQualityScalerResource>
       bandwidth_quality_scaler_resource_;
 
@@ -361,10 +361,12 @@ class FrameCadenceAdapterImpl : public FrameCadenceAdapterInterface {
   void UpdateVideoSourceRestrictions(
       std::optional<double> max_frame_rate) override;
   void ProcessKeyFrameRequest() override;
+  void SetEncoderPaused(bool paused) override;
 
   // VideoFrameSink overrides.
   void OnFrame(const VideoFrame& frame) override;
   void OnDiscardedFrame() override;
+  bool WantsFrame() override;
   void OnConstraintsChanged(
       const VideoTrackSourceConstraints& constraints) override;
 
@@ -441,6 +443,9 @@ class FrameCadenceAdapterImpl : public FrameCadenceAdapterInterface {
   // `queue_`.
   std::atomic<int> frames_scheduled_for_processing_{0};
 
+  // Read by WantsFrame() on the thread delivering frames.
+  std::atomic<bool> encoder_paused_{false};
+
   ScopedTaskSafetyDetached safety_;
 };
 
@@ -511,6 +516,18 @@ void ZeroHertzAdapterMode::OnFrame(Timestamp post_time,
   TRACE_EVENT0("webrtc", "ZeroHertzAdapterMode::OnFrame");
   refresh_frame_requester_.Stop();
 
+  // A frame reported to be identical to the last one needs no encode of its
+  // own. The last frame is already queued and repeated until quality has
+  // converged, so restarting the cadence would only reset that.
+  if (!queued_frames_.empty() && frame.has_update_rect() &&
+      frame.update_rect().IsEmpty() &&
+      frame.width() == queued_frames_.back().width() &&
+      frame.height() == queued_frames_.back().height()) {
+    TRACE_EVENT_INSTANT0("webrtc", "ZeroHertzAdapterMode::UnchangedFrame",
+                         TRACE_EVENT_SCOPE_THREAD);
+    return;
+  }
+
   // Assume all enabled layers are unconverged after frame entry.
   ResetQualityConvergenceInfo();
 
@@ -960,6 +977,11 @@ void FrameCadenceAdapterImpl::ProcessKeyFrameRequest() {
     zero_hertz_adapter_->ProcessKeyFrameRequest();
 }
 
+void FrameCadenceAdapterImpl::SetEncoderPaused(bool paused) {
+  RTC_DCHECK_RUN_ON(queue_);
+  encoder_paused_.store(paused, std::memory_order_relaxed);
+}
+
 void FrameCadenceAdapterImpl::OnFrame(const VideoFrame& frame) {
   // This method is called on the network thread under Chromium, or other
   // various contexts in test.
@@ -998,6 +1020,13 @@ void FrameCadenceAdapterImpl::OnDiscardedFrame() {
   }));
 }
 
+bool FrameCadenceAdapterImpl::WantsFrame() {
+  // Frames are only rejected up front while the encoder is paused. When frames
+  // are still queued, the newest one is delivered and VideoStreamEncoder drops
+  // the older ones, so no latency is added.
+  return !encoder_paused_.load(std::memory_order_relaxed);
+}
+
 void FrameCadenceAdapterImpl::OnConstraintsChanged(
     const VideoTrackSourceConstraints& constraints) {
   RTC_LOG(LS_INFO) << __func__ << " this " << this << " min_fps "
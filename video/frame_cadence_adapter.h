@@ -116,6 +116,11 @@ class FrameCadenceAdapterInterface : public VideoSinkInterface<VideoFrame> {
   // Conditionally requests a refresh frame via
   // Callback::RequestRefreshFrame.
   virtual void ProcessKeyFrameRequest() = 0;
+
+  // Tells the adapter whether the encoder is paused, i.e. drops all frames.
+  // While paused, WantsFrame() returns false so that sources can skip the
+  // frames before converting them.
+  virtual void SetEncoderPaused(bool paused) = 0;
 };
 
 }  // namespace webrtc
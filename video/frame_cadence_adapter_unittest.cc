@@ -48,6 +48,7 @@ using ::testing::InvokeWithoutArgs;
 using ::testing::Mock;
 using ::testing::NiceMock;
 using ::testing::Pair;
+using ::testing::Property;
 using ::testing::Values;
 
 VideoFrame CreateFrame() {
@@ -99,6 +100,37 @@ TEST(FrameCadenceAdapterTest, CountsOutstandingFramesToProcess) {
   time_controller.AdvanceTime(TimeDelta::Zero());
 }
 
+TEST(FrameCadenceAdapterTest, DoesNotWantFramesWhileEncoderPaused) {
+  test::ScopedKeyValueConfig no_field_trials;
+  GlobalSimulatedTimeController time_controller(Timestamp::Millis(1));
+  MockCallback callback;
+  auto adapter = CreateAdapter(no_field_trials, time_controller.GetClock());
+  adapter->Initialize(&callback);
+  EXPECT_TRUE(adapter->WantsFrame());
+  adapter->SetEncoderPaused(true);
+  EXPECT_FALSE(adapter->WantsFrame());
+  adapter->SetEncoderPaused(false);
+  EXPECT_TRUE(adapter->WantsFrame());
+}
+
+TEST(FrameCadenceAdapterTest, WantsNewestFrameWhileOlderFrameIsQueued) {
+  test::ScopedKeyValueConfig no_field_trials;
+  GlobalSimulatedTimeController time_controller(Timestamp::Millis(1));
+  MockCallback callback;
+  auto adapter = CreateAdapter(no_field_trials, time_controller.GetClock());
+  adapter->Initialize(&callback);
+  VideoFrame older = CreateFrame();
+  older.set_id(1);
+  VideoFrame newer = CreateFrame();
+  newer.set_id(2);
+  adapter->OnFrame(older);
+  EXPECT_TRUE(adapter->WantsFrame());
+  adapter->OnFrame(newer);
+  EXPECT_CALL(callback, OnFrame(_, true, Property(&VideoFrame::id, 1)));
+  EXPECT_CALL(callback, OnFrame(_, false, Property(&VideoFrame::id, 2)));
+  time_controller.AdvanceTime(TimeDelta::Zero());
+}
+
 TEST(FrameCadenceAdapterTest, FrameRateFollowsRateStatisticsByDefault) {
   test::ScopedKeyValueConfig no_field_trials;
   GlobalSimulatedTimeController time_controller(Timestamp::Zero());
@@ -391,6 +423,34 @@ TEST(FrameCadenceAdapterTest, StopsRepeatingFramesDelayed) {
   time_controller.AdvanceTime(TimeDelta::Seconds(1));
 }
 
+TEST(FrameCadenceAdapterTest, KeepsRepeatingOnUnchangedFrames) {
+  // At 1s, the initially scheduled frame appears.
+  // At 1.5s, a frame without changes is received and dropped.
+  // At 2s, the repeated initial frame appears.
+  MockCallback callback;
+  GlobalSimulatedTimeController time_controller(Timestamp::Zero());
+  test::ScopedKeyValueConfig no_field_trials;
+  auto adapter = CreateAdapter(no_field_trials, time_controller.GetClock());
+  adapter->Initialize(&callback);
+  adapter->SetZeroHertzModeEnabled(
+      FrameCadenceAdapterInterface::ZeroHertzModeParams{});
+  adapter->OnConstraintsChanged(VideoTrackSourceConstraints{0, 1});
+
+  adapter->OnFrame(CreateFrame());
+  EXPECT_CALL(callback, OnFrame);
+  time_controller.AdvanceTime(TimeDelta::Seconds(1.5));
+  Mock::VerifyAndClearExpectations(&callback);
+
+  VideoFrame unchanged_frame = CreateFrame();
+  unchanged_frame.set_update_region({});
+  adapter->OnFrame(unchanged_frame);
+  EXPECT_CALL(callback, OnFrame)
+      .WillOnce(Invoke([&](Timestamp post_time, bool, const VideoFrame&) {
+        EXPECT_EQ(post_time, Timestamp::Seconds(2));
+      }));
+  time_controller.AdvanceTime(TimeDelta::Seconds(1.4));
+}
+
 TEST(FrameCadenceAdapterTest, RequestsRefreshFrameOnKeyFrameRequestWhenNew) {
   MockCallback callback;
   GlobalSimulatedTimeController time_controller(Timestamp::Zero());
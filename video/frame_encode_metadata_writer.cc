@@ -13,7 +13,11 @@
 #include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
+#include "api/array_view.h"
+#include "api/video/nalu_index.h"
+#include "common_video/h264/h264_common.h"
 #include "common_video/h264/sps_vui_rewriter.h"
 #include "modules/include/module_common_types_public.h"
 #include "modules/video_coding/include/video_coding_defines.h"
@@ -205,11 +209,20 @@ void FrameEncodeMetadataWriter::UpdateBitstream(
 
   // Make sure that the data is not copied if owned by EncodedImage.
   const EncodedImage& buffer = *encoded_image;
+  std::vector<NaluIndex> nalu_indices;
+  ArrayView<const NaluIndex> known_nalu_indices = buffer.NaluIndices();
+  if (known_nalu_indices.empty()) {
+    nalu_indices = H264::FindNaluIndices(buffer);
+    known_nalu_indices = nalu_indices;
+  }
+  std::vector<NaluIndex> modified_nalu_indices;
   Buffer modified_buffer = SpsVuiRewriter::ParseOutgoingBitstreamAndRewrite(
-      buffer, encoded_image->ColorSpace());
+      buffer, known_nalu_indices, encoded_image->ColorSpace(),
+      &modified_nalu_indices);
 
   encoded_image->SetEncodedData(
       make_ref_counted<EncodedImageBufferWrapper>(std::move(modified_buffer)));
+  encoded_image->SetNaluIndices(std::move(modified_nalu_indices));
 }
 
 void FrameEncodeMetadataWriter::Reset() {
@@ -739,6 +739,25 @@ void ReceiveStatisticsProxy::OnRenderedFrame(
       content_specific_stats->e2e_delay_counter.Add(delay_ms);
     }
   }
+
+  if (frame_meta.ntp_time_ms > 0 && frame_meta.first_packet_receive_time &&
+      frame_meta.last_packet_receive_time && frame_meta.decode_finish_time) {
+    // The capture time is in the local NTP time base.
+    const TimeDelta receive_latency = TimeDelta::Millis(
+        clock_->ConvertTimestampToNtpTime(*frame_meta.first_packet_receive_time)
+            .ToMs() -
+        frame_meta.ntp_time_ms);
+    if (receive_latency >= TimeDelta::Zero()) {
+      ++stats_.frames_with_latency_breakdown;
+      stats_.total_receive_latency += receive_latency;
+      stats_.total_assemble_latency += *frame_meta.last_packet_receive_time -
+                                       *frame_meta.first_packet_receive_time;
+      stats_.total_decode_latency += *frame_meta.decode_finish_time -
+                                     *frame_meta.last_packet_receive_time;
+      stats_.total_render_latency +=
+          frame_meta.decode_timestamp - *frame_meta.decode_finish_time;
+    }
+  }
 }
 
 void ReceiveStatisticsProxy::OnSyncOffsetUpdated(int64_t video_playout_ntp_ms,
@@ -301,6 +301,40 @@ TEST_F(ReceiveStatisticsProxyTest, OnDecodedFrameIncreasesAssemblyTime) {
       statistics_proxy_->GetStats().frames_assembled_from_multiple_packets);
 }
 
+TEST_F(ReceiveStatisticsProxyTest, OnRenderedFrameReportsLatencyBreakdown) {
+  const TimeDelta kReceiveLatency = TimeDelta::Millis(20);
+  const TimeDelta kAssembleLatency = TimeDelta::Millis(5);
+  const TimeDelta kDecodeLatency = TimeDelta::Millis(8);
+  const TimeDelta kRenderLatency = TimeDelta::Millis(3);
+  // The capture time is the current time.
+  webrtc::VideoFrame frame = CreateFrame(kWidth, kHeight);
+  const Timestamp first_packet_time = Now() + kReceiveLatency;
+  const Timestamp last_packet_time = first_packet_time + kAssembleLatency;
+  const Timestamp decode_finish_time = last_packet_time + kDecodeLatency;
+  frame.set_packet_infos(RtpPacketInfos({
+      RtpPacketInfo(/*ssrc=*/{}, /*csrcs=*/{}, /*rtp_timestamp=*/{},
+                    /*receive_time=*/last_packet_time),
+      RtpPacketInfo(/*ssrc=*/{}, /*csrcs=*/{}, /*rtp_timestamp=*/{},
+                    /*receive_time=*/first_packet_time),
+  }));
+  frame.set_processing_time(
+      {decode_finish_time - TimeDelta::Millis(2), decode_finish_time});
+
+  const Timestamp render_time = decode_finish_time + kRenderLatency;
+  statistics_proxy_->OnRenderedFrame(MetaData(frame, render_time));
+  // Frames without packet receive times are not part of the breakdown.
+  statistics_proxy_->OnRenderedFrame(
+      MetaData(CreateFrame(kWidth, kHeight), render_time));
+
+  VideoReceiveStreamInterface::Stats stats = statistics_proxy_->GetStats();
+  EXPECT_EQ(stats.frames_rendered, 2u);
+  EXPECT_EQ(stats.frames_with_latency_breakdown, 1u);
+  EXPECT_EQ(stats.total_receive_latency, kReceiveLatency);
+  EXPECT_EQ(stats.total_assemble_latency, kAssembleLatency);
+  EXPECT_EQ(stats.total_decode_latency, kDecodeLatency);
+  EXPECT_EQ(stats.total_render_latency, kRenderLatency);
+}
+
 TEST_F(ReceiveStatisticsProxyTest, OnDecodedFrameIncreasesQpSum) {
   EXPECT_EQ(std::nullopt, statistics_proxy_->GetStats().qp_sum);
   webrtc::VideoFrame frame = CreateFrame(kWidth, kHeight);
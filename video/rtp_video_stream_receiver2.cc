@@ -121,6 +121,32 @@ int PacketBufferMaxSize(const FieldTrialsView& field_trials) {
   return packet_buffer_max_size;
 }
 
+// Returns true if a frame with the decode target indications `dtis` is needed
+// to decode `decode_target`, where std::nullopt stands for all decode targets.
+// Frames without indication for the decode target are kept.
+bool IsPartOfDecodeTarget(ArrayView<const DecodeTargetIndication> dtis,
+                          std::optional<int> decode_target) {
+  return !decode_target || *decode_target >= static_cast<int>(dtis.size()) ||
+         dtis[*decode_target] != DecodeTargetIndication::kNotPresent;
+}
+
+// Returns the highest spatial id of the frames that are part of
+// `decode_target`. The frame of that spatial id ends the temporal unit when
+// the frames of higher spatial ids are dropped.
+std::optional<int> MaxSpatialIdOfDecodeTarget(
+    const FrameDependencyStructure& structure,
+    int decode_target) {
+  std::optional<int> max_spatial_id;
+  for (const FrameDependencyTemplate& frame_template : structure.templates) {
+    if (IsPartOfDecodeTarget(frame_template.decode_target_indications,
+                             decode_target)) {
+      max_spatial_id =
+          std::max(max_spatial_id.value_or(0), frame_template.spatial_id);
+    }
+  }
+  return max_spatial_id;
+}
+
 std::unique_ptr<ModuleRtpRtcpImpl2> CreateRtpRtcpModule(
     const Environment& env,
     ReceiveStatistics* receive_statistics,
@@ -782,6 +808,10 @@ bool RtpVideoStreamReceiver2::OnReceivedPayloadData(
   if (h26x_packet_buffer_ && UseH26xPacketBuffer(packet->codec())) {
     OnInsertedPacket(h26x_packet_buffer_->InsertPacket(std::move(packet)));
   } else {
+    auto depacketizer_it = payload_type_map_.find(packet->payload_type);
+    packet->assemble_in_place =
+        depacketizer_it != payload_type_map_.end() &&
+        depacketizer_it->second->AssemblesFrameByConcatenation();
     OnInsertedPacket(packet_buffer_.InsertPacket(std::move(packet)));
   }
   return false;
@@ -915,8 +945,12 @@ void RtpVideoStreamReceiver2::OnInsertedPacket(
       RTC_CHECK(depacketizer_it != payload_type_map_.end());
       RTC_CHECK(depacketizer_it->second);
 
+      // The packet buffer may already have assembled the frame.
       scoped_refptr<EncodedImageBuffer> bitstream =
-          depacketizer_it->second->AssembleFrame(payloads);
+          packet->assembled_payload
+              ? EncodedImageBuffer::Create(
+                    std::move(*packet->assembled_payload))
+              : depacketizer_it->second->AssembleFrame(payloads);
       if (!bitstream) {
         // Failed to assemble a frame. Discard and continue.
         continue;
@@ -985,6 +1019,19 @@ void RtpVideoStreamReceiver2::OnAssembledFrame(
     has_received_frame_ = true;
   }
 
+  if (decode_target_ && descriptor) {
+    if (!IsPartOfDecodeTarget(descriptor->decode_target_indications,
+                              decode_target_)) {
+      // Not referenced by any frame of the decode target.
+      return;
+    }
+    if (video_structure_ &&
+        descriptor->spatial_index ==
+            MaxSpatialIdOfDecodeTarget(*video_structure_, *decode_target_)) {
+      frame->is_last_spatial_layer = true;
+    }
+  }
+
   // Reset `reference_finder_` if `frame` is new and the codec have changed.
   if (current_codec_) {
     bool frame_is_newer =
@@ -1125,6 +1172,31 @@ void RtpVideoStreamReceiver2::SetNackHistory(TimeDelta history) {
       history.ms() > 0 ? kMaxPacketAgeToNack : kDefaultMaxReorderingThreshold);
 }
 
+void RtpVideoStreamReceiver2::SetDecodeTarget(
+    std::optional<int> decode_target) {
+  RTC_DCHECK_RUN_ON(&packet_sequence_checker_);
+  if (decode_target == decode_target_) {
+    return;
+  }
+  // Frames of the new decode target may reference frames that were dropped
+  // for the old one, in which case decoding has to restart from a key frame.
+  const bool keyframe_required =
+      video_structure_ &&
+      !absl::c_all_of(video_structure_->templates,
+                      [&](const FrameDependencyTemplate& frame_template) {
+                        return !IsPartOfDecodeTarget(
+                                   frame_template.decode_target_indications,
+                                   decode_target) ||
+                               IsPartOfDecodeTarget(
+                                   frame_template.decode_target_indications,
+                                   decode_target_);
+                      });
+  decode_target_ = decode_target;
+  if (keyframe_required) {
+    RequestKeyFrame();
+  }
+}
+
 int RtpVideoStreamReceiver2::ulpfec_payload_type() const {
   RTC_DCHECK_RUN_ON(&packet_sequence_checker_);
   return ulpfec_receiver_ ? ulpfec_receiver_->ulpfec_payload_type() : -1;
@@ -217,6 +217,12 @@ class RtpVideoStreamReceiver2 : public LossNotificationSender,
 
   void SetNackHistory(TimeDelta history);
 
+  // Sets the decode target of the dependency descriptor that the received
+  // frames are decoded for, or std::nullopt to decode all of them. Frames that
+  // are not part of the decode target are dropped before they reach the frame
+  // buffer. Must be called on the packet delivery thread.
+  void SetDecodeTarget(std::optional<int> decode_target);
+
   int ulpfec_payload_type() const;
   int red_payload_type() const;
   void SetProtectionPayloadTypes(int red_payload_type, int ulpfec_payload_type);
@@ -410,6 +416,7 @@ class RtpVideoStreamReceiver2 : public LossNotificationSender,
       RTC_GUARDED_BY(packet_sequence_checker_);
   Timestamp last_logged_failed_to_parse_dd_
       RTC_GUARDED_BY(packet_sequence_checker_) = Timestamp::MinusInfinity();
+  std::optional<int> decode_target_ RTC_GUARDED_BY(packet_sequence_checker_);
 
   std::unique_ptr<RtpFrameReferenceFinder> reference_finder_
       RTC_GUARDED_BY(packet_sequence_checker_);
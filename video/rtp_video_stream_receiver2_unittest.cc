@@ -1355,8 +1355,23 @@ class RtpVideoStreamReceiver2DependencyDescriptorTest
     return stream_structure;
   }
 
+  // Two spatial layers with one temporal layer, with a decode target for each
+  // spatial layer.
+  static FrameDependencyStructure CreateL2T1StreamStructure() {
+    FrameDependencyStructure stream_structure;
+    stream_structure.num_decode_targets = 2;
+    stream_structure.templates = {
+        FrameDependencyTemplate().S(0).Dtis("SS"),
+        FrameDependencyTemplate().S(1).Dtis("-S").FrameDiffs({1}),
+        FrameDependencyTemplate().S(0).Dtis("SS").FrameDiffs({2}),
+        FrameDependencyTemplate().S(1).Dtis("-S").FrameDiffs({2, 1}),
+    };
+    return stream_structure;
+  }
+
   void InjectPacketWith(const FrameDependencyStructure& stream_structure,
-                        const DependencyDescriptor& dependency_descriptor) {
+                        const DependencyDescriptor& dependency_descriptor,
+                        bool marker = true) {
     const std::vector<uint8_t> data = {0, 1, 2, 3, 4};
     RtpPacketReceived rtp_packet(&extension_map_);
     ASSERT_TRUE(rtp_packet.SetExtension<RtpDependencyDescriptorExtension>(
@@ -1367,7 +1382,7 @@ class RtpVideoStreamReceiver2DependencyDescriptorTest
     mock_on_complete_frame_callback_.ClearExpectedBitstream();
     mock_on_complete_frame_callback_.AppendExpectedBitstream(data.data(),
                                                              data.size());
-    rtp_packet.SetMarker(true);
+    rtp_packet.SetMarker(marker);
     rtp_packet.SetPayloadType(payload_type_);
     rtp_packet.SetSequenceNumber(++rtp_sequence_number_);
     rtp_video_stream_receiver_->OnRtpPacket(rtp_packet);
@@ -1609,6 +1624,70 @@ TEST_F(RtpVideoStreamReceiver2DependencyDescriptorTest,
   InjectPacketWith(stream_structure3, keyframe3_descriptor);
 }
 
+TEST_F(RtpVideoStreamReceiver2DependencyDescriptorTest,
+       DropsFramesNotPartOfDecodeTarget) {
+  FrameDependencyStructure stream_structure = CreateL2T1StreamStructure();
+  rtp_video_stream_receiver_->SetDecodeTarget(0);
+
+  DependencyDescriptor s0_keyframe_descriptor;
+  s0_keyframe_descriptor.attached_structure =
+      std::make_unique<FrameDependencyStructure>(stream_structure);
+  s0_keyframe_descriptor.frame_dependencies = stream_structure.templates[0];
+  s0_keyframe_descriptor.frame_number = 1;
+
+  DependencyDescriptor s1_keyframe_descriptor;
+  s1_keyframe_descriptor.frame_dependencies = stream_structure.templates[1];
+  s1_keyframe_descriptor.frame_number = 2;
+
+  DependencyDescriptor s0_deltaframe_descriptor;
+  s0_deltaframe_descriptor.frame_dependencies = stream_structure.templates[2];
+  s0_deltaframe_descriptor.frame_number = 3;
+
+  DependencyDescriptor s1_deltaframe_descriptor;
+  s1_deltaframe_descriptor.frame_dependencies = stream_structure.templates[3];
+  s1_deltaframe_descriptor.frame_number = 4;
+
+  // The S0 frames end the temporal units since the S1 frames are dropped.
+  EXPECT_CALL(mock_on_complete_frame_callback_, DoOnCompleteFrame)
+      .WillOnce([&](EncodedFrame* frame) {
+        EXPECT_EQ(frame->Id() & 0xFFFF, 1);
+        EXPECT_TRUE(frame->is_last_spatial_layer);
+      })
+      .WillOnce([&](EncodedFrame* frame) {
+        EXPECT_EQ(frame->Id() & 0xFFFF, 3);
+        EXPECT_TRUE(frame->is_last_spatial_layer);
+      });
+  InjectPacketWith(stream_structure, s0_keyframe_descriptor,
+                   /*marker=*/false);
+  InjectPacketWith(stream_structure, s1_keyframe_descriptor);
+  InjectPacketWith(stream_structure, s0_deltaframe_descriptor,
+                   /*marker=*/false);
+  InjectPacketWith(stream_structure, s1_deltaframe_descriptor);
+}
+
+TEST_F(RtpVideoStreamReceiver2DependencyDescriptorTest,
+       RequestsKeyFrameWhenSwitchingToHigherDecodeTarget) {
+  FrameDependencyStructure stream_structure = CreateL2T1StreamStructure();
+  rtp_video_stream_receiver_->SetDecodeTarget(1);
+
+  DependencyDescriptor keyframe_descriptor;
+  keyframe_descriptor.attached_structure =
+      std::make_unique<FrameDependencyStructure>(stream_structure);
+  keyframe_descriptor.frame_dependencies = stream_structure.templates[0];
+  keyframe_descriptor.frame_number = 1;
+  EXPECT_CALL(mock_on_complete_frame_callback_, DoOnCompleteFrame);
+  InjectPacketWith(stream_structure, keyframe_descriptor);
+
+  // Switching down drops frames, all frames of the lower decode target have
+  // been received.
+  rtp_video_stream_receiver_->SetDecodeTarget(0);
+  EXPECT_THAT(rtcp_packet_parser_.pli()->num_packets(), Eq(0));
+
+  // Switching up needs frames that were dropped.
+  rtp_video_stream_receiver_->SetDecodeTarget(std::nullopt);
+  EXPECT_THAT(rtcp_packet_parser_.pli()->num_packets(), Eq(1));
+}
+
 TEST_F(RtpVideoStreamReceiver2Test, TransformFrame) {
   scoped_refptr<MockFrameTransformer> mock_frame_transformer =
       make_ref_counted<testing::NiceMock<MockFrameTransformer>>();
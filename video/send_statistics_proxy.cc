@@ -1289,6 +1289,11 @@ void SendStatisticsProxy::OnEncoderInternalScalerUpdate(bool is_scaled) {
   UpdateAdaptationStats();
 }
 
+void SendStatisticsProxy::OnEncoderInputFrameConverted() {
+  MutexLock lock(&mutex_);
+  ++stats_.frames_converted_for_encoder;
+}
+
 // TODO(asapersson): Include fps changes.
 void SendStatisticsProxy::OnInitialQualityResolutionAdaptDown() {
   MutexLock lock(&mutex_);
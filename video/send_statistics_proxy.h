@@ -98,6 +98,8 @@ class SendStatisticsProxy : public VideoStreamEncoderObserver,
 
   void OnEncoderInternalScalerUpdate(bool is_scaled) override;
 
+  void OnEncoderInputFrameConverted() override;
+
   void OnMinPixelLimitReached() override;
   void OnInitialQualityResolutionAdaptDown() override;
 
@@ -0,0 +1,304 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/shared_decode_thread_pool.h"
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/algorithm/container.h"
+#include "absl/functional/any_invocable.h"
+#include "api/location.h"
+#include "api/make_ref_counted.h"
+#include "api/scoped_refptr.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/time_utils.h"
+#include "system_wrappers/include/cpu_info.h"
+
+namespace webrtc {
+
+namespace {
+
+Timestamp Now() {
+  return Timestamp::Micros(TimeMicros());
+}
+
+}  // namespace
+
+class SharedDecodeThreadPool::Queue : public DecodeThreadPool::DecodeQueue {
+ public:
+  struct Task {
+    absl::AnyInvocable<void() &&> run;
+    Timestamp deadline;
+  };
+
+  explicit Queue(SharedDecodeThreadPool* pool) : pool_(pool) {}
+  ~Queue() override = default;
+
+  void Delete() override { pool_->DeleteQueue(this); }
+
+  void RunTask(absl::AnyInvocable<void() &&> task) {
+    CurrentTaskQueueSetter set_current(this);
+    std::move(task)();
+    // Destroys the task while the queue is still current.
+    task = nullptr;
+  }
+
+  void PostTaskWithDeadline(absl::AnyInvocable<void() &&> task,
+                            Timestamp deadline,
+                            const Location& location) override {
+    pool_->PostTask(this, std::move(task), deadline);
+  }
+
+  std::deque<Task> tasks RTC_GUARDED_BY(pool_->mutex_);
+  // True while one of the pool threads runs a task of the queue.
+  bool running RTC_GUARDED_BY(pool_->mutex_) = false;
+  // True once Delete() is called. No more tasks are run.
+  bool deleted RTC_GUARDED_BY(pool_->mutex_) = false;
+  // True if Delete() is called from a task of the queue, in which case the
+  // queue is deleted by the pool thread when the task returns.
+  bool delete_when_idle RTC_GUARDED_BY(pool_->mutex_) = false;
+  // Signaled when the task that ran while Delete() was called returns.
+  Event idle;
+
+ private:
+  void PostTaskImpl(absl::AnyInvocable<void() &&> task,
+                    const PostTaskTraits& traits,
+                    const Location& location) override {
+    pool_->PostTask(this, std::move(task), Timestamp::MinusInfinity());
+  }
+
+  void PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
+                           TimeDelta delay,
+                           const PostDelayedTaskTraits& traits,
+                           const Location& location) override {
+    pool_->PostDelayedTask(this, std::move(task), Now() + delay);
+  }
+
+  SharedDecodeThreadPool* const pool_;
+};
+
+scoped_refptr<SharedDecodeThreadPool> SharedDecodeThreadPool::ProcessWide() {
+  // Intentionally leaked, since receive streams may be destroyed at any point
+  // during shutdown.
+  static SharedDecodeThreadPool* const kPool =
+      Create(CpuInfo::DetectNumberOfCores()).release();
+  return scoped_refptr<SharedDecodeThreadPool>(kPool);
+}
+
+scoped_refptr<SharedDecodeThreadPool> SharedDecodeThreadPool::Create(
+    int num_threads,
+    int decoder_threads_per_stream) {
+  return make_ref_counted<SharedDecodeThreadPool>(num_threads,
+                                                  decoder_threads_per_stream);
+}
+
+SharedDecodeThreadPool::SharedDecodeThreadPool(int num_threads,
+                                               int decoder_threads_per_stream)
+    : decoder_threads_per_stream_(decoder_threads_per_stream) {
+  RTC_DCHECK_GT(num_threads, 0);
+  RTC_DCHECK_GT(decoder_threads_per_stream, 0);
+  threads_.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    threads_.push_back(PlatformThread::SpawnJoinable(
+        [this] { RunWorker(); }, "DecodeThreadPool",
+        ThreadAttributes().SetPriority(ThreadPriority::kHigh)));
+  }
+}
+
+SharedDecodeThreadPool::~SharedDecodeThreadPool() {
+  {
+    MutexLock lock(&mutex_);
+    RTC_DCHECK(queues_.empty());
+    stopping_ = true;
+  }
+  wake_up_.Set();
+  // Joins the threads.
+  threads_.clear();
+}
+
+std::unique_ptr<DecodeThreadPool::DecodeQueue, TaskQueueDeleter>
+SharedDecodeThreadPool::CreateQueue() {
+  auto* queue = new Queue(this);
+  MutexLock lock(&mutex_);
+  queues_.push_back(queue);
+  return std::unique_ptr<DecodeQueue, TaskQueueDeleter>(queue);
+}
+
+int SharedDecodeThreadPool::DecoderThreadsPerStream() const {
+  return decoder_threads_per_stream_;
+}
+
+void SharedDecodeThreadPool::RunWorker() {
+  while (true) {
+    Queue* queue = nullptr;
+    absl::AnyInvocable<void() &&> task;
+    Timestamp next_delayed_task = Timestamp::PlusInfinity();
+    Timestamp now = Now();
+    {
+      MutexLock lock(&mutex_);
+      if (stopping_) {
+        // Passes the stop on to the next thread.
+        wake_up_.Set();
+        return;
+      }
+      next_delayed_task = MoveDueDelayedTasks(now);
+      queue = PickQueue();
+      if (queue) {
+        task = std::move(queue->tasks.front().run);
+        queue->tasks.pop_front();
+        queue->running = true;
+        // Another thread runs the next ready task, or waits for the next
+        // delayed task, which this thread may have been woken up for.
+        if (PickQueue() || next_delayed_task.IsFinite()) {
+          wake_up_.Set();
+        }
+      }
+    }
+    if (!queue) {
+      wake_up_.Wait(next_delayed_task.IsPlusInfinity()
+                        ? Event::kForever
+                        : next_delayed_task - now);
+      continue;
+    }
+
+    queue->RunTask(std::move(task));
+
+    Queue* queue_to_delete = nullptr;
+    {
+      MutexLock lock(&mutex_);
+      queue->running = false;
+      if (queue->deleted) {
+        if (queue->delete_when_idle) {
+          queues_.erase(absl::c_find(queues_, queue));
+          queue_to_delete = queue;
+        } else {
+          queue->idle.Set();
+        }
+      } else if (!queue->tasks.empty()) {
+        wake_up_.Set();
+      }
+    }
+    delete queue_to_delete;
+  }
+}
+
+Timestamp SharedDecodeThreadPool::MoveDueDelayedTasks(Timestamp now) {
+  while (!delayed_tasks_.empty()) {
+    auto it = delayed_tasks_.begin();
+    const Timestamp run_at = it->first.first;
+    if (run_at > now) {
+      return run_at;
+    }
+    Queue* queue = it->second.first;
+    queue->tasks.push_back({std::move(it->second.second), run_at});
+    delayed_tasks_.erase(it);
+  }
+  return Timestamp::PlusInfinity();
+}
+
+SharedDecodeThreadPool::Queue* SharedDecodeThreadPool::PickQueue() {
+  Queue* picked = nullptr;
+  for (Queue* queue : queues_) {
+    if (queue->running || queue->tasks.empty()) {
+      continue;
+    }
+    if (!picked ||
+        queue->tasks.front().deadline < picked->tasks.front().deadline) {
+      picked = queue;
+    }
+  }
+  return picked;
+}
+
+void SharedDecodeThreadPool::PostTask(Queue* queue,
+                                      absl::AnyInvocable<void() &&> task,
+                                      Timestamp deadline) {
+  {
+    MutexLock lock(&mutex_);
+    if (queue->deleted) {
+      // The task is destroyed after the lock is released.
+      return;
+    }
+    queue->tasks.push_back({std::move(task), deadline});
+  }
+  wake_up_.Set();
+}
+
+void SharedDecodeThreadPool::PostDelayedTask(
+    Queue* queue,
+    absl::AnyInvocable<void() &&> task,
+    Timestamp run_at) {
+  {
+    MutexLock lock(&mutex_);
+    if (queue->deleted) {
+      return;
+    }
+    delayed_tasks_.emplace(std::make_pair(run_at, next_delayed_task_id_++),
+                           std::make_pair(queue, std::move(task)));
+  }
+  // Wakes up a thread to wait for the new task, in case it is due before the
+  // ones that the threads currently wait for.
+  wake_up_.Set();
+}
+
+void SharedDecodeThreadPool::DeleteQueue(Queue* queue) {
+  std::deque<Queue::Task> pending_tasks;
+  std::vector<absl::AnyInvocable<void() &&>> pending_delayed_tasks;
+  bool wait_for_idle = false;
+  bool delete_now = false;
+  {
+    MutexLock lock(&mutex_);
+    RTC_DCHECK(!queue->deleted);
+    queue->deleted = true;
+    pending_tasks.swap(queue->tasks);
+    for (auto it = delayed_tasks_.begin(); it != delayed_tasks_.end();) {
+      if (it->second.first == queue) {
+        pending_delayed_tasks.push_back(std::move(it->second.second));
+        it = delayed_tasks_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    if (!queue->running) {
+      queues_.erase(absl::c_find(queues_, queue));
+      delete_now = true;
+    } else if (queue->IsCurrent()) {
+      queue->delete_when_idle = true;
+    } else {
+      wait_for_idle = true;
+    }
+  }
+  // The tasks may post to other queues of the pool, so they are destroyed
+  // without holding the lock.
+  pending_tasks.clear();
+  pending_delayed_tasks.clear();
+
+  if (wait_for_idle) {
+    queue->idle.Wait(Event::kForever);
+    MutexLock lock(&mutex_);
+    queues_.erase(absl::c_find(queues_, queue));
+    delete_now = true;
+  }
+  if (delete_now) {
+    delete queue;
+  }
+}
+
+}  // namespace webrtc
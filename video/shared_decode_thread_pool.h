@@ -0,0 +1,105 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VIDEO_SHARED_DECODE_THREAD_POOL_H_
+#define VIDEO_SHARED_DECODE_THREAD_POOL_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "api/scoped_refptr.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/timestamp.h"
+#include "api/video/decode_thread_pool.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Runs the decode queues of several video receive streams on a fixed number of
+// threads. When more queues have tasks to run than there are idle threads,
+// the task with the earliest deadline runs first, so that the frame that is
+// to be rendered next is decoded first regardless of its stream. Tasks of the
+// same queue run one at a time and in order.
+//
+// Decoders of the streams on the pool are configured with a fixed number of
+// threads, `decoder_threads_per_stream`. With the default of 1 they decode on
+// the pool thread only, so the pool threads are all the decode threads of
+// those streams. With more, each decoder may add up to that many threads of its
+// own, on top of the pool threads.
+//
+// The pool must outlive the queues created from it, and must not be destroyed
+// on one of its threads.
+class SharedDecodeThreadPool : public DecodeThreadPool {
+ public:
+  // Returns a pool with one thread per core that all the receive streams of
+  // the process can share. Neither Call nor PeerConnection sets it in the
+  // receive stream config; embedders that want it set it in
+  // VideoReceiveStreamInterface::Config::decode_thread_pool.
+  static scoped_refptr<SharedDecodeThreadPool> ProcessWide();
+
+  static scoped_refptr<SharedDecodeThreadPool> Create(
+      int num_threads,
+      int decoder_threads_per_stream = 1);
+
+  std::unique_ptr<DecodeQueue, TaskQueueDeleter> CreateQueue() override;
+  int DecoderThreadsPerStream() const override;
+
+  int num_threads() const { return threads_.size(); }
+
+ protected:
+  SharedDecodeThreadPool(int num_threads, int decoder_threads_per_stream);
+  ~SharedDecodeThreadPool() override;
+
+ private:
+  class Queue;
+
+  void RunWorker();
+  // Moves the delayed tasks that are due to their queues and returns the time
+  // at which the next delayed task is due.
+  Timestamp MoveDueDelayedTasks(Timestamp now)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // Returns the queue that is not running and has the task with the earliest
+  // deadline, if any.
+  Queue* PickQueue() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  void PostTask(Queue* queue,
+                absl::AnyInvocable<void() &&> task,
+                Timestamp deadline);
+  void PostDelayedTask(Queue* queue,
+                       absl::AnyInvocable<void() &&> task,
+                       Timestamp run_at);
+  void DeleteQueue(Queue* queue);
+
+  mutable Mutex mutex_;
+  // Wakes up one idle thread. A thread that picks a task wakes up the next one
+  // if there are more tasks to run.
+  Event wake_up_;
+  bool stopping_ RTC_GUARDED_BY(mutex_) = false;
+  std::vector<Queue*> queues_ RTC_GUARDED_BY(mutex_);
+  // Delayed tasks by due time. The sequence number keeps the order of tasks
+  // that are due at the same time.
+  std::map<std::pair<Timestamp, uint64_t>,
+           std::pair<Queue*, absl::AnyInvocable<void() &&>>>
+      delayed_tasks_ RTC_GUARDED_BY(mutex_);
+  uint64_t next_delayed_task_id_ RTC_GUARDED_BY(mutex_) = 0;
+  const int decoder_threads_per_stream_;
+  std::vector<PlatformThread> threads_;
+};
+
+}  // namespace webrtc
+
+#endif  // VIDEO_SHARED_DECODE_THREAD_POOL_H_
@@ -0,0 +1,195 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/scoped_refptr.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
+#include "api/units/timestamp.h"
+#include "api/video/decode_thread_pool.h"
+#include "api/video/encoded_image.h"
+#include "api/video/render_resolution.h"
+#include "api/video/video_bitrate_allocation.h"
+#include "api/video/video_codec_type.h"
+#include "api/video/video_frame.h"
+#include "api/video_codecs/scalability_mode.h"
+#include "api/video_codecs/video_codec.h"
+#include "api/video_codecs/video_decoder.h"
+#include "api/video_codecs/video_encoder.h"
+#include "benchmark/benchmark.h"
+#include "modules/video_coding/codecs/av1/dav1d_decoder.h"
+#include "modules/video_coding/codecs/av1/libaom_av1_encoder.h"
+#include "modules/video_coding/codecs/test/encoded_video_frame_producer.h"
+#include "modules/video_coding/include/video_error_codes.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "system_wrappers/include/cpu_info.h"
+#include "test/video_codec_settings.h"
+#include "video/shared_decode_thread_pool.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kWidth = 640;
+constexpr int kHeight = 360;
+constexpr int kFramerate = 30;
+constexpr int kBitrateBps = 600'000;
+constexpr int kNumFrames = 30;
+
+std::vector<EncodedImage> EncodeClip() {
+  const Environment env = CreateEnvironment();
+  std::unique_ptr<VideoEncoder> encoder = CreateLibaomAv1Encoder(env);
+  VideoCodec codec_settings;
+  test::CodecSettings(kVideoCodecAV1, &codec_settings);
+  codec_settings.width = kWidth;
+  codec_settings.height = kHeight;
+  codec_settings.startBitrate = kBitrateBps / 1000;
+  codec_settings.maxBitrate = kBitrateBps / 1000;
+  codec_settings.SetScalabilityMode(ScalabilityMode::kL1T1);
+  RTC_CHECK_EQ(
+      encoder->InitEncode(
+          &codec_settings,
+          VideoEncoder::Settings(
+              VideoEncoder::Capabilities(/*loss_notification=*/false),
+              /*number_of_cores=*/1, /*max_payload_size=*/1200)),
+      WEBRTC_VIDEO_CODEC_OK);
+  VideoBitrateAllocation allocation;
+  allocation.SetBitrate(0, 0, kBitrateBps);
+  encoder->SetRates(
+      VideoEncoder::RateControlParameters(allocation, kFramerate));
+
+  std::vector<EncodedImage> clip;
+  for (EncodedVideoFrameProducer::EncodedFrame& frame :
+       EncodedVideoFrameProducer(*encoder)
+           .SetNumInputFrames(kNumFrames)
+           .SetResolution(RenderResolution(kWidth, kHeight))
+           .SetFramerateFps(kFramerate)
+           .Encode()) {
+    clip.push_back(std::move(frame.encoded_image));
+  }
+  encoder->Release();
+  return clip;
+}
+
+const std::vector<EncodedImage>& GetClip() {
+  static const auto* const kClip = new std::vector<EncodedImage>(EncodeClip());
+  return *kClip;
+}
+
+// Holds on to the last decoded frame, like a renderer would.
+class LastFrameSink : public DecodedImageCallback {
+ public:
+  int32_t Decoded(VideoFrame& decoded_image) override {
+    last_frame_ = decoded_image;
+    return 0;
+  }
+
+ private:
+  std::optional<VideoFrame> last_frame_;
+};
+
+// The decoding part of a video receive stream.
+struct ReceiveStream {
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> decode_queue;
+  // Set if `decode_queue` runs on the shared pool.
+  DecodeThreadPool::DecodeQueue* pooled_decode_queue = nullptr;
+  std::unique_ptr<VideoDecoder> decoder;
+  LastFrameSink sink;
+};
+
+// Decodes a 360p AV1 clip for each of several simultaneously received
+// streams, either with a decode thread per stream and decoders that use all
+// cores, like receive streams without a decode thread pool, or on a shared
+// pool of one thread per core with single-threaded decoders.
+void BM_DecodeStreams(benchmark::State& state) {
+  const int num_streams = state.range(0);
+  const bool use_pool = state.range(1) != 0;
+  const std::vector<EncodedImage>& clip = GetClip();
+  const Environment env = CreateEnvironment();
+  const int num_cores = CpuInfo::DetectNumberOfCores();
+  scoped_refptr<SharedDecodeThreadPool> pool;
+  if (use_pool) {
+    pool = SharedDecodeThreadPool::Create(num_cores);
+  }
+
+  std::vector<std::unique_ptr<ReceiveStream>> streams;
+  for (int i = 0; i < num_streams; ++i) {
+    auto stream = std::make_unique<ReceiveStream>();
+    if (pool) {
+      std::unique_ptr<DecodeThreadPool::DecodeQueue, TaskQueueDeleter> queue =
+          pool->CreateQueue();
+      stream->pooled_decode_queue = queue.get();
+      stream->decode_queue = std::move(queue);
+    } else {
+      stream->decode_queue = env.task_queue_factory().CreateTaskQueue(
+          "DecodingQueue", TaskQueueFactory::Priority::HIGH);
+    }
+    streams.push_back(std::move(stream));
+  }
+  for (std::unique_ptr<ReceiveStream>& stream : streams) {
+    VideoDecoder::Settings settings;
+    settings.set_codec_type(kVideoCodecAV1);
+    settings.set_max_render_resolution({kWidth, kHeight});
+    settings.set_number_of_cores(pool ? pool->DecoderThreadsPerStream()
+                                      : num_cores);
+    stream->decoder = CreateDav1dDecoder(env);
+    RTC_CHECK(stream->decoder->Configure(settings));
+    stream->decoder->RegisterDecodeCompleteCallback(&stream->sink);
+  }
+
+  for (auto _ : state) {
+    Event done;
+    std::atomic<size_t> frames_left(num_streams * clip.size());
+    for (size_t i = 0; i < clip.size(); ++i) {
+      const Timestamp render_time = Timestamp::Millis(i * 1000 / kFramerate);
+      for (std::unique_ptr<ReceiveStream>& stream : streams) {
+        auto decode = [&frames_left, &done, render_time,
+                       decoder = stream->decoder.get(), frame = &clip[i]] {
+          RTC_CHECK_EQ(decoder->Decode(*frame, render_time.ms()),
+                       WEBRTC_VIDEO_CODEC_OK);
+          if (--frames_left == 0) {
+            done.Set();
+          }
+        };
+        if (stream->pooled_decode_queue) {
+          stream->pooled_decode_queue->PostTaskWithDeadline(std::move(decode),
+                                                            render_time);
+        } else {
+          stream->decode_queue->PostTask(std::move(decode));
+        }
+      }
+    }
+    done.Wait(Event::kForever);
+  }
+
+  for (std::unique_ptr<ReceiveStream>& stream : streams) {
+    stream->decode_queue = nullptr;
+    stream->decoder->Release();
+  }
+  state.SetItemsProcessed(state.iterations() * num_streams * clip.size());
+}
+
+BENCHMARK(BM_DecodeStreams)
+    ->ArgsProduct({{4, 16, 25}, {0, 1}})
+    ->ArgNames({"streams", "pool"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace webrtc
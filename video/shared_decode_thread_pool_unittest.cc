@@ -0,0 +1,226 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/shared_decode_thread_pool.h"
+
+#include <memory>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "api/video/decode_thread_pool.h"
+#include "rtc_base/event.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "system_wrappers/include/sleep.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAre;
+
+constexpr TimeDelta kTimeout = TimeDelta::Seconds(5);
+
+using DecodeQueuePtr =
+    std::unique_ptr<DecodeThreadPool::DecodeQueue, TaskQueueDeleter>;
+
+class TaskLog {
+ public:
+  void Add(int id) {
+    MutexLock lock(&mutex_);
+    ids_.push_back(id);
+  }
+  std::vector<int> ids() const {
+    MutexLock lock(&mutex_);
+    return ids_;
+  }
+
+ private:
+  mutable Mutex mutex_;
+  std::vector<int> ids_;
+};
+
+TEST(SharedDecodeThreadPoolTest, RunsTasksOfQueueInOrder) {
+  scoped_refptr<SharedDecodeThreadPool> pool =
+      SharedDecodeThreadPool::Create(4);
+  DecodeQueuePtr queue = pool->CreateQueue();
+  TaskLog log;
+  Event done;
+  for (int i = 0; i < 10; ++i) {
+    queue->PostTaskWithDeadline([&log, i] { log.Add(i); },
+                                Timestamp::Millis(100 - i));
+  }
+  queue->PostTask([&] { done.Set(); });
+  ASSERT_TRUE(done.Wait(kTimeout));
+  EXPECT_THAT(log.ids(), ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+}
+
+TEST(SharedDecodeThreadPoolTest, RunsTaskWithEarliestDeadlineFirst) {
+  scoped_refptr<SharedDecodeThreadPool> pool =
+      SharedDecodeThreadPool::Create(1);
+  DecodeQueuePtr blocked_queue = pool->CreateQueue();
+  DecodeQueuePtr late_queue = pool->CreateQueue();
+  DecodeQueuePtr early_queue = pool->CreateQueue();
+  Event unblock;
+  Event started;
+  blocked_queue->PostTask([&] {
+    started.Set();
+    unblock.Wait(kTimeout);
+  });
+  ASSERT_TRUE(started.Wait(kTimeout));
+
+  TaskLog log;
+  Event done;
+  late_queue->PostTaskWithDeadline(
+      [&] {
+        log.Add(2);
+        done.Set();
+      },
+      Timestamp::Millis(20));
+  early_queue->PostTaskWithDeadline([&] { log.Add(1); },
+                                    Timestamp::Millis(10));
+  unblock.Set();
+  ASSERT_TRUE(done.Wait(kTimeout));
+  EXPECT_THAT(log.ids(), ElementsAre(1, 2));
+}
+
+TEST(SharedDecodeThreadPoolTest, RunsQueuesInParallel) {
+  scoped_refptr<SharedDecodeThreadPool> pool =
+      SharedDecodeThreadPool::Create(2);
+  DecodeQueuePtr queue1 = pool->CreateQueue();
+  DecodeQueuePtr queue2 = pool->CreateQueue();
+  Event running1;
+  Event running2;
+  Event done1;
+  Event done2;
+  // Each task waits for the other one, which only finishes if they run at the
+  // same time.
+  queue1->PostTask([&] {
+    running1.Set();
+    if (running2.Wait(kTimeout)) {
+      done1.Set();
+    }
+  });
+  queue2->PostTask([&] {
+    running2.Set();
+    if (running1.Wait(kTimeout)) {
+      done2.Set();
+    }
+  });
+  EXPECT_TRUE(done1.Wait(kTimeout));
+  EXPECT_TRUE(done2.Wait(kTimeout));
+}
+
+TEST(SharedDecodeThreadPoolTest, QueueIsCurrentWhileRunningItsTask) {
+  scoped_refptr<SharedDecodeThreadPool> pool =
+      SharedDecodeThreadPool::Create(2);
+  DecodeQueuePtr queue = pool->CreateQueue();
+  Event done;
+  bool is_current = false;
+  queue->PostTask([&] {
+    is_current = queue->IsCurrent();
+    done.Set();
+  });
+  ASSERT_TRUE(done.Wait(kTimeout));
+  EXPECT_TRUE(is_current);
+  EXPECT_FALSE(queue->IsCurrent());
+}
+
+TEST(SharedDecodeThreadPoolTest, RunsDelayedTask) {
+  scoped_refptr<SharedDecodeThreadPool> pool =
+      SharedDecodeThreadPool::Create(1);
+  DecodeQueuePtr queue = pool->CreateQueue();
+  TaskLog log;
+  Event done;
+  queue->PostDelayedTask(
+      [&] {
+        log.Add(2);
+        done.Set();
+      },
+      TimeDelta::Millis(50));
+  queue->PostTask([&] { log.Add(1); });
+  ASSERT_TRUE(done.Wait(kTimeout));
+  EXPECT_THAT(log.ids(), ElementsAre(1, 2));
+}
+
+TEST(SharedDecodeThreadPoolTest, RunsDelayedTaskWhileOtherQueueIsBlocked) {
+  scoped_refptr<SharedDecodeThreadPool> pool =
+      SharedDecodeThreadPool::Create(2);
+  DecodeQueuePtr delayed_queue = pool->CreateQueue();
+  DecodeQueuePtr blocked_queue = pool->CreateQueue();
+  // Lets both threads go idle, waiting for tasks with no delayed task pending.
+  Event idle;
+  blocked_queue->PostTask([&] { idle.Set(); });
+  ASSERT_TRUE(idle.Wait(kTimeout));
+  SleepMs(10);
+
+  Event unblock;
+  Event done;
+  // The thread that wakes up for the delayed task may run the blocking task
+  // instead, and the other thread then has to wait for the delayed task.
+  delayed_queue->PostDelayedTask([&] { done.Set(); }, TimeDelta::Millis(50));
+  blocked_queue->PostTask([&] { unblock.Wait(kTimeout); });
+  EXPECT_TRUE(done.Wait(TimeDelta::Seconds(1)));
+  unblock.Set();
+}
+
+TEST(SharedDecodeThreadPoolTest, DeleteWaitsForRunningTask) {
+  scoped_refptr<SharedDecodeThreadPool> pool =
+      SharedDecodeThreadPool::Create(1);
+  DecodeQueuePtr queue = pool->CreateQueue();
+  Event started;
+  bool finished = false;
+  bool pending_task_ran = false;
+  queue->PostTask([&] {
+    started.Set();
+    // Gives Delete() time to start waiting.
+    Event().Wait(TimeDelta::Millis(50));
+    finished = true;
+  });
+  queue->PostTask([&] { pending_task_ran = true; });
+  ASSERT_TRUE(started.Wait(kTimeout));
+  queue = nullptr;
+  EXPECT_TRUE(finished);
+  EXPECT_FALSE(pending_task_ran);
+}
+
+TEST(SharedDecodeThreadPoolTest, QueueCanBeDeletedFromItsTask) {
+  scoped_refptr<SharedDecodeThreadPool> pool =
+      SharedDecodeThreadPool::Create(1);
+  DecodeQueuePtr queue = pool->CreateQueue();
+  DecodeQueuePtr other_queue = pool->CreateQueue();
+  Event done;
+  queue->PostTask([&] { queue = nullptr; });
+  other_queue->PostTask([&] { done.Set(); });
+  ASSERT_TRUE(done.Wait(kTimeout));
+  EXPECT_EQ(queue, nullptr);
+}
+
+TEST(SharedDecodeThreadPoolTest, DecoderThreadsPerStreamIsFixed) {
+  scoped_refptr<SharedDecodeThreadPool> pool =
+      SharedDecodeThreadPool::Create(8);
+  EXPECT_EQ(pool->DecoderThreadsPerStream(), 1);
+  std::vector<DecodeQueuePtr> queues;
+  for (int i = 0; i < 12; ++i) {
+    queues.push_back(pool->CreateQueue());
+  }
+  EXPECT_EQ(pool->DecoderThreadsPerStream(), 1);
+  queues.clear();
+
+  pool = SharedDecodeThreadPool::Create(8, /*decoder_threads_per_stream=*/2);
+  DecodeQueuePtr queue = pool->CreateQueue();
+  EXPECT_EQ(pool->DecoderThreadsPerStream(), 2);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -0,0 +1,784 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/shared_video_stream_encoder.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/algorithm/container.h"
+#include "absl/functional/function_ref.h"
+#include "api/adaptation/resource.h"
+#include "api/environment/environment.h"
+#include "api/fec_controller_override.h"
+#include "api/make_ref_counted.h"
+#include "api/rtp_parameters.h"
+#include "api/scoped_refptr.h"
+#include "api/sequence_checker.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "api/video/encoded_image.h"
+#include "api/video/video_adaptation_counters.h"
+#include "api/video/video_adaptation_reason.h"
+#include "api/video/video_bitrate_allocation.h"
+#include "api/video/video_codec_constants.h"
+#include "api/video/video_frame.h"
+#include "api/video/video_frame_type.h"
+#include "api/video/video_layers_allocation.h"
+#include "api/video/video_source_interface.h"
+#include "api/video_codecs/video_codec.h"
+#include "api/video_codecs/video_encoder.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread_types.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "video/config/video_encoder_config.h"
+#include "video/video_stream_encoder_interface.h"
+#include "video/video_stream_encoder_observer.h"
+
+namespace webrtc {
+namespace {
+
+// Returns the key frame request for the layers requested by `a` or `b`.
+std::vector<VideoFrameType> MergeKeyFrameRequests(
+    const std::vector<VideoFrameType>& a,
+    const std::vector<VideoFrameType>& b) {
+  if (a.empty() || b.empty() || a.size() != b.size()) {
+    return {};
+  }
+  std::vector<VideoFrameType> merged = a;
+  for (size_t i = 0; i < b.size(); ++i) {
+    if (b[i] == VideoFrameType::kVideoFrameKey) {
+      merged[i] = VideoFrameType::kVideoFrameKey;
+    }
+  }
+  return merged;
+}
+
+// Returns the part of `allocation` that belongs to the first `num_layers`
+// simulcast layers.
+VideoBitrateAllocation AllocationForLayers(
+    const VideoBitrateAllocation& allocation,
+    int num_layers) {
+  VideoBitrateAllocation layers_allocation;
+  for (int sid = 0; sid < std::min<int>(num_layers, kMaxSpatialLayers); ++sid) {
+    for (int tid = 0; tid < kMaxTemporalStreams; ++tid) {
+      if (allocation.HasBitrate(sid, tid)) {
+        layers_allocation.SetBitrate(sid, tid, allocation.GetBitrate(sid, tid));
+      }
+    }
+  }
+  return layers_allocation;
+}
+
+}  // namespace
+
+class SharedVideoStreamEncoder::SendStreamEncoder
+    : public VideoStreamEncoderInterface {
+ public:
+  explicit SendStreamEncoder(scoped_refptr<SharedVideoStreamEncoder> shared)
+      : shared_(std::move(shared)) {}
+  ~SendStreamEncoder() override { Stop(); }
+
+  void AddAdaptationResource(scoped_refptr<Resource> resource) override {
+    shared_->AddAdaptationResource(std::move(resource));
+  }
+  std::vector<scoped_refptr<Resource>> GetAdaptationResources() override {
+    return shared_->GetAdaptationResources();
+  }
+  void SetSource(VideoSourceInterface<VideoFrame>* source,
+                 const DegradationPreference& degradation_preference) override {
+    shared_->SetSource(this, source, degradation_preference);
+  }
+  void SetSink(EncoderSink* sink, bool rotation_applied) override {
+    shared_->SetSink(this, sink, rotation_applied);
+  }
+  void SetStartBitrate(int start_bitrate_bps) override {
+    shared_->SetStartBitrate(start_bitrate_bps);
+  }
+  void SendKeyFrame(const std::vector<VideoFrameType>& layers) override {
+    shared_->SendKeyFrame(layers);
+  }
+  void OnLossNotification(
+      const VideoEncoder::LossNotification& /* loss_notification */) override {
+  }
+  void OnBitrateUpdated(DataRate target_bitrate,
+                        DataRate stable_target_bitrate,
+                        DataRate link_allocation,
+                        uint8_t fraction_lost,
+                        int64_t round_trip_time_ms,
+                        double cwnd_reduce_ratio) override {
+    shared_->OnBitrateUpdated(this, target_bitrate, stable_target_bitrate,
+                              link_allocation, fraction_lost,
+                              round_trip_time_ms, cwnd_reduce_ratio);
+  }
+  void SetFecControllerOverride(
+      FecControllerOverride* /* fec_controller_override */) override {}
+  void ConfigureEncoder(VideoEncoderConfig config,
+                        size_t max_data_payload_length) override {
+    shared_->ConfigureEncoder(std::move(config), max_data_payload_length,
+                              nullptr);
+  }
+  void ConfigureEncoder(VideoEncoderConfig config,
+                        size_t max_data_payload_length,
+                        SetParametersCallback callback) override {
+    shared_->ConfigureEncoder(std::move(config), max_data_payload_length,
+                              std::move(callback));
+  }
+  void Stop() override {
+    if (!stopped_) {
+      stopped_ = true;
+      shared_->RemoveSendStream(this);
+    }
+  }
+
+ private:
+  const scoped_refptr<SharedVideoStreamEncoder> shared_;
+  bool stopped_ = false;
+};
+
+SharedVideoStreamEncoder::SharedVideoStreamEncoder(const Environment& env,
+                                                   Config config)
+    : env_(env), config_(config) {}
+
+SharedVideoStreamEncoder::~SharedVideoStreamEncoder() {
+  // Every send stream holds a reference, and the encoder is destroyed with
+  // the last send stream.
+  RTC_DCHECK(send_streams_.empty());
+}
+
+std::unique_ptr<VideoStreamEncoderInterface>
+SharedVideoStreamEncoder::CreateSendStreamEncoder(
+    VideoStreamEncoderObserver* observer,
+    absl::FunctionRef<std::unique_ptr<VideoStreamEncoderInterface>(
+        const Environment& env,
+        VideoStreamEncoderObserver* observer)> create_encoder) {
+  RTC_DCHECK_RUN_ON(&worker_checker_);
+  RTC_DCHECK(observer);
+  if (!encoder_) {
+    worker_queue_ = TaskQueueBase::Current();
+    encoder_ = create_encoder(env_, this);
+  }
+  auto send_stream_encoder = std::make_unique<SendStreamEncoder>(
+      scoped_refptr<SharedVideoStreamEncoder>(this));
+  SendStream send_stream = {.encoder = send_stream_encoder.get(),
+                            .target = make_ref_counted<Target>(observer)};
+  send_stream.waiting_for_key_frame.fill(true);
+  MutexLock lock(&mutex_);
+  send_streams_.push_back(send_stream);
+  return send_stream_encoder;
+}
+
+int SharedVideoStreamEncoder::NumSendStreams() const {
+  MutexLock lock(&mutex_);
+  return send_streams_.size();
+}
+
+void SharedVideoStreamEncoder::AddAdaptationResource(
+    scoped_refptr<Resource> resource) {
+  RTC_DCHECK_RUN_ON(&worker_checker_);
+  // Resources added to the Call are added to each of its send streams.
+  if (absl::c_linear_search(resources_, resource)) {
+    return;
+  }
+  resources_.push_back(resource);
+  encoder_->AddAdaptationResource(std::move(resource));
+}
+
+std::vector<scoped_refptr<Resource>>
+SharedVideoStreamEncoder::GetAdaptationResources() {
+  RTC_DCHECK_RUN_ON(&worker_checker_);
+  return encoder_->GetAdaptationResources();
+}
+
+void SharedVideoStreamEncoder::SetSource(
+    const SendStreamEncoder* encoder,
+    VideoSourceInterface<VideoFrame>* source,
+    const DegradationPreference& degradation_preference) {
+  RTC_DCHECK_RUN_ON(&worker_checker_);
+  {
+    MutexLock lock(&mutex_);
+    SendStream* send_stream = FindSendStream(encoder);
+    send_stream->source = source;
+    send_stream->degradation_preference = degradation_preference;
+  }
+  UpdateSource();
+}
+
+void SharedVideoStreamEncoder::SetSink(const SendStreamEncoder* encoder,
+                                       EncoderSink* sink,
+                                       bool rotation_applied) {
+  RTC_DCHECK_RUN_ON(&worker_checker_);
+  scoped_refptr<Target> target;
+  {
+    MutexLock lock(&mutex_);
+    target = FindSendStream(encoder)->target;
+    target->sink.store(sink);
+  }
+  WaitForDeliveries(*target);
+  if (!sink_set_) {
+    sink_set_ = true;
+    encoder_->SetSink(this, rotation_applied);
+  }
+}
+
+void SharedVideoStreamEncoder::SetStartBitrate(int start_bitrate_bps) {
+  RTC_DCHECK_RUN_ON(&worker_checker_);
+  encoder_->SetStartBitrate(start_bitrate_bps);
+}
+
+void SharedVideoStreamEncoder::SendKeyFrame(
+    const std::vector<VideoFrameType>& layers) {
+  // Key frame requests from RTCP arrive on the packet delivery queue.
+  if (!worker_queue_->IsCurrent()) {
+    worker_queue_->PostTask(
+        [self = scoped_refptr<SharedVideoStreamEncoder>(this), layers] {
+          self->SendKeyFrame(layers);
+        });
+    return;
+  }
+  RTC_DCHECK_RUN_ON(&worker_checker_);
+  if (encoder_) {
+    RequestKeyFrame(layers);
+  }
+}
+
+void SharedVideoStreamEncoder::OnBitrateUpdated(
+    const SendStreamEncoder* encoder,
+    DataRate target_bitrate,
+    DataRate stable_target_bitrate,
+    DataRate link_allocation,
+    uint8_t fraction_lost,
+    int64_t round_trip_time_ms,
+    double cwnd_reduce_ratio) {
+  RTC_DCHECK_RUN_ON(&worker_checker_);
+  std::array<bool, kMaxSimulcastStreams> new_layers = {};
+  {
+    MutexLock lock(&mutex_);
+    SendStream* send_stream = FindSendStream(encoder);
+    send_stream->target_bitrate = target_bitrate;
+    send_stream->stable_target_bitrate = stable_target_bitrate;
+    send_stream->link_allocation = link_allocation;
+    send_stream->fraction_lost = fraction_lost;
+    send_stream->round_trip_time_ms = round_trip_time_ms;
+    send_stream->cwnd_reduce_ratio = cwnd_reduce_ratio;
+    UpdateNumLayers(*send_stream, new_layers);
+  }
+  UpdateBitrate();
+  RequestKeyFrameForNewLayers(new_layers);
+}
+
+void SharedVideoStreamEncoder::ConfigureEncoder(
+    VideoEncoderConfig config,
+    size_t max_data_payload_length,
+    SetParametersCallback callback) {
+  RTC_DCHECK_RUN_ON(&worker_checker_);
+  // The reconfiguration also reports the configuration to send streams that
+  // were added since the last one.
+  if (callback) {
+    encoder_->ConfigureEncoder(std::move(config), max_data_payload_length,
+                               std::move(callback));
+  } else {
+    encoder_->ConfigureEncoder(std::move(config), max_data_payload_length);
+  }
+}
+
+void SharedVideoStreamEncoder::RemoveSendStream(
+    const SendStreamEncoder* encoder) {
+  RTC_DCHECK_RUN_ON(&worker_checker_);
+  bool last_send_stream = false;
+  scoped_refptr<Target> target;
+  {
+    MutexLock lock(&mutex_);
+    target = FindSendStream(encoder)->target;
+    target->removed.store(true);
+    std::erase_if(send_streams_, [&](const SendStream& send_stream) {
+      return send_stream.encoder == encoder;
+    });
+    last_send_stream = send_streams_.empty();
+    if (last_send_stream) {
+      allocation_ = VideoBitrateAllocation();
+      is_svc_ = false;
+      num_streams_ = 1;
+    }
+  }
+  WaitForDeliveries(*target);
+  if (!last_send_stream) {
+    UpdateSource();
+    UpdateBitrate();
+    return;
+  }
+  encoder_->Stop();
+  encoder_ = nullptr;
+  sink_set_ = false;
+  resources_.clear();
+  source_ = nullptr;
+  degradation_preference_ = DegradationPreference::DISABLED;
+  last_key_frame_request_ = Timestamp::MinusInfinity();
+  pending_key_frame_request_ = std::nullopt;
+}
+
+void SharedVideoStreamEncoder::RequestKeyFrame(
+    const std::vector<VideoFrameType>& layers) {
+  if (pending_key_frame_request_.has_value()) {
+    *pending_key_frame_request_ =
+        MergeKeyFrameRequests(*pending_key_frame_request_, layers);
+    return;
+  }
+  const Timestamp now = env_.clock().CurrentTime();
+  const TimeDelta since_last_request = now - last_key_frame_request_;
+  if (since_last_request >= config_.min_key_frame_request_interval) {
+    last_key_frame_request_ = now;
+    encoder_->SendKeyFrame(layers);
+    return;
+  }
+  pending_key_frame_request_ = layers;
+  worker_queue_->PostDelayedTask(
+      [self = scoped_refptr<SharedVideoStreamEncoder>(this)] {
+        RTC_DCHECK_RUN_ON(&self->worker_checker_);
+        std::optional<std::vector<VideoFrameType>> layers =
+            std::move(self->pending_key_frame_request_);
+        self->pending_key_frame_request_ = std::nullopt;
+        if (!layers.has_value() || !self->encoder_) {
+          return;
+        }
+        self->last_key_frame_request_ = self->env_.clock().CurrentTime();
+        self->encoder_->SendKeyFrame(*layers);
+      },
+      config_.min_key_frame_request_interval - since_last_request);
+}
+
+void SharedVideoStreamEncoder::RequestKeyFrameForNewLayers(
+    const std::array<bool, kMaxSimulcastStreams>& new_layers) {
+  if (absl::c_none_of(new_layers, [](bool is_new) { return is_new; })) {
+    return;
+  }
+  std::vector<VideoFrameType> layers;
+  {
+    MutexLock lock(&mutex_);
+    layers.assign(num_streams_, VideoFrameType::kVideoFrameDelta);
+  }
+  for (size_t i = 0; i < layers.size() && i < new_layers.size(); ++i) {
+    if (new_layers[i]) {
+      layers[i] = VideoFrameType::kVideoFrameKey;
+    }
+  }
+  SendKeyFrame(layers);
+}
+
+void SharedVideoStreamEncoder::UpdateSource() {
+  VideoSourceInterface<VideoFrame>* source = nullptr;
+  DegradationPreference degradation_preference =
+      DegradationPreference::DISABLED;
+  {
+    MutexLock lock(&mutex_);
+    for (const SendStream& send_stream : send_streams_) {
+      if (send_stream.source) {
+        source = send_stream.source;
+        degradation_preference = send_stream.degradation_preference;
+        break;
+      }
+    }
+  }
+  if (source == source_ && degradation_preference == degradation_preference_) {
+    return;
+  }
+  source_ = source;
+  degradation_preference_ = degradation_preference;
+  encoder_->SetSource(source, degradation_preference);
+}
+
+void SharedVideoStreamEncoder::UpdateBitrate() {
+  SendStream top;
+  {
+    MutexLock lock(&mutex_);
+    const SendStream* top_send_stream = nullptr;
+    for (const SendStream& send_stream : send_streams_) {
+      if (!top_send_stream ||
+          send_stream.target_bitrate > top_send_stream->target_bitrate) {
+        top_send_stream = &send_stream;
+      }
+    }
+    RTC_DCHECK(top_send_stream);
+    top = *top_send_stream;
+  }
+  encoder_->OnBitrateUpdated(top.target_bitrate, top.stable_target_bitrate,
+                             top.link_allocation, top.fraction_lost,
+                             top.round_trip_time_ms, top.cwnd_reduce_ratio);
+}
+
+void SharedVideoStreamEncoder::UpdateNumLayers(
+    SendStream& send_stream,
+    std::array<bool, kMaxSimulcastStreams>& new_layers) {
+  int num_layers = 0;
+  if (send_stream.target_bitrate > DataRate::Zero()) {
+    // Always send the lowest layer, and each higher layer that fits the
+    // target bitrate together with the layers below it. With SVC, all the
+    // layers are in one stream.
+    num_layers = 1;
+    if (!is_svc_) {
+      uint32_t bitrate_bps = allocation_.GetSpatialLayerSum(0);
+      while (num_layers < static_cast<int>(num_streams_)) {
+        bitrate_bps += allocation_.GetSpatialLayerSum(num_layers);
+        if (DataRate::BitsPerSec(bitrate_bps) > send_stream.target_bitrate) {
+          break;
+        }
+        ++num_layers;
+      }
+    }
+  }
+  for (int i = send_stream.num_layers; i < num_layers; ++i) {
+    send_stream.waiting_for_key_frame[i] = true;
+    new_layers[i] = true;
+  }
+  send_stream.num_layers = num_layers;
+}
+
+bool SharedVideoStreamEncoder::IsSent(const SendStream& send_stream,
+                                      int layer) {
+  return send_stream.target->sink.load() != nullptr &&
+         layer < send_stream.num_layers;
+}
+
+SharedVideoStreamEncoder::SendStream* SharedVideoStreamEncoder::FindSendStream(
+    const SendStreamEncoder* encoder) {
+  auto it = absl::c_find_if(send_streams_, [&](const SendStream& send_stream) {
+    return send_stream.encoder == encoder;
+  });
+  RTC_CHECK(it != send_streams_.end());
+  return &*it;
+}
+
+std::vector<SharedVideoStreamEncoder::Delivery>
+SharedVideoStreamEncoder::StartDeliveries(
+    absl::FunctionRef<bool(const SendStream& send_stream)> include) const {
+  std::vector<Delivery> deliveries;
+  for (const SendStream& send_stream : send_streams_) {
+    if (include(send_stream)) {
+      send_stream.target->delivering_threads.push_back(CurrentThreadRef());
+      deliveries.push_back({.target = send_stream.target,
+                            .num_layers = send_stream.num_layers});
+    }
+  }
+  return deliveries;
+}
+
+std::vector<SharedVideoStreamEncoder::Delivery>
+SharedVideoStreamEncoder::StartDeliveries() const {
+  return StartDeliveries([](const SendStream&) { return true; });
+}
+
+void SharedVideoStreamEncoder::Deliver(
+    const std::vector<Delivery>& deliveries,
+    absl::FunctionRef<void(const Delivery& delivery)> f) const {
+  for (const Delivery& delivery : deliveries) {
+    if (!delivery.target->removed.load()) {
+      f(delivery);
+    }
+  }
+  if (deliveries.empty()) {
+    return;
+  }
+  const PlatformThreadRef current_thread = CurrentThreadRef();
+  {
+    MutexLock lock(&mutex_);
+    for (const Delivery& delivery : deliveries) {
+      std::vector<PlatformThreadRef>& threads =
+          delivery.target->delivering_threads;
+      auto it = absl::c_find_if(threads, [&](const PlatformThreadRef& thread) {
+        return IsThreadRefEqual(thread, current_thread);
+      });
+      RTC_DCHECK(it != threads.end());
+      threads.erase(it);
+    }
+  }
+  delivery_done_.Set();
+}
+
+void SharedVideoStreamEncoder::WaitForDeliveries(const Target& target) {
+  // Deliveries on the current thread are the ones the caller is called from,
+  // and end after it returns.
+  const PlatformThreadRef current_thread = CurrentThreadRef();
+  while (true) {
+    {
+      MutexLock lock(&mutex_);
+      if (absl::c_all_of(target.delivering_threads,
+                         [&](const PlatformThreadRef& thread) {
+                           return IsThreadRefEqual(thread, current_thread);
+                         })) {
+        return;
+      }
+    }
+    delivery_done_.Wait(Event::kForever);
+  }
+}
+
+void SharedVideoStreamEncoder::ForEachObserver(
+    absl::FunctionRef<void(VideoStreamEncoderObserver& observer)> f) {
+  std::vector<Delivery> deliveries;
+  {
+    MutexLock lock(&mutex_);
+    deliveries = StartDeliveries();
+  }
+  Deliver(deliveries,
+          [&](const Delivery& delivery) { f(*delivery.target->observer); });
+}
+
+void SharedVideoStreamEncoder::OnEncoderConfigurationChanged(
+    std::vector<VideoStream> streams,
+    bool is_svc,
+    VideoEncoderConfig::ContentType content_type,
+    int min_transmit_bitrate_bps) {
+  std::vector<Delivery> deliveries;
+  {
+    MutexLock lock(&mutex_);
+    is_svc_ = is_svc;
+    num_streams_ = std::max<size_t>(streams.size(), 1);
+    deliveries = StartDeliveries();
+  }
+  Deliver(deliveries, [&](const Delivery& delivery) {
+    if (EncoderSink* sink = delivery.target->sink.load()) {
+      sink->OnEncoderConfigurationChanged(streams, is_svc, content_type,
+                                          min_transmit_bitrate_bps);
+    }
+  });
+}
+
+void SharedVideoStreamEncoder::OnBitrateAllocationUpdated(
+    const VideoBitrateAllocation& allocation) {
+  std::array<bool, kMaxSimulcastStreams> new_layers = {};
+  std::vector<Delivery> deliveries;
+  bool is_svc = false;
+  {
+    MutexLock lock(&mutex_);
+    allocation_ = allocation;
+    is_svc = is_svc_;
+    for (SendStream& send_stream : send_streams_) {
+      UpdateNumLayers(send_stream, new_layers);
+    }
+    deliveries = StartDeliveries();
+  }
+  Deliver(deliveries, [&](const Delivery& delivery) {
+    if (EncoderSink* sink = delivery.target->sink.load()) {
+      sink->OnBitrateAllocationUpdated(
+          is_svc ? allocation
+                 : AllocationForLayers(allocation, delivery.num_layers));
+    }
+  });
+  RequestKeyFrameForNewLayers(new_layers);
+}
+
+void SharedVideoStreamEncoder::OnVideoLayersAllocationUpdated(
+    VideoLayersAllocation allocation) {
+  std::vector<Delivery> deliveries;
+  {
+    MutexLock lock(&mutex_);
+    deliveries = StartDeliveries();
+  }
+  Deliver(deliveries, [&](const Delivery& delivery) {
+    EncoderSink* sink = delivery.target->sink.load();
+    if (!sink) {
+      return;
+    }
+    VideoLayersAllocation layers_allocation = allocation;
+    auto& layers = layers_allocation.active_spatial_layers;
+    layers.erase(
+        std::remove_if(layers.begin(), layers.end(),
+                       [&](const VideoLayersAllocation::SpatialLayer& layer) {
+                         return layer.rtp_stream_index >= delivery.num_layers;
+                       }),
+        layers.end());
+    sink->OnVideoLayersAllocationUpdated(std::move(layers_allocation));
+  });
+}
+
+EncodedImageCallback::Result SharedVideoStreamEncoder::OnEncodedImage(
+    const EncodedImage& encoded_image,
+    const CodecSpecificInfo* codec_specific_info) {
+  const int layer = encoded_image.SimulcastIndex().value_or(0);
+  RTC_DCHECK_LT(layer, kMaxSimulcastStreams);
+  const bool is_key_frame =
+      encoded_image.FrameType() == VideoFrameType::kVideoFrameKey;
+  std::vector<Delivery> deliveries;
+  {
+    MutexLock lock(&mutex_);
+    for (SendStream& send_stream : send_streams_) {
+      if (is_key_frame && IsSent(send_stream, layer)) {
+        send_stream.waiting_for_key_frame[layer] = false;
+      }
+    }
+    deliveries = StartDeliveries([&](const SendStream& send_stream) {
+      return IsSent(send_stream, layer) &&
+             !send_stream.waiting_for_key_frame[layer];
+    });
+  }
+  Deliver(deliveries, [&](const Delivery& delivery) {
+    if (EncoderSink* sink = delivery.target->sink.load()) {
+      sink->OnEncodedImage(encoded_image, codec_specific_info);
+    }
+  });
+  return Result(Result::OK, encoded_image.RtpTimestamp());
+}
+
+void SharedVideoStreamEncoder::OnDroppedFrame(
+    EncodedImageCallback::DropReason reason) {
+  std::vector<Delivery> deliveries;
+  {
+    MutexLock lock(&mutex_);
+    deliveries = StartDeliveries();
+  }
+  Deliver(deliveries, [&](const Delivery& delivery) {
+    if (EncoderSink* sink = delivery.target->sink.load()) {
+      sink->OnDroppedFrame(reason);
+    }
+  });
+}
+
+void SharedVideoStreamEncoder::OnEncodedFrameTimeMeasured(
+    int encode_duration_ms,
+    int encode_usage_percent) {
+  ForEachObserver([&](VideoStreamEncoderObserver& observer) {
+    observer.OnEncodedFrameTimeMeasured(encode_duration_ms,
+                                        encode_usage_percent);
+  });
+}
+
+void SharedVideoStreamEncoder::OnIncomingFrame(int width, int height) {
+  ForEachObserver([&](VideoStreamEncoderObserver& observer) {
+    observer.OnIncomingFrame(width, height);
+  });
+}
+
+void SharedVideoStreamEncoder::OnSendEncodedImage(
+    const EncodedImage& encoded_image,
+    const CodecSpecificInfo* codec_info) {
+  const int layer = encoded_image.SimulcastIndex().value_or(0);
+  std::vector<Delivery> deliveries;
+  {
+    MutexLock lock(&mutex_);
+    deliveries = StartDeliveries([&](const SendStream& send_stream) {
+      return IsSent(send_stream, layer);
+    });
+  }
+  Deliver(deliveries, [&](const Delivery& delivery) {
+    delivery.target->observer->OnSendEncodedImage(encoded_image, codec_info);
+  });
+}
+
+void SharedVideoStreamEncoder::OnEncoderImplementationChanged(
+    EncoderImplementation implementation) {
+  ForEachObserver([&](VideoStreamEncoderObserver& observer) {
+    observer.OnEncoderImplementationChanged(implementation);
+  });
+}
+
+void SharedVideoStreamEncoder::OnFrameDropped(
+    VideoStreamEncoderObserver::DropReason reason) {
+  ForEachObserver([&](VideoStreamEncoderObserver& observer) {
+    observer.OnFrameDropped(reason);
+  });
+}
+
+void SharedVideoStreamEncoder::OnEncoderReconfigured(
+    const VideoEncoderConfig& encoder_config,
+    const std::vector<VideoStream>& streams) {
+  ForEachObserver([&](VideoStreamEncoderObserver& observer) {
+    observer.OnEncoderReconfigured(encoder_config, streams);
+  });
+}
+
+void SharedVideoStreamEncoder::OnAdaptationChanged(
+    VideoAdaptationReason reason,
+    const VideoAdaptationCounters& cpu_steps,
+    const VideoAdaptationCounters& quality_steps) {
+  ForEachObserver([&](VideoStreamEncoderObserver& observer) {
+    observer.OnAdaptationChanged(reason, cpu_steps, quality_steps);
+  });
+}
+
+void SharedVideoStreamEncoder::ClearAdaptationStats() {
+  ForEachObserver([](VideoStreamEncoderObserver& observer) {
+    observer.ClearAdaptationStats();
+  });
+}
+
+void SharedVideoStreamEncoder::UpdateAdaptationSettings(
+    AdaptationSettings cpu_settings,
+    AdaptationSettings quality_settings) {
+  ForEachObserver([&](VideoStreamEncoderObserver& observer) {
+    observer.UpdateAdaptationSettings(cpu_settings, quality_settings);
+  });
+}
+
+void SharedVideoStreamEncoder::OnMinPixelLimitReached() {
+  ForEachObserver([](VideoStreamEncoderObserver& observer) {
+    observer.OnMinPixelLimitReached();
+  });
+}
+
+void SharedVideoStreamEncoder::OnInitialQualityResolutionAdaptDown() {
+  ForEachObserver([](VideoStreamEncoderObserver& observer) {
+    observer.OnInitialQualityResolutionAdaptDown();
+  });
+}
+
+void SharedVideoStreamEncoder::OnSuspendChange(bool is_suspended) {
+  ForEachObserver([&](VideoStreamEncoderObserver& observer) {
+    observer.OnSuspendChange(is_suspended);
+  });
+}
+
+void SharedVideoStreamEncoder::OnBitrateAllocationUpdated(
+    const VideoCodec& codec,
+    const VideoBitrateAllocation& allocation) {
+  ForEachObserver([&](VideoStreamEncoderObserver& observer) {
+    observer.OnBitrateAllocationUpdated(codec, allocation);
+  });
+}
+
+void SharedVideoStreamEncoder::OnEncoderInternalScalerUpdate(bool is_scaled) {
+  ForEachObserver([&](VideoStreamEncoderObserver& observer) {
+    observer.OnEncoderInternalScalerUpdate(is_scaled);
+  });
+}
+
+void SharedVideoStreamEncoder::OnEncoderInputFrameConverted() {
+  ForEachObserver([](VideoStreamEncoderObserver& observer) {
+    observer.OnEncoderInputFrameConverted();
+  });
+}
+
+int SharedVideoStreamEncoder::GetInputFrameRate() const {
+  std::vector<Delivery> deliveries;
+  {
+    MutexLock lock(&mutex_);
+    if (send_streams_.empty()) {
+      return 0;
+    }
+    deliveries = StartDeliveries([&](const SendStream& send_stream) {
+      return &send_stream == &send_streams_.front();
+    });
+  }
+  int input_frame_rate = 0;
+  Deliver(deliveries, [&](const Delivery& delivery) {
+    input_frame_rate = delivery.target->observer->GetInputFrameRate();
+  });
+  return input_frame_rate;
+}
+
+}  // namespace webrtc
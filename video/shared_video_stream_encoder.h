@@ -0,0 +1,310 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VIDEO_SHARED_VIDEO_STREAM_ENCODER_H_
+#define VIDEO_SHARED_VIDEO_STREAM_ENCODER_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "absl/functional/function_ref.h"
+#include "api/adaptation/resource.h"
+#include "api/environment/environment.h"
+#include "api/fec_controller_override.h"
+#include "api/ref_counted_base.h"
+#include "api/rtp_parameters.h"
+#include "api/scoped_refptr.h"
+#include "api/sequence_checker.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "api/video/encoded_image.h"
+#include "api/video/shared_video_encoder.h"
+#include "api/video/video_adaptation_counters.h"
+#include "api/video/video_adaptation_reason.h"
+#include "api/video/video_bitrate_allocation.h"
+#include "api/video/video_codec_constants.h"
+#include "api/video/video_frame.h"
+#include "api/video/video_frame_type.h"
+#include "api/video/video_layers_allocation.h"
+#include "api/video/video_source_interface.h"
+#include "api/video_codecs/video_codec.h"
+#include "api/video_codecs/video_encoder.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread_types.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system/no_unique_address.h"
+#include "rtc_base/thread_annotations.h"
+#include "video/config/video_encoder_config.h"
+#include "video/video_stream_encoder_interface.h"
+#include "video/video_stream_encoder_observer.h"
+
+namespace webrtc {
+
+// Encodes one source once for several video send streams, e.g. one per
+// receiver of a broadcast, and fans the encoded frames out to them. Every send
+// stream gets its own VideoStreamEncoderInterface from
+// CreateSendStreamEncoder(), which it uses in place of a VideoStreamEncoder.
+// Applications create it with CreateSharedVideoEncoder().
+//
+// The shared encoder runs at the highest target bitrate of the send streams.
+// Every send stream gets only the simulcast layers that fit its own target
+// bitrate, so that its bandwidth estimate selects layers instead of setting
+// the encoder bitrate. A send stream starts getting a layer with the next key
+// frame of that layer. Key frame requests of the send streams are coalesced,
+// and forwarded to the encoder at most once per
+// `min_key_frame_request_interval`.
+//
+// The send streams are expected to have the same source and encoder
+// configuration, and must be created and configured on the same worker
+// thread, which is the case for the PeerConnections of one
+// PeerConnectionFactory. Loss notifications and FEC overrides of individual
+// send streams are not forwarded, since they would change the encoding for
+// all of them.
+//
+// Encoder output is delivered to the sinks and stats observers of the send
+// streams without holding a lock, so they may call back into the shared
+// encoder, including to stop their send stream or replace its sink. Once
+// Stop() or SetSink() of a send stream returns, its previous sink and
+// observer are no longer called, other than by a delivery that the call was
+// made from.
+//
+// The encoder runs with the environment of the shared encoder. It does not use
+// the metronome, encoder selector or encoder switch callback of any send
+// stream, since those belong to a single call, which may end before the
+// others.
+class SharedVideoStreamEncoder
+    : public SharedVideoEncoder,
+      public VideoStreamEncoderInterface::EncoderSink,
+      public VideoStreamEncoderObserver {
+ public:
+  struct Config {
+    TimeDelta min_key_frame_request_interval = TimeDelta::Millis(300);
+  };
+
+  SharedVideoStreamEncoder(const Environment& env, Config config);
+  explicit SharedVideoStreamEncoder(const Environment& env)
+      : SharedVideoStreamEncoder(env, Config()) {}
+
+  // Returns the implementation of `shared_encoder`.
+  static SharedVideoStreamEncoder& FromSharedVideoEncoder(
+      SharedVideoEncoder& shared_encoder) {
+    return *shared_encoder.implementation();
+  }
+
+  // Creates the encoder interface of a send stream, whose encoder stats are
+  // reported to `observer`. The shared encoder is created with
+  // `create_encoder` when the first send stream is added, and destroyed when
+  // the last one is stopped. It must run with the environment passed to
+  // `create_encoder`, and report its stats to the observer passed to it,
+  // which forwards them to the send streams.
+  std::unique_ptr<VideoStreamEncoderInterface> CreateSendStreamEncoder(
+      VideoStreamEncoderObserver* observer,
+      absl::FunctionRef<std::unique_ptr<VideoStreamEncoderInterface>(
+          const Environment& env,
+          VideoStreamEncoderObserver* observer)> create_encoder);
+
+  // Implements SharedVideoEncoder.
+  int NumSendStreams() const override;
+
+ protected:
+  ~SharedVideoStreamEncoder() override;
+
+ private:
+  class SendStreamEncoder;
+
+  // The sink and observer of a send stream, as used by the deliveries of the
+  // encoder output. Kept alive by the deliveries that are in progress after
+  // the send stream is removed.
+  struct Target : public RefCountedNonVirtual<Target> {
+    explicit Target(VideoStreamEncoderObserver* observer)
+        : observer(observer) {}
+
+    VideoStreamEncoderObserver* const observer;
+    std::atomic<EncoderSink*> sink{nullptr};
+    // Set when the send stream is removed, after which it is not called.
+    std::atomic<bool> removed{false};
+    // The thread of each delivery to the send stream in progress. Guarded by
+    // `mutex_` of the shared encoder.
+    std::vector<PlatformThreadRef> delivering_threads;
+  };
+
+  // A delivery to `target`, with the number of layers of its send stream when
+  // the delivery started.
+  struct Delivery {
+    scoped_refptr<Target> target;
+    int num_layers;
+  };
+
+  // Implements SharedVideoEncoder.
+  SharedVideoStreamEncoder* implementation() override { return this; }
+
+  struct SendStream {
+    const SendStreamEncoder* encoder;
+    scoped_refptr<Target> target;
+    VideoSourceInterface<VideoFrame>* source = nullptr;
+    DegradationPreference degradation_preference =
+        DegradationPreference::DISABLED;
+    DataRate target_bitrate = DataRate::Zero();
+    DataRate stable_target_bitrate = DataRate::Zero();
+    DataRate link_allocation = DataRate::Zero();
+    uint8_t fraction_lost = 0;
+    int64_t round_trip_time_ms = 0;
+    double cwnd_reduce_ratio = 0;
+    // Number of simulcast layers sent to the send stream.
+    int num_layers = 0;
+    // Whether the send stream waits for a key frame of each layer.
+    std::array<bool, kMaxSimulcastStreams> waiting_for_key_frame;
+  };
+
+  // Called by SendStreamEncoder on the worker thread.
+  void AddAdaptationResource(scoped_refptr<Resource> resource);
+  std::vector<scoped_refptr<Resource>> GetAdaptationResources();
+  void SetSource(const SendStreamEncoder* encoder,
+                 VideoSourceInterface<VideoFrame>* source,
+                 const DegradationPreference& degradation_preference);
+  void SetSink(const SendStreamEncoder* encoder,
+               EncoderSink* sink,
+               bool rotation_applied);
+  void SetStartBitrate(int start_bitrate_bps);
+  void SendKeyFrame(const std::vector<VideoFrameType>& layers);
+  void OnBitrateUpdated(const SendStreamEncoder* encoder,
+                        DataRate target_bitrate,
+                        DataRate stable_target_bitrate,
+                        DataRate link_allocation,
+                        uint8_t fraction_lost,
+                        int64_t round_trip_time_ms,
+                        double cwnd_reduce_ratio);
+  void ConfigureEncoder(VideoEncoderConfig config,
+                        size_t max_data_payload_length,
+                        SetParametersCallback callback);
+  void RemoveSendStream(const SendStreamEncoder* encoder);
+
+  // Forwards `layers` to the encoder, or keeps them until the key frame
+  // request interval has passed.
+  void RequestKeyFrame(const std::vector<VideoFrameType>& layers)
+      RTC_RUN_ON(worker_checker_);
+  // Requests key frames for the layers the send streams started to get.
+  void RequestKeyFrameForNewLayers(
+      const std::array<bool, kMaxSimulcastStreams>& new_layers);
+  void UpdateSource() RTC_RUN_ON(worker_checker_);
+  void UpdateBitrate() RTC_RUN_ON(worker_checker_);
+  // Updates the layers of `send_stream` and marks the layers it starts to get
+  // in `new_layers`.
+  void UpdateNumLayers(SendStream& send_stream,
+                       std::array<bool, kMaxSimulcastStreams>& new_layers)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // Returns true if the frame of simulcast layer `layer` is sent to
+  // `send_stream`.
+  static bool IsSent(const SendStream& send_stream, int layer);
+  SendStream* FindSendStream(const SendStreamEncoder* encoder)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // Starts deliveries on the current thread to the send streams for which
+  // `include` returns true, or to all of them.
+  std::vector<Delivery> StartDeliveries(
+      absl::FunctionRef<bool(const SendStream& send_stream)> include) const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  std::vector<Delivery> StartDeliveries() const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // Calls `f` for each of `deliveries` whose send stream has not been removed,
+  // and ends them.
+  void Deliver(const std::vector<Delivery>& deliveries,
+               absl::FunctionRef<void(const Delivery& delivery)> f) const
+      RTC_LOCKS_EXCLUDED(mutex_);
+  // Waits for the deliveries to `target` that run on other threads.
+  void WaitForDeliveries(const Target& target) RTC_LOCKS_EXCLUDED(mutex_);
+  void ForEachObserver(
+      absl::FunctionRef<void(VideoStreamEncoderObserver& observer)> f);
+
+  // Implements VideoStreamEncoderInterface::EncoderSink, called by the
+  // encoder.
+  void OnEncoderConfigurationChanged(
+      std::vector<VideoStream> streams,
+      bool is_svc,
+      VideoEncoderConfig::ContentType content_type,
+      int min_transmit_bitrate_bps) override;
+  void OnBitrateAllocationUpdated(
+      const VideoBitrateAllocation& allocation) override;
+  void OnVideoLayersAllocationUpdated(
+      VideoLayersAllocation allocation) override;
+  EncodedImageCallback::Result OnEncodedImage(
+      const EncodedImage& encoded_image,
+      const CodecSpecificInfo* codec_specific_info) override;
+  void OnDroppedFrame(EncodedImageCallback::DropReason reason) override;
+
+  // Implements VideoStreamEncoderObserver, called by the encoder. Forwards the
+  // stats to the observers of the send streams.
+  void OnEncodedFrameTimeMeasured(int encode_duration_ms,
+                                  int encode_usage_percent) override;
+  void OnIncomingFrame(int width, int height) override;
+  void OnSendEncodedImage(const EncodedImage& encoded_image,
+                          const CodecSpecificInfo* codec_info) override;
+  void OnEncoderImplementationChanged(
+      EncoderImplementation implementation) override;
+  void OnFrameDropped(VideoStreamEncoderObserver::DropReason reason) override;
+  void OnEncoderReconfigured(const VideoEncoderConfig& encoder_config,
+                             const std::vector<VideoStream>& streams) override;
+  void OnAdaptationChanged(
+      VideoAdaptationReason reason,
+      const VideoAdaptationCounters& cpu_steps,
+      const VideoAdaptationCounters& quality_steps) override;
+  void ClearAdaptationStats() override;
+  void UpdateAdaptationSettings(AdaptationSettings cpu_settings,
+                                AdaptationSettings quality_settings) override;
+  void OnMinPixelLimitReached() override;
+  void OnInitialQualityResolutionAdaptDown() override;
+  void OnSuspendChange(bool is_suspended) override;
+  void OnBitrateAllocationUpdated(
+      const VideoCodec& codec,
+      const VideoBitrateAllocation& allocation) override;
+  void OnEncoderInternalScalerUpdate(bool is_scaled) override;
+  void OnEncoderInputFrameConverted() override;
+  int GetInputFrameRate() const override;
+
+  const Environment env_;
+  const Config config_;
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker worker_checker_{
+      SequenceChecker::kDetached};
+  TaskQueueBase* worker_queue_ = nullptr;
+  std::unique_ptr<VideoStreamEncoderInterface> encoder_
+      RTC_GUARDED_BY(worker_checker_);
+  bool sink_set_ RTC_GUARDED_BY(worker_checker_) = false;
+  std::vector<scoped_refptr<Resource>> resources_
+      RTC_GUARDED_BY(worker_checker_);
+  VideoSourceInterface<VideoFrame>* source_ RTC_GUARDED_BY(worker_checker_) =
+      nullptr;
+  DegradationPreference degradation_preference_
+      RTC_GUARDED_BY(worker_checker_) = DegradationPreference::DISABLED;
+  Timestamp last_key_frame_request_ RTC_GUARDED_BY(worker_checker_) =
+      Timestamp::MinusInfinity();
+  // Requests that wait for the key frame request interval to pass. An empty
+  // vector requests key frames for all layers.
+  std::optional<std::vector<VideoFrameType>> pending_key_frame_request_
+      RTC_GUARDED_BY(worker_checker_);
+
+  // Signaled when deliveries end.
+  mutable Event delivery_done_;
+
+  mutable Mutex mutex_;
+  std::vector<SendStream> send_streams_ RTC_GUARDED_BY(mutex_);
+  VideoBitrateAllocation allocation_ RTC_GUARDED_BY(mutex_);
+  bool is_svc_ RTC_GUARDED_BY(mutex_) = false;
+  size_t num_streams_ RTC_GUARDED_BY(mutex_) = 1;
+};
+
+}  // namespace webrtc
+
+#endif  // VIDEO_SHARED_VIDEO_STREAM_ENCODER_H_
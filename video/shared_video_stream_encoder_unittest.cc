@@ -0,0 +1,321 @@
+/*
+ *  Copyright (c) 2026 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/shared_video_stream_encoder.h"
+
+#include <memory>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/make_ref_counted.h"
+#include "api/scoped_refptr.h"
+#include "api/units/data_rate.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "api/video/create_shared_video_encoder.h"
+#include "api/video/encoded_image.h"
+#include "api/video/video_bitrate_allocation.h"
+#include "api/video/video_frame_type.h"
+#include "api/video/video_layers_allocation.h"
+#include "api/video/shared_video_encoder.h"
+#include "api/video_codecs/video_encoder.h"
+#include "call/video_send_stream.h"
+#include "modules/video_coding/include/video_codec_interface.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+#include "test/scoped_key_value_config.h"
+#include "test/time_controller/simulated_time_controller.h"
+#include "video/config/video_encoder_config.h"
+#include "video/send_statistics_proxy.h"
+#include "video/test/mock_video_stream_encoder.h"
+#include "video/video_stream_encoder_interface.h"
+#include "video/video_stream_encoder_observer.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::NiceMock;
+using ::testing::Property;
+using ::testing::Return;
+using ::testing::SaveArg;
+
+class MockEncoderSink : public VideoStreamEncoderInterface::EncoderSink {
+ public:
+  MockEncoderSink() {
+    ON_CALL(*this, OnEncodedImage).WillByDefault(Return(Result(Result::OK)));
+  }
+
+  MOCK_METHOD(void,
+              OnEncoderConfigurationChanged,
+              (std::vector<VideoStream>,
+               bool,
+               VideoEncoderConfig::ContentType,
+               int),
+              (override));
+  MOCK_METHOD(void,
+              OnBitrateAllocationUpdated,
+              (const VideoBitrateAllocation&),
+              (override));
+  MOCK_METHOD(void,
+              OnVideoLayersAllocationUpdated,
+              (VideoLayersAllocation),
+              (override));
+  MOCK_METHOD(Result,
+              OnEncodedImage,
+              (const EncodedImage&, const CodecSpecificInfo*),
+              (override));
+};
+
+EncodedImage CreateEncodedImage(int simulcast_index, VideoFrameType type) {
+  EncodedImage image;
+  image.SetSimulcastIndex(simulcast_index);
+  image.SetFrameType(type);
+  return image;
+}
+
+class SharedVideoStreamEncoderTest : public ::testing::Test {
+ protected:
+  // Adds a send stream with its own stats and sink, and returns its encoder.
+  std::unique_ptr<VideoStreamEncoderInterface> AddSendStream(
+      NiceMock<MockEncoderSink>& sink) {
+    stats_proxies_.push_back(std::make_unique<SendStatisticsProxy>(
+        time_controller_.GetClock(), VideoSendStream::Config(nullptr),
+        VideoEncoderConfig::ContentType::kRealtimeVideo, field_trials_));
+    std::unique_ptr<VideoStreamEncoderInterface> send_stream_encoder =
+        shared_->CreateSendStreamEncoder(
+            stats_proxies_.back().get(),
+            [&](const Environment& /* env */,
+                VideoStreamEncoderObserver* /* observer */) {
+              auto encoder =
+                  std::make_unique<NiceMock<MockVideoStreamEncoder>>();
+              encoder_ = encoder.get();
+              ON_CALL(*encoder_, SetSink)
+                  .WillByDefault(SaveArg<0>(&encoder_sink_));
+              return encoder;
+            });
+    send_stream_encoder->SetSink(&sink, /*rotation_applied=*/false);
+    return send_stream_encoder;
+  }
+
+  void ConfigureSimulcast(int num_streams) {
+    encoder_sink_->OnEncoderConfigurationChanged(
+        std::vector<VideoStream>(num_streams), /*is_svc=*/false,
+        VideoEncoderConfig::ContentType::kRealtimeVideo,
+        /*min_transmit_bitrate_bps=*/0);
+  }
+
+  GlobalSimulatedTimeController time_controller_{Timestamp::Seconds(1000)};
+  test::ScopedKeyValueConfig field_trials_;
+  std::vector<std::unique_ptr<SendStatisticsProxy>> stats_proxies_;
+  scoped_refptr<SharedVideoStreamEncoder> shared_ =
+      make_ref_counted<SharedVideoStreamEncoder>(
+          CreateEnvironment(&field_trials_, time_controller_.GetClock()));
+  NiceMock<MockVideoStreamEncoder>* encoder_ = nullptr;
+  VideoStreamEncoderInterface::EncoderSink* encoder_sink_ = nullptr;
+};
+
+TEST_F(SharedVideoStreamEncoderTest, EncodesOnceForAllSendStreams) {
+  NiceMock<MockEncoderSink> sink1;
+  NiceMock<MockEncoderSink> sink2;
+  auto send_stream1 = AddSendStream(sink1);
+  MockVideoStreamEncoder* encoder = encoder_;
+  auto send_stream2 = AddSendStream(sink2);
+  EXPECT_EQ(encoder_, encoder);
+  EXPECT_EQ(shared_->NumSendStreams(), 2);
+  ASSERT_TRUE(encoder_sink_);
+
+  send_stream1->OnBitrateUpdated(DataRate::KilobitsPerSec(500),
+                                 DataRate::KilobitsPerSec(500),
+                                 DataRate::KilobitsPerSec(500), 0, 0, 0);
+  send_stream2->OnBitrateUpdated(DataRate::KilobitsPerSec(300),
+                                 DataRate::KilobitsPerSec(300),
+                                 DataRate::KilobitsPerSec(300), 0, 0, 0);
+
+  EXPECT_CALL(sink1, OnEncodedImage).Times(2);
+  EXPECT_CALL(sink2, OnEncodedImage).Times(2);
+  encoder_sink_->OnEncodedImage(
+      CreateEncodedImage(0, VideoFrameType::kVideoFrameKey), nullptr);
+  encoder_sink_->OnEncodedImage(
+      CreateEncodedImage(0, VideoFrameType::kVideoFrameDelta), nullptr);
+
+  EXPECT_CALL(*encoder_, Stop).Times(0);
+  send_stream1->Stop();
+  EXPECT_EQ(shared_->NumSendStreams(), 1);
+  EXPECT_CALL(*encoder_, Stop);
+  send_stream2->Stop();
+  EXPECT_EQ(shared_->NumSendStreams(), 0);
+}
+
+TEST_F(SharedVideoStreamEncoderTest, SinksMayCallBackIntoSharedEncoder) {
+  NiceMock<MockEncoderSink> sink1;
+  NiceMock<MockEncoderSink> sink2;
+  NiceMock<MockEncoderSink> other_sink;
+  auto send_stream1 = AddSendStream(sink1);
+  auto send_stream2 = AddSendStream(sink2);
+  send_stream1->OnBitrateUpdated(DataRate::KilobitsPerSec(500),
+                                 DataRate::KilobitsPerSec(500),
+                                 DataRate::KilobitsPerSec(500), 0, 0, 0);
+  send_stream2->OnBitrateUpdated(DataRate::KilobitsPerSec(500),
+                                 DataRate::KilobitsPerSec(500),
+                                 DataRate::KilobitsPerSec(500), 0, 0, 0);
+
+  EXPECT_CALL(sink1, OnBitrateAllocationUpdated).WillOnce([&] {
+    EXPECT_EQ(shared_->NumSendStreams(), 2);
+    static_cast<VideoStreamEncoderObserver&>(*shared_).GetInputFrameRate();
+  });
+  encoder_sink_->OnBitrateAllocationUpdated(VideoBitrateAllocation());
+
+  // The first send stream is delivered to first. It stops the second one and
+  // replaces its own sink, which must not deliver the image to the stopped
+  // send stream.
+  EXPECT_CALL(sink1, OnEncodedImage).WillOnce([&] {
+    send_stream2->Stop();
+    send_stream1->SetSink(&other_sink, /*rotation_applied=*/false);
+    EXPECT_EQ(shared_->NumSendStreams(), 1);
+    return EncodedImageCallback::Result(EncodedImageCallback::Result::OK);
+  });
+  EXPECT_CALL(sink2, OnEncodedImage).Times(0);
+  encoder_sink_->OnEncodedImage(
+      CreateEncodedImage(0, VideoFrameType::kVideoFrameKey), nullptr);
+
+  EXPECT_CALL(other_sink, OnEncodedImage);
+  encoder_sink_->OnEncodedImage(
+      CreateEncodedImage(0, VideoFrameType::kVideoFrameDelta), nullptr);
+}
+
+TEST(SharedVideoEncoderTest, CreatesSharedVideoStreamEncoder) {
+  scoped_refptr<SharedVideoEncoder> shared_encoder =
+      CreateSharedVideoEncoder(CreateEnvironment());
+  EXPECT_EQ(shared_encoder->NumSendStreams(), 0);
+  EXPECT_EQ(
+      &SharedVideoStreamEncoder::FromSharedVideoEncoder(*shared_encoder),
+      shared_encoder.get());
+}
+
+TEST_F(SharedVideoStreamEncoderTest, RunsEncoderAtHighestTargetBitrate) {
+  NiceMock<MockEncoderSink> sink1;
+  NiceMock<MockEncoderSink> sink2;
+  auto send_stream1 = AddSendStream(sink1);
+  auto send_stream2 = AddSendStream(sink2);
+
+  EXPECT_CALL(*encoder_, OnBitrateUpdated(DataRate::KilobitsPerSec(500), _, _,
+                                          _, _, _));
+  send_stream1->OnBitrateUpdated(DataRate::KilobitsPerSec(500),
+                                 DataRate::KilobitsPerSec(500),
+                                 DataRate::KilobitsPerSec(500), 0, 0, 0);
+  EXPECT_CALL(*encoder_, OnBitrateUpdated(DataRate::KilobitsPerSec(500), _, _,
+                                          _, _, _));
+  send_stream2->OnBitrateUpdated(DataRate::KilobitsPerSec(300),
+                                 DataRate::KilobitsPerSec(300),
+                                 DataRate::KilobitsPerSec(300), 0, 0, 0);
+  EXPECT_CALL(*encoder_, OnBitrateUpdated(DataRate::KilobitsPerSec(300), _, _,
+                                          _, _, _));
+  send_stream1->Stop();
+}
+
+TEST_F(SharedVideoStreamEncoderTest, SendsLayersThatFitTargetBitrate) {
+  NiceMock<MockEncoderSink> sink1;
+  NiceMock<MockEncoderSink> sink2;
+  auto send_stream1 = AddSendStream(sink1);
+  auto send_stream2 = AddSendStream(sink2);
+  ConfigureSimulcast(2);
+  send_stream1->OnBitrateUpdated(DataRate::KilobitsPerSec(1000),
+                                 DataRate::KilobitsPerSec(1000),
+                                 DataRate::KilobitsPerSec(1000), 0, 0, 0);
+  send_stream2->OnBitrateUpdated(DataRate::KilobitsPerSec(300),
+                                 DataRate::KilobitsPerSec(300),
+                                 DataRate::KilobitsPerSec(300), 0, 0, 0);
+
+  VideoBitrateAllocation allocation;
+  allocation.SetBitrate(0, 0, 200'000);
+  allocation.SetBitrate(1, 0, 600'000);
+  EXPECT_CALL(sink1, OnBitrateAllocationUpdated(
+                         Property(&VideoBitrateAllocation::get_sum_bps,
+                                  800'000u)));
+  EXPECT_CALL(sink2, OnBitrateAllocationUpdated(
+                         Property(&VideoBitrateAllocation::get_sum_bps,
+                                  200'000u)));
+  encoder_sink_->OnBitrateAllocationUpdated(allocation);
+
+  EXPECT_CALL(sink1, OnEncodedImage(
+                         Property(&EncodedImage::SimulcastIndex, 0), _));
+  EXPECT_CALL(sink1, OnEncodedImage(
+                         Property(&EncodedImage::SimulcastIndex, 1), _));
+  EXPECT_CALL(sink2, OnEncodedImage(
+                         Property(&EncodedImage::SimulcastIndex, 0), _));
+  encoder_sink_->OnEncodedImage(
+      CreateEncodedImage(0, VideoFrameType::kVideoFrameKey), nullptr);
+  encoder_sink_->OnEncodedImage(
+      CreateEncodedImage(1, VideoFrameType::kVideoFrameKey), nullptr);
+}
+
+TEST_F(SharedVideoStreamEncoderTest, StartsNewLayerWithKeyFrame) {
+  NiceMock<MockEncoderSink> sink1;
+  NiceMock<MockEncoderSink> sink2;
+  auto send_stream1 = AddSendStream(sink1);
+  auto send_stream2 = AddSendStream(sink2);
+  ConfigureSimulcast(2);
+  VideoBitrateAllocation allocation;
+  allocation.SetBitrate(0, 0, 200'000);
+  allocation.SetBitrate(1, 0, 600'000);
+  encoder_sink_->OnBitrateAllocationUpdated(allocation);
+  send_stream1->OnBitrateUpdated(DataRate::KilobitsPerSec(1000),
+                                 DataRate::KilobitsPerSec(1000),
+                                 DataRate::KilobitsPerSec(1000), 0, 0, 0);
+  send_stream2->OnBitrateUpdated(DataRate::KilobitsPerSec(300),
+                                 DataRate::KilobitsPerSec(300),
+                                 DataRate::KilobitsPerSec(300), 0, 0, 0);
+  encoder_sink_->OnEncodedImage(
+      CreateEncodedImage(1, VideoFrameType::kVideoFrameKey), nullptr);
+  time_controller_.AdvanceTime(TimeDelta::Seconds(1));
+
+  // The second send stream gets the upper layer, but only from its next key
+  // frame on.
+  EXPECT_CALL(*encoder_, SendKeyFrame(ElementsAre(
+                             VideoFrameType::kVideoFrameDelta,
+                             VideoFrameType::kVideoFrameKey)));
+  send_stream2->OnBitrateUpdated(DataRate::KilobitsPerSec(1000),
+                                 DataRate::KilobitsPerSec(1000),
+                                 DataRate::KilobitsPerSec(1000), 0, 0, 0);
+
+  EXPECT_CALL(sink1, OnEncodedImage).Times(2);
+  EXPECT_CALL(sink2, OnEncodedImage);
+  encoder_sink_->OnEncodedImage(
+      CreateEncodedImage(1, VideoFrameType::kVideoFrameDelta), nullptr);
+  encoder_sink_->OnEncodedImage(
+      CreateEncodedImage(1, VideoFrameType::kVideoFrameKey), nullptr);
+}
+
+TEST_F(SharedVideoStreamEncoderTest, CoalescesKeyFrameRequests) {
+  NiceMock<MockEncoderSink> sink1;
+  NiceMock<MockEncoderSink> sink2;
+  auto send_stream1 = AddSendStream(sink1);
+  auto send_stream2 = AddSendStream(sink2);
+
+  EXPECT_CALL(*encoder_, SendKeyFrame(IsEmpty()));
+  send_stream1->SendKeyFrame({});
+  time_controller_.AdvanceTime(TimeDelta::Millis(100));
+
+  // Requests within the minimum interval are sent once the interval passed.
+  EXPECT_CALL(*encoder_, SendKeyFrame).Times(0);
+  send_stream2->SendKeyFrame({});
+  send_stream1->SendKeyFrame({});
+  time_controller_.AdvanceTime(TimeDelta::Millis(199));
+
+  EXPECT_CALL(*encoder_, SendKeyFrame(IsEmpty()));
+  time_controller_.AdvanceTime(TimeDelta::Millis(1));
+}
+
+}  // namespace
+}  // namespace webrtc
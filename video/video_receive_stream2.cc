@@ -46,6 +46,7 @@
 #include "api/video/color_space.h"
 #include "api/video/encoded_frame.h"
 #include "api/video/encoded_image.h"
+#include "api/video/frame_latency_trace.h"
 #include "api/video/recordable_encoded_frame.h"
 #include "api/video/render_resolution.h"
 #include "api/video/video_codec_type.h"
@@ -267,11 +268,20 @@ VideoReceiveStream2::VideoReceiveStream2(
       max_wait_for_frame_(DetermineMaxWaitForFrame(
           TimeDelta::Millis(config_.rtp.nack.rtp_history_ms),
           false)),
-      decode_queue_(env_.task_queue_factory().CreateTaskQueue(
-          "DecodingQueue",
-          TaskQueueFactory::Priority::HIGH)) {
+      decode_queue_(config_.decode_thread_pool
+                        ? nullptr
+                        : env_.task_queue_factory().CreateTaskQueue(
+                              "DecodingQueue",
+                              TaskQueueFactory::Priority::HIGH)) {
   RTC_LOG(LS_INFO) << "VideoReceiveStream2: " << config_.ToString();
 
+  if (config_.decode_thread_pool) {
+    std::unique_ptr<DecodeThreadPool::DecodeQueue, TaskQueueDeleter> queue =
+        config_.decode_thread_pool->CreateQueue();
+    pooled_decode_queue_ = queue.get();
+    decode_queue_ = std::move(queue);
+  }
+
   RTC_DCHECK(call_->worker_thread());
   RTC_DCHECK(config_.renderer);
   RTC_DCHECK(call_stats_);
@@ -297,6 +307,10 @@ VideoReceiveStream2::VideoReceiveStream2(
       &env_.clock(), call_->worker_thread(), timing_.get(), &stats_proxy_, this,
       max_wait_for_keyframe_, max_wait_for_frame_, std::move(scheduler),
       env_.field_trials());
+  if (config_.low_latency_playout) {
+    timing_->set_low_latency_mode(true);
+    buffer_->SetLowLatencyMode(true);
+  }
 
   if (!config_.rtp.rtx_associated_payload_types.empty()) {
     rtx_receive_stream_ = std::make_unique<RtxReceiveStream>(
@@ -386,7 +400,9 @@ void VideoReceiveStream2::Start() {
 
   transport_adapter_.Enable();
   VideoSinkInterface<VideoFrame>* renderer = nullptr;
-  if (config_.enable_prerenderer_smoothing) {
+  // Smoothing would queue frames for rendering, which low-latency playout
+  // avoids.
+  if (config_.enable_prerenderer_smoothing && !config_.low_latency_playout) {
     incoming_video_stream_.reset(new IncomingVideoStream(
         &env_.task_queue_factory(), config_.render_delay_ms, this));
     renderer = incoming_video_stream_.get();
@@ -400,7 +416,14 @@ void VideoReceiveStream2::Start() {
         PayloadStringToCodecType(decoder.video_format.name));
     settings.set_max_render_resolution(
         InitialDecoderResolution(env_.field_trials()));
-    settings.set_number_of_cores(num_cpu_cores_);
+    // With a shared decode thread pool, the decoders use the fixed number of
+    // threads per stream of the pool, so that the number of threads does not
+    // grow with the number of cores times the number of streams.
+    settings.set_number_of_cores(
+        config_.decode_thread_pool
+            ? std::min(num_cpu_cores_,
+                       config_.decode_thread_pool->DecoderThreadsPerStream())
+            : num_cpu_cores_);
 
     const bool raw_payload =
         config_.rtp.raw_payload_types.count(decoder.payload_type) > 0;
@@ -693,6 +716,9 @@ void VideoReceiveStream2::OnFrame(const VideoFrame& video_frame) {
   // inaccuracy but is still the best we can do in the absence of "frame
   // rendered" callback from the renderer.
   VideoFrameMetaData frame_meta(video_frame, env_.clock().CurrentTime());
+  if (config_.frame_latency_trace) {
+    TraceRenderedFrame(video_frame, frame_meta);
+  }
   call_->worker_thread()->PostTask(
       SafeTask(task_safety_.flag(), [frame_meta, packet_infos, this]() {
         RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
@@ -747,6 +773,42 @@ void VideoReceiveStream2::RequestKeyFrame(Timestamp now) {
   last_keyframe_request_ = now;
 }
 
+void VideoReceiveStream2::TraceRenderedFrame(
+    const VideoFrame& video_frame,
+    const VideoFrameMetaData& frame_meta) {
+  FrameLatencyTrace& trace = *config_.frame_latency_trace;
+  const uint32_t ssrc = remote_ssrc();
+  const uint32_t rtp_timestamp = video_frame.rtp_timestamp();
+  if (video_frame.ntp_time_ms() > 0) {
+    // The estimated capture time is in the local NTP time base.
+    const Timestamp now = frame_meta.decode_timestamp;
+    const int64_t ntp_offset_ms =
+        env_.clock().ConvertTimestampToNtpTime(now).ToMs() - now.ms();
+    trace.OnFrameStage(
+        ssrc, rtp_timestamp, FrameLatencyTrace::Stage::kCapture,
+        Timestamp::Millis(video_frame.ntp_time_ms() - ntp_offset_ms));
+  }
+  if (frame_meta.first_packet_receive_time) {
+    trace.OnFrameStage(ssrc, rtp_timestamp,
+                       FrameLatencyTrace::Stage::kFirstPacketReceived,
+                       *frame_meta.first_packet_receive_time);
+    trace.OnFrameStage(ssrc, rtp_timestamp,
+                       FrameLatencyTrace::Stage::kLastPacketReceived,
+                       *frame_meta.last_packet_receive_time);
+  }
+  if (video_frame.processing_time()) {
+    trace.OnFrameStage(ssrc, rtp_timestamp,
+                       FrameLatencyTrace::Stage::kDecodeStart,
+                       video_frame.processing_time()->start);
+    trace.OnFrameStage(ssrc, rtp_timestamp,
+                       FrameLatencyTrace::Stage::kDecodeFinish,
+                       video_frame.processing_time()->finish);
+  }
+  // `decode_timestamp` is when the frame was passed to the renderer.
+  trace.OnFrameStage(ssrc, rtp_timestamp, FrameLatencyTrace::Stage::kRender,
+                     frame_meta.decode_timestamp);
+}
+
 void VideoReceiveStream2::OnCompleteFrame(std::unique_ptr<EncodedFrame> frame) {
   RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
 
@@ -757,6 +819,12 @@ void VideoReceiveStream2::OnCompleteFrame(std::unique_ptr<EncodedFrame> frame) {
     UpdatePlayoutDelays();
   }
 
+  if (config_.frame_latency_trace) {
+    config_.frame_latency_trace->OnFrameStage(
+        remote_ssrc(), frame->RtpTimestamp(),
+        FrameLatencyTrace::Stage::kFrameComplete, env_.clock().CurrentTime());
+  }
+
   auto last_continuous_pid = buffer_->InsertFrame(std::move(frame));
   if (last_continuous_pid.has_value()) {
     {
@@ -829,9 +897,14 @@ void VideoReceiveStream2::OnEncodedFrame(std::unique_ptr<EncodedFrame> frame) {
   }
   stats_proxy_.OnPreDecode(frame->CodecSpecific()->codecType, qp);
 
-  decode_queue_->PostTask([this, now, keyframe_request_is_due,
-                           received_frame_is_keyframe, frame = std::move(frame),
-                           keyframe_required = keyframe_required_]() mutable {
+  // Frames that are to be rendered first are decoded first when the decode
+  // thread pool is shared with other streams.
+  const Timestamp decode_deadline =
+      frame->RenderTimeMs() > 0 ? Timestamp::Millis(frame->RenderTimeMs())
+                                : now;
+  auto decode_task = [this, now, keyframe_request_is_due,
+                      received_frame_is_keyframe, frame = std::move(frame),
+                      keyframe_required = keyframe_required_]() mutable {
     RTC_DCHECK_RUN_ON(&decode_sequence_checker_);
     if (decoder_stopped_)
       return;
@@ -858,7 +931,13 @@ void VideoReceiveStream2::OnEncodedFrame(std::unique_ptr<EncodedFrame> frame) {
                                             keyframe_request_is_due);
                    buffer_->StartNextDecode(keyframe_required_);
                  }));
-  });
+  };
+  if (pooled_decode_queue_) {
+    pooled_decode_queue_->PostTaskWithDeadline(std::move(decode_task),
+                                               decode_deadline);
+  } else {
+    decode_queue_->PostTask(std::move(decode_task));
+  }
 }
 
 void VideoReceiveStream2::OnDecodableFrameTimeout(TimeDelta wait) {
@@ -1191,6 +1270,28 @@ void VideoReceiveStream2::GenerateKeyFrame() {
   keyframe_generation_requested_ = true;
 }
 
+void VideoReceiveStream2::SetSinkPaused(bool paused) {
+  RTC_DCHECK_RUN_ON(&packet_sequence_checker_);
+  if (sink_paused_ == paused) {
+    return;
+  }
+  sink_paused_ = paused;
+  // Decoding key frames keeps the decoder configured for the stream, and the
+  // last frame available to the sink, at a small fraction of the decoding
+  // cost.
+  buffer_->SetDecodeKeyFramesOnly(paused);
+  if (!paused) {
+    // Resumes with the next key frame, which is requested now rather than
+    // after the key frame wait times out.
+    GenerateKeyFrame();
+  }
+}
+
+void VideoReceiveStream2::SetDecodeTarget(std::optional<int> decode_target) {
+  RTC_DCHECK_RUN_ON(&packet_sequence_checker_);
+  rtp_video_stream_receiver_.SetDecodeTarget(decode_target);
+}
+
 void VideoReceiveStream2::UpdateRtxSsrc(uint32_t ssrc) {
   RTC_DCHECK_RUN_ON(&packet_sequence_checker_);
   RTC_DCHECK(rtx_receive_stream_);
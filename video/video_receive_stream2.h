@@ -24,6 +24,7 @@
 #include "api/environment/environment.h"
 #include "api/frame_transformer_interface.h"
 #include "api/rtp_headers.h"
+#include "api/rtp_packet_info.h"
 #include "api/scoped_refptr.h"
 #include "api/sequence_checker.h"
 #include "api/task_queue/pending_task_safety_flag.h"
@@ -31,6 +32,7 @@
 #include "api/transport/rtp/rtp_source.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
+#include "api/video/decode_thread_pool.h"
 #include "api/video/encoded_frame.h"
 #include "api/video/recordable_encoded_frame.h"
 #include "api/video/video_frame.h"
@@ -83,7 +85,13 @@ struct VideoFrameMetaData {
         ntp_time_ms(frame.ntp_time_ms()),
         width(frame.width()),
         height(frame.height()),
-        decode_timestamp(now) {}
+        decode_timestamp(now),
+        first_packet_receive_time(PacketReceiveTime(frame, /*last=*/false)),
+        last_packet_receive_time(PacketReceiveTime(frame, /*last=*/true)),
+        decode_finish_time(frame.processing_time()
+                               ? std::optional<Timestamp>(
+                                     frame.processing_time()->finish)
+                               : std::nullopt) {}
 
   int64_t render_time_ms() const {
     return timestamp_us / kNumMicrosecsPerMillisec;
@@ -96,6 +104,27 @@ struct VideoFrameMetaData {
   const int height;
 
   const Timestamp decode_timestamp;
+
+  // Receive time of the first and of the last received packet of the frame,
+  // and the time the frame finished decoding, if known.
+  const std::optional<Timestamp> first_packet_receive_time;
+  const std::optional<Timestamp> last_packet_receive_time;
+  const std::optional<Timestamp> decode_finish_time;
+
+ private:
+  static std::optional<Timestamp> PacketReceiveTime(const VideoFrame& frame,
+                                                    bool last) {
+    std::optional<Timestamp> receive_time;
+    for (const RtpPacketInfo& packet_info : frame.packet_infos()) {
+      const Timestamp time = packet_info.receive_time();
+      if (time.IsFinite() &&
+          (!receive_time || (last ? time > *receive_time
+                                  : time < *receive_time))) {
+        receive_time = time;
+      }
+    }
+    return receive_time;
+  }
 };
 
 class VideoReceiveStream2
@@ -210,6 +239,8 @@ class VideoReceiveStream2
   RecordingState SetAndGetRecordingState(RecordingState state,
                                          bool generate_key_frame) override;
   void GenerateKeyFrame() override;
+  void SetSinkPaused(bool paused) override;
+  void SetDecodeTarget(std::optional<int> decode_target) override;
 
   void UpdateRtxSsrc(uint32_t ssrc) override;
 
@@ -221,6 +252,10 @@ class VideoReceiveStream2
   void OnDecodableFrameTimeout(TimeDelta wait) override;
 
   void CreateAndRegisterExternalDecoder(const Decoder& decoder);
+  // Records the stages of a frame passed to the renderer in
+  // `config_.frame_latency_trace`.
+  void TraceRenderedFrame(const VideoFrame& video_frame,
+                          const VideoFrameMetaData& frame_meta);
 
   struct DecodeFrameResult {
     // True if the decoder returned code WEBRTC_VIDEO_CODEC_OK_REQUEST_KEYFRAME,
@@ -317,6 +352,8 @@ class VideoReceiveStream2
   // Whenever we are in an undecodable state (stream has just started or due to
   // a decoding error) we require a keyframe to restart the stream.
   bool keyframe_required_ RTC_GUARDED_BY(packet_sequence_checker_) = true;
+  // Set while the sink does not use the decoded frames, see SetSinkPaused().
+  bool sink_paused_ RTC_GUARDED_BY(packet_sequence_checker_) = false;
 
   // If we have successfully decoded any frame.
   bool frame_decoded_ RTC_GUARDED_BY(decode_sequence_checker_) = false;
@@ -371,6 +408,8 @@ class VideoReceiveStream2
   // destructed to avoid races when running tasks on the `decode_queue_` during
   // VideoReceiveStream2 destruction.
   std::unique_ptr<TaskQueueBase, TaskQueueDeleter> decode_queue_;
+  // Set if `decode_queue_` runs on `config_.decode_thread_pool`.
+  DecodeThreadPool::DecodeQueue* pooled_decode_queue_ = nullptr;
 
   std::optional<uint32_t> last_decoded_rtp_timestamp_;
 };
@@ -37,7 +37,9 @@
 #include "api/task_queue/task_queue_factory.h"
 #include "api/units/data_rate.h"
 #include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
 #include "api/video/encoded_image.h"
+#include "api/video/frame_latency_trace.h"
 #include "api/video/video_bitrate_allocation.h"
 #include "api/video/video_codec_constants.h"
 #include "api/video/video_codec_type.h"
@@ -78,8 +80,10 @@
 #include "video/frame_cadence_adapter.h"
 #include "video/send_delay_stats.h"
 #include "video/send_statistics_proxy.h"
+#include "video/shared_video_stream_encoder.h"
 #include "video/video_stream_encoder.h"
 #include "video/video_stream_encoder_interface.h"
+#include "video/video_stream_encoder_observer.h"
 
 namespace webrtc {
 namespace internal {
@@ -342,7 +346,7 @@ RtpSenderObservers CreateObservers(RtcpRttStats* call_stats,
 std::unique_ptr<VideoStreamEncoderInterface> CreateVideoStreamEncoder(
     const Environment& env,
     int num_cpu_cores,
-    SendStatisticsProxy* stats_proxy,
+    VideoStreamEncoderObserver* stats_proxy,
     const VideoStreamEncoderSettings& encoder_settings,
     VideoStreamEncoder::BitrateAllocationCallbackType
         bitrate_allocation_callback_type,
@@ -362,6 +366,41 @@ std::unique_ptr<VideoStreamEncoderInterface> CreateVideoStreamEncoder(
       encoder_selector);
 }
 
+// Creates the encoder of a send stream, which is shared with other send
+// streams if `encoder_settings.shared_encoder` is set.
+std::unique_ptr<VideoStreamEncoderInterface> CreateSendStreamEncoder(
+    const Environment& env,
+    int num_cpu_cores,
+    SendStatisticsProxy* stats_proxy,
+    const VideoStreamEncoderSettings& encoder_settings,
+    VideoStreamEncoder::BitrateAllocationCallbackType
+        bitrate_allocation_callback_type,
+    Metronome* metronome,
+    webrtc::VideoEncoderFactory::EncoderSelectorInterface* encoder_selector) {
+  if (!encoder_settings.shared_encoder) {
+    return CreateVideoStreamEncoder(env, num_cpu_cores, stats_proxy,
+                                    encoder_settings,
+                                    bitrate_allocation_callback_type,
+                                    metronome, encoder_selector);
+  }
+  return SharedVideoStreamEncoder::FromSharedVideoEncoder(
+             *encoder_settings.shared_encoder)
+      .CreateSendStreamEncoder(
+          stats_proxy, [&](const Environment& shared_env,
+                           VideoStreamEncoderObserver* shared_stats_proxy) {
+            // The shared encoder must not keep itself alive, and must not use
+            // what belongs to this send stream, which may be destroyed before
+            // the other send streams.
+            VideoStreamEncoderSettings settings = encoder_settings;
+            settings.shared_encoder = nullptr;
+            settings.encoder_switch_request_callback = nullptr;
+            return CreateVideoStreamEncoder(
+                shared_env, num_cpu_cores, shared_stats_proxy, settings,
+                bitrate_allocation_callback_type, /*metronome=*/nullptr,
+                /*encoder_selector=*/nullptr);
+          });
+}
+
 bool HasActiveEncodings(const VideoEncoderConfig& config) {
   for (const VideoStream& stream : config.simulcast_layers) {
     if (stream.active) {
@@ -402,13 +441,16 @@ VideoSendStreamImpl::VideoSendStreamImpl(
                    config,
                    encoder_config.content_type,
                    env_.field_trials()),
-      send_packet_observer_(&stats_proxy_, send_delay_stats),
+      send_packet_observer_(&stats_proxy_,
+                            send_delay_stats,
+                            config.frame_latency_trace,
+                            &env_.clock()),
       config_(std::move(config)),
       content_type_(encoder_config.content_type),
       video_stream_encoder_(
           video_stream_encoder_for_test
               ? std::move(video_stream_encoder_for_test)
-              : CreateVideoStreamEncoder(
+              : CreateSendStreamEncoder(
                     env_,
                     num_cpu_cores,
                     &stats_proxy_,
@@ -889,7 +931,59 @@ EncodedImageCallback::Result VideoSendStreamImpl::OnEncodedImage(
   worker_queue_->PostTask(
       SafeTask(worker_queue_safety_.flag(), std::move(task_to_run_on_worker)));
 
-  return rtp_video_sender_->OnEncodedImage(encoded_image, codec_specific_info);
+  // The packets may leave the pacer before OnEncodedImage() returns, and are
+  // matched to the frame by its capture stage, so the frame is recorded
+  // first.
+  if (config_.frame_latency_trace) {
+    TraceEncodedImage(encoded_image);
+  }
+  EncodedImageCallback::Result result =
+      rtp_video_sender_->OnEncodedImage(encoded_image, codec_specific_info);
+  if (config_.frame_latency_trace) {
+    TracePacketizedImage(encoded_image);
+  }
+  return result;
+}
+
+std::optional<uint32_t> VideoSendStreamImpl::TracedSsrc(
+    const EncodedImage& encoded_image) const {
+  const size_t simulcast_index = encoded_image.SimulcastIndex().value_or(0);
+  if (simulcast_index >= config_.rtp.ssrcs.size()) {
+    return std::nullopt;
+  }
+  return config_.rtp.ssrcs[simulcast_index];
+}
+
+void VideoSendStreamImpl::TraceEncodedImage(const EncodedImage& encoded_image) {
+  const std::optional<uint32_t> ssrc = TracedSsrc(encoded_image);
+  if (!ssrc) {
+    return;
+  }
+  const uint32_t rtp_timestamp = encoded_image.RtpTimestamp();
+  FrameLatencyTrace& trace = *config_.frame_latency_trace;
+  trace.OnFrameStage(*ssrc, rtp_timestamp, FrameLatencyTrace::Stage::kCapture,
+                     Timestamp::Millis(encoded_image.capture_time_ms_));
+  if (encoded_image.timing_.encode_finish_ms > 0) {
+    trace.OnFrameStage(
+        *ssrc, rtp_timestamp, FrameLatencyTrace::Stage::kEncodeStart,
+        Timestamp::Millis(encoded_image.timing_.encode_start_ms));
+    trace.OnFrameStage(
+        *ssrc, rtp_timestamp, FrameLatencyTrace::Stage::kEncodeFinish,
+        Timestamp::Millis(encoded_image.timing_.encode_finish_ms));
+  }
+}
+
+void VideoSendStreamImpl::TracePacketizedImage(
+    const EncodedImage& encoded_image) {
+  const std::optional<uint32_t> ssrc = TracedSsrc(encoded_image);
+  if (!ssrc) {
+    return;
+  }
+  // The packets of the image were created by `rtp_video_sender_`, and are
+  // traced as they leave the pacer by `send_packet_observer_`.
+  config_.frame_latency_trace->OnFrameStage(
+      *ssrc, encoded_image.RtpTimestamp(),
+      FrameLatencyTrace::Stage::kPacketized, env_.clock().CurrentTime());
 }
 
 void VideoSendStreamImpl::OnDroppedFrame(
@@ -25,7 +25,9 @@
 #include "api/metronome/metronome.h"
 #include "api/task_queue/pending_task_safety_flag.h"
 #include "api/task_queue/task_queue_base.h"
+#include "api/units/timestamp.h"
 #include "api/video/encoded_image.h"
+#include "api/video/frame_latency_trace.h"
 #include "api/video/video_bitrate_allocation.h"
 #include "api/video_codecs/video_encoder.h"
 #include "call/bitrate_allocator.h"
@@ -39,6 +41,7 @@
 #include "rtc_base/system/no_unique_address.h"
 #include "rtc_base/task_utils/repeating_task.h"
 #include "rtc_base/thread_annotations.h"
+#include "system_wrappers/include/clock.h"
 #include "video/config/video_encoder_config.h"
 #include "video/encoder_rtcp_feedback.h"
 #include "video/send_delay_stats.h"
@@ -127,8 +130,13 @@ class VideoSendStreamImpl : public webrtc::VideoSendStream,
   class OnSendPacketObserver : public SendPacketObserver {
    public:
     OnSendPacketObserver(SendStatisticsProxy* stats_proxy,
-                         SendDelayStats* send_delay_stats)
-        : stats_proxy_(*stats_proxy), send_delay_stats_(*send_delay_stats) {}
+                         SendDelayStats* send_delay_stats,
+                         FrameLatencyTrace* frame_latency_trace,
+                         Clock* clock)
+        : stats_proxy_(*stats_proxy),
+          send_delay_stats_(*send_delay_stats),
+          frame_latency_trace_(frame_latency_trace),
+          clock_(*clock) {}
 
     void OnSendPacket(std::optional<uint16_t> packet_id,
                       Timestamp capture_time,
@@ -137,11 +145,17 @@ class VideoSendStreamImpl : public webrtc::VideoSendStream,
       if (packet_id.has_value()) {
         send_delay_stats_.OnSendPacket(*packet_id, capture_time, ssrc);
       }
+      if (frame_latency_trace_) {
+        frame_latency_trace_->OnPacketSent(ssrc, capture_time,
+                                           clock_.CurrentTime());
+      }
     }
 
    private:
     SendStatisticsProxy& stats_proxy_;
     SendDelayStats& send_delay_stats_;
+    FrameLatencyTrace* const frame_latency_trace_;
+    Clock& clock_;
   };
 
   std::optional<float> GetPacingFactorOverride() const;
@@ -167,6 +181,14 @@ class VideoSendStreamImpl : public webrtc::VideoSendStream,
   EncodedImageCallback::Result OnEncodedImage(
       const EncodedImage& encoded_image,
       const CodecSpecificInfo* codec_specific_info) override;
+  // Returns the SSRC that the stages of `encoded_image` are recorded under in
+  // `config_.frame_latency_trace`, or nullopt if it has none.
+  std::optional<uint32_t> TracedSsrc(const EncodedImage& encoded_image) const;
+  // Records the capture and encode stages of `encoded_image` in
+  // `config_.frame_latency_trace`, before it is packetized.
+  void TraceEncodedImage(const EncodedImage& encoded_image);
+  // Records that `encoded_image` has been packetized.
+  void TracePacketizedImage(const EncodedImage& encoded_image);
 
   // Implements EncodedImageCallback.
   void OnDroppedFrame(EncodedImageCallback::DropReason reason) override;
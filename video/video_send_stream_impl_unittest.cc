@@ -32,6 +32,7 @@
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "api/video/encoded_image.h"
+#include "api/video/frame_latency_trace.h"
 #include "api/video/video_bitrate_allocation.h"
 #include "api/video/video_layers_allocation.h"
 #include "api/video_codecs/video_encoder.h"
@@ -382,6 +383,53 @@ TEST_F(VideoSendStreamImplTest,
   vss_impl->Stop();
 }
 
+TEST_F(VideoSendStreamImplTest, TracesSendStagesAroundPacketization) {
+  using Stage = FrameLatencyTrace::Stage;
+  FrameLatencyTrace trace;
+  config_.frame_latency_trace = &trace;
+  auto vss_impl = CreateVideoSendStreamImpl(TestVideoEncoderConfig());
+
+  const Timestamp now = time_controller_.GetClock()->CurrentTime();
+  EncodedImage encoded_image;
+  encoded_image.SetRtpTimestamp(90000);
+  encoded_image.capture_time_ms_ = now.ms() - 30;
+  encoded_image.timing_.encode_start_ms = now.ms() - 20;
+  encoded_image.timing_.encode_finish_ms = now.ms() - 10;
+  CodecSpecificInfo codec_specific;
+
+  // The capture and encode stages are recorded before the frame is
+  // packetized, so that its packets can be matched to it.
+  std::vector<FrameLatencyTrace::Frame> frames_during_packetization;
+  EXPECT_CALL(rtp_video_sender_, OnEncodedImage)
+      .WillOnce(Invoke([&](const EncodedImage&, const CodecSpecificInfo*) {
+        frames_during_packetization = trace.GetFrames();
+        return EncodedImageCallback::Result(EncodedImageCallback::Result::OK);
+      }));
+  encoder_queue_->PostTask([&] {
+    static_cast<EncodedImageCallback*>(vss_impl.get())
+        ->OnEncodedImage(encoded_image, &codec_specific);
+  });
+  time_controller_.AdvanceTime(TimeDelta::Zero());
+
+  ASSERT_THAT(frames_during_packetization, SizeIs(1));
+  const FrameLatencyTrace::Frame& before = frames_during_packetization[0];
+  EXPECT_EQ(before.ssrc, 8080u);
+  EXPECT_EQ(before.rtp_timestamp, 90000u);
+  EXPECT_EQ(before.stage_times[static_cast<size_t>(Stage::kCapture)],
+            now - TimeDelta::Millis(30));
+  EXPECT_EQ(before.stage_times[static_cast<size_t>(Stage::kEncodeStart)],
+            now - TimeDelta::Millis(20));
+  EXPECT_EQ(before.stage_times[static_cast<size_t>(Stage::kEncodeFinish)],
+            now - TimeDelta::Millis(10));
+  EXPECT_EQ(before.stage_times[static_cast<size_t>(Stage::kPacketized)],
+            std::nullopt);
+
+  std::vector<FrameLatencyTrace::Frame> frames = trace.GetFrames();
+  ASSERT_THAT(frames, SizeIs(1));
+  EXPECT_EQ(frames[0].stage_times[static_cast<size_t>(Stage::kPacketized)],
+            now);
+}
+
 TEST_F(VideoSendStreamImplTest, UpdatesObserverOnConfigurationChange) {
   const bool kSuspend = false;
   config_.suspend_below_min_bitrate = kSuspend;
@@ -185,6 +185,10 @@ void VideoStreamBufferController::SetMaxWaits(TimeDelta max_wait_for_keyframe,
 
 void VideoStreamBufferController::StartNextDecode(bool keyframe_required) {
   RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
+  // Frames that were skipped while decoding only key frames may be referenced
+  // by the following ones.
+  keyframe_required |=
+      skipped_frames_since_keyframe_ && !decode_key_frames_only_;
   if (!timeout_tracker_.Running())
     timeout_tracker_.Start(keyframe_required);
   keyframe_required_ = keyframe_required;
@@ -195,6 +199,28 @@ void VideoStreamBufferController::StartNextDecode(bool keyframe_required) {
   MaybeScheduleFrameForRelease();
 }
 
+void VideoStreamBufferController::SetDecodeKeyFramesOnly(
+    bool key_frames_only) {
+  RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
+  if (decode_key_frames_only_ == key_frames_only) {
+    return;
+  }
+  decode_key_frames_only_ = key_frames_only;
+  if (!decode_key_frames_only_ && skipped_frames_since_keyframe_) {
+    keyframe_required_ = true;
+    if (timeout_tracker_.Running()) {
+      timeout_tracker_.SetWaitingForKeyframe();
+    }
+  }
+  MaybeScheduleFrameForRelease();
+}
+
+void VideoStreamBufferController::SetLowLatencyMode(bool low_latency_mode) {
+  RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
+  low_latency_mode_ = low_latency_mode;
+  MaybeScheduleFrameForRelease();
+}
+
 int VideoStreamBufferController::Size() {
   RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
   return buffer_->CurrentSize();
@@ -216,8 +242,10 @@ void VideoStreamBufferController::OnFrameReady(
   Timestamp min_receive_time = MinReceiveTime(first_frame);
   Timestamp max_receive_time = ReceiveTime(first_frame);
 
-  if (first_frame.is_keyframe())
+  if (first_frame.is_keyframe()) {
     keyframe_required_ = false;
+    skipped_frames_since_keyframe_ = false;
+  }
 
   // Gracefully handle bad RTP timestamps and render time issues.
   if (FrameHasBadRenderTiming(render_time, now) ||
@@ -364,7 +392,7 @@ bool VideoStreamBufferController::IsTooManyFramesQueued() const
 
 void VideoStreamBufferController::ForceKeyFrameReleaseImmediately()
     RTC_RUN_ON(&worker_sequence_checker_) {
-  RTC_DCHECK(keyframe_required_);
+  RTC_DCHECK(keyframe_required_ || decode_key_frames_only_);
   // Iterate through the frame buffer until there is a complete keyframe and
   // release this right away.
   while (buffer_->DecodableTemporalUnitsInfo()) {
@@ -374,6 +402,13 @@ void VideoStreamBufferController::ForceKeyFrameReleaseImmediately()
           << "Frame buffer should always return at least 1 frame.";
       continue;
     }
+    if (decode_key_frames_only_ && !next_frame.front()->is_keyframe()) {
+      // The frame was decodable, so it does not count as a missing frame
+      // that should trigger a key frame request on timeout.
+      skipped_frames_since_keyframe_ = true;
+      timeout_tracker_.OnEncodedFrameReleased();
+      continue;
+    }
     // Found keyframe - decode right away.
     if (next_frame.front()->is_keyframe()) {
       auto render_time = timing_->RenderTime(next_frame.front()->RtpTimestamp(),
@@ -384,6 +419,25 @@ void VideoStreamBufferController::ForceKeyFrameReleaseImmediately()
   }
 }
 
+void VideoStreamBufferController::ReleaseLatestFrameImmediately()
+    RTC_RUN_ON(&worker_sequence_checker_) {
+  auto decodable_tu_info = buffer_->DecodableTemporalUnitsInfo();
+  // Decoding the older temporal units would only delay the latest one, which
+  // does not depend on them since it is decodable already.
+  while (decodable_tu_info && decodable_tu_info->next_rtp_timestamp !=
+                                  decodable_tu_info->last_rtp_timestamp) {
+    buffer_->DropNextDecodableTemporalUnit();
+    decodable_tu_info = buffer_->DecodableTemporalUnitsInfo();
+  }
+  if (!decodable_tu_info) {
+    return;
+  }
+  frame_decode_scheduler_->CancelOutstanding();
+  FrameReadyForDecode(decodable_tu_info->next_rtp_timestamp,
+                      timing_->RenderTime(decodable_tu_info->next_rtp_timestamp,
+                                          clock_->CurrentTime()));
+}
+
 void VideoStreamBufferController::MaybeScheduleFrameForRelease()
     RTC_RUN_ON(&worker_sequence_checker_) {
   auto decodable_tu_info = buffer_->DecodableTemporalUnitsInfo();
@@ -391,10 +445,14 @@ void VideoStreamBufferController::MaybeScheduleFrameForRelease()
     return;
   }
 
-  if (keyframe_required_) {
+  if (keyframe_required_ || decode_key_frames_only_) {
     return ForceKeyFrameReleaseImmediately();
   }
 
+  if (low_latency_mode_) {
+    return ReleaseLatestFrameImmediately();
+  }
+
   // If already scheduled then abort.
   if (frame_decode_scheduler_->ScheduledRtpTimestamp() ==
       decodable_tu_info->next_rtp_timestamp) {
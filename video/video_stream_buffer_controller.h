@@ -85,6 +85,15 @@ class VideoStreamBufferController {
   void SetMaxWaits(TimeDelta max_wait_for_keyframe,
                    TimeDelta max_wait_for_frame);
   void StartNextDecode(bool keyframe_required);
+  // While set, only key frames are released for decoding and other frames are
+  // dropped, e.g. while the decoded frames are not rendered. Once cleared,
+  // decoding resumes with the next key frame if any frame was dropped.
+  void SetDecodeKeyFramesOnly(bool key_frames_only);
+  // In low-latency mode the latest decodable temporal unit is released for
+  // decoding as soon as the decoder is ready, without going through the frame
+  // decode scheduler, and older decodable temporal units are dropped so that
+  // at most one frame waits for the decoder.
+  void SetLowLatencyMode(bool low_latency_mode);
   int Size();
 
  private:
@@ -98,6 +107,7 @@ class VideoStreamBufferController {
   void UpdateTimingFrameInfo();
   bool IsTooManyFramesQueued() const RTC_RUN_ON(&worker_sequence_checker_);
   void ForceKeyFrameReleaseImmediately() RTC_RUN_ON(&worker_sequence_checker_);
+  void ReleaseLatestFrameImmediately() RTC_RUN_ON(&worker_sequence_checker_);
   void MaybeScheduleFrameForRelease() RTC_RUN_ON(&worker_sequence_checker_);
 
   RTC_NO_UNIQUE_ADDRESS SequenceChecker worker_sequence_checker_;
@@ -113,6 +123,14 @@ class VideoStreamBufferController {
   InterFrameDelayVariationCalculator ifdv_calculator_
       RTC_GUARDED_BY(&worker_sequence_checker_);
   bool keyframe_required_ RTC_GUARDED_BY(&worker_sequence_checker_) = false;
+  bool decode_key_frames_only_ RTC_GUARDED_BY(&worker_sequence_checker_) =
+      false;
+  // True if frames were dropped because of `decode_key_frames_only_` since the
+  // last released key frame, so that the next decoded frame must be a key
+  // frame.
+  bool skipped_frames_since_keyframe_
+      RTC_GUARDED_BY(&worker_sequence_checker_) = false;
+  bool low_latency_mode_ RTC_GUARDED_BY(&worker_sequence_checker_) = false;
   std::unique_ptr<FrameBuffer> buffer_
       RTC_GUARDED_BY(&worker_sequence_checker_);
   FrameDecodeTiming decode_timing_ RTC_GUARDED_BY(&worker_sequence_checker_);
@@ -476,6 +476,114 @@ TEST_P(VideoStreamBufferControllerTest, ForceKeyFrame) {
   EXPECT_THAT(WaitForFrameOrTimeout(kFps30Delay * 3), Frame(test::WithId(2)));
 }
 
+TEST_P(VideoStreamBufferControllerTest, DecodesOnlyKeyFramesWhenSet) {
+  StartNextDecodeForceKeyframe();
+  buffer_->InsertFrame(test::FakeFrameBuilder().Id(0).Time(0).AsLast().Build());
+  EXPECT_THAT(WaitForFrameOrTimeout(TimeDelta::Zero()), Frame(test::WithId(0)));
+
+  buffer_->SetDecodeKeyFramesOnly(true);
+  StartNextDecode();
+  buffer_->InsertFrame(test::FakeFrameBuilder()
+                           .Id(1)
+                           .Time(kFps30Rtp)
+                           .AsLast()
+                           .Refs({0})
+                           .Build());
+  buffer_->InsertFrame(
+      test::FakeFrameBuilder().Id(2).Time(kFps30Rtp * 2).AsLast().Build());
+
+  EXPECT_THAT(WaitForFrameOrTimeout(kFps30Delay * 3), Frame(test::WithId(2)));
+}
+
+TEST_P(VideoStreamBufferControllerTest,
+       LowLatencyModeReleasesLatestDecodableFrameImmediately) {
+  timing_.set_min_playout_delay(TimeDelta::Millis(100));
+  buffer_->SetLowLatencyMode(true);
+  StartNextDecodeForceKeyframe();
+  buffer_->InsertFrame(test::FakeFrameBuilder().Id(0).Time(0).AsLast().Build());
+  EXPECT_THAT(WaitForFrameOrTimeout(TimeDelta::Zero()), Frame(test::WithId(0)));
+
+  // Both frames are decodable when the decoder gets ready, only the latest
+  // one is decoded.
+  buffer_->InsertFrame(test::FakeFrameBuilder()
+                           .Id(1)
+                           .Time(kFps30Rtp)
+                           .AsLast()
+                           .Refs({0})
+                           .Build());
+  buffer_->InsertFrame(test::FakeFrameBuilder()
+                           .Id(2)
+                           .Time(kFps30Rtp * 2)
+                           .AsLast()
+                           .Refs({0})
+                           .Build());
+  StartNextDecode();
+  EXPECT_THAT(WaitForFrameOrTimeout(TimeDelta::Zero()), Frame(test::WithId(2)));
+  EXPECT_EQ(dropped_frames(), 1);
+
+  // A frame is decoded without waiting for its render time.
+  StartNextDecode();
+  buffer_->InsertFrame(test::FakeFrameBuilder()
+                           .Id(3)
+                           .Time(kFps30Rtp * 3)
+                           .AsLast()
+                           .Refs({2})
+                           .Build());
+  EXPECT_THAT(WaitForFrameOrTimeout(TimeDelta::Zero()), Frame(test::WithId(3)));
+}
+
+TEST_P(VideoStreamBufferControllerTest,
+       DoesNotTimeOutWhileSkippingDecodableFrames) {
+  StartNextDecodeForceKeyframe();
+  buffer_->InsertFrame(test::FakeFrameBuilder().Id(0).Time(0).AsLast().Build());
+  EXPECT_THAT(WaitForFrameOrTimeout(TimeDelta::Zero()), Frame(test::WithId(0)));
+
+  buffer_->SetDecodeKeyFramesOnly(true);
+  StartNextDecode();
+  // Delta frames for twice the max wait for a frame.
+  for (int id = 1; id < 90; ++id) {
+    time_controller_.AdvanceTime(kFps30Delay);
+    buffer_->InsertFrame(test::FakeFrameBuilder()
+                             .Id(id)
+                             .Time(kFps30Rtp * id)
+                             .AsLast()
+                             .Refs({id - 1})
+                             .Build());
+    EXPECT_THAT(WaitForFrameOrTimeout(TimeDelta::Zero()), Eq(std::nullopt));
+  }
+}
+
+TEST_P(VideoStreamBufferControllerTest,
+       ResumesWithKeyFrameAfterDecodingKeyFramesOnly) {
+  StartNextDecodeForceKeyframe();
+  buffer_->InsertFrame(test::FakeFrameBuilder().Id(0).Time(0).AsLast().Build());
+  EXPECT_THAT(WaitForFrameOrTimeout(TimeDelta::Zero()), Frame(test::WithId(0)));
+
+  buffer_->SetDecodeKeyFramesOnly(true);
+  StartNextDecode();
+  time_controller_.AdvanceTime(kFps30Delay);
+  buffer_->InsertFrame(test::FakeFrameBuilder()
+                           .Id(1)
+                           .Time(kFps30Rtp)
+                           .AsLast()
+                           .Refs({0})
+                           .Build());
+  EXPECT_THAT(WaitForFrameOrTimeout(TimeDelta::Zero()), Eq(std::nullopt));
+
+  // F2 references the skipped F1, so decoding resumes with the key frame F3.
+  buffer_->SetDecodeKeyFramesOnly(false);
+  time_controller_.AdvanceTime(kFps30Delay);
+  buffer_->InsertFrame(test::FakeFrameBuilder()
+                           .Id(2)
+                           .Time(kFps30Rtp * 2)
+                           .AsLast()
+                           .Refs({1})
+                           .Build());
+  buffer_->InsertFrame(
+      test::FakeFrameBuilder().Id(3).Time(kFps30Rtp * 3).AsLast().Build());
+  EXPECT_THAT(WaitForFrameOrTimeout(kFps30Delay * 2), Frame(test::WithId(3)));
+}
+
 TEST_P(VideoStreamBufferControllerTest, SlowDecoderDropsTemporalLayers) {
   StartNextDecodeForceKeyframe();
   // 2 temporal layers, at 15fps per layer to make 30fps total.
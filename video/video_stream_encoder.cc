@@ -66,6 +66,7 @@
 #include "call/adaptation/video_source_restrictions.h"
 #include "call/adaptation/video_stream_adapter.h"
 #include "common_video/frame_instrumentation_data.h"
+#include "common_video/h264/h264_common.h"
 #include "media/base/media_channel.h"
 #include "modules/video_coding/codecs/interface/common_constants.h"
 #include "modules/video_coding/include/video_codec_initializer.h"
@@ -148,6 +149,20 @@ std::optional<EncodedImageCallback::DropReason> MaybeConvertDropReason(
   }
 }
 
+// Returns true if an encoder with `info` has to convert buffers of `type` to
+// another pixel format before it can encode them. Native buffers are not
+// counted since mapping them may not involve a conversion.
+bool EncoderConvertsBuffer(VideoFrameBuffer::Type type,
+                           const VideoEncoder::EncoderInfo& info) {
+  if (type == VideoFrameBuffer::Type::kNative) {
+    return false;
+  }
+  if (info.preferred_pixel_formats.empty()) {
+    return type != VideoFrameBuffer::Type::kI420;
+  }
+  return !absl::c_linear_search(info.preferred_pixel_formats, type);
+}
+
 bool RequiresEncoderReset(const VideoCodec& prev_send_codec,
                           const VideoCodec& new_send_codec,
                           bool was_encode_called_since_last_initialization) {
@@ -767,6 +782,10 @@ VideoStreamEncoder::VideoStreamEncoder(
     video_stream_adapter_->AddRestrictionsListener(&stream_resource_manager_);
     video_stream_adapter_->AddRestrictionsListener(this);
     stream_resource_manager_.MaybeInitializePixelLimitResource();
+    if (settings_.encoder_cpu_share) {
+      stream_resource_manager_.AddEncoderCpuShareResource(
+          settings_.encoder_cpu_share);
+    }
 
     // Add the stream resource manager's resources to the processor.
     adaptation_constraints_ = stream_resource_manager_.AdaptationConstraints();
@@ -1840,6 +1859,7 @@ void VideoStreamEncoder::MaybeEncodeVideoFrame(const VideoFrame& video_frame,
     // Force full frame update, since resolution has changed.
     accumulated_update_rect_ =
         VideoFrame::UpdateRect{0, 0, video_frame.width(), video_frame.height()};
+    accumulated_update_region_ = {accumulated_update_rect_};
   }
 
   // We have to create the encoder before the frame drop logic,
@@ -2015,7 +2035,8 @@ void VideoStreamEncoder::EncodeVideoFrame(const VideoFrame& video_frame,
     scoped_refptr<VideoFrameBuffer> cropped_buffer;
     // TODO(ilnik): Remove scaling if cropping is too big, as it should never
     // happen after SinkWants signaled correctly from ReconfigureEncoder.
-    VideoFrame::UpdateRect update_rect = video_frame.update_rect();
+    std::vector<VideoFrame::UpdateRect> update_region =
+        video_frame.update_region();
     if (crop_width_ < 4 && crop_height_ < 4) {
       // The difference is small, crop without scaling.
       int offset_x = (crop_width_ + 1) / 2;
@@ -2027,20 +2048,22 @@ void VideoStreamEncoder::EncodeVideoFrame(const VideoFrame& video_frame,
       cropped_buffer = video_frame.video_frame_buffer()->CropAndScale(
           offset_x, offset_y, cropped_width, cropped_height, cropped_width,
           cropped_height);
-      update_rect.offset_x -= offset_x;
-      update_rect.offset_y -= offset_y;
-      update_rect.Intersect(
-          VideoFrame::UpdateRect{0, 0, cropped_width, cropped_height});
+      for (VideoFrame::UpdateRect& update_rect : update_region) {
+        update_rect.offset_x -= offset_x;
+        update_rect.offset_y -= offset_y;
+        update_rect.Intersect(
+            VideoFrame::UpdateRect{0, 0, cropped_width, cropped_height});
+      }
 
     } else {
       // The difference is large, scale it.
       cropped_buffer = video_frame.video_frame_buffer()->Scale(cropped_width,
                                                                cropped_height);
-      if (!update_rect.IsEmpty()) {
+      if (!update_region.empty()) {
         // Since we can't reason about pixels after scaling, we invalidate whole
         // picture, if anything changed.
-        update_rect =
-            VideoFrame::UpdateRect{0, 0, cropped_width, cropped_height};
+        update_region = {
+            VideoFrame::UpdateRect{0, 0, cropped_width, cropped_height}};
       }
     }
     if (!cropped_buffer) {
@@ -2049,7 +2072,7 @@ void VideoStreamEncoder::EncodeVideoFrame(const VideoFrame& video_frame,
     }
 
     out_frame.set_video_frame_buffer(cropped_buffer);
-    out_frame.set_update_rect(update_rect);
+    out_frame.set_update_region(std::move(update_region));
     out_frame.set_ntp_time_ms(video_frame.ntp_time_ms());
     out_frame.set_presentation_timestamp(video_frame.presentation_timestamp());
     // Since accumulated_update_rect_ is constructed before cropping,
@@ -2058,6 +2081,7 @@ void VideoStreamEncoder::EncodeVideoFrame(const VideoFrame& video_frame,
     if (!accumulated_update_rect_.IsEmpty()) {
       accumulated_update_rect_ =
           VideoFrame::UpdateRect{0, 0, out_frame.width(), out_frame.height()};
+      accumulated_update_region_.clear();
       accumulated_update_rect_is_valid_ = false;
     }
   }
@@ -2066,12 +2090,22 @@ void VideoStreamEncoder::EncodeVideoFrame(const VideoFrame& video_frame,
     out_frame.clear_update_rect();
   } else if (!accumulated_update_rect_.IsEmpty() &&
              out_frame.has_update_rect()) {
-    accumulated_update_rect_.Union(out_frame.update_rect());
-    accumulated_update_rect_.Intersect(
-        VideoFrame::UpdateRect{0, 0, out_frame.width(), out_frame.height()});
-    out_frame.set_update_rect(accumulated_update_rect_);
+    // Changes in frames dropped since the last encoded frame are part of the
+    // update of this frame.
+    std::vector<VideoFrame::UpdateRect> update_region =
+        std::move(accumulated_update_region_);
+    for (const VideoFrame::UpdateRect& update_rect :
+         out_frame.update_region()) {
+      update_region.push_back(update_rect);
+    }
+    for (VideoFrame::UpdateRect& update_rect : update_region) {
+      update_rect.Intersect(
+          VideoFrame::UpdateRect{0, 0, out_frame.width(), out_frame.height()});
+    }
+    out_frame.set_update_region(std::move(update_region));
     accumulated_update_rect_.MakeEmptyUpdate();
   }
+  accumulated_update_region_.clear();
   accumulated_update_rect_is_valid_ = true;
 
   TRACE_EVENT_ASYNC_STEP_INTO0("webrtc", "Video", video_frame.render_time_ms(),
@@ -2079,6 +2113,10 @@ void VideoStreamEncoder::EncodeVideoFrame(const VideoFrame& video_frame,
 
   stream_resource_manager_.OnEncodeStarted(out_frame, time_when_posted_us);
 
+  if (EncoderConvertsBuffer(out_frame.video_frame_buffer()->type(), info)) {
+    encoder_stats_observer_->OnEncoderInputFrameConverted();
+  }
+
   // The encoder should get the size that it expects.
   RTC_DCHECK(send_codec_.width <= out_frame.width() &&
              send_codec_.height <= out_frame.height())
@@ -2185,12 +2223,17 @@ EncodedImage VideoStreamEncoder::AugmentEncodedImage(
   VideoCodecType codec_type = codec_specific_info
                                   ? codec_specific_info->codecType
                                   : VideoCodecType::kVideoCodecGeneric;
+  if ((codec_type == kVideoCodecH264 || codec_type == kVideoCodecH265) &&
+      image_copy.NaluIndices().empty()) {
+    // Scan the bitstream once for the QP parser and the RTP packetizer.
+    image_copy.SetNaluIndices(H264::FindNaluIndices(image_copy));
+  }
   if (image_copy.qp_ < 0 && qp_parsing_allowed_) {
     // Parse encoded frame QP if that was not provided by encoder.
-    image_copy.qp_ =
-        qp_parser_
-            .Parse(codec_type, stream_idx, image_copy.data(), image_copy.size())
-            .value_or(-1);
+    image_copy.qp_ = qp_parser_
+                         .Parse(codec_type, stream_idx, image_copy.data(),
+                                image_copy.size(), image_copy.NaluIndices())
+                         .value_or(-1);
   }
 
   TRACE_EVENT2("webrtc", "VideoStreamEncoder::AugmentEncodedImage",
@@ -2420,6 +2463,13 @@ void VideoStreamEncoder::OnBitrateUpdated(DataRate target_bitrate,
     RTC_LOG(LS_INFO) << "Video suspend state changed to: "
                      << (video_is_suspended ? "suspended" : "not suspended");
     encoder_stats_observer_->OnSuspendChange(video_is_suspended);
+    // Lets sources skip frames while paused, before converting them. A first
+    // frame is still needed to configure the encoder.
+    const bool source_frames_skipped = source_frames_paused_;
+    source_frames_paused_ = video_is_suspended && last_frame_info_.has_value();
+    if (frame_cadence_adapter_) {
+      frame_cadence_adapter_->SetEncoderPaused(source_frames_paused_);
+    }
 
     if (!video_is_suspended && pending_frame_ &&
         !DropDueToSize(pending_frame_->size())) {
@@ -2430,10 +2480,10 @@ void VideoStreamEncoder::OnBitrateUpdated(DataRate target_bitrate,
         EncodeVideoFrame(*pending_frame_, pending_frame_post_time_us_);
       pending_frame_.reset();
     } else if (!video_is_suspended && !pending_frame_ &&
-               encoder_paused_and_dropped_frame_) {
+               (encoder_paused_and_dropped_frame_ || source_frames_skipped)) {
       // A frame was enqueued during pause-state, but since it was a native
-      // frame we could not store it in `pending_frame_` so request a
-      // refresh-frame instead.
+      // frame we could not store it in `pending_frame_`, or the source
+      // skipped the frames while paused, so request a refresh-frame instead.
       RequestRefreshFrame();
     }
   }
@@ -2625,6 +2675,12 @@ void VideoStreamEncoder::ProcessDroppedFrame(
     VideoStreamEncoderObserver::DropReason reason) {
   accumulated_update_rect_.Union(frame.update_rect());
   accumulated_update_rect_is_valid_ &= frame.has_update_rect();
+  for (const VideoFrame::UpdateRect& update_rect : frame.update_region()) {
+    accumulated_update_region_.push_back(update_rect);
+  }
+  if (accumulated_update_region_.size() > VideoFrame::kMaxUpdateRegionRects) {
+    accumulated_update_region_ = {accumulated_update_rect_};
+  }
   if (auto converted_reason = MaybeConvertDropReason(reason)) {
     OnDroppedFrame(*converted_reason);
   }
@@ -319,6 +319,9 @@ class VideoStreamEncoder : public VideoStreamEncoderInterface,
   std::optional<EncoderRateSettings> last_encoder_rate_settings_
       RTC_GUARDED_BY(encoder_queue_);
   bool encoder_paused_and_dropped_frame_ RTC_GUARDED_BY(encoder_queue_) = false;
+  // Set while the frame cadence adapter tells sources to skip frames because
+  // the encoder is paused.
+  bool source_frames_paused_ RTC_GUARDED_BY(encoder_queue_) = false;
 
   // Set to true if at least one frame was sent to encoder since last encoder
   // initialization.
@@ -339,6 +342,9 @@ class VideoStreamEncoder : public VideoStreamEncoderInterface,
 
   VideoFrame::UpdateRect accumulated_update_rect_
       RTC_GUARDED_BY(encoder_queue_);
+  // The rectangles that make up `accumulated_update_rect_`.
+  std::vector<VideoFrame::UpdateRect> accumulated_update_region_
+      RTC_GUARDED_BY(encoder_queue_);
   bool accumulated_update_rect_is_valid_ RTC_GUARDED_BY(encoder_queue_) = true;
 
   FecControllerOverride* fec_controller_override_
@@ -108,6 +108,10 @@ class VideoStreamEncoderObserver : public CpuOveruseMetricsObserver {
   // down.
   virtual void OnEncoderInternalScalerUpdate(bool is_scaled) {}
 
+  // Called for every frame passed to the encoder in a pixel format that the
+  // encoder has to convert, typically to I420, before encoding it.
+  virtual void OnEncoderInputFrameConverted() {}
+
   // TODO(bugs.webrtc.org/14246): VideoStreamEncoder wants to query the stats,
   // which makes this not a pure observer. GetInputFrameRate is needed for the
   // cpu adaptation, so can be deleted if that responsibility is moved out to a
@@ -125,6 +125,7 @@ namespace webrtc {
 
 using ::testing::_;
 using ::testing::AllOf;
+using ::testing::ElementsAre;
 using ::testing::Eq;
 using ::testing::Field;
 using ::testing::Ge;
@@ -857,6 +858,7 @@ class MockFrameCadenceAdapter : public FrameCadenceAdapterInterface {
               (std::optional<double>),
               (override));
   MOCK_METHOD(void, ProcessKeyFrameRequest, (), (override));
+  MOCK_METHOD(void, SetEncoderPaused, (bool), (override));
 };
 
 class MockEncoderSelector
@@ -1214,6 +1216,11 @@ class VideoStreamEncoderTest : public ::testing::Test {
       return last_update_rect_;
     }
 
+    std::vector<VideoFrame::UpdateRect> GetLastUpdateRegion() const {
+      MutexLock lock(&local_mutex_);
+      return last_update_region_;
+    }
+
     const std::vector<VideoFrameType>& LastFrameTypes() const {
       MutexLock lock(&local_mutex_);
       return last_frame_types_;
@@ -1319,6 +1326,7 @@ class VideoStreamEncoderTest : public ::testing::Test {
         last_input_width_ = input_image.width();
         last_input_height_ = input_image.height();
         last_update_rect_ = input_image.update_rect();
+        last_update_region_ = input_image.update_region();
         last_frame_types_ = *frame_types;
         last_input_pixel_format_ = input_image.video_frame_buffer()->type();
       }
@@ -1425,6 +1433,8 @@ class VideoStreamEncoderTest : public ::testing::Test {
         last_rate_control_settings_;
     VideoFrame::UpdateRect last_update_rect_ RTC_GUARDED_BY(local_mutex_) = {
         0, 0, 0, 0};
+    std::vector<VideoFrame::UpdateRect> last_update_region_
+        RTC_GUARDED_BY(local_mutex_);
     std::vector<VideoFrameType> last_frame_types_;
     bool expect_null_frame_ = false;
     EncodedImageCallback* encoded_image_callback_ RTC_GUARDED_BY(local_mutex_) =
@@ -1967,6 +1977,44 @@ TEST_F(VideoStreamEncoderTest, DropsPendingFramesOnSlowEncode) {
   EXPECT_EQ(1, dropped_count);
 }
 
+TEST_F(VideoStreamEncoderTest, EncodesNewestFrameWhenSourceAsksWantsFrame) {
+  // Forwards a frame only if the sink wants it, like AdaptedVideoTrackSource.
+  class WantsFrameForwarder : public test::FrameForwarder {
+   public:
+    void IncomingCapturedFrameIfWanted(const VideoFrame& frame) {
+      MutexLock lock(&mutex_);
+      if (!sink_)
+        return;
+      if (sink_->WantsFrame()) {
+        sink_->OnFrame(frame);
+      } else {
+        sink_->OnDiscardedFrame();
+      }
+    }
+  };
+  WantsFrameForwarder source;
+  video_stream_encoder_->SetSource(&source,
+                                   DegradationPreference::MAINTAIN_FRAMERATE);
+  video_stream_encoder_->OnBitrateUpdatedAndWaitForManagedResources(
+      kTargetBitrate, kTargetBitrate, kTargetBitrate, 0, 0, 0);
+
+  int dropped_count = 0;
+  stats_proxy_->SetDroppedFrameCallback(
+      [&dropped_count](VideoStreamEncoderObserver::DropReason) {
+        ++dropped_count;
+      });
+
+  // The encoder queue does not run until the last frame has arrived, so the
+  // older frames are still pending when the newer ones are offered. They must
+  // still be wanted, and only the newest one encoded.
+  source.IncomingCapturedFrameIfWanted(CreateFrame(1, nullptr));
+  source.IncomingCapturedFrameIfWanted(CreateFrame(2, nullptr));
+  source.IncomingCapturedFrameIfWanted(CreateFrame(3, nullptr));
+  WaitForEncodedFrame(3);
+  video_stream_encoder_->Stop();
+  EXPECT_EQ(2, dropped_count);
+}
+
 TEST_F(VideoStreamEncoderTest, NativeFrameWithoutI420SupportGetsDelivered) {
   video_stream_encoder_->OnBitrateUpdatedAndWaitForManagedResources(
       kTargetBitrate, kTargetBitrate, kTargetBitrate, 0, 0, 0);
@@ -2026,6 +2074,27 @@ TEST_F(VideoStreamEncoderTest, NonI420FramesShouldNotBeConvertedToI420) {
   video_stream_encoder_->Stop();
 }
 
+TEST_F(VideoStreamEncoderTest, CountsFramesConvertedForEncoder) {
+  video_stream_encoder_->OnBitrateUpdatedAndWaitForManagedResources(
+      kTargetBitrate, kTargetBitrate, kTargetBitrate, 0, 0, 0);
+
+  fake_encoder_.SetPreferredPixelFormats({VideoFrameBuffer::Type::kI420});
+  video_source_.IncomingCapturedFrame(
+      CreateNV12Frame(1, codec_width_, codec_height_));
+  WaitForEncodedFrame(1);
+  EXPECT_EQ(1u, stats_proxy_->GetStats().frames_converted_for_encoder);
+
+  fake_encoder_.SetPreferredPixelFormats(
+      {VideoFrameBuffer::Type::kI420, VideoFrameBuffer::Type::kNV12});
+  video_source_.IncomingCapturedFrame(
+      CreateNV12Frame(2, codec_width_, codec_height_));
+  WaitForEncodedFrame(2);
+  video_source_.IncomingCapturedFrame(CreateFrame(3, nullptr));
+  WaitForEncodedFrame(3);
+  EXPECT_EQ(1u, stats_proxy_->GetStats().frames_converted_for_encoder);
+  video_stream_encoder_->Stop();
+}
+
 TEST_F(VideoStreamEncoderTest, NativeFrameGetsDelivered_NoFrameTypePreference) {
   video_stream_encoder_->OnBitrateUpdatedAndWaitForManagedResources(
       kTargetBitrate, kTargetBitrate, kTargetBitrate, 0, 0, 0);
@@ -7835,6 +7904,10 @@ TEST_F(VideoStreamEncoderTest, AccumulatesUpdateRectOnDroppedFrames) {
   EXPECT_EQ(rect.offset_y, 0);
   EXPECT_EQ(rect.width, 10);
   EXPECT_EQ(rect.height, 1);
+  // The encoder also gets the two updated pixels separately.
+  EXPECT_THAT(fake_encoder_.GetLastUpdateRegion(),
+              ElementsAre(VideoFrame::UpdateRect{1, 0, 1, 1},
+                          VideoFrame::UpdateRect{10, 0, 1, 1}));
 
   source.IncomingCapturedFrame(CreateFrameWithUpdatedPixel(4, nullptr, 0));
   WaitForEncodedFrame(4);
@@ -10137,6 +10210,49 @@ TEST(VideoStreamEncoderFrameCadenceTest,
   factory.DepleteTaskQueues();
 }
 
+TEST(VideoStreamEncoderFrameCadenceTest, LetsSourceSkipFramesWhilePaused) {
+  auto adapter = std::make_unique<NiceMock<MockFrameCadenceAdapter>>();
+  auto* adapter_ptr = adapter.get();
+  MockVideoSourceInterface mock_source;
+  SimpleVideoStreamEncoderFactory factory;
+  FrameCadenceAdapterInterface::Callback* video_stream_encoder_callback =
+      nullptr;
+  EXPECT_CALL(*adapter_ptr, Initialize)
+      .WillOnce(Invoke([&video_stream_encoder_callback](
+                           FrameCadenceAdapterInterface::Callback* callback) {
+        video_stream_encoder_callback = callback;
+      }));
+  TaskQueueBase* encoder_queue = nullptr;
+  auto video_stream_encoder =
+      factory.Create(std::move(adapter), &encoder_queue);
+  video_stream_encoder->SetSource(
+      &mock_source, webrtc::DegradationPreference::MAINTAIN_FRAMERATE);
+  VideoEncoderConfig config;
+  test::FillEncoderConfiguration(kVideoCodecVP8, 1, &config);
+  video_stream_encoder->ConfigureEncoder(std::move(config), 0);
+  PassAFrame(encoder_queue, video_stream_encoder_callback, /*ntp_time_ms=*/2);
+  factory.DepleteTaskQueues();
+
+  EXPECT_CALL(*adapter_ptr, SetEncoderPaused(false));
+  video_stream_encoder->OnBitrateUpdated(kTargetBitrate, kTargetBitrate,
+                                         kTargetBitrate, 0, 0, 0);
+  factory.DepleteTaskQueues();
+  Mock::VerifyAndClearExpectations(adapter_ptr);
+
+  EXPECT_CALL(*adapter_ptr, SetEncoderPaused(true));
+  video_stream_encoder->OnBitrateUpdated(DataRate::Zero(), DataRate::Zero(),
+                                         DataRate::Zero(), 0, 0, 0);
+  factory.DepleteTaskQueues();
+  Mock::VerifyAndClearExpectations(adapter_ptr);
+
+  // The source skipped the frames while paused, so a refresh frame is needed.
+  EXPECT_CALL(*adapter_ptr, SetEncoderPaused(false));
+  EXPECT_CALL(mock_source, RequestRefreshFrame);
+  video_stream_encoder->OnBitrateUpdated(kTargetBitrate, kTargetBitrate,
+                                         kTargetBitrate, 0, 0, 0);
+  factory.DepleteTaskQueues();
+}
+
 TEST(VideoStreamEncoderFrameCadenceTest,
      RequestsRefreshFrameForEarlyZeroHertzKeyFrameRequest) {
   SimpleVideoStreamEncoderFactory factory;